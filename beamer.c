@@ -21,7 +21,7 @@
 void print_beamer_node_tree(GString *out, node *list, scratch_pad *scratch) {
 	while (list != NULL) {
 		print_beamer_node(out, list, scratch);
-		list = list->next;
+		list = abbreviation_end(list, scratch)->next;
 	}
 }
 
@@ -124,27 +124,23 @@ void print_beamer_node(GString *out, node *n, scratch_pad *scratch) {
 
 /* print_beamer_endnotes */
 void print_beamer_endnotes(GString *out, scratch_pad *scratch) {
-	scratch->used_notes = reverse_list(scratch->used_notes);
+	int count = scratch->used_note_count;
+	int i;
+	node *note;
+
 	scratch->printing_notes = 1;
-	
-	node *note = scratch->used_notes;
 #ifdef DEBUG_ON
 	fprintf(stderr, "start endnotes\n");
 #endif
 	
-	if ((note == NULL) || ((note->key == KEY_COUNTER) && (note->next == NULL)))
-		return;
-	while (note != NULL) {
-		if (note->key == CITATIONSOURCE)
+	for (i = 1; i <= count; i++) {
+		if (note_for_number(i, scratch)->key == CITATIONSOURCE)
 			break;
-		note = note->next;
 	}
 
-	if (note == NULL)
+	if (i > count)
 		return;
 	
-	note = scratch->used_notes;
-	
 	/* TODO: need CITATIONSOURCE to print bibliography */
 #ifdef DEBUG_ON
 	fprintf(stderr, "there are endnotes to print\n");
@@ -152,12 +148,8 @@ void print_beamer_endnotes(GString *out, scratch_pad *scratch) {
 
 	pad(out, 2, scratch);
 	g_string_append_printf(out, "\\part{Bibliography}\n\\begin{frame}[allowframebreaks]\n\\frametitle{Bibliography}\n\\def\\newblock{}\n\\begin{thebibliography}{0}\n");
-	while ( note != NULL) {
-		if (note->key == KEY_COUNTER) {
-			note = note->next;
-			continue;
-		}
-		
+	for (i = 1; i <= count; i++) {
+		note = note_for_number(i, scratch);
 		pad(out, 1, scratch);
 		
 		if (note->key == CITATIONSOURCE) {
@@ -170,8 +162,6 @@ void print_beamer_endnotes(GString *out, scratch_pad *scratch) {
 		} else {
 			/* footnotes handled elsewhere */
 		}
-
-		note = note->next;
 	}
 	pad(out,2, scratch);
 	g_string_append_printf(out, "\\end{thebibliography}\n\\end{frame}\n\n");
@@ -0,0 +1,240 @@
+/*
+
+	compact.c -- Pack a parse tree into one array, and back again
+
+	(c) 2013-2015 Fletcher T. Penney (http://fletcherpenney.net/).
+
+	This program is free software; you can redistribute it and/or modify
+	it under the terms of the GNU General Public License or the MIT
+	license.  See LICENSE for details.
+
+	This program is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+*/
+
+#include "compact.h"
+
+
+#pragma mark - Packing
+
+/*
+	A compact_node is 24 bytes against 56 for a node (plus its record
+	header), and a walk reads the array front to back instead of chasing
+	pointers around the heap. Strings go into one block of text, and the
+	few nodes with link_data point into a separate table, so the common
+	node doesn't pay for them.
+
+	Nodes are laid out in document order: a node's children start at the
+	next index, and next skips over them (and over any attribute lists of
+	its links, which are packed after the children).
+*/
+
+/* Count nodes, links and string bytes so we allocate once */
+static void measure_list(node *n, unsigned int *count, unsigned int *links, size_t *text) {
+	while (n != NULL) {
+		(*count)++;
+		if (n->str != NULL)
+			*text += strlen(n->str) + 1;
+		if (n->link_data != NULL) {
+			(*links)++;
+			if (n->link_data->label != NULL)
+				*text += strlen(n->link_data->label) + 1;
+			if (n->link_data->source != NULL)
+				*text += strlen(n->link_data->source) + 1;
+			if (n->link_data->title != NULL)
+				*text += strlen(n->link_data->title) + 1;
+			measure_list(n->link_data->attr, count, links, text);
+		}
+		measure_list(n->children, count, links, text);
+		n = n->next;
+	}
+}
+
+static unsigned int pack_string(compact_tree *tree, const char *str) {
+	size_t offset = tree->text_length;
+	size_t len;
+
+	if (str == NULL)
+		return COMPACT_NONE;
+
+	len = strlen(str) + 1;
+	memcpy(tree->text + offset, str, len);
+	tree->text_length += len;
+	return (unsigned int) offset;
+}
+
+/* Returns the index of the first node of the list */
+static unsigned int pack_list(compact_tree *tree, node *n) {
+	unsigned int first = tree->count;
+	unsigned int i;
+	compact_node *c;
+	compact_link *l;
+
+	while (n != NULL) {
+		i = tree->count++;
+		c = &tree->nodes[i];
+
+		c->key   = n->key;
+		c->flags = (n->children != NULL) ? COMPACT_HAS_CHILDREN : 0;
+		c->start = (unsigned int) n->start;
+		c->stop  = (unsigned int) n->stop;
+		c->str   = pack_string(tree, n->str);
+		c->link  = COMPACT_NONE;
+
+		pack_list(tree, n->children);
+
+		if (n->link_data != NULL) {
+			c->link = tree->link_count++;
+			l = &tree->links[c->link];
+			l->label  = pack_string(tree, n->link_data->label);
+			l->source = pack_string(tree, n->link_data->source);
+			l->title  = pack_string(tree, n->link_data->title);
+			l->attr   = (n->link_data->attr == NULL) ? COMPACT_NONE : pack_list(tree, n->link_data->attr);
+		}
+
+		/* Whatever was packed above sits between us and our sibling */
+		c->next = (n->next == NULL) ? COMPACT_NONE : tree->count;
+		n = n->next;
+	}
+
+	return first;
+}
+
+/* compact_node_tree -- pack the list n (and everything below it) into a
+	compact_tree; n is left as it was */
+compact_tree * compact_node_tree(node *n) {
+	compact_tree *tree = malloc(sizeof(compact_tree));
+	unsigned int count = 0;
+	unsigned int links = 0;
+	size_t text = 0;
+
+	measure_list(n, &count, &links, &text);
+
+	tree->nodes = malloc(count * sizeof(compact_node) + 1);
+	tree->links = malloc(links * sizeof(compact_link) + 1);
+	tree->text = malloc(text + 1);
+	tree->count = 0;
+	tree->link_count = 0;
+	tree->text_length = 0;
+
+	pack_list(tree, n);
+	return tree;
+}
+
+/* markdown_to_compact_tree -- parse source straight into a compact_tree
+	(positions as in markdown_to_node_tree); NULL if the parse fails */
+compact_tree * markdown_to_compact_tree(const char *source, unsigned long extensions) {
+	node_arena *arena = mk_node_arena();
+	node_arena *outer = use_node_arena(arena);
+	compact_tree *result = NULL;
+	node *tree;
+
+	tree = markdown_to_node_tree(source, extensions);
+	if (tree != NULL)
+		result = compact_node_tree(tree);
+
+	free_node_tree(tree);
+	use_node_arena(outer);
+	free_node_arena(arena);
+	return result;
+}
+
+void free_compact_tree(compact_tree *tree) {
+	if (tree == NULL)
+		return;
+
+	free(tree->nodes);
+	free(tree->links);
+	free(tree->text);
+	free(tree);
+}
+
+
+#pragma mark - Unpacking
+
+static char * unpack_string(compact_tree *tree, unsigned int offset) {
+	return (offset == COMPACT_NONE) ? NULL : tree->text + offset;
+}
+
+static node * unpack_list(compact_tree *tree, unsigned int i) {
+	node *first = NULL;
+	node *last = NULL;
+	node *n;
+	compact_node *c;
+	compact_link *l;
+
+	for (; i != COMPACT_NONE; i = compact_next(tree, i)) {
+		c = &tree->nodes[i];
+		n = mk_pos_node(c->key, unpack_string(tree, c->str), c->start, c->stop);
+
+		if (c->flags & COMPACT_HAS_CHILDREN)
+			n->children = unpack_list(tree, i + 1);
+
+		if (c->link != COMPACT_NONE) {
+			l = &tree->links[c->link];
+			n->link_data = mk_link_data(unpack_string(tree, l->label),
+				unpack_string(tree, l->source), unpack_string(tree, l->title),
+				(l->attr == COMPACT_NONE) ? NULL : unpack_list(tree, l->attr));
+		}
+
+		if (last == NULL)
+			first = n;
+		else
+			last->next = n;
+		last = n;
+	}
+
+	return first;
+}
+
+/* node_tree_from_compact -- rebuild an ordinary node tree (for the writers)
+	from tree, in the current node arena if there is one */
+node * node_tree_from_compact(compact_tree *tree) {
+	if ((tree == NULL) || (tree->count == 0))
+		return NULL;
+
+	return unpack_list(tree, 0);
+}
+
+
+#pragma mark - Output
+
+/* print_raw_compact_tree -- the list starting at i as original text, as
+	print_raw_node_tree does for node trees */
+void print_raw_compact_tree(GString *out, compact_tree *tree, unsigned int i) {
+	compact_node *c;
+
+	for (; i != COMPACT_NONE; i = compact_next(tree, i)) {
+		c = &tree->nodes[i];
+
+		if (c->str != COMPACT_NONE) {
+			g_string_append(out, tree->text + c->str);
+		} else {
+			if (c->flags & COMPACT_HAS_CHILDREN)
+				print_raw_compact_tree(out, tree, i + 1);
+
+			/* Links are followed by their label */
+			if ((c->key == LINK) && (c->link != COMPACT_NONE)
+				&& (tree->links[c->link].label != COMPACT_NONE))
+				g_string_append(out, tree->text + tree->links[c->link].label);
+		}
+	}
+}
+
+/* string_from_compact_tree -- Returns a null-terminated string,
+	which must be freed after use. */
+char * string_from_compact_tree(compact_tree *tree) {
+	char *result;
+	GString *raw = g_string_new("");
+
+	if ((tree != NULL) && (tree->count > 0))
+		print_raw_compact_tree(raw, tree, 0);
+
+	result = raw->str;
+	g_string_free(raw, false);
+
+	return result;
+}
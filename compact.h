@@ -0,0 +1,9 @@
+#ifndef COMPACT_PARSER_H
+#define COMPACT_PARSER_H
+
+#include "parser.h"
+
+void   print_raw_compact_tree(GString *out, compact_tree *tree, unsigned int i);
+char * string_from_compact_tree(compact_tree *tree);
+
+#endif
@@ -109,3 +109,108 @@ void print_critic_html_highlight_node(GString *out, node *n, scratch_pad *scratc
 			break;
 	}
 }
+
+/* The next occurrence of a closing marker, remembered so that a document
+	full of openers (closed or not) is still searched only once */
+typedef struct {
+	const char *marker;
+	const char *from;            /* Searched from here... */
+	const char *found;           /* ...and found it here (NULL for nowhere) */
+} critic_closer;
+
+static const char * find_closer(critic_closer *closer, const char *p) {
+	if ((closer->from == NULL) || (p < closer->from) ||
+		((closer->found != NULL) && (p > closer->found))) {
+		closer->from = p;
+		closer->found = strstr(p, closer->marker);
+	}
+	return closer->found;
+}
+
+static void append_critic(preformat_buffer *buf, const char *tag, const char *start, const char *stop, bool show, int format) {
+	if (format == CRITIC_HTML_HIGHLIGHT_FORMAT) {
+		if (tag == NULL)
+			return;
+		preformat_append(buf, "<", 1);
+		preformat_append(buf, tag, strlen(tag));
+		preformat_append(buf, ">", 1);
+		preformat_append(buf, start, stop - start);
+		preformat_append(buf, "</", 2);
+		preformat_append(buf, tag, strlen(tag));
+		preformat_append(buf, ">", 1);
+	} else if (show) {
+		preformat_append(buf, start, stop - start);
+	}
+}
+
+/* preformat_critic -- resolve the CriticMarkup in source (format is one of
+	the CRITIC_*_FORMATs) straight into preformatted text, in one scan. Gives
+	the same text as exporting a DocForCritic parse and preformatting that:
+	markup runs to the first closing marker, and an opener without one is
+	left as written */
+char * preformat_critic(const char *source, int format) {
+	bool accept = (format == CRITIC_ACCEPT_FORMAT);
+	bool reject = (format == CRITIC_REJECT_FORMAT);
+	critic_closer addition = { "++}" }, deletion = { "--}" }, arrow = { "~>" },
+		substitution = { "~~}" }, highlight = { "==}" }, comment = { "<<}" };
+	preformat_buffer buf;
+	const char *raw;             /* Start of text not yet appended */
+	const char *open;
+	const char *middle;
+	const char *close;
+
+	preformat_start(&buf, strlen(source));
+
+	if (strncmp(source, "\357\273\277", 3) == 0)
+		source += 3;
+	raw = source;
+
+	for (open = strchr(source, '{'); open != NULL; open = strchr(open + 1, '{')) {
+		middle = NULL;
+		close = NULL;
+
+		if ((open[1] == '+') && (open[2] == '+'))
+			close = find_closer(&addition, open + 3);
+		else if ((open[1] == '-') && (open[2] == '-'))
+			close = find_closer(&deletion, open + 3);
+		else if ((open[1] == '~') && (open[2] == '~')) {
+			middle = find_closer(&arrow, open + 3);
+			if (middle != NULL)
+				close = find_closer(&substitution, middle + 2);
+		} else if ((open[1] == '=') && (open[2] == '='))
+			close = find_closer(&highlight, open + 3);
+		else if ((open[1] == '>') && (open[2] == '>'))
+			close = find_closer(&comment, open + 3);
+
+		if (close == NULL)
+			continue;
+
+		preformat_append(&buf, raw, open - raw);
+
+		switch (open[1]) {
+			case '+':
+				append_critic(&buf, "ins", open + 3, close, accept, format);
+				break;
+			case '-':
+				append_critic(&buf, "del", open + 3, close, reject, format);
+				break;
+			case '~':
+				append_critic(&buf, "del", open + 3, middle, reject, format);
+				append_critic(&buf, "ins", middle + 2, close, accept, format);
+				break;
+			case '=':
+				append_critic(&buf, "mark", open + 3, close, true, format);
+				break;
+			default:
+				/* Comments are hidden */
+				break;
+		}
+
+		raw = close + 3;                      /* Every closing marker is 3 bytes */
+		open = raw - 1;
+	}
+
+	preformat_append(&buf, raw, strlen(raw));
+
+	return preformat_finish(&buf);
+}
@@ -0,0 +1,1002 @@
+/*
+
+	document.c -- Split documents into blocks that parse on their own, so
+		that we can re-parse only what an edit touches, and parse large
+		documents on several threads
+
+	(c) 2013-2015 Fletcher T. Penney (http://fletcherpenney.net/).
+
+	This program is free software; you can redistribute it and/or modify
+	it under the terms of the GNU General Public License or the MIT
+	license.  See LICENSE for details.
+
+	This program is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+*/
+
+#include "document.h"
+
+#ifndef MMD_NO_THREADS
+#include <pthread.h>
+#include <unistd.h>
+#endif
+
+/* Documents smaller than this aren't worth starting threads for */
+#define PARALLEL_MINIMUM   (256 * 1024)
+
+/* Ranges per worker thread -- more than one evens out the load */
+#define RANGES_PER_WORKER  4
+
+/* Workers run the same deep recursion as the main thread */
+#define WORKER_STACK_SIZE  (8 * 1024 * 1024)
+
+/* Formats mmd_export() keeps the output of (see whole_document_format) */
+#define DOC_FORMATS        (TOC_FORMAT + 1)
+
+
+#pragma mark - Block Boundaries
+
+/*
+	A document is split into segments that the grammar would parse the same
+	way on their own as it does in place.  We only split at the start of a
+	line that follows a blank line, begins in column 0, and can't continue
+	the block above it (lists, block quotes, tables, definition lists).  We
+	never split inside fenced code, HTML blocks, HTML comments, Critic
+	Markup, or \\[ \\] math, all of which can span blank lines.
+
+	When in doubt we don't split -- that costs a larger re-parse, never a
+	different result.
+*/
+
+/* HTML elements that never take a closing tag */
+static const char * void_tags[] = {
+	"area", "base", "br", "col", "embed", "hr", "img", "input", "link",
+	"meta", "param", "source", "track", "wbr", NULL
+};
+
+typedef struct {
+	int    fence;            /* number of backticks in an open fence, or 0 */
+	bool   fence_certain;    /* fence opened at the start of a block */
+	char   tag[16];          /* HTML element that opened an HTML block */
+	int    tag_depth;        /* how deeply nested we are in that element */
+	bool   comment;          /* inside <!-- ... --> */
+	int    critic;           /* open Critic Markup spans */
+	int    math;             /* open \\[ or \\( spans */
+	bool   pipe;             /* the current block contains a '|' */
+} boundary_state;
+
+static size_t line_end(const char *source, size_t pos, size_t length) {
+	const char *newline = memchr(source + pos, '\n', length - pos);
+
+	return (newline == NULL) ? length : (size_t)(newline - source) + 1;
+}
+
+static bool blank_range(const char *source, size_t start, size_t stop) {
+	while (start < stop) {
+		switch (source[start++]) {
+			case ' ': case '\t': case '\r': case '\n':
+				break;
+			default:
+				return false;
+		}
+	}
+	return true;
+}
+
+/* Up to three spaces */
+static size_t skip_nonindent(const char *source, size_t pos, size_t stop) {
+	size_t limit = pos + 3;
+
+	while ((pos < stop) && (pos < limit) && (source[pos] == ' '))
+		pos++;
+	return pos;
+}
+
+/* Length of a fence marker (3 to 5 backticks) at the start of a line */
+static int fence_ticks(const char *source, size_t pos, size_t stop, size_t *after) {
+	size_t ticks;
+
+	pos = skip_nonindent(source, pos, stop);
+	ticks = pos;
+	while ((ticks < stop) && (source[ticks] == '`'))
+		ticks++;
+
+	*after = ticks;
+	ticks -= pos;
+
+	return ((ticks >= 3) && (ticks <= 5)) ? (int) ticks : 0;
+}
+
+/* Does this line start an ATX heading? */
+static bool atx_heading(const char *source, size_t pos, size_t stop) {
+	if (source[pos] != '#')
+		return false;
+
+	/* "#" or "# ##" on its own is just text */
+	for (; pos < stop; pos++) {
+		switch (source[pos]) {
+			case '#': case ' ': case '\t': case '\r': case '\n':
+				break;
+			default:
+				return true;
+		}
+	}
+	return false;
+}
+
+/* Lines followed (after at most one blank line) by ':' are terms of a
+	definition list, which continues the one above it */
+static bool starts_definition(const char *source, size_t pos, size_t length) {
+	size_t stop;
+	size_t marker;
+	bool seen_blank = false;
+
+	while (pos < length) {
+		stop = line_end(source, pos, length);
+
+		if (blank_range(source, pos, stop)) {
+			if (seen_blank)
+				return false;
+			seen_blank = true;
+		} else {
+			marker = skip_nonindent(source, pos, stop);
+			if ((marker < stop) && (source[marker] == ':'))
+				return true;
+			if (seen_blank)
+				return false;
+		}
+		pos = stop;
+	}
+
+	return false;
+}
+
+static bool can_split(const char *source, size_t pos, size_t stop, size_t length,
+	boundary_state *state, unsigned long extensions) {
+	char c = source[pos];
+
+	if ((state->fence) || (state->tag_depth > 0) || (state->comment) ||
+		(state->critic > 0) || (state->math > 0))
+		return false;
+
+	/* Indented lines, list items, block quotes, definitions, table rows */
+	if ((c == ' ') || (c == '\t') || (c == '>') || (c == '-') || (c == '*') ||
+		(c == '+') || (c == ':') || ((c >= '0') && (c <= '9')))
+		return false;
+
+	/* Table rows and captions */
+	if (memchr(source + pos, '|', stop - pos) != NULL)
+		return false;
+	if ((c == '[') && (state->pipe))
+		return false;
+
+	/* Headings own everything up to the next heading */
+	if ((extensions & EXT_HEADINGSECTION) && !atx_heading(source, pos, stop))
+		return false;
+
+	return !starts_definition(source, pos, length);
+}
+
+/* Open an HTML block on a line that starts with a tag */
+static void open_html_block(const char *source, size_t pos, size_t stop, boundary_state *state) {
+	size_t len = 0;
+	int i;
+
+	if ((pos + 1 >= stop) || (source[pos] != '<') || !isalpha((unsigned char) source[pos + 1]))
+		return;
+
+	pos++;
+	while ((pos + len < stop) && (len < sizeof(state->tag) - 1) && isalnum((unsigned char) source[pos + len])) {
+		state->tag[len] = tolower((unsigned char) source[pos + len]);
+		len++;
+	}
+	state->tag[len] = '\0';
+
+	for (i = 0; void_tags[i] != NULL; i++) {
+		if (strcmp(state->tag, void_tags[i]) == 0) {
+			state->tag[0] = '\0';
+			return;
+		}
+	}
+}
+
+static bool matches_tag(const char *source, size_t pos, size_t stop, const char *tag) {
+	size_t len = strlen(tag);
+
+	if ((pos + len > stop) || (strncasecmp(source + pos, tag, len) != 0))
+		return false;
+
+	return (pos + len == stop) || !isalnum((unsigned char) source[pos + len]);
+}
+
+/* Track anything in this line that can carry a block across a blank line */
+static void scan_spans(const char *source, size_t pos, size_t stop, boundary_state *state) {
+	const char *gt;
+	char c;
+
+	for (; pos < stop; pos++) {
+		c = source[pos];
+		switch (c) {
+			case '|':
+				state->pipe = true;
+				break;
+			case '<':
+				if ((pos + 3 < stop) && (strncmp(source + pos, "<!--", 4) == 0)) {
+					state->comment = true;
+				} else if ((pos + 2 < stop) && (strncmp(source + pos, "<<}", 3) == 0)) {
+					if (state->critic > 0)
+						state->critic--;
+				} else if (state->tag[0] != '\0') {
+					if ((pos + 1 < stop) && (source[pos + 1] == '/')) {
+						if (matches_tag(source, pos + 2, stop, state->tag))
+							state->tag_depth--;
+					} else if (matches_tag(source, pos + 1, stop, state->tag)) {
+						state->tag_depth++;
+						gt = memchr(source + pos, '>', stop - pos);
+						if ((gt != NULL) && (gt[-1] == '/'))
+							state->tag_depth--;
+					}
+				}
+				break;
+			case '-':
+				if ((pos + 2 < stop) && (strncmp(source + pos, "-->", 3) == 0))
+					state->comment = false;
+				/* fall through */
+			case '+': case '~': case '=':
+				if ((pos + 2 < stop) && (source[pos + 1] == c) && (source[pos + 2] == '}') &&
+					(state->critic > 0))
+					state->critic--;
+				break;
+			case '{':
+				if ((pos + 2 < stop) && (source[pos + 1] == source[pos + 2]) &&
+					(strchr("+-~=>", source[pos + 1]) != NULL))
+					state->critic++;
+				break;
+			case '\\':
+				if ((pos + 2 < stop) && (source[pos + 1] == '\\')) {
+					if ((source[pos + 2] == '[') || (source[pos + 2] == '('))
+						state->math++;
+					else if (((source[pos + 2] == ']') || (source[pos + 2] == ')')) && (state->math > 0))
+						state->math--;
+				}
+				pos++;
+				break;
+			default:
+				break;
+		}
+	}
+}
+
+/* Returns false if the line leaves us unable to tell what the grammar will do */
+static bool scan_line(const char *source, size_t pos, size_t stop, boundary_state *state,
+	bool block_start, unsigned long extensions) {
+	size_t after;
+	int ticks = fence_ticks(source, pos, stop, &after);
+
+	if (state->fence) {
+		if (ticks == state->fence) {
+			/* A fence marker followed by text ends the fence's content, but
+				doesn't close it -- the grammar then backtracks */
+			if (!blank_range(source, after, stop))
+				return false;
+			state->fence = 0;
+			return true;
+		}
+		/* A ``` inside a paragraph is inline code, which can't span a blank line */
+		if ((!state->fence_certain) && blank_range(source, pos, stop))
+			return false;
+	} else if ((ticks) && (memchr(source + after, '`', stop - after) == NULL)) {
+		state->fence = ticks;
+		state->fence_certain = block_start && !(extensions & EXT_COMPATIBILITY);
+		if (state->fence_certain)
+			return true;
+	}
+
+	/* Contents of a real fence are opaque */
+	if ((state->fence) && (state->fence_certain))
+		return true;
+
+	if ((state->tag_depth <= 0) && (!state->comment))
+		open_html_block(source, pos, stop, state);
+
+	scan_spans(source, pos, stop, state);
+
+	if (state->tag_depth <= 0) {
+		state->tag[0] = '\0';
+		state->tag_depth = 0;
+	}
+
+	return true;
+}
+
+/* next_block_boundary -- given a position where the grammar starts a new
+	top-level block, return the next one after it that is safe to parse on
+	its own (or length if there is none) */
+size_t next_block_boundary(const char *source, size_t start, size_t length, unsigned long extensions) {
+	boundary_state state;
+	size_t pos = start;
+	size_t stop;
+	bool blank;
+	bool prev_blank = false;
+
+	memset(&state, 0, sizeof(boundary_state));
+
+	while (pos < length) {
+		stop = line_end(source, pos, length);
+		blank = blank_range(source, pos, stop);
+
+		if (!blank && prev_blank) {
+			if (can_split(source, pos, stop, length, &state, extensions))
+				return pos;
+
+			/* A new block, but one we have to keep with the last */
+			state.pipe = false;
+		}
+
+		if (!scan_line(source, pos, stop, &state, prev_blank || (pos == start), extensions))
+			return length;
+
+		prev_blank = blank;
+		pos = stop;
+	}
+
+	return length;
+}
+
+
+#pragma mark - Parallel Parsing
+
+#ifndef MMD_NO_THREADS
+
+typedef struct {
+	const char      *document;
+	unsigned long    extensions;
+	block_range     *ranges;
+	size_t           count;
+	size_t           next;
+	pthread_mutex_t  lock;
+} parse_queue;
+
+static void * parse_worker(void *arg) {
+	parse_queue *queue = (parse_queue *)arg;
+	size_t i;
+
+	while (1) {
+		pthread_mutex_lock(&queue->lock);
+		i = queue->next++;
+		pthread_mutex_unlock(&queue->lock);
+
+		if (i >= queue->count)
+			break;
+
+		/* Only the first range can start with metadata */
+		parse_range(queue->document, (i == 0) ? queue->extensions :
+			(queue->extensions | EXT_NO_METADATA), &queue->ranges[i]);
+	}
+
+	return NULL;
+}
+
+/* Worker threads hand back their parser contexts before they exit */
+static void * parse_thread(void *arg) {
+	parse_worker(arg);
+	release_parser_contexts();
+
+	return NULL;
+}
+
+static long worker_count(void) {
+	long count = sysconf(_SC_NPROCESSORS_ONLN);
+
+	return (count < 1) ? 1 : count;
+}
+
+#endif
+
+/* parse_in_parallel -- split a preformatted document at safe block
+	boundaries and parse the ranges on several threads, leaving the same
+	result, autolabels and budget in data as a serial parse (including RAW
+	blocks). Returns false, having done nothing, if it isn't worth it */
+bool parse_in_parallel(parser_data *data) {
+#ifdef MMD_NO_THREADS
+	(void) data;
+	return false;
+#else
+	const char *document = data->document;
+	size_t length = data->charbuf_end - document;
+	long workers = worker_count();
+	size_t target;
+	size_t size = 0;
+	size_t pos = 0;
+	size_t stop;
+	size_t i;
+	pthread_t *threads;
+	pthread_attr_t attr;
+	long started = 0;
+	parse_queue queue;
+	node *head = NULL;
+	node *last = NULL;
+	node *footer = NULL;
+	node *n;
+
+	if ((workers < 2) || (length < PARALLEL_MINIMUM))
+		return false;
+
+	queue.document = document;
+	queue.extensions = data->extensions;
+	queue.ranges = NULL;
+	queue.count = 0;
+	queue.next = 0;
+
+	/* Group the segments into ranges of about the target size */
+	target = length / (workers * RANGES_PER_WORKER);
+	while (pos < length) {
+		stop = pos;
+		do {
+			stop = next_block_boundary(document, stop, length, data->extensions);
+		} while ((stop < length) && (stop - pos < target));
+
+		if (queue.count == size) {
+			size = (size == 0) ? 16 : size * 2;
+			queue.ranges = realloc(queue.ranges, size * sizeof(block_range));
+		}
+		memset(&queue.ranges[queue.count], 0, sizeof(block_range));
+		queue.ranges[queue.count].start = pos;
+		queue.ranges[queue.count].stop = stop;
+		queue.count++;
+
+		pos = stop;
+	}
+
+	if (queue.count < 2) {
+		free(queue.ranges);
+		return false;
+	}
+
+	if (workers > (long) queue.count)
+		workers = (long) queue.count;
+
+	/* Split the budget up front so the ranges together can't overspend it */
+	for (i = 0; i < queue.count; i++)
+		queue.ranges[i].fuel = data->fuel / (long) queue.count;
+	data->fuel = 0;
+
+	/* This thread works too */
+	pthread_mutex_init(&queue.lock, NULL);
+	pthread_attr_init(&attr);
+	pthread_attr_setstacksize(&attr, WORKER_STACK_SIZE);
+
+	threads = malloc((workers - 1) * sizeof(pthread_t));
+	while ((started < workers - 1) &&
+		(pthread_create(&threads[started], &attr, parse_thread, &queue) == 0))
+		started++;
+
+	parse_worker(&queue);
+
+	for (i = 0; i < (size_t) started; i++)
+		pthread_join(threads[i], NULL);
+
+	pthread_attr_destroy(&attr);
+	pthread_mutex_destroy(&queue.lock);
+	free(threads);
+
+	/* Splice the ranges back together in order */
+	for (i = 0; i < queue.count; i++) {
+		data->parse_aborted |= queue.ranges[i].aborted;
+		data->fuel += queue.ranges[i].fuel;
+
+		for (n = queue.ranges[i].result; n != NULL; n = queue.ranges[i].result) {
+			queue.ranges[i].result = n->next;
+			n->next = NULL;
+
+			/* Metadata's FOOTER belongs after the last block */
+			if ((i == 0) && (n->key == FOOTER) && (queue.ranges[i].result == NULL)) {
+				footer = n;
+				continue;
+			}
+
+			if (last == NULL)
+				head = n;
+			else
+				last->next = n;
+			last = n;
+		}
+	}
+
+	if (footer != NULL) {
+		if (last == NULL)
+			head = footer;
+		else
+			last->next = footer;
+	}
+
+	/* The serial parse collects autolabels newest first */
+	last = NULL;
+	for (i = queue.count; i-- > 0;) {
+		if ((n = queue.ranges[i].autolabels) == NULL)
+			continue;
+
+		if (last == NULL)
+			data->autolabels = n;
+		else
+			last->next = n;
+
+		while (n->next != NULL)
+			n = n->next;
+		last = n;
+	}
+
+	data->result = head;
+
+	free(queue.ranges);
+	return true;
+#endif
+}
+
+
+#pragma mark - Segments
+
+typedef struct {
+	size_t start;            /* offset of this range in the source */
+	size_t length;
+	bool   last;             /* parsed with the end-of-document padding */
+	bool   failed;           /* the parse was aborted */
+	bool   defines;          /* holds something for the reference tables */
+	node  *tree;
+	node  *autolabels;
+} doc_segment;
+
+struct mmd_doc {
+	char          *source;
+	size_t         length;
+	size_t         capacity;
+	unsigned long  extensions;   /* as requested */
+	unsigned long  effective;    /* adjusted by metadata (latexmode) */
+	doc_segment   *segments;
+	size_t         count;
+	node          *links;        /* reference tables from the last export */
+	node          *notes;
+	bool           stale;        /* ... which an edit has since changed */
+	char          *whole[DOC_FORMATS];   /* output of whole document parses */
+};
+
+/* Segments without definitions can come and go without touching the
+	reference tables */
+static void free_segment(mmd_doc *doc, doc_segment *segment) {
+	if (segment->defines)
+		doc->stale = true;
+
+	free_node_tree(segment->tree);
+	free_node_tree(segment->autolabels);
+	segment->tree = NULL;
+	segment->autolabels = NULL;
+	segment->defines = false;
+}
+
+/* Move the positions in a segment's tree from one start to another */
+static void move_positions(node *n, size_t from, size_t to) {
+	while (n != NULL) {
+		if (has_position(n)) {
+			n->start = n->start - from + to;
+			n->stop = n->stop - from + to;
+		}
+		move_positions(n->children, from, to);
+		n = n->next;
+	}
+}
+
+/* Parse a segment as the grammar would see it in place -- only the first
+	may hold metadata, and only the last gets preformat_text()'s padding.
+	Positions in the tree are offsets into the document */
+static void parse_doc_segment(mmd_doc *doc, doc_segment *segment, bool first, bool last) {
+	unsigned long extensions = doc->effective;
+	char *slice = malloc(segment->length + 1);
+	char *formatted;
+	block_range range;
+
+	memcpy(slice, doc->source + segment->start, segment->length);
+	slice[segment->length] = '\0';
+
+	formatted = preformat_text(slice);
+
+	if (!last)
+		formatted[strlen(formatted) - 2] = '\0';
+
+	if (!first)
+		extensions |= EXT_NO_METADATA;
+
+	range.start = 0;
+	range.stop = strlen(formatted);
+	range.fuel = default_fuel(range.stop);
+	parse_range(formatted, extensions, &range);
+
+	fill_node_positions(range.result);
+	map_preformatted_positions(range.result, slice);
+	move_positions(range.result, 0, segment->start);
+	map_preformatted_positions(range.autolabels, slice);
+	move_positions(range.autolabels, 0, segment->start);
+
+	segment->tree = range.result;
+	segment->autolabels = range.autolabels;
+	segment->failed = range.aborted;
+	segment->last = last;
+	segment->defines = defines_references(range.result);
+	if (segment->defines)
+		doc->stale = true;
+
+	free(formatted);
+	free(slice);
+}
+
+/* Metadata can ask for heading sections (latexmode: beamer) -- only the top
+	of the document is read to find out (see read_metadata) */
+static unsigned long effective_extensions(mmd_doc *doc) {
+	unsigned long extensions = doc->extensions;
+	char *value;
+	char *temp;
+
+	value = extract_metadata_value(doc->source, extensions, "latexmode");
+	if (value != NULL) {
+		temp = label_from_string(value);
+		if (strcmp(temp, "beamer") == 0)
+			extensions = extensions | EXT_HEADINGSECTION;
+		free(temp);
+	}
+	free(value);
+
+	return extensions;
+}
+
+/* Index of the segment containing offset */
+static size_t segment_at(mmd_doc *doc, size_t offset) {
+	size_t low = 0;
+	size_t high = doc->count;
+	size_t mid;
+
+	while (low + 1 < high) {
+		mid = (low + high) / 2;
+		if (doc->segments[mid].start <= offset)
+			low = mid;
+		else
+			high = mid;
+	}
+	return low;
+}
+
+static void append_segment(doc_segment **list, size_t *count, size_t *size, size_t start, size_t length) {
+	if (*count == *size) {
+		*size = (*size == 0) ? 16 : *size * 2;
+		*list = realloc(*list, *size * sizeof(doc_segment));
+	}
+	memset(&(*list)[*count], 0, sizeof(doc_segment));
+	(*list)[*count].start = start;
+	(*list)[*count].length = length;
+	(*count)++;
+}
+
+/* Re-split and re-parse everything from segment `from` on */
+static void rebuild_segments(mmd_doc *doc, size_t from) {
+	size_t pos = (from < doc->count) ? doc->segments[from].start : 0;
+	size_t next;
+	size_t size = doc->count;
+	size_t i;
+
+	for (i = from; i < doc->count; i++)
+		free_segment(doc, &doc->segments[i]);
+	doc->count = from;
+
+	while ((pos < doc->length) || (doc->count == 0)) {
+		next = next_block_boundary(doc->source, pos, doc->length, doc->effective);
+		append_segment(&doc->segments, &doc->count, &size, pos, next - pos);
+		pos = next;
+	}
+
+	for (i = from; i < doc->count; i++)
+		parse_doc_segment(doc, &doc->segments[i], i == 0, i + 1 == doc->count);
+}
+
+static void splice_source(mmd_doc *doc, size_t offset, size_t deleted, const char *inserted, size_t added) {
+	size_t length = doc->length - deleted + added;
+
+	if (length + 1 > doc->capacity) {
+		doc->capacity = (length + 1) * 2;
+		doc->source = realloc(doc->source, doc->capacity);
+	}
+
+	/* Move the tail, including its '\0' */
+	memmove(doc->source + offset + added, doc->source + offset + deleted, doc->length - offset - deleted + 1);
+	memcpy(doc->source + offset, inserted, added);
+
+	doc->length = length;
+}
+
+/* A top level node standing in for n -- everything below it is n's */
+static node * borrow_node(node *n) {
+	node *m = mk_node(n->key);
+
+	*m = *n;
+	m->next = NULL;
+	return m;
+}
+
+/* Free a list made by assemble_tree, leaving what it borrowed alone */
+static void free_assembled_tree(node *n) {
+	node *next;
+
+	while (n != NULL) {
+		next = n->next;
+		n->str = NULL;
+		n->link_data = NULL;
+		n->children = NULL;
+		free_node(n);
+		n = next;
+	}
+}
+
+static void forget_whole_documents(mmd_doc *doc) {
+	int format;
+
+	for (format = 0; format < DOC_FORMATS; format++) {
+		free(doc->whole[format]);
+		doc->whole[format] = NULL;
+	}
+}
+
+/* These need the whole document in front of the grammar -- OPML and the TOC
+	parse it their own way, and accepting or rejecting changes comes first */
+static bool whole_document_format(mmd_doc *doc, int format) {
+	return (format == OPML_FORMAT) || (format == TOC_FORMAT) ||
+		(doc->extensions & EXT_CRITIC_ACCEPT) || (doc->extensions & EXT_CRITIC_REJECT);
+}
+
+/* Build the tree the serial parse would have -- exporting leaves the tree
+	alone, so only the top level list is new */
+static node * assemble_tree(mmd_doc *doc) {
+	node *head = NULL;
+	node *last = NULL;
+	node *footer = NULL;
+	node *copy;
+	node *n;
+	size_t i;
+
+	for (i = 0; i < doc->count; i++) {
+		for (n = doc->segments[i].tree; n != NULL; n = n->next) {
+			copy = borrow_node(n);
+
+			/* Metadata's FOOTER belongs after the last block */
+			if ((i == 0) && (n->key == FOOTER) && (n->next == NULL)) {
+				footer = copy;
+				continue;
+			}
+
+			if (last == NULL)
+				head = copy;
+			else
+				last->next = copy;
+			last = copy;
+		}
+	}
+
+	if (footer != NULL) {
+		if (last == NULL)
+			head = footer;
+		else
+			last->next = footer;
+		last = footer;
+	}
+
+	/* The serial parse collects autolabels newest first */
+	for (i = doc->count; i-- > 0;) {
+		for (n = doc->segments[i].autolabels; n != NULL; n = n->next) {
+			copy = borrow_node(n);
+
+			if (last == NULL)
+				head = copy;
+			else
+				last->next = copy;
+			last = copy;
+		}
+	}
+
+	return head;
+}
+
+
+#pragma mark - Public API
+
+/* mmd_doc_new -- parse source and keep the result for later edits */
+mmd_doc * mmd_doc_new(const char * source, unsigned long extensions) {
+	mmd_doc *doc = (mmd_doc *)malloc(sizeof(mmd_doc));
+
+	doc->length = strlen(source);
+	doc->capacity = doc->length + 1;
+	doc->source = malloc(doc->capacity);
+	memcpy(doc->source, source, doc->capacity);
+
+	doc->extensions = extensions;
+	doc->effective = effective_extensions(doc);
+	doc->segments = NULL;
+	doc->count = 0;
+	doc->links = NULL;
+	doc->notes = NULL;
+	doc->stale = true;
+	memset(doc->whole, 0, sizeof(doc->whole));
+
+	rebuild_segments(doc, 0);
+
+	return doc;
+}
+
+/* mmd_doc_edit -- replace `deleted` bytes at `offset` with `inserted` (may be
+	NULL), then re-parse the blocks around the change. Returns false if the
+	range is outside the document */
+bool mmd_doc_edit(mmd_doc * doc, size_t offset, size_t deleted, const char * inserted) {
+	size_t added = (inserted == NULL) ? 0 : strlen(inserted);
+	doc_segment *fresh = NULL;
+	doc_segment *merged;
+	size_t fresh_count = 0;
+	size_t fresh_size = 0;
+	size_t restart;
+	size_t kept = 0;
+	size_t tail;
+	size_t pos;
+	size_t next;
+	size_t count;
+	size_t i;
+	bool matched = false;
+	unsigned long effective;
+
+	if ((doc == NULL) || (offset > doc->length) || (deleted > doc->length - offset))
+		return false;
+
+	/* A boundary looks ahead as far as the first line of the segment after
+		it, so the two boundaries before the edit have to be rechecked */
+	restart = segment_at(doc, offset);
+	restart = (restart > 2) ? restart - 2 : 0;
+
+	splice_source(doc, offset, deleted, inserted, added);
+	forget_whole_documents(doc);
+
+	if (restart == 0) {
+		effective = effective_extensions(doc);
+		if (effective != doc->effective) {
+			doc->effective = effective;
+			doc->stale = true;
+			rebuild_segments(doc, 0);
+			return true;
+		}
+	}
+
+	/* Re-split from restart until a new boundary lands on an old one past
+		the edit -- from there on, the old segments are still valid */
+	pos = doc->segments[restart].start;
+	tail = restart + 1;
+
+	while (pos < doc->length) {
+		next = next_block_boundary(doc->source, pos, doc->length, doc->effective);
+		append_segment(&fresh, &fresh_count, &fresh_size, pos, next - pos);
+		pos = next;
+
+		if ((pos < doc->length) && (pos >= offset + added)) {
+			while ((tail < doc->count) && (doc->segments[tail].start + added < pos + deleted))
+				tail++;
+			if ((tail < doc->count) && (doc->segments[tail].start + added == pos + deleted)) {
+				matched = true;
+				break;
+			}
+		}
+	}
+	if (!matched)
+		tail = doc->count;
+
+	if ((fresh_count == 0) && (restart == 0) && (tail == doc->count))
+		append_segment(&fresh, &fresh_count, &fresh_size, 0, 0);
+
+	/* Segments that end before the edit and were split the same way as
+		before still parse the same way -- keep those */
+	while ((kept < fresh_count) && (restart + kept < tail) &&
+		(fresh[kept].start + fresh[kept].length <= offset) &&
+		(fresh[kept].start == doc->segments[restart + kept].start) &&
+		(fresh[kept].length == doc->segments[restart + kept].length) &&
+		!doc->segments[restart + kept].last) {
+		fresh[kept] = doc->segments[restart + kept];
+		memset(&doc->segments[restart + kept], 0, sizeof(doc_segment));
+		kept++;
+	}
+
+	/* Splice the new segments in */
+	count = restart + fresh_count + (doc->count - tail);
+	merged = malloc(count * sizeof(doc_segment));
+
+	memcpy(merged, doc->segments, restart * sizeof(doc_segment));
+	memcpy(merged + restart, fresh, fresh_count * sizeof(doc_segment));
+	for (i = tail; i < doc->count; i++) {
+		merged[restart + fresh_count + i - tail] = doc->segments[i];
+		merged[restart + fresh_count + i - tail].start = doc->segments[i].start + added - deleted;
+		move_positions(doc->segments[i].tree, doc->segments[i].start, doc->segments[i].start + added - deleted);
+		move_positions(doc->segments[i].autolabels, doc->segments[i].start, doc->segments[i].start + added - deleted);
+	}
+
+	for (i = restart; i < tail; i++)
+		free_segment(doc, &doc->segments[i]);
+	free(doc->segments);
+	free(fresh);
+
+	doc->segments = merged;
+	doc->count = count;
+
+	for (i = restart + kept; i < restart + fresh_count; i++)
+		parse_doc_segment(doc, &doc->segments[i], i == 0, i + 1 == count);
+
+	/* If the end of the document moved into an older segment, it needs the
+		end-of-document padding */
+	if (!doc->segments[count - 1].last) {
+		free_segment(doc, &doc->segments[count - 1]);
+		parse_doc_segment(doc, &doc->segments[count - 1], count == 1, true);
+	}
+
+	return true;
+}
+
+/* mmd_export -- export the current state of the document as format; the
+	parse is kept, so a document can be exported to any number of formats.
+	The reference tables are kept too, until an edit touches a block that
+	defines something */
+char * mmd_export(mmd_doc * doc, int format) {
+	char *out;
+	node *tree;
+	size_t i;
+
+	if (whole_document_format(doc, format)) {
+		if ((format < 0) || (format >= DOC_FORMATS))
+			return markdown_to_string(doc->source, doc->extensions, format);
+
+		if (doc->whole[format] == NULL)
+			doc->whole[format] = markdown_to_string(doc->source, doc->extensions, format);
+		return strdup(doc->whole[format]);
+	}
+
+	for (i = 0; i < doc->count; i++) {
+		if (doc->segments[i].failed)
+			return strdup("MultiMarkdown was unable to parse this file.");
+	}
+
+	tree = assemble_tree(doc);
+
+	if (doc->stale) {
+		free_node_tree(doc->links);
+		free_node_tree(doc->notes);
+		collect_references(tree, doc->effective, &doc->links, &doc->notes);
+		doc->stale = false;
+	}
+
+	out = export_node_tree_with_references(tree, doc->source, format, doc->effective, doc->links, doc->notes);
+	free_assembled_tree(tree);
+
+	return out;
+}
+
+/* mmd_doc_to_string -- export the current state of the document */
+char * mmd_doc_to_string(mmd_doc * doc, int format) {
+	return mmd_export(doc, format);
+}
+
+void mmd_doc_free(mmd_doc * doc) {
+	size_t i;
+
+	if (doc == NULL)
+		return;
+
+	for (i = 0; i < doc->count; i++)
+		free_segment(doc, &doc->segments[i]);
+
+	free(doc->segments);
+	free(doc->source);
+	free_node_tree(doc->links);
+	free_node_tree(doc->notes);
+	forget_whole_documents(doc);
+	free(doc);
+}
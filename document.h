@@ -0,0 +1,9 @@
+#ifndef DOCUMENT_PARSER_H
+#define DOCUMENT_PARSER_H
+
+#include "parser.h"
+#include "writer.h"
+
+size_t next_block_boundary(const char *source, size_t start, size_t length, unsigned long extensions);
+
+#endif
@@ -23,7 +23,7 @@
 
 /* #define DEBUG_ON */
 
-bool is_html_complete_doc(node *meta);
+bool is_html_complete_doc(node *meta, scratch_pad *scratch);
 void print_col_group(GString *out,scratch_pad *scratch);
 
 
@@ -43,6 +43,7 @@ void print_html_node(GString *out, node *n, scratch_pad *scratch) {
 	int lev;
 	int random;
 	char temp_type;
+	char *key;
 	char *width = NULL;
 	char *height = NULL;
 	GString *temp_str;
@@ -63,7 +64,7 @@ void print_html_node(GString *out, node *n, scratch_pad *scratch) {
 			g_string_append_printf(out, "</head>\n<body>\n");
 			scratch->extensions = scratch->extensions | EXT_HEAD_CLOSED;
 		}
-	switch (n->key) {
+	switch (node_key(n, scratch)) {
 		case NO_TYPE:
 			break;
 		case LIST:
@@ -74,22 +75,24 @@ void print_html_node(GString *out, node *n, scratch_pad *scratch) {
 			print_html_string(out,n->str, scratch);
 			break;
 		case ABBR:
-			if (strlen(n->children->str) == 0) {
+			temp_node = abbreviation_for_node(n, scratch);
+			if (strlen(temp_node->str) == 0) {
 				g_string_append_printf(out, "<abbr>");
 			} else {
 				g_string_append_printf(out, "<abbr title=\"");
-				print_html_string(out, n->children->str, scratch);
+				print_html_string(out, temp_node->str, scratch);
 				g_string_append_printf(out, "\">");
 			}
 			print_html_string(out,n->str, scratch);
 			g_string_append_printf(out, "</abbr>");
 			break;
 		case ABBRSTART:
-			if (strlen(n->children->str) == 0) {
+			temp_node = abbreviation_for_node(n, scratch);
+			if (strlen(temp_node->str) == 0) {
 				g_string_append_printf(out, "<abbr>");
 			} else {
 				g_string_append_printf(out, "<abbr title=\"");
-				print_html_string(out, n->children->str, scratch);
+				print_html_string(out, temp_node->str, scratch);
 				g_string_append_printf(out, "\">");
 			}
 			print_html_string(out,n->str, scratch);
@@ -141,11 +144,12 @@ void print_html_node(GString *out, node *n, scratch_pad *scratch) {
 		case VERBATIMFENCE:
 			pad(out, 2, scratch);
 			if ((n->children != NULL) && (n->children->key == VERBATIMTYPE)) {
-				trim_trailing_whitespace(n->children->str);
-				if (strlen(n->children->str) > 0)
-					g_string_append_printf(out, "<pre><code class=\"%s\">", n->children->str);
+				temp = trimmed_string(n->children->str);
+				if (strlen(temp) > 0)
+					g_string_append_printf(out, "<pre><code class=\"%s\">", temp);
 				else
 					g_string_append_printf(out, "%s", "<pre><code>");
+				free(temp);
 			} else {
 				g_string_append_printf(out, "%s", "<pre><code>");
 			}
@@ -182,27 +186,22 @@ void print_html_node(GString *out, node *n, scratch_pad *scratch) {
 		case METADATA:
 			/* Not if snippet only */
 			if (scratch->extensions & EXT_SNIPPET) {
-				is_html_complete_doc(n);
 				print_html_node_tree(out,n->children, scratch);
 				break;
 			}
 			
-			if (!(scratch->extensions & EXT_COMPLETE) && (is_html_complete_doc(n))) {
+			if (!(scratch->extensions & EXT_COMPLETE) && (is_html_complete_doc(n, scratch))) {
 				/* We have metadata to include, and didn't already force complete */
-				temp = metavalue_for_key("lang", scratch->result_tree);
+				temp = dict_metavalue_for_key("lang", scratch->metadata);
 				if (temp != NULL) {
 				    g_string_append_printf(out,
 					"<!DOCTYPE html>\n<html lang=\"%s\">\n<head>\n\t<meta charset=\"utf-8\"/>\n",temp);
-					free(temp);
 				} else {
 				    g_string_append_printf(out,
 					"<!DOCTYPE html>\n<html>\n<head>\n\t<meta charset=\"utf-8\"/>\n");
 				}
 				/* either way, now we need to be a complete doc */
 				scratch->extensions = scratch->extensions | EXT_COMPLETE;
-			} else {
-				/* Ensure we lowercase metadata */
-				is_html_complete_doc(n);
 			}
 			/* print the metadata */
 			scratch->extensions = scratch->extensions | EXT_HEAD_CLOSED;
@@ -213,16 +212,17 @@ void print_html_node(GString *out, node *n, scratch_pad *scratch) {
 			}
 			break;
 		case METAKEY:
-			if (strcmp(n->str, "baseheaderlevel") == 0) {
+			key = metadata_key_for_node(n, scratch);
+			if (strcmp(key, "baseheaderlevel") == 0) {
 				scratch->baseheaderlevel = atoi(n->children->str);
 				break;
-			} else if (strcmp(n->str, "xhtmlheaderlevel") == 0) {
+			} else if (strcmp(key, "xhtmlheaderlevel") == 0) {
 				scratch->baseheaderlevel = atoi(n->children->str);
 				break;
-			} else if (strcmp(n->str, "htmlheaderlevel") == 0) {
+			} else if (strcmp(key, "htmlheaderlevel") == 0) {
 				scratch->baseheaderlevel = atoi(n->children->str);
 				break;
-			} else if (strcmp(n->str, "quoteslanguage") == 0) {
+			} else if (strcmp(key, "quoteslanguage") == 0) {
 				temp = label_from_node_tree(n->children);
 				if ((strcmp(temp, "nl") == 0) || (strcmp(temp, "dutch") == 0)) { scratch->language = DUTCH; }   else 
 				if ((strcmp(temp, "de") == 0) || (strcmp(temp, "german") == 0)) { scratch->language = GERMAN; } else 
@@ -237,34 +237,35 @@ void print_html_node(GString *out, node *n, scratch_pad *scratch) {
 			if (scratch->extensions & EXT_SNIPPET)
 				break;
 			
-			if (strcmp(n->str, "title") == 0) {
+			if (strcmp(key, "title") == 0) {
 				g_string_append_printf(out, "\t<title>");
 				print_html_node(out, n->children, scratch);
 				g_string_append_printf(out, "</title>\n");
-			} else if (strcmp(n->str, "css") == 0) {
+			} else if (strcmp(key, "css") == 0) {
 				g_string_append_printf(out, "\t<link type=\"text/css\" rel=\"stylesheet\" href=\"");
 				print_html_node(out, n->children, scratch);
 				g_string_append_printf(out, "\"/>\n");
-			} else if (strcmp(n->str, "xhtmlheader") == 0) {
-				trim_trailing_whitespace(n->children->str);
-				print_raw_node(out, n->children);
-				g_string_append_printf(out, "\n");
-			} else if (strcmp(n->str, "htmlheader") == 0) {
-				trim_trailing_whitespace(n->children->str);
-				print_raw_node(out, n->children);
-				g_string_append_printf(out, "\n");
-			} else if (strcmp(n->str, "mmdfooter") == 0) {
-			} else if (strcmp(n->str, "mmdheader") == 0) {
-			} else if (strcmp(n->str, "lang") == 0) {
+			} else if (strcmp(key, "xhtmlheader") == 0) {
+				temp = trimmed_string(n->children->str);
+				g_string_append_printf(out, "%s\n", temp);
+				free(temp);
+			} else if (strcmp(key, "htmlheader") == 0) {
+				temp = trimmed_string(n->children->str);
+				g_string_append_printf(out, "%s\n", temp);
+				free(temp);
+			} else if (strcmp(key, "mmdfooter") == 0) {
+			} else if (strcmp(key, "mmdheader") == 0) {
+			} else if (strcmp(key, "lang") == 0) {
 			} else {
-				g_string_append_printf(out,"\t<meta name=\"%s\" content=\"",n->str);
+				g_string_append_printf(out,"\t<meta name=\"%s\" content=\"",key);
 				print_html_node(out,n->children,scratch);
 				g_string_append_printf(out,"\"/>\n");
 			}
 			break;
 		case METAVALUE:
-			trim_trailing_whitespace(n->str);
-			print_html_string(out,n->str, scratch);
+			temp = trimmed_string(n->str);
+			print_html_string(out,temp, scratch);
+			free(temp);
 			break;
 		case FOOTER:
 			break;
@@ -360,33 +361,31 @@ void print_html_node(GString *out, node *n, scratch_pad *scratch) {
 #ifdef DEBUG_ON
 	fprintf(stderr, "print html link: '%s'\n",n->str);
 #endif
-			/* Stash a copy of the link data */
-			if (n->link_data != NULL)
-				temp_link_data = mk_link_data(n->link_data->label, n->link_data->source, n->link_data->title, n->link_data->attr);
+			/* Reference links print with the definition's link_data
+				(borrowed from scratch) in place of the node's own */
+			temp_link_data = n->link_data;
+			temp = NULL;
 
 			/* Do we have proper info? */
-			if ((n->link_data->label == NULL) &&
-			(n->link_data->source == NULL)) {
+			if ((temp_link_data->label == NULL) &&
+			(temp_link_data->source == NULL)) {
 				/* we seem to be a [foo][] style link */
 				/* so load a label */
 				temp_str = g_string_new("");
 				print_raw_node_tree(temp_str, n->children);
-				n->link_data->label = temp_str->str;
+				temp = temp_str->str;
 				g_string_free(temp_str, FALSE);
+			} else if (temp_link_data->label != NULL) {
+				temp = strdup(temp_link_data->label);
 			}
 			/* Load reference data */
-			if (n->link_data->label != NULL) {
-				temp = strdup(n->link_data->label);
-
+			if (temp != NULL) {
 #ifdef DEBUG_ON
-	fprintf(stderr, "print html link: '%s'\n",n->link_data->title);				
+	fprintf(stderr, "print html link: '%s'\n",temp_link_data->title);				
 	fprintf(stderr, "print html link: '%s'\n",temp);
 #endif
-				n->link_data->attr = NULL;
-				free_link_data(n->link_data);
-
-				n->link_data = extract_link_data(temp, scratch);
-				if (n->link_data == NULL) {
+				temp_link_data = find_link_data(temp, scratch);
+				if (temp_link_data == NULL) {
 					/* replace original text since no definition found */
 					g_string_append_printf(out, "[");
 					print_html_node(out, n->children, scratch);
@@ -404,39 +403,31 @@ void print_html_node(GString *out, node *n, scratch_pad *scratch) {
 					
 					free(temp);
 
-					/* Restore stashed copy */
-					n->link_data = temp_link_data;
-
 					break;
 				}
 				free(temp);
 			}
 			g_string_append_printf(out, "<a");
-			if (n->link_data->source != NULL) {
+			if (temp_link_data->source != NULL) {
 				g_string_append_printf(out, " href=\"");
-				if (strncmp(n->link_data->source,"mailto:", 6) == 0) {
+				if (strncmp(temp_link_data->source,"mailto:", 6) == 0) {
 					scratch->obfuscate = 1;		/* flag obfuscated */
 				}
-				print_html_string(out,n->link_data->source, scratch);
+				print_html_string(out,temp_link_data->source, scratch);
 				g_string_append_printf(out, "\"");
 			}
-			if ((n->link_data->title != NULL) && (strlen(n->link_data->title) > 0)) {
+			if ((temp_link_data->title != NULL) && (strlen(temp_link_data->title) > 0)) {
 				g_string_append_printf(out, " title=\"");
-				print_html_string(out, n->link_data->title, scratch);
+				print_html_string(out, temp_link_data->title, scratch);
 				g_string_append_printf(out, "\"");
 			}
-			print_html_node_tree(out, n->link_data->attr, scratch);
+			print_html_node_tree(out, temp_link_data->attr, scratch);
 			g_string_append_printf(out, ">");
 			if (n->children != NULL)
 				print_html_node_tree(out,n->children,scratch);
 			g_string_append_printf(out, "</a>");
 			scratch->obfuscate = 0;
 
-			/* Restore stashed copy */
-			n->link_data->attr = NULL;
-			free_link_data(n->link_data);
-			n->link_data = temp_link_data;
-
 			break;
 		case ATTRKEY:
 			if ( (strcmp(n->str,"height") == 0) || (strcmp(n->str, "width") == 0)) {
@@ -461,40 +452,34 @@ void print_html_node(GString *out, node *n, scratch_pad *scratch) {
                 exit(EXIT_FAILURE);
             }
                 
-			/* Stash a copy of the link data */
-			if (n->link_data != NULL)
-				temp_link_data = mk_link_data(n->link_data->label, n->link_data->source, n->link_data->title, n->link_data->attr);
+			/* As for links, borrow the definition's link_data */
+			temp_link_data = n->link_data;
+			temp = NULL;
 
 			/* Do we have proper info? */
-			if ((n->link_data->label == NULL) &&
-			(n->link_data->source == NULL)) {
+			if ((temp_link_data->label == NULL) &&
+			(temp_link_data->source == NULL)) {
 				/* we seem to be a [foo][] style link */
 				/* so load a label */
 				temp_str = g_string_new("");
 				print_raw_node_tree(temp_str, n->children);
-				n->link_data->label = temp_str->str;
+				temp = temp_str->str;
 				g_string_free(temp_str, FALSE);
+			} else if (temp_link_data->label != NULL) {
+				temp = strdup(temp_link_data->label);
 			}
 #ifdef DEBUG_ON
 	fprintf(stderr, "load reference data\n");
 #endif
 			/* Load reference data */
-			if (n->link_data->label != NULL) {
-				temp = strdup(n->link_data->label);
-
-				n->link_data->attr = NULL;
-				free_link_data(n->link_data);
-
-				n->link_data = extract_link_data(temp, scratch);
+			if (temp != NULL) {
+				temp_link_data = find_link_data(temp, scratch);
 				
-				if (n->link_data == NULL) {
+				if (temp_link_data == NULL) {
 					g_string_append_printf(out, "![");
 					print_html_node_tree(out, n->children, scratch);
 					g_string_append_printf(out,"][%s]",temp);
 
-					/* Restore stashed copy */
-					n->link_data = temp_link_data;
-
 					free(temp);
 
 					break;
@@ -511,8 +496,8 @@ void print_html_node(GString *out, node *n, scratch_pad *scratch) {
 	fprintf(stderr, "create img\n");
 #endif
 			g_string_append_printf(out, "<img");
-			if (n->link_data->source != NULL)
-				g_string_append_printf(out, " src=\"%s\"",n->link_data->source);
+			if (temp_link_data->source != NULL)
+				g_string_append_printf(out, " src=\"%s\"",temp_link_data->source);
 			if (n->children != NULL) {
 				g_string_append_printf(out, " alt=\"");
 				temp_str = g_string_new("");
@@ -521,28 +506,28 @@ void print_html_node(GString *out, node *n, scratch_pad *scratch) {
 				g_string_free(temp_str, true);
 				g_string_append_printf(out, "\"");
 			} else {
-				g_string_append_printf(out, " alt=\"%s\"",n->link_data->title);
+				g_string_append_printf(out, " alt=\"%s\"",temp_link_data->title);
 			}
 			if (!(scratch->extensions & EXT_COMPATIBILITY)) {
-				if (n->link_data->label != NULL) {
-					temp = label_from_string(n->link_data->label);
+				if (temp_link_data->label != NULL) {
+					temp = label_from_string(temp_link_data->label);
 					g_string_append_printf(out, " id=\"%s\"",temp);
 					free(temp);
 				}
 			}
-			if ((n->link_data->title != NULL) && (strlen(n->link_data->title) > 0)) {
+			if ((temp_link_data->title != NULL) && (strlen(temp_link_data->title) > 0)) {
 				g_string_append_printf(out, " title=\"");
-				print_html_string(out, n->link_data->title, scratch);
+				print_html_string(out, temp_link_data->title, scratch);
 				g_string_append_printf(out, "\"");
 			}
 #ifdef DEBUG_ON
 	fprintf(stderr, "attributes\n");
 #endif
-			if (n->link_data->attr != NULL) {
-				temp_node = node_for_attribute("height",n->link_data->attr);
+			if (temp_link_data->attr != NULL) {
+				temp_node = node_for_attribute("height",temp_link_data->attr);
 				if (temp_node != NULL)
 					height = strdup(temp_node->children->str);
-				temp_node = node_for_attribute("width",n->link_data->attr);
+				temp_node = node_for_attribute("width",temp_link_data->attr);
 				if (temp_node != NULL)
 					width = strdup(temp_node->children->str);
 				if ((height != NULL) || (width != NULL)) {
@@ -559,7 +544,7 @@ void print_html_node(GString *out, node *n, scratch_pad *scratch) {
 	#ifdef DEBUG_ON
 		fprintf(stderr, "other attributes\n");
 	#endif
-				print_html_node_tree(out, n->link_data->attr, scratch);
+				print_html_node_tree(out, temp_link_data->attr, scratch);
 				free(height);
 				free(width);
 			}
@@ -579,18 +564,13 @@ void print_html_node(GString *out, node *n, scratch_pad *scratch) {
 				scratch->padded = 0;
 			}
 
-			/* Restore stashed copy */
-			n->link_data->attr = NULL;
-			free_link_data(n->link_data);
-			n->link_data = temp_link_data;
-
 			break;
 #ifdef DEBUG_ON
 	fprintf(stderr, "finish image\n");
 #endif
 		case NOTEREFERENCE:
 			lev = note_number_for_node(n, scratch);
-			temp_node = node_for_count(scratch->used_notes, lev);
+			temp_node = note_for_number(lev, scratch);
 			
 			if (scratch->extensions & EXT_RANDOM_FOOT) {
 				srand(scratch->random_seed_base + lev);
@@ -653,7 +633,7 @@ void print_html_node(GString *out, node *n, scratch_pad *scratch) {
 						random = lev;
 					}
 					
-					temp_node = node_for_count(scratch->used_notes, lev);
+					temp_node = note_for_number(lev, scratch);
 					/* flag that this is used as a citation */
 					temp_node->key = CITATIONSOURCE;
 					if (lev > scratch->max_footnote_num) {
@@ -700,12 +680,11 @@ void print_html_node(GString *out, node *n, scratch_pad *scratch) {
 #endif
 			break;
 		case VARIABLE:
-			temp = metavalue_for_key(n->str,scratch->result_tree);
+			temp = dict_metavalue_for_key(n->str, scratch->metadata);
 			if (temp == NULL) {
 				g_string_append_printf(out, "[%%%s]",n->str);
 			} else {
 				print_html_string(out, temp, scratch);
-				free(temp);
 			}
 			break;
 		case GLOSSARYTERM:
@@ -875,7 +854,7 @@ void print_html_node(GString *out, node *n, scratch_pad *scratch) {
 			break;
 		case TOC:
 			g_string_append_printf(out, "<div class=\"TOC\">\n");
-			print_html_node_tree(out,n->children, scratch);
+			print_html_node_tree(out,scratch->toc, scratch);
 			g_string_append_printf(out, "\n</div>");
 			break;
 		default:
@@ -886,37 +865,37 @@ void print_html_node(GString *out, node *n, scratch_pad *scratch) {
 
 /* print_html_endnotes */
 void print_html_endnotes(GString *out, scratch_pad *scratch) {
-	int counter = 0;
+	int counter;
 	int random;
-	node *reversed = copy_node_tree(scratch->used_notes);
+	node *note;
+	short *keys;
 
-	reversed = reverse_list(reversed);
+	/* Printing the notes can use more; leave those out, as we always have */
+	int count = scratch->used_note_count;
 
 	scratch->printing_notes = 1;
 	
-	node *note = reversed;
 #ifdef DEBUG_ON
 	fprintf(stderr, "start endnotes\n");
 #endif
 	
-	if ((note == NULL) || ((note->key == KEY_COUNTER) && (note->next == NULL))) {
-		free_node_tree(reversed);
+	if (count == 0)
 		return;
-	}
 
 #ifdef DEBUG_ON
 	fprintf(stderr, "there are endnotes to print\n");
 #endif
 
+	/* Go by the keys as they are now -- a citation inside one note mustn't
+		turn a later note into a citation while we print */
+	keys = malloc(count * sizeof(short));
+	for (counter = 1; counter <= count; counter++)
+		keys[counter - 1] = note_for_number(counter, scratch)->key;
+
 	pad(out,2, scratch);
 	g_string_append_printf(out, "<div class=\"footnotes\">\n<hr />\n<ol>");
-	while ( note != NULL) {
-		if (note->key == KEY_COUNTER) {
-			note = note->next;
-			continue;
-		}
-		
-		counter++;
+	for (counter = 1; counter <= count; counter++) {
+		note = note_for_number(counter, scratch);
 		pad(out, 1, scratch);
 		
 		if (scratch->extensions & EXT_RANDOM_FOOT) {
@@ -926,7 +905,7 @@ void print_html_endnotes(GString *out, scratch_pad *scratch) {
 			random = counter;
 		}
 		
-		if (note->key == CITATIONSOURCE) {
+		if (keys[counter - 1] == CITATIONSOURCE) {
 			g_string_append_printf(out, "<li id=\"fn:%d\" class=\"citation\"><span class=\"citekey\" style=\"display:none\">%s</span>", 
 				random, note->str);
 		} else {
@@ -935,49 +914,39 @@ void print_html_endnotes(GString *out, scratch_pad *scratch) {
 		
 		
 		scratch->padded = 2;
-		if ((note->key == NOTESOURCE) || (note->key == GLOSSARYSOURCE))
+		if ((keys[counter - 1] == NOTESOURCE) || (keys[counter - 1] == GLOSSARYSOURCE))
 			scratch->footnote_to_print = counter;
 		scratch->footnote_para_counter = tree_contains_key_count(note->children,PARA);
 		print_html_node(out, note, scratch);
 		pad(out, 1, scratch);
 		g_string_append_printf(out, "</li>");
-		
-		note = note->next;
 	}
 	pad(out,1, scratch);
 	g_string_append_printf(out, "</ol>\n</div>\n");
 	scratch->padded = 0;
-
-	free_node_tree(reversed);
+	free(keys);
 #ifdef DEBUG_ON
 	fprintf(stderr, "finish endnotes\n");
 #endif
 }
 
-/* Check metadata keys and determine if we need a complete document */
-/* We also preconvert metadata keys to proper formatting -- lowercase with no spaces */
-bool is_html_complete_doc(node *meta) {
+/* Check metadata keys (as metadata_key_for_node gives them) and determine
+	if we need a complete document */
+bool is_html_complete_doc(node *meta, scratch_pad *scratch) {
 	node *step;
-	char *temp;
-	step = meta->children;
-
-	while (step != NULL) {
-		/* process key to proper label */
-		temp = step->str;	/* store pointer to original str */
-		step->str = label_from_string(step->str);
-		free(temp);			/* free original since we don't need it */
-		step = step->next;
-	}
+	char *key;
 
 	step = meta->children;
 	while (step != NULL) {
+		key = metadata_key_for_node(step, scratch);
+
 		/* the following types of metadata do not require a complete document */
-		if ((strcmp(step->str, "baseheaderlevel")  != 0) &&
-			(strcmp(step->str, "xhtmlheaderlevel") != 0) &&
-			(strcmp(step->str, "htmlheaderlevel")  != 0) &&
-			(strcmp(step->str, "latexheaderlevel") != 0) &&
-			(strcmp(step->str, "odfheaderlevel")   != 0) &&
-			(strcmp(step->str, "quoteslanguage")   != 0))
+		if ((strcmp(key, "baseheaderlevel")  != 0) &&
+			(strcmp(key, "xhtmlheaderlevel") != 0) &&
+			(strcmp(key, "htmlheaderlevel")  != 0) &&
+			(strcmp(key, "latexheaderlevel") != 0) &&
+			(strcmp(key, "odfheaderlevel")   != 0) &&
+			(strcmp(key, "quoteslanguage")   != 0))
 			{ return TRUE;}
 		step = step->next;
 	}
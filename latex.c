@@ -21,30 +21,25 @@
 
 #include "latex.h"
 
-bool is_latex_complete_doc(node *meta);
+bool is_latex_complete_doc(node *meta, scratch_pad *scratch);
 
 /* find_latex_mode -- check for metadata to switch to beamer/memoir */
-int find_latex_mode(int format, node *n) {
-	node *latex_mode;
+int find_latex_mode(int format, scratch_pad *scratch) {
 	char *key;
 	char *label;
 	
 	if (format != LATEX_FORMAT)
 		return format;
 	
-	if (tree_contains_key(n, METAKEY)) {
-		latex_mode = metadata_for_key("latexmode",n);
-		if (latex_mode != NULL) {
-			key = metavalue_for_key("latexmode",n);
-			label = label_from_string(key);
-			if (strcmp(label, "beamer") == 0) {
-				format = BEAMER_FORMAT;
-			} else if (strcmp(label, "memoir") == 0) {
-				format = MEMOIR_FORMAT;
-			}
-			free(label);
-			free(key);
+	key = dict_metavalue_for_key("latexmode", scratch->metadata);
+	if (key != NULL) {
+		label = label_from_string(key);
+		if (strcmp(label, "beamer") == 0) {
+			format = BEAMER_FORMAT;
+		} else if (strcmp(label, "memoir") == 0) {
+			format = MEMOIR_FORMAT;
 		}
+		free(label);
 	}
 	
 	return format;
@@ -55,14 +50,16 @@ int find_latex_mode(int format, node *n) {
 void print_latex_node_tree(GString *out, node *list, scratch_pad *scratch) {
 	while (list != NULL) {
 		print_latex_node(out, list, scratch);
-		list = list->next;
+		list = abbreviation_end(list, scratch)->next;
 	}
 }
 
 /* print_latex_node -- convert given node to LaTeX and append */
 void print_latex_node(GString *out, node *n, scratch_pad *scratch) {
 	node *temp_node;
+	link_data *temp_link_data;
 	char *temp;
+	char *key;
 	int lev;
 	char *width = NULL;
 	char *height = NULL;
@@ -87,7 +84,7 @@ void print_latex_node(GString *out, node *n, scratch_pad *scratch) {
 			pad(out, 2, scratch);
 			scratch->extensions = scratch->extensions | EXT_HEAD_CLOSED;
 		}
-	switch (n->key) {
+	switch (node_key(n, scratch)) {
 		case NO_TYPE:
 			break;
 		case LIST:
@@ -111,21 +108,12 @@ void print_latex_node(GString *out, node *n, scratch_pad *scratch) {
 			free(width);
 			break;
 		case ABBRSTART:
-			/* Strip out nodes that are being replaced with the abbreviation */
-			temp_node = n->next;
-			while (temp_node->key != ABBRSTOP) {
-				n->next = temp_node->next;
-				temp_node->next = NULL;
-				free_node(temp_node);
-				temp_node = n->next;
-			}
-			n->next = temp_node->next;
-			temp_node->next = NULL;
-			free_node(temp_node);
+			/* The nodes up to ABBRSTOP are skipped (see abbreviation_end) */
 		case ABBR:
 			/* In either case, now we call on the abbreviation */
-			width = ascii_label_from_node(n->children->children);
-			temp = ascii_label_from_string(n->children->str);
+			temp_node = abbreviation_for_node(n, scratch);
+			width = ascii_label_from_node(temp_node->children);
+			temp = ascii_label_from_string(temp_node->str);
 			g_string_append_printf(out, "\\ac{%s%s}", width, temp);
 			free(temp);
 			free(width);
@@ -156,8 +144,7 @@ void print_latex_node(GString *out, node *n, scratch_pad *scratch) {
 			if (strncmp(n->str,"<!--",4) == 0) {
 				pad(out, 2, scratch);
 				/* trim "-->" from end */
-				n->str[strlen(n->str)-3] = '\0';
-				g_string_append_printf(out, "%s", &n->str[4]);
+				g_string_append_printf(out, "%.*s", (int) strlen(n->str) - 7, &n->str[4]);
 				scratch->padded = 0;
 			}
 			break;
@@ -165,12 +152,14 @@ void print_latex_node(GString *out, node *n, scratch_pad *scratch) {
 		case VERBATIMFENCE:
 			pad(out, 2, scratch);
 			if ((n->children != NULL) && (n->children->key == VERBATIMTYPE)) {
-				trim_trailing_whitespace(n->children->str);
-				if (strlen(n->children->str) > 0) {
-					g_string_append_printf(out, "\\begin{lstlisting}[language=%s]\n%s\\end{lstlisting}", n->children->str,n->str);
+				temp = trimmed_string(n->children->str);
+				if (strlen(temp) > 0) {
+					g_string_append_printf(out, "\\begin{lstlisting}[language=%s]\n%s\\end{lstlisting}", temp,n->str);
 					scratch->padded = 0;
+					free(temp);
 					break;
 				}
+				free(temp);
 			}
 			g_string_append_printf(out, "\\begin{verbatim}\n%s\\end{verbatim}",n->str);
 			scratch->padded = 0;
@@ -204,25 +193,23 @@ void print_latex_node(GString *out, node *n, scratch_pad *scratch) {
 		case METADATA:
 			/* print the metadata */
 			print_latex_node_tree(out,n->children, scratch);
-			if (!(scratch->extensions & EXT_SNIPPET) && (is_latex_complete_doc(n))) {
+			if (!(scratch->extensions & EXT_SNIPPET) && (is_latex_complete_doc(n, scratch))) {
 				scratch->extensions = scratch->extensions | EXT_COMPLETE;
 			}
 			/* print acronym definitions */
 			print_latex_node_tree(out, scratch->abbreviations, scratch);
 			break;
 		case METAKEY:
-			/* reformat the key */
-			temp = n->str;
-			n->str = label_from_string(temp);
-			free(temp);
-			
-			if (strcmp(n->str, "baseheaderlevel") == 0) {
+			/* the key as label_from_string makes it */
+			key = metadata_key_for_node(n, scratch);
+
+			if (strcmp(key, "baseheaderlevel") == 0) {
 				scratch->baseheaderlevel = atoi(n->children->str);
 				break;
-			} else if (strcmp(n->str, "latexheaderlevel") == 0) {
+			} else if (strcmp(key, "latexheaderlevel") == 0) {
 				scratch->baseheaderlevel = atoi(n->children->str);
 				break;
-			} else if (strcmp(n->str, "quoteslanguage") == 0) {
+			} else if (strcmp(key, "quoteslanguage") == 0) {
 				temp = label_from_node_tree(n->children);
 				if ((strcmp(temp, "nl") == 0) || (strcmp(temp, "dutch") == 0)) { scratch->language = DUTCH; }   else 
 				if ((strcmp(temp, "de") == 0) || (strcmp(temp, "german") == 0)) { scratch->language = GERMAN; } else 
@@ -237,52 +224,54 @@ void print_latex_node(GString *out, node *n, scratch_pad *scratch) {
 			if (scratch->extensions & EXT_SNIPPET)
 				break;
 							
-			if (strcmp(n->str, "title") == 0) {
+			if (strcmp(key, "title") == 0) {
 				g_string_append_printf(out, "\\def\\mytitle{");
 				print_latex_node(out, n->children, scratch);
 				g_string_append_printf(out, "}\n");
-			} else if (strcmp(n->str, "latextitle") == 0) {
+			} else if (strcmp(key, "latextitle") == 0) {
 				g_string_append_printf(out, "\\def\\mytitle{%s}\n",n->children->str);
-			} else if (strcmp(n->str, "author") == 0) {
+			} else if (strcmp(key, "author") == 0) {
 				g_string_append_printf(out, "\\def\\myauthor{");
 				print_latex_node(out, n->children, scratch);
 				g_string_append_printf(out, "}\n");
-			} else if (strcmp(n->str, "latexauthor") == 0) {
+			} else if (strcmp(key, "latexauthor") == 0) {
 				g_string_append_printf(out, "\\def\\myauthor{%s}\n",n->children->str);
-			} else if (strcmp(n->str, "date") == 0) {
+			} else if (strcmp(key, "date") == 0) {
 				g_string_append_printf(out, "\\def\\mydate{");
 				print_latex_node(out, n->children, scratch);
 				g_string_append_printf(out, "}\n");
-			} else if (strcmp(n->str, "copyright") == 0) {
+			} else if (strcmp(key, "copyright") == 0) {
 				g_string_append_printf(out, "\\def\\mycopyright{");
 				print_latex_node(out, n->children, scratch);
 				g_string_append_printf(out, "}\n");
-			} else if (strcmp(n->str, "css") == 0) {
-			} else if (strcmp(n->str, "xhtmlheader") == 0) {
-			} else if (strcmp(n->str, "htmlheader") == 0) {
-			} else if (strcmp(n->str, "mmdfooter") == 0) {
-			} else if (strcmp(n->str, "mmdheader") == 0) {
-			} else if (strcmp(n->str, "lang") == 0) {
-			} else if (strcmp(n->str, "latexinput") == 0) {
-				trim_trailing_whitespace(n->children->str);
-				g_string_append_printf(out, "\\input{%s}\n", n->children->str);
-			} else if (strcmp(n->str, "latexfooter") == 0) {
-				trim_trailing_whitespace(n->children->str);
-				scratch->latex_footer = strdup(n->children->str);
-			} else if (strcmp(n->str, "bibtex") == 0) {
-				trim_trailing_whitespace(n->children->str);
-				g_string_append_printf(out, "\\def\\bibliocommand{\\bibliography{%s}}\n",n->children->str);
+			} else if (strcmp(key, "css") == 0) {
+			} else if (strcmp(key, "xhtmlheader") == 0) {
+			} else if (strcmp(key, "htmlheader") == 0) {
+			} else if (strcmp(key, "mmdfooter") == 0) {
+			} else if (strcmp(key, "mmdheader") == 0) {
+			} else if (strcmp(key, "lang") == 0) {
+			} else if (strcmp(key, "latexinput") == 0) {
+				temp = trimmed_string(n->children->str);
+				g_string_append_printf(out, "\\input{%s}\n", temp);
+				free(temp);
+			} else if (strcmp(key, "latexfooter") == 0) {
+				scratch->latex_footer = trimmed_string(n->children->str);
+			} else if (strcmp(key, "bibtex") == 0) {
+				temp = trimmed_string(n->children->str);
+				g_string_append_printf(out, "\\def\\bibliocommand{\\bibliography{%s}}\n",temp);
+				free(temp);
 			} else {
 				g_string_append_printf(out, "\\def\\");
-				print_latex_string(out, n->str, scratch);
+				print_latex_string(out, key, scratch);
 				g_string_append_printf(out, "{");
 				print_latex_node_tree(out, n->children, scratch);
 				g_string_append_printf(out, "}\n");
 			}
 			break;
 		case METAVALUE:
-			trim_trailing_whitespace(n->str);
-			print_latex_string(out,n->str, scratch);
+			temp = trimmed_string(n->str);
+			print_latex_string(out,temp, scratch);
+			free(temp);
 			break;
 		case FOOTER:
 			print_latex_endnotes(out, scratch);
@@ -417,16 +406,14 @@ void print_latex_node(GString *out, node *n, scratch_pad *scratch) {
 #ifdef DEBUG_ON
 	fprintf(stderr, "print LaTeX link: '%s'\n",n->str);
 #endif
-			/* Do we have proper info? */
+			/* Reference links print with the definition's link_data
+				(borrowed from scratch) in place of the node's own */
+			temp_link_data = n->link_data;
+			temp = NULL;
 
-			if (n->link_data == NULL) {
-				/* NULL link_data could occur if we parsed this link before and it didn't
-					match anything */
-				n->link_data =  mk_link_data(NULL, NULL, NULL, NULL);
-			}
-
-			if ((n->link_data->label == NULL) &&
-			(n->link_data->source == NULL)) {
+			/* Do we have proper info? */
+			if ((temp_link_data == NULL) || ((temp_link_data->label == NULL) &&
+			(temp_link_data->source == NULL))) {
 #ifdef DEBUG_ON
 	fprintf(stderr, "print latex link: '%s'\n",n->str);
 #endif
@@ -434,22 +421,21 @@ void print_latex_node(GString *out, node *n, scratch_pad *scratch) {
 				/* so load a label */
 				temp_str = g_string_new("");
 				print_raw_node_tree(temp_str, n->children);
-				free(n->link_data->label);
-				n->link_data->label = temp_str->str;
+				temp = temp_str->str;
 				g_string_free(temp_str, FALSE);
+			} else if (temp_link_data->label != NULL) {
+				temp = strdup(temp_link_data->label);
 			}
 #ifdef DEBUG_ON
 	fprintf(stderr, "look for reference data for latex link: '%s'\n",n->str);
 #endif
 			/* Load reference data */
-			if (n->link_data->label != NULL) {
+			if (temp != NULL) {
 #ifdef DEBUG_ON
 	fprintf(stderr, "have label for latex link: '%s'\n",n->str);
 #endif
-				temp = strdup(n->link_data->label);
-				free_link_data(n->link_data);
-				n->link_data = extract_link_data(temp, scratch);
-				if (n->link_data == NULL) {
+				temp_link_data = find_link_data(temp, scratch);
+				if (temp_link_data == NULL) {
 					/* replace original text since no definition found */
 					g_string_append_printf(out, "[");
 					print_latex_node(out, n->children, scratch);
@@ -474,49 +460,48 @@ void print_latex_node(GString *out, node *n, scratch_pad *scratch) {
 			raw_str = g_string_new("");
 			print_raw_node_tree(raw_str, n->children);
 			
-			if ((n->link_data->source != NULL) && (n->link_data->source[0] == '#' )) {
+			if ((temp_link_data->source != NULL) && (temp_link_data->source[0] == '#' )) {
 				/* link to anchor within the document */
 				if (strlen(temp_str->str) > 0) {
 					/* We have text before the link */
 					g_string_append_printf(out, "%s (", temp_str->str);
 				}
 				
-				if (n->link_data->label == NULL) {
-					if ((n->link_data->source !=  NULL) && (strncmp(n->link_data->source,"#",1) == 0)) {
+				if (temp_link_data->label == NULL) {
+					if ((temp_link_data->source !=  NULL) && (strncmp(temp_link_data->source,"#",1) == 0)) {
 						/* This link was specified as [](#bar) */
-						g_string_append_printf(out, "\\autoref{%s}", n->link_data->source + 1);
+						g_string_append_printf(out, "\\autoref{%s}", temp_link_data->source + 1);
 					} else {
-						g_string_append_printf(out, "\\href{%s}{}", n->link_data->source);
+						g_string_append_printf(out, "\\href{%s}{}", temp_link_data->source);
 					}
 				} else {
-					g_string_append_printf(out, "\\autoref{%s}", n->link_data->label);
+					g_string_append_printf(out, "\\autoref{%s}", temp_link_data->label);
 				}
 				if (strlen(temp_str->str) > 0) {
 					g_string_append_printf(out, ")", temp_str->str);
 				}
-			} else if (strcmp(raw_str->str, n->link_data->source) == 0){
+			} else if (strcmp(raw_str->str, temp_link_data->source) == 0){
 				/* This is a <link> */
-				g_string_append_printf(out, "\\href{%s}{%s}", n->link_data->source, temp_str->str);
-			} else if ((strlen(n->link_data->source) > 7) &&
-				(strcmp(raw_str->str,&n->link_data->source[7]) == 0)) {
+				g_string_append_printf(out, "\\href{%s}{%s}", temp_link_data->source, temp_str->str);
+			} else if ((strlen(temp_link_data->source) > 7) &&
+				(strcmp(raw_str->str,&temp_link_data->source[7]) == 0)) {
 				/*This is a <mailto> */
-				g_string_append_printf(out, "\\href{%s}{%s}", n->link_data->source, temp_str->str);
+				g_string_append_printf(out, "\\href{%s}{%s}", temp_link_data->source, temp_str->str);
 			} else {
 				/* this is a [text](link) */
-				g_string_append_printf(out, "\\href{%s}{", n->link_data->source);
+				g_string_append_printf(out, "\\href{%s}{", temp_link_data->source);
 				print_latex_node_tree(out, n->children, scratch);
 				g_string_append_printf(out, "}");
 				if (scratch->no_latex_footnote == FALSE) {
 					g_string_append_printf(out, "\\footnote{\\href{");
-					print_latex_url(out, n->link_data->source, scratch);
-					g_string_append_printf(out, "}{", n->link_data->source);
-					print_latex_string(out, n->link_data->source, scratch);
+					print_latex_url(out, temp_link_data->source, scratch);
+					g_string_append_printf(out, "}{", temp_link_data->source);
+					print_latex_string(out, temp_link_data->source, scratch);
 					g_string_append_printf(out, "}}");
 				}
 			}
 			g_string_free(temp_str, true);
 			g_string_free(raw_str, true);
-			n->link_data->attr = NULL;
 			break;
 		case ATTRKEY:
 			g_string_append_printf(out, " %s=\"%s\"", n->str,
@@ -532,22 +517,26 @@ void print_latex_node(GString *out, node *n, scratch_pad *scratch) {
 #ifdef DEBUG_ON
 	fprintf(stderr, "print image\n");
 #endif
+			/* As for links, borrow the definition's link_data */
+			temp_link_data = n->link_data;
+			temp = NULL;
+
 			/* Do we have proper info? */
-			if ((n->link_data->label == NULL) &&
-			(n->link_data->source == NULL)) {
+			if ((temp_link_data->label == NULL) &&
+			(temp_link_data->source == NULL)) {
 				/* we seem to be a [foo][] style link */
 				/* so load a label */
 				temp_str = g_string_new("");
 				print_raw_node_tree(temp_str, n->children);
-				n->link_data->label = temp_str->str;
+				temp = temp_str->str;
 				g_string_free(temp_str, FALSE);
+			} else if (temp_link_data->label != NULL) {
+				temp = strdup(temp_link_data->label);
 			}
 			/* Load reference data */
-			if (n->link_data->label != NULL) {
-				temp = strdup(n->link_data->label);
-				free_link_data(n->link_data);
-				n->link_data = extract_link_data(temp, scratch);
-				if (n->link_data == NULL) {
+			if (temp != NULL) {
+				temp_link_data = find_link_data(temp, scratch);
+				if (temp_link_data == NULL) {
 					/* replace original text since no definition found */
 					g_string_append_printf(out, "![");
 					print_latex_node(out, n->children, scratch);
@@ -577,11 +566,11 @@ void print_latex_node(GString *out, node *n, scratch_pad *scratch) {
 	fprintf(stderr, "attributes\n");
 #endif
 
-			if (n->link_data->attr != NULL) {
-				temp_node = node_for_attribute("height",n->link_data->attr);
+			if (temp_link_data->attr != NULL) {
+				temp_node = node_for_attribute("height",temp_link_data->attr);
 				if (temp_node != NULL)
 					height = correct_dimension_units(temp_node->children->str);
-				temp_node = node_for_attribute("width",n->link_data->attr);
+				temp_node = node_for_attribute("width",temp_link_data->attr);
 				if (temp_node != NULL)
 					width = correct_dimension_units(temp_node->children->str);
 			}
@@ -623,7 +612,7 @@ void print_latex_node(GString *out, node *n, scratch_pad *scratch) {
 				}
 			}
 
-			g_string_append_printf(out, "]{%s}",n->link_data->source);
+			g_string_append_printf(out, "]{%s}",temp_link_data->source);
 			
 			if (n->key == IMAGEBLOCK) {
 				if (n->children != NULL) {
@@ -637,8 +626,8 @@ void print_latex_node(GString *out, node *n, scratch_pad *scratch) {
 					g_string_free(temp_str, true);
 				}
 				
-				if (n->link_data->label != NULL) {
-					temp = label_from_string(n->link_data->label);
+				if (temp_link_data->label != NULL) {
+					temp = label_from_string(temp_link_data->label);
 					g_string_append_printf(out, "\n\\label{%s}",temp);
 					free(temp);
 				}
@@ -648,14 +637,13 @@ void print_latex_node(GString *out, node *n, scratch_pad *scratch) {
 			
 			free(height);
 			free(width);
-			n->link_data->attr = NULL;	/* We'll delete these elsewhere */
 			break;
 #ifdef DEBUG_ON
 	fprintf(stderr, "finish image\n");
 #endif
 		case NOTEREFERENCE:
 			lev = note_number_for_node(n, scratch);
-			temp_node = node_for_count(scratch->used_notes, lev);
+			temp_node = note_for_number(lev, scratch);
 			scratch->padded = 2;
 			if (temp_node->key == GLOSSARYSOURCE) {
 				g_string_append_printf(out, "\\newglossaryentry{%s}{",temp_node->children->children->str);
@@ -677,7 +665,6 @@ void print_latex_node(GString *out, node *n, scratch_pad *scratch) {
 #endif
 			if ((n->link_data != NULL) && (strncmp(n->link_data->label,"[#",2) == 0)) {
 				/* external citation (e.g. BibTeX) */
-				n->link_data->label[strlen(n->link_data->label)-1] = '\0';
 				if (n->key == NOCITATION) {
 					g_string_append_printf(out, "~\\nocite{%s}",&n->str[2]);
 				} else {
@@ -695,7 +682,7 @@ void print_latex_node(GString *out, node *n, scratch_pad *scratch) {
 #ifdef DEBUG_ON
 					fprintf(stderr, "matching cite found\n");
 #endif
-					temp_node = node_for_count(scratch->used_notes, lev);
+					temp_node = note_for_number(lev, scratch);
 					/* flag that this is used as a citation */
 					temp_node->key = CITATIONSOURCE;
 					if (lev > scratch->max_footnote_num) {
@@ -725,21 +712,22 @@ void print_latex_node(GString *out, node *n, scratch_pad *scratch) {
 #ifdef DEBUG_ON
 				fprintf(stderr, "cite with children\n");
 #endif
-							if (strcmp(&temp[strlen(temp) - 1],";") == 0) {
+							/* A trailing ';' asks for \citet (and isn't part of the key) */
+							lev = strlen(temp);
+							if (temp[lev - 1] == ';') {
 								g_string_append_printf(out, " \\citet[");
-								temp[strlen(temp) - 1] = '\0';
+								lev--;
 							} else {
 								g_string_append_printf(out, "~\\citep[");
 							}
 							print_latex_node(out, n->children, scratch);
-							g_string_append_printf(out, "]{%s}",temp);
+							g_string_append_printf(out, "]{%.*s}", lev, temp);
 						} else {
 #ifdef DEBUG_ON
 				fprintf(stderr, "cite without children. locat:'%s'\n",n->str);
 #endif
 							if (strcmp(&temp[strlen(temp) - 1],";") == 0) {
-								temp[strlen(temp) - 1] = '\0';
-								g_string_append_printf(out, " \\citet{%s}",temp);
+								g_string_append_printf(out, " \\citet{%.*s}", (int) strlen(temp) - 1, temp);
 							} else {
 								g_string_append_printf(out, "~\\citep{%s}",temp);
 							}
@@ -752,12 +740,11 @@ void print_latex_node(GString *out, node *n, scratch_pad *scratch) {
 #endif
 			break;
 		case VARIABLE:
-			temp = metavalue_for_key(n->str,scratch->result_tree);
+			temp = dict_metavalue_for_key(n->str, scratch->metadata);
 			if (temp == NULL) {
 				g_string_append_printf(out, "[%%%s]",n->str);
 			} else {
 				print_latex_string(out, temp, scratch);
-				free(temp);
 			}
 			break;
 		case GLOSSARYTERM:
@@ -799,8 +786,7 @@ void print_latex_node(GString *out, node *n, scratch_pad *scratch) {
 			/* but do print HTML comments for raw LaTeX */
 			if (strncmp(n->str,"<!--",4) == 0) {
 				/* trim "-->" from end */
-				n->str[strlen(n->str)-3] = '\0';
-				g_string_append_printf(out, "%s", &n->str[4]);
+				g_string_append_printf(out, "%.*s", (int) strlen(n->str) - 7, &n->str[4]);
 				scratch->padded = 0;
 			}
 			break;
@@ -930,7 +916,7 @@ void print_latex_node(GString *out, node *n, scratch_pad *scratch) {
 		case KEY_COUNTER:
 			break;
 		case TOC:
-			print_latex_node_tree(out,n->children, scratch);
+			print_latex_node_tree(out,scratch->toc, scratch);
 			break;
 		default:
 			fprintf(stderr, "print_latex_node encountered unknown node key = %d\n",n->key);
@@ -940,27 +926,23 @@ void print_latex_node(GString *out, node *n, scratch_pad *scratch) {
 
 /* print_latex_endnotes */
 void print_latex_endnotes(GString *out, scratch_pad *scratch) {
-	scratch->used_notes = reverse_list(scratch->used_notes);
-	scratch->printing_notes = 1;
+	int count = scratch->used_note_count;
+	int i;
+	node *note;
 
-	node *note = scratch->used_notes;
+	scratch->printing_notes = 1;
 #ifdef DEBUG_ON
 	fprintf(stderr, "start endnotes\n");
 #endif
 	
-	if ((note == NULL) || ((note->key == KEY_COUNTER) && (note->next == NULL)))
-		return;
-	while (note != NULL) {
-		if (note->key == CITATIONSOURCE)
+	for (i = 1; i <= count; i++) {
+		if (note_for_number(i, scratch)->key == CITATIONSOURCE)
 			break;
-		note = note->next;
 	}
 
-	if (note == NULL)
+	if (i > count)
 		return;
 	
-	note = scratch->used_notes;
-	
 	/* TODO: need CITATIONSOURCE to print bibliography */
 #ifdef DEBUG_ON
 	fprintf(stderr, "there are endnotes to print\n");
@@ -968,12 +950,8 @@ void print_latex_endnotes(GString *out, scratch_pad *scratch) {
 
 	pad(out, 2, scratch);
 	g_string_append_printf(out, "\\begin{thebibliography}{0}");
-	while ( note != NULL) {
-		if (note->key == KEY_COUNTER) {
-			note = note->next;
-			continue;
-		}
-		
+	for (i = 1; i <= count; i++) {
+		note = note_for_number(i, scratch);
 		pad(out, 1, scratch);
 		
 		if (note->key == CITATIONSOURCE) {
@@ -986,8 +964,6 @@ void print_latex_endnotes(GString *out, scratch_pad *scratch) {
 		} else {
 			/* footnotes handled elsewhere */
 		}
-
-		note = note->next;
 	}
 	pad(out,2, scratch);
 	g_string_append_printf(out, "\\end{thebibliography}");
@@ -997,32 +973,25 @@ void print_latex_endnotes(GString *out, scratch_pad *scratch) {
 #endif
 }
 
-/* Check metadata keys and determine if we need a complete document */
-/* We also preconvert metadata keys to proper formatting -- lowercase with no spaces */
-bool is_latex_complete_doc(node *meta) {
+/* Check metadata keys (as metadata_key_for_node gives them) and determine
+	if we need a complete document */
+bool is_latex_complete_doc(node *meta, scratch_pad *scratch) {
 	node *step;
-	char *temp;
-	step = meta->children;
-
-	while (step != NULL) {
-		/* process key to proper label */
-		temp = step->str;	/* store pointer to original str */
-		step->str = label_from_string(step->str);
-		free(temp);			/* free original since we don't need it */
-		step = step->next;
-	}
+	char *key;
 
 	step = meta->children;
 	while (step != NULL) {
+		key = metadata_key_for_node(step, scratch);
+
 		/* the following types of metadata do not require a complete document */
-		if ((strcmp(step->str, "baseheaderlevel")  != 0) &&
-			(strcmp(step->str, "xhtmlheaderlevel") != 0) &&
-			(strcmp(step->str, "htmlheaderlevel")  != 0) &&
-			(strcmp(step->str, "latexheaderlevel") != 0) &&
-			(strcmp(step->str, "odfheaderlevel")   != 0) &&
-			(strcmp(step->str, "xhtmlheader")      != 0) &&
-			(strcmp(step->str, "htmlheader")       != 0) &&
-			(strcmp(step->str, "quoteslanguage")   != 0))
+		if ((strcmp(key, "baseheaderlevel")  != 0) &&
+			(strcmp(key, "xhtmlheaderlevel") != 0) &&
+			(strcmp(key, "htmlheaderlevel")  != 0) &&
+			(strcmp(key, "latexheaderlevel") != 0) &&
+			(strcmp(key, "odfheaderlevel")   != 0) &&
+			(strcmp(key, "xhtmlheader")      != 0) &&
+			(strcmp(key, "htmlheader")       != 0) &&
+			(strcmp(key, "quoteslanguage")   != 0))
 			{ return TRUE;}
 		step = step->next;
 	}
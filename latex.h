@@ -11,6 +11,6 @@ void print_latex_localized_typography(GString *out, int character, scratch_pad *
 void print_latex_string(GString *out, char *str, scratch_pad *scratch);
 void print_latex_url(GString *out, char *str, scratch_pad *scratch);
 void print_latex_endnotes(GString *out, scratch_pad *scratch);
-int  find_latex_mode(int format, node *n);
+int  find_latex_mode(int format, scratch_pad *scratch);
 
 #endif
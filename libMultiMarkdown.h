@@ -20,11 +20,17 @@
 /* Main API commands */
 
 char * markdown_to_string(const char * source, unsigned long extensions, int format);
+char * markdown_to_string_with_budget(const char * source, unsigned long extensions, int format, unsigned long budget);
 bool   has_metadata(const char *source, unsigned long extensions);
 char * extract_metadata_keys(const char *source, unsigned long extensions);
 char * extract_metadata_value(const char *source, unsigned long extensions, char *key);
 char * mmd_version(void);
 
+/* Each thread keeps a few parser contexts and the metadata it read last for
+	the next conversion. Threads let them go when they exit; call this to
+	free them sooner, or from the main thread before it returns */
+void   release_parser_contexts(void);
+
 
 /* These are the basic extensions */
 enum parser_extensions {
@@ -48,6 +54,9 @@ enum parser_extensions {
 	EXT_ESCAPED_LINE_BREAKS = 1 << 17,   /* Escaped line break */
 	EXT_NO_STRONG           = 1 << 18,   /* Don't allow nested <strong>'s */
 	EXT_NO_EMPH             = 1 << 19,   /* Don't allow nested <emph>'s */
+	EXT_MEMOIZE             = 1 << 20,   /* Remember failed rule attempts (packrat) */
+	EXT_DELIMITER_EMPH      = 1 << 21,   /* Match emphasis with a delimiter stack */
+	EXT_NO_ARENA            = 1 << 22,   /* Allocate tree nodes one at a time */
 	EXT_FAKE                = 1 << 31,   /* 31 is highest number allowed */
 };
 
@@ -154,6 +163,7 @@ enum keys {
 	ABBRSTART,
 	ABBRSTOP,
 	TOC,
+	EMPHDELIM,                       /* Run of '*' or '_' (EXT_DELIMITER_EMPH) */
 	KEY_COUNTER                      /* This *MUST* be the last item in the list */
 };
 
@@ -165,6 +175,8 @@ struct node {
 	struct link_data  *link_data;    /* store link info when relevant */
 	struct node       *children;     /* child elements */
 	struct node       *next;         /* next element */
+	size_t            start;         /* byte offset in source where element begins */
+	size_t            stop;          /* ... and ends (0, 0 if unknown) */
 };
 
 typedef struct node node;
@@ -179,3 +191,62 @@ struct link_data {
 };
 
 typedef struct link_data link_data;
+
+
+/* Parse tree access -- node start/stop are byte offsets into source */
+node * markdown_to_node_tree(const char * source, unsigned long extensions);
+void   free_node_tree(node * n);
+
+
+/* Compact parse trees -- the same tree packed into one array in document
+	order, with 32 bit indices instead of pointers. A node's first child (if
+	it has any) is the entry right after it; next jumps over its subtree */
+#define COMPACT_NONE          0xffffffffU   /* No string, link or sibling */
+#define COMPACT_HAS_CHILDREN  0x1
+
+typedef struct {
+	unsigned short    key;
+	unsigned short    flags;         /* COMPACT_HAS_CHILDREN */
+	unsigned int      start;         /* Same as node (so under 4 GB) */
+	unsigned int      stop;
+	unsigned int      str;           /* Offset into text, or COMPACT_NONE */
+	unsigned int      next;          /* Index of next sibling, or COMPACT_NONE */
+	unsigned int      link;          /* Index into links, or COMPACT_NONE */
+} compact_node;
+
+typedef struct {
+	unsigned int      label;         /* Offsets into text, or COMPACT_NONE */
+	unsigned int      source;
+	unsigned int      title;
+	unsigned int      attr;          /* Index of first attribute node, or COMPACT_NONE */
+} compact_link;
+
+typedef struct {
+	compact_node     *nodes;         /* Index 0 is the first top level node */
+	unsigned int      count;
+	compact_link     *links;
+	unsigned int      link_count;
+	char             *text;          /* Every string, each followed by '\0' */
+	size_t            text_length;
+} compact_tree;
+
+#define compact_first_child(t, i)  (((t)->nodes[i].flags & COMPACT_HAS_CHILDREN) ? (i) + 1 : COMPACT_NONE)
+#define compact_next(t, i)         ((t)->nodes[i].next)
+#define compact_str(t, i)          (((t)->nodes[i].str == COMPACT_NONE) ? NULL : (t)->text + (t)->nodes[i].str)
+
+compact_tree * markdown_to_compact_tree(const char * source, unsigned long extensions);
+compact_tree * compact_node_tree(node * n);
+node * node_tree_from_compact(compact_tree * tree);
+void   free_compact_tree(compact_tree * tree);
+
+
+/* Live documents -- keep the parse around and, after an edit, re-parse only
+	the top-level blocks it touched. Exporting leaves the parse as it was, so
+	one parse can be exported to as many formats as needed */
+typedef struct mmd_doc mmd_doc;
+
+mmd_doc * mmd_doc_new(const char * source, unsigned long extensions);
+bool   mmd_doc_edit(mmd_doc * doc, size_t offset, size_t deleted, const char * inserted);
+char * mmd_export(mmd_doc * doc, int format);
+char * mmd_doc_to_string(mmd_doc * doc, int format);
+void   mmd_doc_free(mmd_doc * doc);
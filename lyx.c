@@ -193,10 +193,10 @@ void perform_lyx_output(GString *out, node* list, scratch_pad *scratch)
 	const char s[2] = ",";
     char *token;
     char *cleaned;
-	if (tree_contains_key(list, METAKEY)) {
-		headings = metadata_for_key("lyxheadings",list);
+	if (scratch->metadata != NULL) {
+		headings = dict_metadata_for_key("lyxheadings", scratch->metadata);
 		if (headings != NULL) {
-			key = metavalue_for_key("lyxheadings",list);
+			key = dict_metavalue_for_key("lyxheadings", scratch->metadata);
 			g_string_append(lyx_headings,key);
 			token = strtok(lyx_headings->str, s);
 			 while( token != NULL )  {
@@ -210,7 +210,6 @@ void perform_lyx_output(GString *out, node* list, scratch_pad *scratch)
 			     break;
 				 }
              }
-			free(key);
 			free(token);
 		} 
 	}
@@ -218,18 +217,17 @@ void perform_lyx_output(GString *out, node* list, scratch_pad *scratch)
 	
 	/* get base heading level */
         scratch->baseheaderlevel = 1;
-        if (tree_contains_key(list, METAKEY)) {
-		base_header_level = metadata_for_key("baseheaderlevel",list);
+        if (scratch->metadata != NULL) {
+		base_header_level = dict_metadata_for_key("baseheaderlevel", scratch->metadata);
 		if (base_header_level != NULL) {
-			key = metavalue_for_key("baseheaderlevel",list);
+			key = dict_metavalue_for_key("baseheaderlevel", scratch->metadata);
 			scratch->baseheaderlevel = atoi(key);
-			free(key);
 		};
 	};
 	
 	
 	/* add prefixes for LyX references */
-	add_prefixes(list, list, scratch);
+	add_prefixes(list, scratch);
 	
 	bool isbeamer;
 	isbeamer = begin_lyx_output(out,list,scratch);    /* get Metadata controls */
@@ -281,10 +279,10 @@ bool begin_lyx_output(GString *out, node* list, scratch_pad *scratch) {
 
 	/* check for numbered versus unnumbered headings */
 	    scratch->lyx_number_headers = TRUE; /* default - numbering */
-		if (tree_contains_key(list, METAKEY)) {
-		number_headings = metadata_for_key("numberheadings",list);
+		if (scratch->metadata != NULL) {
+		number_headings = dict_metadata_for_key("numberheadings", scratch->metadata);
 		if (number_headings != NULL) {
-			key = metavalue_for_key("numberheadings",list);
+			key = dict_metavalue_for_key("numberheadings", scratch->metadata);
 			label = label_from_string(key);
 			if (strcmp(label, "yes") == 0) {
 				scratch->lyx_number_headers = TRUE;
@@ -292,15 +290,14 @@ bool begin_lyx_output(GString *out, node* list, scratch_pad *scratch) {
 				scratch->lyx_number_headers = FALSE;
 			}
 			free(label);
-			free(key);
 		}
 	}
 	
 	/* Get the language for quotes */
-		if (tree_contains_key(list, METAKEY)) {
-		quote_language = metadata_for_key("quoteslanguage",list);
+		if (scratch->metadata != NULL) {
+		quote_language = dict_metadata_for_key("quoteslanguage", scratch->metadata);
 		if (quote_language != NULL) {
-			key = metavalue_for_key("quoteslanguage",list);
+			key = dict_metavalue_for_key("quoteslanguage", scratch->metadata);
 			temp = label_from_node_tree(quote_language->children);
 			if ((strcmp(temp, "nl") == 0) || (strcmp(temp, "dutch") == 0)) { scratch->language = DUTCH; }   else 
 			if ((strcmp(temp, "de") == 0) || (strcmp(temp, "german") == 0)) { scratch->language = GERMAN; } else 
@@ -308,7 +305,6 @@ bool begin_lyx_output(GString *out, node* list, scratch_pad *scratch) {
 			if ((strcmp(temp, "fr") == 0) || (strcmp(temp, "french") == 0)) { scratch->language = FRENCH; } else 
 			if ((strcmp(temp, "sv") == 0) || (strcmp(temp, "swedish") == 0)) { scratch->language = SWEDISH; }
 			free(temp);
-			free(key);
 			}
 	    }
 			
@@ -318,17 +314,16 @@ bool begin_lyx_output(GString *out, node* list, scratch_pad *scratch) {
 	g_string_append(out, "\\begin_header\n");
 	
 	GString *lyx_class = g_string_new("");
-	if (tree_contains_key(list, METAKEY)) {
-		latex_mode = metadata_for_key("latexmode",list);
+	if (scratch->metadata != NULL) {
+		latex_mode = dict_metadata_for_key("latexmode", scratch->metadata);
 		if (latex_mode != NULL) {
-			key = metavalue_for_key("latexmode",list);
+			key = dict_metavalue_for_key("latexmode", scratch->metadata);
 			label = label_from_string(key);
 			g_string_append(lyx_class,label);
 			if (strcmp(label,"beamer")==0){
 				isbeamer = TRUE;
 			}
 			free(label);
-			free(key);
 		} else {
 			g_string_append(lyx_class,"memoir");
 		}
@@ -349,28 +344,26 @@ bool begin_lyx_output(GString *out, node* list, scratch_pad *scratch) {
 	g_string_append(out,"\\usepackage{varioref}\n");
 	
 	
-	if (tree_contains_key(list, METAKEY)) {
-		packages = metadata_for_key("packages",list);
+	if (scratch->metadata != NULL) {
+		packages = dict_metadata_for_key("packages", scratch->metadata);
 		if (packages != NULL) {
-			key = metavalue_for_key("packages",list);
+			key = dict_metavalue_for_key("packages", scratch->metadata);
 			tmp = strdup(key);
 			token = strtok(tmp, s);
 			 while( token != NULL )  {
                g_string_append_printf(out,"\\usepackage{%s}\n",clean_string(token));
                token = strtok(NULL, s);
              }
-			free(key);
 			free(tmp);
 		} 
 	}
 	
 	if(isbeamer){
-	  if (tree_contains_key(list, METAKEY)) {
-		content = metadata_for_key("theme", list);
+	  if (scratch->metadata != NULL) {
+		content = dict_metadata_for_key("theme", scratch->metadata);
 		if (content != NULL) {
-			value = metavalue_for_key("theme",list);
+			value = dict_metavalue_for_key("theme", scratch->metadata);
 			g_string_append_printf(out,"\\usetheme{%s}\n",value);
-			free(value);
 		} else{
 			g_string_append(out,"\\usetheme{warsaw}\n");
 		}
@@ -380,16 +373,15 @@ bool begin_lyx_output(GString *out, node* list, scratch_pad *scratch) {
 	  g_string_append(out,"\\setbeamercovered{transparent}\n");
 	}
 	
-	if (tree_contains_key(list, METAKEY)) {
-		content = metadata_for_key("latex input", list);
+	if (scratch->metadata != NULL) {
+		content = dict_metadata_for_key("latex input", scratch->metadata);
 		if (content != NULL) {
-			value = metavalue_for_key("latex input",list);
+			value = dict_metavalue_for_key("latex input", scratch->metadata);
 			if (strcmp(value,"mmd-natbib-plain")==0){
 				g_string_append(out,"\\bibpunct{[}{]}{;}{n}{}{,}\n");
 			}else{
 				g_string_append(out,"\\bibpunct{(}{)}{,}{a}{,}{,}\n");
 			}
-			free(value);
 		} else{
 			g_string_append(out,"\\bibpunct{(}{)}{,}{a}{,}{,}\n");
 		}
@@ -428,26 +420,24 @@ bool begin_lyx_output(GString *out, node* list, scratch_pad *scratch) {
 	
 	GString *class_options = g_string_new("\\options refpage");
 	
-	if (tree_contains_key(list, METAKEY)) {
-		clean_pdf = metadata_for_key("cleanpdf",list);
+	if (scratch->metadata != NULL) {
+		clean_pdf = dict_metadata_for_key("cleanpdf", scratch->metadata);
 		if (clean_pdf != NULL) {
-			key = metavalue_for_key("cleanpdf",list);
+			key = dict_metavalue_for_key("cleanpdf", scratch->metadata);
 			label = label_from_string(key);
 			if (strcmp(label, "yes") == 0) {
 				g_string_append(class_options,",hidelinks");
 			} 
 			free(label);
-			free(key);
 		}
 	}
 	
-    if (tree_contains_key(list, METAKEY)) {
-		content = metadata_for_key("class options", list);
+    if (scratch->metadata != NULL) {
+		content = dict_metadata_for_key("class options", scratch->metadata);
 		if (content != NULL) {
-			value = metavalue_for_key("class options",list);
+			value = dict_metavalue_for_key("class options", scratch->metadata);
 			g_string_append(class_options,",");
 			g_string_append(class_options,value);
-			free(value);
 		}
 	}
 	g_string_append(class_options,"\n");
@@ -457,10 +447,10 @@ bool begin_lyx_output(GString *out, node* list, scratch_pad *scratch) {
 			
 		
 	g_string_append(out,"\\begin_modules\n");
-	if (tree_contains_key(list, METAKEY)) {
-		modules = metadata_for_key("modules",list);
+	if (scratch->metadata != NULL) {
+		modules = dict_metadata_for_key("modules", scratch->metadata);
 		if (modules != NULL) {
-			key = metavalue_for_key("modules",list);
+			key = dict_metavalue_for_key("modules", scratch->metadata);
 			tmp = strdup(key);
 			token = strtok(tmp, s);
 			 while( token != NULL )  {
@@ -469,7 +459,6 @@ bool begin_lyx_output(GString *out, node* list, scratch_pad *scratch) {
                free(cleaned);
                token = strtok(NULL, s);
              }
-			free(key);
 			free(tmp);
 			free(token);
 		} 
@@ -484,68 +473,62 @@ bool begin_lyx_output(GString *out, node* list, scratch_pad *scratch) {
 	g_string_append(out,"\\end_header\n");
 	g_string_append(out,"\\begin_body\n");
 	
-	if (tree_contains_key(list, METAKEY)) {
-		content = metadata_for_key("title", list);
+	if (scratch->metadata != NULL) {
+		content = dict_metadata_for_key("title", scratch->metadata);
 		if (content != NULL) {
 			g_string_append(out, "\n\\begin_layout Title\n");
-			value = metavalue_for_key("title",list);
+			value = dict_metavalue_for_key("title", scratch->metadata);
             print_lyx_string(out,value,scratch,LYX_NONE);
-			free(value);
 			g_string_append(out, "\n\\end_layout\n");
 		}
 	}
 	
-	if ((isbeamer) && (tree_contains_key(list, METAKEY))) {
-		content = metadata_for_key("subtitle", list);
+	if ((isbeamer) && (scratch->metadata != NULL)) {
+		content = dict_metadata_for_key("subtitle", scratch->metadata);
 		if (content != NULL) {
 			g_string_append(out, "\n\\begin_layout Subtitle\n");
-			value = metavalue_for_key("subtitle",list);
+			value = dict_metavalue_for_key("subtitle", scratch->metadata);
 			print_lyx_string(out,value,scratch,LYX_NONE);
-			free(value);
 			g_string_append(out, "\n\\end_layout\n");
 		}
 	}
 	
-	if (tree_contains_key(list, METAKEY)) {
-		content = metadata_for_key("author", list);
+	if (scratch->metadata != NULL) {
+		content = dict_metadata_for_key("author", scratch->metadata);
 		if (content != NULL) {
 			g_string_append(out, "\n\\begin_layout Author\n");
-			value = metavalue_for_key("author",list);
+			value = dict_metavalue_for_key("author", scratch->metadata);
 			print_lyx_string(out,value,scratch,LYX_NONE);
-			free(value);
 			g_string_append(out, "\n\\end_layout\n");
 		}
 	}
 	
-	if ((isbeamer) && (tree_contains_key(list, METAKEY))){
-		content = metadata_for_key("affiliation", list);
+	if ((isbeamer) && (scratch->metadata != NULL)){
+		content = dict_metadata_for_key("affiliation", scratch->metadata);
 		if (content != NULL) {
 			g_string_append(out, "\n\\begin_layout Institute\n");
-			value = metavalue_for_key("affiliation",list);
+			value = dict_metavalue_for_key("affiliation", scratch->metadata);
 			print_lyx_string(out,value,scratch,LYX_NONE);
-			free(value);
 			g_string_append(out, "\n\\end_layout\n");
 		}
 	}
 	
-	if (tree_contains_key(list, METAKEY)) {
-		content = metadata_for_key("date", list);
+	if (scratch->metadata != NULL) {
+		content = dict_metadata_for_key("date", scratch->metadata);
 		if (content != NULL) {
 			g_string_append(out, "\n\\begin_layout Date\n");
-			value = metavalue_for_key("date",list);
+			value = dict_metavalue_for_key("date", scratch->metadata);
 			print_lyx_string(out,value,scratch,LYX_NONE);
-			free(value);
 			g_string_append(out, "\n\\end_layout\n");
 		}
 	}
 	
-	if (tree_contains_key(list, METAKEY)) {
-		content = metadata_for_key("abstract", list);
+	if (scratch->metadata != NULL) {
+		content = dict_metadata_for_key("abstract", scratch->metadata);
 		if (content != NULL) {
 			g_string_append(out, "\n\\begin_layout Abstract\n");
-			value = metavalue_for_key("abstract",list);
+			value = dict_metavalue_for_key("abstract", scratch->metadata);
             print_lyx_string(out,value,scratch,LYX_NONE);
-			free(value);
 			g_string_append(out, "\n\\end_layout\n");
 		}
 	}
@@ -563,15 +546,14 @@ void end_lyx_output(GString *out, node* list, scratch_pad *scratch) {
 
      	/* Handle BibTeX */
 	
-if (tree_contains_key(list, METAKEY)) {
-		content = metadata_for_key("bibtex",list);
+if (scratch->metadata != NULL) {
+		content = dict_metadata_for_key("bibtex", scratch->metadata);
 		if (content != NULL) {
 			g_string_append(out, "\n\\begin_layout Standard\n");
 			g_string_append(out,"\n\\begin_inset CommandInset bibtex");
 			g_string_append(out,"\nLatexCommand bibtex");
-			value = metavalue_for_key("bibtex",list);
+			value = dict_metavalue_for_key("bibtex", scratch->metadata);
 			g_string_append_printf(out,"\nbibfiles \"%s\"",value);
-			free(value);
 			g_string_append(out,"\noptions \"plainnat\"");
 			g_string_append(out,"\n\n\\end_inset");
 			g_string_append(out, "\n\n\\end_layout\n");
@@ -597,7 +579,7 @@ void print_lyx_node_tree(GString *out, node *list, scratch_pad *scratch, bool no
 #endif
 	while (list != NULL) {
 		print_lyx_node(out, list, scratch, no_newline);
-		list = list->next;
+		list = abbreviation_end(list, scratch)->next;
 	}
 #ifdef DEBUG_ON
     scratch->lyx_debug_nest--;
@@ -618,6 +600,8 @@ void print_lyx_node_tree(GString *out, node *list, scratch_pad *scratch, bool no
 void print_lyx_node(GString *out, node *n, scratch_pad *scratch, bool no_newline) {
 	node *temp_node;
 	node *tcaption;
+	link_data *temp_link_data;
+	char *source;
 	char *temp;
 	char *prefixed_label;
 	int lev;
@@ -642,7 +626,7 @@ void print_lyx_node(GString *out, node *n, scratch_pad *scratch, bool no_newline
 	fprintf(stderr,"%scontent: %s\n",scratch->lyx_debug_pad->str,n->str);
 #endif
 	
-	switch (n->key) {
+	switch (node_key(n, scratch)) {
 		case NO_TYPE:
 			break;
 		case LIST:
@@ -655,21 +639,12 @@ void print_lyx_node(GString *out, node *n, scratch_pad *scratch, bool no_newline
 		   // this work was done in writer.c
 			break;
 		case ABBRSTART:
-			/* Strip out nodes that are being replaced with the abbreviation */
-			temp_node = n->next;
-			while (temp_node->key != ABBRSTOP) {
-				n->next = temp_node->next;
-				temp_node->next = NULL;
-				free_node(temp_node);
-				temp_node = n->next;
-			}
-			n->next = temp_node->next;
-			temp_node->next = NULL;
-			free_node(temp_node);
+			/* The nodes up to ABBRSTOP are skipped (see abbreviation_end) */
 		case ABBR:
 			/* In either case, now we call on the abbreviation */
-//			width = ascii_label_from_node(n->children->children);
-            width = string_from_node_tree(n->children->children);
+			temp_node = abbreviation_for_node(n, scratch);
+//			width = ascii_label_from_node(temp_node->children);
+            width = string_from_node_tree(temp_node->children);
 //			temp = ascii_label_from_string(n->children->str);
 			temp_str = g_string_new("");
 		    g_string_append_printf(temp_str,"[%s]",width);
@@ -681,7 +656,7 @@ void print_lyx_node(GString *out, node *n, scratch_pad *scratch, bool no_newline
 		    g_string_append(used_abbreviations,temp_str->str);
 		      
 			
-			g_string_append(out,n->children->str);
+			g_string_append(out,temp_node->str);
 			g_string_append_printf(out," (%s)",width);
 			
 			
@@ -689,8 +664,8 @@ void print_lyx_node(GString *out, node *n, scratch_pad *scratch, bool no_newline
 			g_string_append(out,"\nLatexCommand nomenclature");
      		g_string_append_printf(out,"\nsymbol \"%s\"",width);
 			g_string_append(out,"\ndescription \"");
-//            g_string_append(out,n->children->str);
-            temp = escape_string(n->children->str);
+//            g_string_append(out,temp_node->str);
+            temp = escape_string(temp_node->str);
             g_string_append(out,temp);
 			g_string_append(out,"\"");		
 			g_string_append(out, "\n\\end_inset\n");
@@ -807,9 +782,10 @@ void print_lyx_node(GString *out, node *n, scratch_pad *scratch, bool no_newline
 			/* but do print HTML comments for raw LaTeX */
 			if (strncmp(n->str,"<!--",4) == 0) {
 				/* trim "-->" from end */
-				n->str[strlen(n->str)-3] = '\0';
+				temp = my_strndup(&n->str[4], strlen(n->str) - 7);
 				g_string_append(out, "\n\\begin_layout Plain Layout\n\\begin_inset ERT\nstatus collapsed\n\n\\begin_layout Plain Layout\n\n");
-                print_latex_string(out,&n->str[4],scratch);				
+                print_latex_string(out,temp,scratch);
+				free(temp);
 				g_string_append(out,"\n\n\\end_layout\n\n\\end_inset\n\\end_layout\n");
 			}
 			break;
@@ -824,14 +800,15 @@ void print_lyx_node(GString *out, node *n, scratch_pad *scratch, bool no_newline
 			g_string_append(out,"\\begin_layout Standard\n");
 			g_string_append(out,"\\begin_inset listings\n");
 			if ((n->children != NULL) && (n->children->key == VERBATIMTYPE)) {
-				trim_trailing_whitespace(n->children->str);
-				if (strlen(n->children->str) > 0) {
+				temp = trimmed_string(n->children->str);
+				if (strlen(temp) > 0) {
 					// NOTE: the language must match the LyX (LaTex) languages (e.g: Perl, not perl)
-					g_string_append_printf(out, "lstparams \"basicstyle={\\footnotesize\\ttfamily},language=%s\"\n", n->children->str,n->str);
+					g_string_append_printf(out, "lstparams \"basicstyle={\\footnotesize\\ttfamily},language=%s\"\n", temp,n->str);
 				}
 			   else {
 			   	 	g_string_append(out,"lstparams \"basicstyle={\\footnotesize\\ttfamily}\"\n");
 			   }
+				free(temp);
 			} else {
 		 	    g_string_append(out,"lstparams \"basicstyle={\\footnotesize\\ttfamily}\"\n");
 		       }
@@ -994,31 +971,26 @@ void print_lyx_node(GString *out, node *n, scratch_pad *scratch, bool no_newline
 			if (n->str[0] == '$') {
 				if (n->str[1] == '$') {
 					if (strncmp(&n->str[2],"\\begin",5) == 0) {
-						n->str[strlen(n->str)-2] = '\0';
-						g_string_append_printf(out, "\n\\begin_inset Formula %s\n\\end_inset\n",&n->str[1]);
+						g_string_append_printf(out, "\n\\begin_inset Formula %.*s\n\\end_inset\n",(int) strlen(n->str) - 3,&n->str[1]);
 					} else {
 						g_string_append_printf(out, "\n\\begin_inset Formula %s\n\\end_inset\n",n->str);
 					}
 				} else {
 					if (strncmp(&n->str[1],"\\begin",5) == 0) {
-						n->str[strlen(n->str)-1] = '\0';
-						g_string_append_printf(out, "\n\\begin_inset Formula %s\n\\end_inset\n",&n->str[1]);
+						g_string_append_printf(out, "\n\\begin_inset Formula %.*s\n\\end_inset\n",(int) strlen(n->str) - 2,&n->str[1]);
 					} else {
 						g_string_append_printf(out, "\n\\begin_inset Formula %s\n\\end_inset\n",n->str);
 					}
 				}
 			} else if (strncmp(&n->str[2],"\\begin",5) == 0) {
 				/* trim */
-				n->str[strlen(n->str)-3] = '\0';
-				g_string_append_printf(out, "\n\\begin_inset Formula %s\n\\end_inset\n", &n->str[2]);
+				g_string_append_printf(out, "\n\\begin_inset Formula %.*s\n\\end_inset\n", (int) strlen(n->str) - 5, &n->str[2]);
 			} else {
 				if (n->str[strlen(n->str)-1] == ']') {
-					n->str[strlen(n->str)-3] = '\0';
 					g_string_append(out,"\\begin_inset Formula \n\\[");
-					g_string_append_printf(out, "\n%s\n\\]\n\\end_inset\n", &n->str[2]);
+					g_string_append_printf(out, "\n%.*s\n\\]\n\\end_inset\n", (int) strlen(n->str) - 5, &n->str[2]);
 				} else {
-					n->str[strlen(n->str)-3] = '\0';
-					g_string_append_printf(out, "\n\\begin_inset Formula $%s$\n\\end_inset\n", &n->str[2]);
+					g_string_append_printf(out, "\n\\begin_inset Formula $%.*s$\n\\end_inset\n", (int) strlen(n->str) - 5, &n->str[2]);
 				}
 			}
 			break;
@@ -1039,16 +1011,14 @@ void print_lyx_node(GString *out, node *n, scratch_pad *scratch, bool no_newline
 	fprintf(stderr, "print LyX link: '%s'\n",n->str);
 #endif
            
-			/* Do we have proper info? */
+			/* Reference links print with the definition's link_data
+				(borrowed from scratch) in place of the node's own */
+			temp_link_data = n->link_data;
+			temp = NULL;
 
-			if (n->link_data == NULL) {
-				/* NULL link_data could occur if we parsed this link before and it didn't
-					match anything */
-				n->link_data =  mk_link_data(NULL, NULL, NULL, NULL);
-			}
-
-			if ((n->link_data->label == NULL) &&
-			(n->link_data->source == NULL)) {
+			/* Do we have proper info? */
+			if ((temp_link_data == NULL) || ((temp_link_data->label == NULL) &&
+			(temp_link_data->source == NULL))) {
 #ifdef DEBUG_ON
 	fprintf(stderr, "print LyX link: '%s'\n",n->str);
 #endif
@@ -1064,23 +1034,22 @@ void print_lyx_node(GString *out, node *n, scratch_pad *scratch, bool no_newline
 					}
 					temp++;
 				}
-				free(n->link_data->label);
-				n->link_data->label = temp_str->str;
+				temp = temp_str->str;
 				g_string_free(temp_str, FALSE);
+			} else if (temp_link_data->label != NULL) {
+				temp = strdup(temp_link_data->label);
 			}
 #ifdef DEBUG_ON
 	fprintf(stderr, "look for reference data for LyX link: '%s'\n",n->str);
 #endif
 			/* Load reference data */
-			if (n->link_data->label != NULL) {
+			if (temp != NULL) {
 #ifdef DEBUG_ON
 	fprintf(stderr, "have label for LyX link: '%s'\n",n->str);
 #endif
-				temp = strdup(n->link_data->label);
-				free_link_data(n->link_data);
-				n->link_data = extract_link_data(temp, scratch);
+				temp_link_data = find_link_data(temp, scratch);
 				   
-				if (n->link_data == NULL) {
+				if (temp_link_data == NULL) {
 					/* replace original text since no definition found */
 					g_string_append(out, "[");
 					print_lyx_node(out, n->children, scratch, FALSE);
@@ -1099,6 +1068,10 @@ void print_lyx_node(GString *out, node *n, scratch_pad *scratch, bool no_newline
 					break;
 				}
 				free(temp);
+				source = temp_link_data->source;
+			} else {
+				/* our own anchor may have a prefix (see add_prefixes) */
+				source = anchor_with_prefix(temp_link_data->source, scratch);
 			}
 			temp_str = g_string_new("");
 			print_lyx_node_tree(temp_str, n->children, scratch, TRUE);
@@ -1112,7 +1085,7 @@ void print_lyx_node(GString *out, node *n, scratch_pad *scratch, bool no_newline
 					}
 					temp++;
 				}	
-			if ((n->link_data->source != NULL) && (n->link_data->source[0] == '#' )) {
+			if ((source != NULL) && (source[0] == '#' )) {
 				   
 				/* link to anchor within the document */
 				if (strlen(temp_str->str) > 0) {
@@ -1120,41 +1093,42 @@ void print_lyx_node(GString *out, node *n, scratch_pad *scratch, bool no_newline
 					g_string_append_printf(out, "%s (", temp_str->str);
 				}
 				
-				if (n->link_data->label == NULL) {
-					if ((n->link_data->source !=  NULL) && (n->link_data->source[0] == '#' )) {
+				if (temp_link_data->label == NULL) {
+					if ((source !=  NULL) && (source[0] == '#' )) {
 						/* This link was specified as [](#bar) */
 						g_string_append(out,"\n\\begin_inset CommandInset ref");
 						g_string_append_printf(out,"\nLatexCommand formatted");
-						g_string_append_printf(out,"\nreference \"%s\"\n",n->link_data->source + 1);
+						g_string_append_printf(out,"\nreference \"%s\"\n",source + 1);
 						g_string_append(out,"\n\\end_inset\n");
 
 					} else {
-                        g_string_append_printf(out, "\n\\begin_inset CommandInset href\nLatexCommand href\ntarget \"%s\"\n", n->link_data->source);
+                        g_string_append_printf(out, "\n\\begin_inset CommandInset href\nLatexCommand href\ntarget \"%s\"\n", source);
 						g_string_append(out, "\"\n\n\\end_inset\n");
 	
 					}
 				} else {
 					g_string_append(out,"\n\\begin_inset CommandInset ref");
 					g_string_append_printf(out,"\nLatexCommand formatted");
-					g_string_append_printf(out,"\nreference \"%s\"\n",n->link_data->source + 1);
+					g_string_append_printf(out,"\nreference \"%s\"\n",source + 1);
 					g_string_append(out,"\n\\end_inset\n");
 				}
 				if (strlen(temp_str->str) > 0) {
 					g_string_append(out, ")");
 				}
-			} else if (strcmp(raw_str->str, n->link_data->source) == 0){
+			} else if (strcmp(raw_str->str, source) == 0){
 				/* This is a <link> */
-	            g_string_append_printf(out, "\n\\begin_inset CommandInset href\nLatexCommand href\ntarget \"%s\"\n", n->link_data->source);
+	            g_string_append_printf(out, "\n\\begin_inset CommandInset href\nLatexCommand href\ntarget \"%s\"\n", source);
 				g_string_append_printf(out,"name \"%s\"",temp_str->str);
 				g_string_append(out, "\n\n\\end_inset\n");
-			} else if (strcmp(raw_str->str,&n->link_data->source[7]) == 0) {
+			} else if ((strlen(source) > 7) &&
+				(strcmp(raw_str->str,&source[7]) == 0)) {
 				/*This is a <mailto> */
-                g_string_append_printf(out, "\n\\begin_inset CommandInset href\nLatexCommand href\ntarget \"%s\"\n", n->link_data->source);
+                g_string_append_printf(out, "\n\\begin_inset CommandInset href\nLatexCommand href\ntarget \"%s\"\n", source);
 				g_string_append_printf(out,"name \"%s\"",temp_str->str);
 				g_string_append(out,"\ntype \"mailto:\"");
 				g_string_append(out, "\n\n\\end_inset\n");
 			} else {
-				g_string_append_printf(out, "\n\\begin_inset CommandInset href\nLatexCommand href\ntarget \"%s\"\n", n->link_data->source);
+				g_string_append_printf(out, "\n\\begin_inset CommandInset href\nLatexCommand href\ntarget \"%s\"\n", source);
 				g_string_append(out,"name \"");
 				
 				g_string_free(temp_str,TRUE);
@@ -1165,15 +1139,14 @@ void print_lyx_node(GString *out, node *n, scratch_pad *scratch, bool no_newline
 				if (scratch->no_lyx_footnote == FALSE) {
 					g_string_append(out, "\n\\begin_inset Foot\nstatus collapsed\n\n\\begin_layout Plain Layout\n");
 					g_string_append(out, "\n\\begin_inset CommandInset href\nLatexCommand href\n");
-					g_string_append_printf(out,"\nname \"%s\"",n->link_data->source);
-					g_string_append_printf(out,"\ntarget \"%s\"",n->link_data->source);
+					g_string_append_printf(out,"\nname \"%s\"",source);
+					g_string_append_printf(out,"\ntarget \"%s\"",source);
                     g_string_append(out,"\n\n\\end_inset");
 					g_string_append(out, "\n\\end_layout\n\n\\end_inset\n");
 				}
 			}
 			g_string_free(temp_str, TRUE);
 			g_string_free(raw_str, true);
-			n->link_data->attr = NULL;
 			break;
 		case ATTRKEY:
 			g_string_append_printf(out, " %s=\"%s\"", n->str,
@@ -1188,23 +1161,27 @@ void print_lyx_node(GString *out, node *n, scratch_pad *scratch, bool no_newline
 #ifdef DEBUG_ON
 	fprintf(stderr, "print image\n");
 #endif
+			/* As for links, borrow the definition's link_data */
+			temp_link_data = n->link_data;
+			temp = NULL;
+
 			/* Do we have proper info? */
-			if ((n->link_data->label == NULL) &&
-			(n->link_data->source == NULL)) {
+			if ((temp_link_data->label == NULL) &&
+			(temp_link_data->source == NULL)) {
 				/* we seem to be a [foo][] style link */
 				/* so load a label */
 				temp_str = g_string_new("");
 				print_raw_node_tree(temp_str, n->children);
-				n->link_data->label = temp_str->str;
+				temp = temp_str->str;
 				g_string_free(temp_str, FALSE);
+			} else if (temp_link_data->label != NULL) {
+				temp = strdup(temp_link_data->label);
 			}
 			/* Load reference data */
-			if (n->link_data->label != NULL) {
-				temp = strdup(n->link_data->label);
-				free_link_data(n->link_data);
-				n->link_data = extract_link_data(temp, scratch);
+			if (temp != NULL) {
+				temp_link_data = find_link_data(temp, scratch);
 				    
-				if (n->link_data == NULL) {
+				if (temp_link_data == NULL) {
 					/* replace original text since no definition found */
 					g_string_append(out, "![");
 					print_lyx_node(out, n->children, scratch, FALSE);
@@ -1236,17 +1213,17 @@ void print_lyx_node(GString *out, node *n, scratch_pad *scratch, bool no_newline
 			
 			g_string_append(out,"\n\\begin_inset Graphics");
 			
-			g_string_append_printf(out, "\n\t filename %s\n",n->link_data->source);
+			g_string_append_printf(out, "\n\t filename %s\n",temp_link_data->source);
 
 #ifdef DEBUG_ON
 	fprintf(stderr, "attributes\n");
 #endif
 
-			if (n->link_data->attr != NULL) {
-				temp_node = node_for_attribute("height",n->link_data->attr);
+			if (temp_link_data->attr != NULL) {
+				temp_node = node_for_attribute("height",temp_link_data->attr);
 				if (temp_node != NULL)
 					height = correct_dimension_units(temp_node->children->str);
-				temp_node = node_for_attribute("width",n->link_data->attr);
+				temp_node = node_for_attribute("width",temp_link_data->attr);
 				if (temp_node != NULL)
 					width = correct_dimension_units(temp_node->children->str);
 			}
@@ -1281,10 +1258,10 @@ void print_lyx_node(GString *out, node *n, scratch_pad *scratch, bool no_newline
 					print_lyx_node_tree(out, n->children, scratch, FALSE);
 				g_string_append(out,"\n\\end_layout\n");
 			    g_string_append(out,"\n\\end_inset");
-				if (n->link_data->label != NULL) {
+				if (temp_link_data->label != NULL) {
 					g_string_append(out,"\n\n\\begin_inset CommandInset label");
 					g_string_append(out,"\nLatexCommand label\n");
-					temp = label_from_string(n->link_data->label);
+					temp = label_from_string(temp_link_data->label);
 				    g_string_append_printf(out, "\nname \"fig:%s\"",temp);
 					g_string_append(out,"\n\\end_inset");
 					free(temp);
@@ -1298,14 +1275,13 @@ void print_lyx_node(GString *out, node *n, scratch_pad *scratch, bool no_newline
 			
 			free(height);
 			free(width);
-			n->link_data->attr = NULL;	/* We'll delete these elsewhere */
 			break;
 #ifdef DEBUG_ON
 	fprintf(stderr, "finish image\n");
 #endif
 		case NOTEREFERENCE:
 			lev = note_number_for_node(n, scratch);
-			temp_node = node_for_count(scratch->used_notes, lev);
+			temp_node = note_for_number(lev, scratch);
 			if (temp_node->key == GLOSSARYSOURCE) {
 				g_string_append(out,"\n\\begin_inset CommandInset nomenclature");
 			    g_string_append(out,"\nLatexCommand nomenclature");
@@ -1330,7 +1306,6 @@ void print_lyx_node(GString *out, node *n, scratch_pad *scratch, bool no_newline
 #endif
 			if ((n->link_data != NULL) && (strncmp(n->link_data->label,"[#",2) == 0)) {
 				/* external citation (e.g. BibTeX) */
-				n->link_data->label[strlen(n->link_data->label)-1] = '\0';
 				if (n->key == NOCITATION) {
 					g_string_append(out,"\n\\begin_inset CommandInset citation");
 					g_string_append(out,"\nLatexCommand nocite");
@@ -1351,7 +1326,7 @@ void print_lyx_node(GString *out, node *n, scratch_pad *scratch, bool no_newline
 #ifdef DEBUG_ON
 					fprintf(stderr, "matching cite found\n");
 #endif
-					temp_node = node_for_count(scratch->used_notes, lev);
+					temp_node = note_for_number(lev, scratch);
 					/* flag that this is used as a citation */
 					temp_node->key = CITATIONSOURCE;
 					if (lev > scratch->max_footnote_num) {
@@ -1393,24 +1368,25 @@ void print_lyx_node(GString *out, node *n, scratch_pad *scratch, bool no_newline
 #ifdef DEBUG_ON
 				fprintf(stderr, "cite with children\n");
 #endif
-							if (strcmp(&temp[strlen(temp) - 1],";") == 0) {
+							/* A trailing ';' asks for \citet (and isn't part of the key) */
+							lev = strlen(temp);
+							if (temp[lev - 1] == ';') {
 								g_string_append(out, " \\citet[");
-								temp[strlen(temp) - 1] = '\0';
+								lev--;
 							} else {
 								g_string_append(out,"\n\\begin_inset CommandInset citation");
 							    g_string_append(out,"\nLatexCommand cite");
 							    g_string_append(out, "\nafter \"");	
 							}
 							print_lyx_node(out, n->children, scratch, FALSE);
-							g_string_append_printf(out,"\"\nkey \"%s\"",temp);
+							g_string_append_printf(out,"\"\nkey \"%.*s\"", lev, temp);
 							g_string_append(out,"\n\n\\end_inset\n");
 						} else {
 #ifdef DEBUG_ON
 				fprintf(stderr, "cite without children. locat:'%s'\n",n->str);
 #endif
 							if (strcmp(&temp[strlen(temp) - 1],";") == 0) {
-								temp[strlen(temp) - 1] = '\0';
-								g_string_append_printf(out, " \\citet{%s}",temp);
+								g_string_append_printf(out, " \\citet{%.*s}", (int) strlen(temp) - 1, temp);
 							} else {
 								g_string_append(out,"\n\\begin_inset CommandInset citation");
 							    g_string_append(out,"\nLatexCommand cite");
@@ -1426,12 +1402,11 @@ void print_lyx_node(GString *out, node *n, scratch_pad *scratch, bool no_newline
 #endif
 			break;
 		case VARIABLE:
-			temp = metavalue_for_key(n->str,scratch->result_tree);
+			temp = dict_metavalue_for_key(n->str, scratch->metadata);
 			if (temp == NULL) {
 				g_string_append_printf(out, "[%%%s]",n->str);
 			} else {
 				print_lyx_string(out, temp, scratch, LYX_NONE);
-				free(temp);
 			}
 			break;
 		case GLOSSARYTERM:
@@ -1496,10 +1471,11 @@ void print_lyx_node(GString *out, node *n, scratch_pad *scratch, bool no_newline
 			/* but do print HTML comments for raw LaTeX */
 			if (strncmp(n->str,"<!--",4) == 0) {
 				/* trim "-->" from end */
-				n->str[strlen(n->str)-3] = '\0';
+				temp = my_strndup(&n->str[4], strlen(n->str) - 7);
 //				g_string_append(out, "\n\\begin_layout Plain Layout\n\\begin_inset ERT\nstatus collapsed\n\n\\begin_layout Plain Layout\n\n");
 				g_string_append(out, "\n\\begin_inset ERT\nstatus collapsed\n\n\\begin_layout Plain Layout\n\n");
-                print_lyx_string(out,&n->str[4],scratch,LYX_NONE);				
+                print_lyx_string(out,temp,scratch,LYX_NONE);
+				free(temp);
 //              g_string_append(out,"\n\n\\end_layout\n\\end_inset\n\\end_layout\n");
 				g_string_append(out,"\n\n\\end_layout\n\\end_inset\n");
 			}
@@ -1731,7 +1707,7 @@ void print_lyx_node(GString *out, node *n, scratch_pad *scratch, bool no_newline
 		case KEY_COUNTER:
 			break;
 		case TOC:
-			print_lyx_node_tree(out,n->children, scratch, false);
+			print_lyx_node_tree(out,scratch->toc, scratch, false);
 			break;
 		default:
 			fprintf(stderr, "print_lyx_node encountered unknown node key = %d\n",n->key);
@@ -1743,8 +1719,9 @@ void print_lyx_node(GString *out, node *n, scratch_pad *scratch, bool no_newline
 void print_lyx_endnotes(GString *out, scratch_pad *scratch) {
 	node *temp_node;
 	bool do_nomenclature;
-	scratch->used_notes = reverse_list(scratch->used_notes);
-	node *note = scratch->used_notes;
+	int count = scratch->used_note_count;
+	int i;
+	node *note;
 #ifdef DEBUG_ON
 	fprintf(stderr, "start endnotes\n");
 #endif
@@ -1755,13 +1732,12 @@ void print_lyx_endnotes(GString *out, scratch_pad *scratch) {
 	  do_nomenclature = true; 
 	} else
 	{
-      temp_node = note;
-      while (temp_node != NULL){
+      for (i = 1; i <= count; i++){
+      	  temp_node = note_for_number(i, scratch);
       	  if(temp_node->key == GLOSSARYSOURCE){
           do_nomenclature = true;
     	  break;
           }
-	  temp_node = temp_node->next;
 	  }
     }
 	
@@ -1774,20 +1750,15 @@ void print_lyx_endnotes(GString *out, scratch_pad *scratch) {
     	g_string_append(out,"\n\\end_layout\n");
 	}
 
-	if (note == NULL)
+	if (count == 0)
 		return;
 	
-	note = scratch->used_notes;
-	
 #ifdef DEBUG_ON
 	fprintf(stderr, "there are endnotes to print\n");
 #endif
 
-	while ( note != NULL) {
-		if (note->key == KEY_COUNTER) {
-			note = note->next;
-			continue;
-		}
+	for (i = 1; i <= count; i++) {
+		note = note_for_number(i, scratch);
 		
 		if (note->key == CITATIONSOURCE) {
 			g_string_append(out, "\n\\begin_layout Bibliography\n");
@@ -1801,8 +1772,6 @@ void print_lyx_endnotes(GString *out, scratch_pad *scratch) {
 		} else {
 			/* footnotes handled elsewhere */
 		}
-
-		note = note->next;
 	}
 	
 	
@@ -2060,7 +2029,7 @@ void lyx_get_table_dimensions(node* list, int *rows, int *cols, scratch_pad *scr
 }
 /* add_prefixes -- go through node tree and find elements created from headers, figures, and tables
                    add the prefix so LyX can create proper references */
-void add_prefixes(node *list, node *root, scratch_pad *scratch) {
+void add_prefixes(node *list, scratch_pad *scratch) {
 	char *label;
 	GString *pound_label;
 	int  lev;
@@ -2078,11 +2047,11 @@ void add_prefixes(node *list, node *root, scratch_pad *scratch) {
 					label = label_from_string(list->children->str);
 				}
 				
-					/* update any links in the tree */
+					/* note the prefix for any links in the tree */
 				
 				pound_label = g_string_new("#");
                 g_string_append(pound_label,label);
-				update_link_source(pound_label->str,heading_name[lev-1]->str,root);
+				add_anchor_prefix(pound_label->str,heading_name[lev-1]->str,scratch);
 				
 				
 				/* and any in the "links" list */
@@ -2113,13 +2082,13 @@ void add_prefixes(node *list, node *root, scratch_pad *scratch) {
                     label = label_from_string(list->link_data->label);
                     pound_label = g_string_new("#");
                     g_string_append(pound_label,label);
-                    update_link_source(pound_label->str,"fig",root);
+                    add_anchor_prefix(pound_label->str,"fig",scratch);
                     g_string_free(pound_label,TRUE);
                     free(label);
 				}
 				break;
 			case HEADINGSECTION:
-				add_prefixes(list->children, root, scratch);
+				add_prefixes(list->children, scratch);
 				break;
 			default:
 				break;
@@ -2145,28 +2114,34 @@ void update_links(char *source,char *prefix, scratch_pad *scratch) {
 	}
 }
 
-/* update_link_source - walk the tree and add prefixes */
-void update_link_source(char *source, char *prefix,node *n){
-	 link_data *l;
-	 char* new_source;
-	 while(n != NULL){
-	   	if (n->key == LINK){
-	   		l = n->link_data;
-	   		if ((l != NULL) && (l->source != NULL)) {
-	   	  		if (strcmp (l->source,source) == 0){
-	   	  			new_source = prefix_label(prefix,l->source,TRUE);
-					free(l->source);
-		    		l->source = strdup(new_source);
-					free(new_source);
-	   	  		}
-	   		}
-		}
-		if(n->children != NULL) {
-		   update_link_source(source,prefix,n->children);
-		}
-	 n = n-> next;	
-	 }
-	
+/* add_anchor_prefix - links in the tree to source (an anchor) are to get
+	prefix; the tree isn't changed, LINK uses anchor_with_prefix instead.
+	The first prefix given for an anchor is the one used */
+void add_anchor_prefix(char *source, char *prefix, scratch_pad *scratch){
+	char* new_source;
+
+	if (anchor_with_prefix(source, scratch) != source)
+		return;
+
+	new_source = prefix_label(prefix,source,TRUE);
+	scratch->lyx_anchors = cons(mk_link(NULL, source, new_source, NULL, NULL), scratch->lyx_anchors);
+	free(new_source);
+}
+
+/* anchor_with_prefix - source as links to it are printed: with the prefix
+	add_anchor_prefix gave it, if any */
+char *anchor_with_prefix(char *source, scratch_pad *scratch){
+	node *n;
+
+	if ((source == NULL) || (source[0] != '#'))
+		return source;
+
+	for (n = scratch->lyx_anchors; n != NULL; n = n->next) {
+		if (strcmp(n->link_data->label, source) == 0)
+			return n->link_data->source;
+	}
+
+	return source;
 }
 
 /* prefix_label - Builds a label with a prefix - Returns a null-terminated string,
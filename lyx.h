@@ -27,10 +27,11 @@ void print_lyx_string(GString *out,char *str, scratch_pad *scratch,short environ
 void print_lyx_url(GString *out, char *str, scratch_pad *scratch);
 void print_lyx_endnotes(GString *out, scratch_pad *scratch);
 void lyx_get_table_dimensions(node* list, int *rows, int *cols, scratch_pad *scratch);
-void add_prefixes(node *list, node *root, scratch_pad *scratch);
+void add_prefixes(node *list, scratch_pad *scratch);
 void update_links(char *label,char *prefix, scratch_pad *scratch);
 char *prefix_label(char *prefix, char *label, bool pound);
-void update_link_source(char *source, char *prefix,node *n);
+void add_anchor_prefix(char *source, char *prefix, scratch_pad *scratch);
+char *anchor_with_prefix(char *source, scratch_pad *scratch);
 void print_escaped_node_tree(GString *out, node *n);
 void print_escaped_node(GString *out, node *n);
 char * escape_string(char *str);
@@ -27,7 +27,7 @@ bool need_fragile; // if the frame needs to be fragile
 void print_lyxbeamer_node_tree(GString *out, node *list, scratch_pad *scratch, bool no_newline) {
 	while (list != NULL) {
 		print_lyxbeamer_node(out, list, scratch, no_newline);
-		list = list->next;
+		list = abbreviation_end(list, scratch)->next;
 	}
 }
 
@@ -206,12 +206,13 @@ void print_lyxbeamer_node(GString *out, node *n, scratch_pad *scratch, bool no_n
 /* print_beamer_endnotes */
 void print_lyxbeamer_endnotes(GString *out, scratch_pad *scratch) {
 	node *temp_node;
-	scratch->used_notes = reverse_list(scratch->used_notes);
-	node *note = scratch->used_notes;
+	int count = scratch->used_note_count;
+	int i;
+	node *note;
 
     	    // Handle Glossary
-    temp_node = note;
-    while (temp_node != NULL){
+    for (i = 1; i <= count; i++){
+    	temp_node = note_for_number(i, scratch);
     	if(temp_node->key == GLOSSARYSOURCE){
     	g_string_append(out, "\n\\begin_layout BeginFrame\nGlossary\n");
     	g_string_append(out,"\n\\begin_layout Standard");
@@ -225,24 +226,18 @@ void print_lyxbeamer_endnotes(GString *out, scratch_pad *scratch) {
 		g_string_append(out, "\n\\end_layout");
     	break;
         }
-		temp_node = temp_node->next;
 	}
 
-	if (note == NULL)
-		return;
-	
-	note = scratch->used_notes;
-	
-	if (tree_contains_key(note,CITATIONSOURCE)){
-	   g_string_append(out, "\n\\begin_layout BeginFrame\nReferences\n");
-	   g_string_append(out, "\n\\end_layout");
-    }
-	while ( note != NULL) {
-		if (note->key == KEY_COUNTER) {
-			note = note->next;
-			continue;
+	for (i = 1; i <= count; i++) {
+		if (note_for_number(i, scratch)->key == CITATIONSOURCE){
+		   g_string_append(out, "\n\\begin_layout BeginFrame\nReferences\n");
+		   g_string_append(out, "\n\\end_layout");
+		   break;
 		}
-		
+	}
+
+	for (i = 1; i <= count; i++) {
+		note = note_for_number(i, scratch);
 		
 		if (note->key == CITATIONSOURCE) {
 			g_string_append(out, "\n\\begin_layout Bibliography\n");
@@ -256,8 +251,6 @@ void print_lyxbeamer_endnotes(GString *out, scratch_pad *scratch) {
 		} else {
 			/* footnotes handled elsewhere */
 		}
-
-		note = note->next;
 	}
 	g_string_append(out, "\n\\begin_layout EndFrame"); // close last frame
 	g_string_append(out, "\n\\end_layout");
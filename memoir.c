@@ -21,12 +21,13 @@
 void print_memoir_node_tree(GString *out, node *list, scratch_pad *scratch) {
 	while (list != NULL) {
 		print_memoir_node(out, list, scratch);
-		list = list->next;
+		list = abbreviation_end(list, scratch)->next;
 	}
 }
 
 /* print_memoir_node -- convert given node to LaTeX and append */
 void print_memoir_node(GString *out, node *n, scratch_pad *scratch) {
+	char *temp;
 
 	/* If we are forcing a complete document, and METADATA isn't the first thing,
 		we need to close <head> */
@@ -41,14 +42,16 @@ void print_memoir_node(GString *out, node *n, scratch_pad *scratch) {
 		case VERBATIMFENCE:
 			pad(out, 2, scratch);
 			if ((n->children != NULL) && (n->children->key == VERBATIMTYPE)) {
-				trim_trailing_whitespace(n->children->str);
-				if (strlen(n->children->str) > 0) {
-					g_string_append_printf(out, "\\begin{adjustwidth}{2.5em}{2.5em}\n\\begin{lstlisting}[language=%s]\n", n->children->str);
+				temp = trimmed_string(n->children->str);
+				if (strlen(temp) > 0) {
+					g_string_append_printf(out, "\\begin{adjustwidth}{2.5em}{2.5em}\n\\begin{lstlisting}[language=%s]\n", temp);
 					print_raw_node(out, n);
 					g_string_append_printf(out, "\n\\end{lstlisting}\n\\end{adjustwidth}");					
 					scratch->padded = 0;
+					free(temp);
 					break;
 				}
+				free(temp);
 			}
 			g_string_append_printf(out, "\\begin{adjustwidth}{2.5em}{2.5em}\n\\begin{verbatim}\n\n");
 			print_raw_node(out, n);
@@ -44,6 +44,10 @@ int main(int argc, char **argv)
 	static int no_obfuscate_flag = 0;
 	static int process_html_flag = 0;
 	static int random_footnotes_flag = 0;
+	static int memoize_flag = 0;
+	static int parse_stats_flag = 0;
+	static int delimiter_emph_flag = 0;
+	static int no_arena_flag = 0;
 	bool list_meta_keys = 0;
 	bool list_transclude_manifest = 0;
 	char *target_meta_key = FALSE;
@@ -66,6 +70,10 @@ int main(int argc, char **argv)
 		{"compatibility", no_argument, &compatibility_flag, 1},              /* compatibility mode */
 		{"process-html", no_argument, &process_html_flag, 1},                /* process Markdown inside HTML */
 		{"random", no_argument, &random_footnotes_flag, 1},                  /* Use random numbers for footnote links */
+		{"memoize", no_argument, &memoize_flag, 1},                          /* Remember failed rule attempts */
+		{"parse-stats", no_argument, &parse_stats_flag, 1},                  /* Report parser context reuse and rule attempts */
+		{"delimiter-emph", no_argument, &delimiter_emph_flag, 1},            /* Linear time emphasis matching */
+		{"no-arena", no_argument, &no_arena_flag, 1},                        /* malloc each tree node (for comparison) */
 		{"accept", no_argument, 0, 'a'},                                     /* Accept all proposed CriticMarkup changes */
 		{"reject", no_argument, 0, 'r'},                                     /* Reject all proposed CriticMarkup changes */
 		{"metadata-keys", no_argument, 0, 'm'},                              /* List all metadata keys */
@@ -142,6 +150,11 @@ int main(int argc, char **argv)
 				"    -e, --extract          Extract specified metadata\n"
 				"    -x, --manifest         Show manifest of all transcluded files\n"
 				"    --random               Use random numbers for footnote anchors\n"
+				"    --memoize              Speed up pathological documents (uses more memory)\n"
+				"    --parse-stats          Report parser allocations and rule attempts on stderr\n"
+				"    --delimiter-emph       Match emphasis in one pass (faster on heavy use,\n"
+				"                           with CommonMark's rules for the edge cases)\n"
+				"    --no-arena             Allocate tree nodes one at a time (for comparison)\n"
 				"\n"
 				"    -a, --accept           Accept all CriticMarkup changes\n"
 				"    -r, --reject           Reject all CriticMarkup changes\n"
@@ -268,6 +281,15 @@ int main(int argc, char **argv)
 	if (escaped_line_breaks_flag)
 		extensions = extensions | EXT_ESCAPED_LINE_BREAKS;
 
+	if (memoize_flag)
+		extensions = extensions | EXT_MEMOIZE;
+
+	if (delimiter_emph_flag)
+		extensions = extensions | EXT_DELIMITER_EMPH;
+
+	if (no_arena_flag)
+		extensions = extensions | EXT_NO_ARENA;
+
 	/* Enable HEADINGSECTION for certain formats */
 	if ((output_format == OPML_FORMAT) || (output_format == BEAMER_FORMAT) || (output_format == LYX_FORMAT))
 		extensions = extensions | EXT_HEADINGSECTION;
@@ -514,5 +536,34 @@ int main(int argc, char **argv)
 			free(out);
 	}
 	
+	/* This thread's rule counts are only added to the totals here */
+	release_parser_contexts();
+
+	if (parse_stats_flag) {
+		unsigned long created, reused, allocations;
+		unsigned long tried, skipped, failures;
+		unsigned long heap, arena, chunks;
+		int rule;
+
+#ifndef MMD_PARSE_STATS
+		fprintf(stderr, "parser statistics are only counted in a build with -DMMD_PARSE_STATS\n");
+#endif
+		parser_context_stats(&created, &reused, &allocations);
+		fprintf(stderr, "parser contexts: %lu created, %lu reused; greg allocations: %lu\n",
+			created, reused, allocations);
+
+		parser_node_stats(&heap, &arena, &chunks);
+		fprintf(stderr, "tree records: %lu malloc'd, %lu from %lu arena chunks\n",
+			heap, arena, chunks);
+
+		fprintf(stderr, "%-20s %12s %12s %12s\n", "alternative", "tried", "skipped", "failed");
+		for (rule = 0; rule < DISPATCH_RULE_COUNT; rule++) {
+			parser_rule_stats(rule, &tried, &skipped, &failures);
+			if (tried > 0)
+				fprintf(stderr, "%-20s %12lu %12lu %12lu\n", dispatch_rule_name(rule),
+					tried, skipped, failures);
+		}
+	}
+
 	return(EXIT_SUCCESS);
 }
@@ -76,7 +76,7 @@ void print_odf_node(GString *out, node *n, scratch_pad *scratch) {
 			scratch->extensions = scratch->extensions | EXT_HEAD_CLOSED;
 		}
 	
-	switch (n->key) {
+	switch (node_key(n, scratch)) {
 		case NO_TYPE:
 		case ABBREVIATION:
 			break;
@@ -143,8 +143,7 @@ void print_odf_node(GString *out, node *n, scratch_pad *scratch) {
 			if (strncmp(n->str,"<!--",4) == 0) {
 				pad(out, 2, scratch);
 				/* trim "-->" from end */
-				n->str[strlen(n->str)-3] = '\0';
-				g_string_append_printf(out, "<text:p text:style-name=\"Standard\">%s</text:p>", &n->str[4]);
+				g_string_append_printf(out, "<text:p text:style-name=\"Standard\">%.*s</text:p>", (int) strlen(n->str) - 7, &n->str[4]);
 				scratch->padded = 0;
 			}
 			break;
@@ -232,7 +231,7 @@ void print_odf_node(GString *out, node *n, scratch_pad *scratch) {
 			scratch->extensions = scratch->extensions | EXT_HEAD_CLOSED;
 			print_odf_node_tree(out, n->children, scratch);
 			g_string_append_printf(out, "</office:meta>\n");
-			temp_node = metadata_for_key("odfheader", n);
+			temp_node = dict_metadata_for_key("odfheader", scratch->metadata);
 			if (temp_node != NULL) {
 				print_raw_node(out, temp_node->children);
 			}
@@ -280,8 +279,9 @@ void print_odf_node(GString *out, node *n, scratch_pad *scratch) {
 			free(temp);
 			break;
 		case METAVALUE:
-			trim_trailing_whitespace(n->str);
-			print_odf_string(out,n->str);
+			temp = trimmed_string(n->str);
+			print_odf_string(out,temp);
+			free(temp);
 			break;
 		case FOOTER:
 			break;
@@ -364,19 +364,14 @@ void print_odf_node(GString *out, node *n, scratch_pad *scratch) {
 #ifdef DEBUG_ON
 	fprintf(stderr, "print odf link: '%s'\n",n->str);
 #endif
-			/* Stash a copy of the link data */
-			if (n->link_data != NULL)
-				temp_link_data = mk_link_data(n->link_data->label, n->link_data->source, n->link_data->title, n->link_data->attr);
+			/* Reference links print with the definition's link_data
+				(borrowed from scratch) in place of the node's own */
+			temp_link_data = n->link_data;
+			temp = NULL;
 
 			/* Do we have proper info? */
-			if (n->link_data == NULL) {
-				/* NULL link_data could occur if we parsed this link before and it didn't
-					match anything */
-				n->link_data =  mk_link_data(NULL, NULL, NULL, NULL);
-			}
-			
-			if ((n->link_data->label == NULL) &&
-			(n->link_data->source == NULL)) {
+			if ((temp_link_data == NULL) || ((temp_link_data->label == NULL) &&
+			(temp_link_data->source == NULL))) {
 #ifdef DEBUG_ON
 	fprintf(stderr, "print odf link: '%s'\n",n->str);
 #endif
@@ -384,22 +379,21 @@ void print_odf_node(GString *out, node *n, scratch_pad *scratch) {
 				/* so load a label */
 				temp_str = g_string_new("");
 				print_raw_node_tree(temp_str, n->children);
-				free(n->link_data->label);
-				n->link_data->label = temp_str->str;
+				temp = temp_str->str;
 				g_string_free(temp_str, FALSE);
+			} else if (temp_link_data->label != NULL) {
+				temp = strdup(temp_link_data->label);
 			}
 #ifdef DEBUG_ON
 	fprintf(stderr, "look for reference data for odf link: '%s'\n",n->str);
 #endif
 			/* Load reference data */
-			if (n->link_data->label != NULL) {
+			if (temp != NULL) {
 #ifdef DEBUG_ON
 	fprintf(stderr, "have label for odf link: '%s'\n",n->str);
 #endif
-				temp = strdup(n->link_data->label);
-				free_link_data(n->link_data);
-				n->link_data = extract_link_data(temp, scratch);
-				if (n->link_data == NULL) {
+				temp_link_data = find_link_data(temp, scratch);
+				if (temp_link_data == NULL) {
 					/* replace original text since no definition found */
 					g_string_append_printf(out, "[");
 					print_odf_node(out, n->children, scratch);
@@ -417,9 +411,6 @@ void print_odf_node(GString *out, node *n, scratch_pad *scratch) {
 
 					free(temp);
 
-					/* Restore stashed copy */
-					n->link_data = temp_link_data;
-
 					break;
 				}
 				free(temp);
@@ -428,27 +419,22 @@ void print_odf_node(GString *out, node *n, scratch_pad *scratch) {
 	fprintf(stderr, "got link data for odf link: '%s'\n",n->str);
 #endif
 			g_string_append_printf(out, "<text:a xlink:type=\"simple\"");
-			if (n->link_data->source != NULL) {
+			if (temp_link_data->source != NULL) {
 				g_string_append_printf(out, " xlink:href=\"");
-				print_html_string(out,n->link_data->source, scratch);
+				print_html_string(out,temp_link_data->source, scratch);
 				g_string_append_printf(out, "\"");
 			}
-			if ((n->link_data->title != NULL) && (strlen(n->link_data->title) > 0)) {
+			if ((temp_link_data->title != NULL) && (strlen(temp_link_data->title) > 0)) {
 				g_string_append_printf(out, " office:name=\"");
-				print_html_string(out, n->link_data->title, scratch);
+				print_html_string(out, temp_link_data->title, scratch);
 				g_string_append_printf(out, "\"");
 			}
-			print_odf_node_tree(out, n->link_data->attr, scratch);
+			print_odf_node_tree(out, temp_link_data->attr, scratch);
 			g_string_append_printf(out, ">");
 			if (n->children != NULL)
 				print_odf_node_tree(out,n->children,scratch);
 			g_string_append_printf(out, "</text:a>");
 
-			/* Restore stashed copy */
-			n->link_data->attr = NULL;
-			free_link_data(n->link_data);
-			n->link_data = temp_link_data;
-
 			break;
 		case ATTRKEY:
 			if ( (strcmp(n->str,"height") == 0) || (strcmp(n->str, "width") == 0)) {
@@ -464,38 +450,35 @@ void print_odf_node(GString *out, node *n, scratch_pad *scratch) {
 #ifdef DEBUG_ON
 	fprintf(stderr, "print image\n");
 #endif
-			/* Stash a copy of the link data */
-			if (n->link_data != NULL)
-				temp_link_data = mk_link_data(n->link_data->label, n->link_data->source, n->link_data->title, n->link_data->attr);
+			/* As for links, borrow the definition's link_data */
+			temp_link_data = n->link_data;
+			temp = NULL;
 
 			if (n->key == IMAGEBLOCK)
 				g_string_append_printf(out, "<text:p>\n");
 			/* Do we have proper info? */
-			if ((n->link_data->label == NULL) &&
-			(n->link_data->source == NULL)) {
+			if ((temp_link_data->label == NULL) &&
+			(temp_link_data->source == NULL)) {
 				/* we seem to be a [foo][] style link */
 				/* so load a label */
 				temp_str = g_string_new("");
 				print_raw_node_tree(temp_str, n->children);
-				n->link_data->label = temp_str->str;
+				temp = temp_str->str;
 				g_string_free(temp_str, FALSE);
+			} else if (temp_link_data->label != NULL) {
+				temp = strdup(temp_link_data->label);
 			}
 #ifdef DEBUG_ON
 	fprintf(stderr, "load reference data\n");
 #endif
 			/* Load reference data */
-			if (n->link_data->label != NULL) {
-				temp = strdup(n->link_data->label);
-				free_link_data(n->link_data);
-				n->link_data = extract_link_data(temp, scratch);
-				if (n->link_data == NULL) {
+			if (temp != NULL) {
+				temp_link_data = find_link_data(temp, scratch);
+				if (temp_link_data == NULL) {
 					g_string_append_printf(out, "![");
 					print_html_node_tree(out, n->children, scratch);
 					g_string_append_printf(out,"][%s]",temp);
 
-					/* Restore stashed copy */
-					n->link_data = temp_link_data;
-
 					free(temp);
 					
 					break;
@@ -507,11 +490,11 @@ void print_odf_node(GString *out, node *n, scratch_pad *scratch) {
 #endif
 			g_string_append_printf(out, "<draw:frame text:anchor-type=\"as-char\"\ndraw:z-index=\"0\" draw:style-name=\"fr1\" ");
 
-			if (n->link_data->attr != NULL) {
-				temp_node = node_for_attribute("height",n->link_data->attr);
+			if (temp_link_data->attr != NULL) {
+				temp_node = node_for_attribute("height",temp_link_data->attr);
 				if (temp_node != NULL)
 					height = correct_dimension_units(temp_node->children->str);
-				temp_node = node_for_attribute("width",n->link_data->attr);
+				temp_node = node_for_attribute("width",temp_link_data->attr);
 				if (temp_node != NULL)
 					width = correct_dimension_units(temp_node->children->str);
 			}
@@ -528,8 +511,8 @@ void print_odf_node(GString *out, node *n, scratch_pad *scratch) {
 				g_string_append_printf(out, "svg:width=\"%s\"\n", width);
 			}
 			
-			if (n->link_data->source != NULL)
-				g_string_append_printf(out, "><draw:image xlink:href=\"%s\"",n->link_data->source);
+			if (temp_link_data->source != NULL)
+				g_string_append_printf(out, "><draw:image xlink:href=\"%s\"",temp_link_data->source);
 
 			g_string_append_printf(out," xlink:type=\"simple\" xlink:show=\"embed\" xlink:actuate=\"onLoad\" draw:filter-name=\"&lt;All formats&gt;\"/>\n</draw:frame></text:p>");
 
@@ -550,11 +533,6 @@ void print_odf_node(GString *out, node *n, scratch_pad *scratch) {
 			}
 			scratch->padded = 1;
 
-			/* Restore stashed copy */
-			n->link_data->attr = NULL;
-			free_link_data(n->link_data);
-			n->link_data = temp_link_data;
-			
 			free(height);
 			free(width);
 			
@@ -566,7 +544,7 @@ void print_odf_node(GString *out, node *n, scratch_pad *scratch) {
 			old_type = scratch->odf_para_type;
 			scratch->odf_para_type = NOTEREFERENCE;
 			lev = note_number_for_node(n, scratch);
-			temp_node = node_for_count(scratch->used_notes, lev);
+			temp_node = note_for_number(lev, scratch);
 			scratch->padded = 2;
 			scratch->printing_notes = 1;
 			if (temp_node->key == GLOSSARYSOURCE) {
@@ -607,7 +585,7 @@ void print_odf_node(GString *out, node *n, scratch_pad *scratch) {
 #ifdef DEBUG_ON
 					fprintf(stderr, "matching cite found - %d\n", lev);
 #endif
-					temp_node = node_for_count(scratch->used_notes, lev);
+					temp_node = note_for_number(lev, scratch);
 					/* flag that this is used as a citation */
 					temp_node->key = CITATIONSOURCE;
 					if (lev > scratch->max_footnote_num) {
@@ -618,7 +596,7 @@ void print_odf_node(GString *out, node *n, scratch_pad *scratch) {
 						scratch->odf_para_type = CITATION;
 						
 						/* change to represent cite count only */
-						lev = cite_count_node_from_end(temp_node);
+						lev = cite_number_for_note(lev, scratch);
 						g_string_append_printf(out, "<text:note text:id=\"cite%d\" text:note-class=\"endnote\"><text:note-body>\n", lev);
 						scratch->padded = 2;
 						if (temp_node->children != NULL) {
@@ -633,7 +611,7 @@ void print_odf_node(GString *out, node *n, scratch_pad *scratch) {
 					fprintf(stderr, "link to existing cite %d\n", lev);
 #endif
 						/* Change lev to represent cite count only */
-						lev = cite_count_node_from_end(temp_node);
+						lev = cite_number_for_note(lev, scratch);
 #ifdef DEBUG_ON
 					fprintf(stderr, "renumbered to %d\n", lev);
 #endif
@@ -666,12 +644,11 @@ void print_odf_node(GString *out, node *n, scratch_pad *scratch) {
 #endif
 			break;
 		case VARIABLE:
-			temp = metavalue_for_key(n->str,scratch->result_tree);
+			temp = dict_metavalue_for_key(n->str, scratch->metadata);
 			if (temp == NULL) {
 				g_string_append_printf(out, "[%%%s]",n->str);
 			} else {
 				print_odf_string(out, temp);
-				free(temp);
 			}
 			break;
 		case GLOSSARYTERM:
@@ -706,8 +683,7 @@ void print_odf_node(GString *out, node *n, scratch_pad *scratch) {
 			/* but do print HTML comments for raw ODF */
 			if (strncmp(n->str,"<!--",4) == 0) {
 				/* trim "-->" from end */
-				n->str[strlen(n->str)-3] = '\0';
-				g_string_append_printf(out, "%s", &n->str[4]);
+				g_string_append_printf(out, "%.*s", (int) strlen(n->str) - 7, &n->str[4]);
 			}
 			break;
 		case DEFLIST:
@@ -839,7 +815,7 @@ void print_odf_node(GString *out, node *n, scratch_pad *scratch) {
 		case KEY_COUNTER:
 			break;
 		case TOC:
-			print_odf_node_tree(out,n->children, scratch);
+			print_odf_node_tree(out,scratch->toc, scratch);
 			break;
 		default:
 			fprintf(stderr, "print_odf_node encountered unknown node key = %d\n",n->key);
@@ -26,20 +26,18 @@ void begin_opml_output(GString *out, node* list, scratch_pad *scratch) {
 	
 	g_string_append_printf(out, "<?xml version=\"1.0\" encoding=\"utf-8\"?>\n<opml version=\"1.0\">\n");
 	
-	if (tree_contains_key(list, METAKEY)) {
-		title = metadata_for_key("title", list);
-		if (title != NULL) {
-			char *temp_str;
-			GString *temp = g_string_new("");
-			g_string_append_printf(out, "<head><title>");
-			print_raw_node_tree(temp, title->children);
-			temp_str = strdup(temp->str);
-			trim_trailing_whitespace(temp_str);
-			print_opml_string(out, temp_str);
-			g_string_append_printf(out, "</title></head>\n",temp_str);
-			free(temp_str);
-			g_string_free(temp, true);
-		}
+	title = dict_metadata_for_key("title", scratch->metadata);
+	if (title != NULL) {
+		char *temp_str;
+		GString *temp = g_string_new("");
+		g_string_append_printf(out, "<head><title>");
+		print_raw_node_tree(temp, title->children);
+		temp_str = strdup(temp->str);
+		trim_trailing_whitespace(temp_str);
+		print_opml_string(out, temp_str);
+		g_string_append_printf(out, "</title></head>\n",temp_str);
+		free(temp_str);
+		g_string_free(temp, true);
 	}
 	g_string_append_printf(out, "<body>\n");
 }
@@ -102,6 +100,8 @@ void print_opml_section_and_children(GString *out, node *list, scratch_pad *scra
 
 /* print_opml_node -- convert given node to OPML and append */
 void print_opml_node(GString *out, node *n, scratch_pad *scratch) {
+	char *temp;
+
 #ifdef DEBUG_ON
 	fprintf(stderr, "print_opml_node: %d\n",n->key);
 #endif
@@ -113,8 +113,10 @@ void print_opml_node(GString *out, node *n, scratch_pad *scratch) {
 			g_string_append_printf(out, "<outline text=\"");
 			print_opml_string(out, n->str);
 			g_string_append_printf(out, "\" _note=\"");
-			trim_trailing_newlines(n->children->str);
-			print_opml_string(out, n->children->str);
+			temp = strdup(n->children->str);
+			trim_trailing_newlines(temp);
+			print_opml_string(out, temp);
+			free(temp);
 			g_string_append_printf(out, "\"/>");
 			break;
 		case HEADINGSECTION:
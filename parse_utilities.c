@@ -21,13 +21,229 @@
 
 #include "parser.h"
 #include <libgen.h>
+#include <ctype.h>
+
+#ifndef MMD_NO_THREADS
+#include <pthread.h>
+#endif
+
+#pragma mark - Arena
+
+/* A conversion builds its tree from many small nodes and link_data records,
+	and they all go away together at the end. While an arena is in use on a
+	thread, mk_node() and mk_link_data() carve records out of big chunks,
+	freeing one just puts it on a free list, and free_node_arena() releases
+	the chunks. The text of those nodes (mk_str and friends -- most of it
+	slices of the source) is copied in there too, so it costs no malloc or
+	free of its own; anything that swaps a node's str for another must use
+	set_node_str(). Link labels and URLs stay on the heap, since the writers
+	replace and free those in place.
+
+	Every record starts with the arena it came from (NULL for malloc), so
+	trees can mix the two: the parallel workers and read_metadata() make
+	ordinary heap records. A record must not outlive its arena */
+
+#define ARENA_FIRST_CHUNK  (64 * 1024)
+#define ARENA_MAX_CHUNK    (4 * 1024 * 1024)
+
+enum arena_record_kinds {
+	NODE_RECORD,
+	LINK_RECORD,
+	RECORD_KINDS
+};
+
+typedef struct arena_chunk {
+	struct arena_chunk *next;
+	size_t              size;
+	size_t              used;
+	void               *align;      /* Pads this to 32 bytes, keeping records aligned */
+} arena_chunk;
+
+#define RECORD_ARENA_STR   0x1      /* The node's str is in the arena too */
+
+typedef struct record_header {
+	node_arena           *arena;
+	unsigned long         flags;    /* RECORD_* bits (also keeps 16 byte alignment) */
+} record_header;
+
+struct node_arena {
+	arena_chunk        *chunks;
+	record_header      *free[RECORD_KINDS];    /* Linked through the records */
+	unsigned long       records;
+	unsigned long       chunk_count;
+};
+
+#ifdef MMD_NO_THREADS
+static node_arena *current_arena;
+#else
+static __thread node_arena *current_arena;
+#endif
+
+static unsigned long heap_records = 0;
+static unsigned long arena_records = 0;
+static unsigned long arena_chunks = 0;
+
+/* Only counted in a build with -DMMD_PARSE_STATS (see parser_node_stats) */
+#ifndef MMD_PARSE_STATS
+#define count_records(x, n)
+#elif defined(MMD_NO_THREADS)
+#define count_records(x, n)  ((*(x)) += (n))
+#else
+#define count_records(x, n)  __sync_fetch_and_add((x), (n))
+#endif
+
+/* mk_node_arena -- an empty arena (chunks are added as needed) */
+node_arena * mk_node_arena(void) {
+	return calloc(1, sizeof(node_arena));
+}
+
+/* use_node_arena -- allocate this thread's records from arena (NULL for the
+	heap) until further notice; returns the arena that was in use */
+node_arena * use_node_arena(node_arena *arena) {
+	node_arena *previous = current_arena;
+
+	current_arena = arena;
+	return previous;
+}
+
+/* free_node_arena -- release everything allocated from arena at once */
+void free_node_arena(node_arena *arena) {
+	arena_chunk *chunk;
+
+	if (arena == NULL)
+		return;
+
+	if (current_arena == arena)
+		current_arena = NULL;
+
+	while (arena->chunks != NULL) {
+		chunk = arena->chunks;
+		arena->chunks = chunk->next;
+		free(chunk);
+	}
+
+	count_records(&arena_records, arena->records);
+	count_records(&arena_chunks, arena->chunk_count);
+	free(arena);
+}
+
+/* parser_node_stats -- how tree records were allocated so far */
+void parser_node_stats(unsigned long *heap, unsigned long *arena, unsigned long *chunks) {
+	*heap = heap_records;
+	*arena = arena_records;
+	*chunks = arena_chunks;
+}
+
+static void * arena_alloc(node_arena *arena, size_t size) {
+	arena_chunk *chunk = arena->chunks;
+	size_t chunk_size;
+	void *result;
+
+	size = (size + sizeof(void *) - 1) & ~(sizeof(void *) - 1);
+
+	if ((chunk == NULL) || (chunk->used + size > chunk->size)) {
+		chunk_size = (chunk == NULL) ? ARENA_FIRST_CHUNK : chunk->size * 2;
+		if (chunk_size > ARENA_MAX_CHUNK)
+			chunk_size = ARENA_MAX_CHUNK;
+		if (chunk_size < size)
+			chunk_size = size;
+
+		chunk = malloc(sizeof(arena_chunk) + chunk_size);
+		chunk->next = arena->chunks;
+		chunk->size = chunk_size;
+		chunk->used = 0;
+		arena->chunks = chunk;
+		arena->chunk_count++;
+	}
+
+	result = (char *)(chunk + 1) + chunk->used;
+	chunk->used += size;
+	return result;
+}
+
+/* new_record -- room for a node or link_data, from the thread's arena if
+	it has one */
+static void * new_record(int kind, size_t size) {
+	node_arena *arena = current_arena;
+	record_header *header;
+
+	if (arena == NULL) {
+		header = malloc(sizeof(record_header) + size);
+		count_records(&heap_records, 1);
+	} else if (arena->free[kind] != NULL) {
+		header = arena->free[kind];
+		arena->free[kind] = *(record_header **)(header + 1);
+	} else {
+		header = arena_alloc(arena, sizeof(record_header) + size);
+		arena->records++;
+	}
+
+	header->arena = arena;
+	header->flags = 0;
+	return header + 1;
+}
+
+static void free_record(int kind, void *record) {
+	record_header *header = (record_header *) record - 1;
+
+	if (header->arena == NULL) {
+		free(header);
+	} else if (header->arena == current_arena) {
+		*(record_header **) record = current_arena->free[kind];
+		current_arena->free[kind] = header;
+	}
+	/* Otherwise it goes when its arena does */
+}
+
+/* node_text -- a copy of length bytes of text to be n's str, kept in n's
+	arena when it has one */
+static char * node_text(node *n, const char *text, size_t length) {
+	record_header *header = (record_header *) n - 1;
+	char *result;
+
+	if (header->arena == NULL) {
+		result = malloc(length + 1);
+	} else {
+		result = arena_alloc(header->arena, length + 1);
+		header->flags |= RECORD_ARENA_STR;
+	}
+
+	memcpy(result, text, length);
+	result[length] = '\0';
+	return result;
+}
+
+/* set_node_str -- replace n's str with str (a malloc'd string, which n now
+	owns, or NULL), freeing the old one if it was n's to free */
+void set_node_str(node *n, char *str) {
+	record_header *header = (record_header *) n - 1;
+
+	if (!(header->flags & RECORD_ARENA_STR))
+		free(n->str);
+
+	header->flags &= ~RECORD_ARENA_STR;
+	n->str = str;
+}
 
 #pragma mark - Parse Tree
 
+/* Grow the range of n to include that of part */
+static void widen_position(node *n, node *part) {
+	if (!has_position(part))
+		return;
+
+	if (!has_position(n) || (part->start < n->start))
+		n->start = part->start;
+	if (part->stop > n->stop)
+		n->stop = part->stop;
+}
+
 /* Create a new node in the parse tree */
 node * mk_node(int key) {
-	node *result = (node *) malloc(sizeof(node));
+	node *result = new_record(NODE_RECORD, sizeof(node));
 	result->key = key;
+	result->start = 0;
+	result->stop = 0;
 	result->str = NULL;
 	result->children = NULL;
 	result->next = NULL;
@@ -39,16 +255,21 @@ node * mk_node(int key) {
 node * mk_str(char *string) {
 	node *result = mk_node(STR);
 	assert(string != NULL);
-	result->str = strdup(string);
+	result->str = node_text(result, string, strlen(string));
 	return result;
 }
 
-/* mk_str_from_list - merge list into a STR */
+/* mk_str_from_list - merge list (built with add_node) into a STR */
 node * mk_str_from_list(node *list, bool extra_newline) {
 	node *result = mk_node(STR);
-	node *rev = reverse_list(list);
+	node *pieces = close_list(list);
+	node *step;
+
+	/* Cover the range of the pieces we're merging */
+	for (step = pieces; step != NULL; step = step->next)
+		widen_position(result, step);
 	
-	GString *c = concat_string_list(rev);
+	GString *c = concat_string_list(pieces);
 	if (extra_newline)
 		g_string_append(c, "\n");
 
@@ -95,45 +316,76 @@ GString * concat_string_list(node *list) {
 	return result;
 }
 
-/* Create a node that is basically a parent for other elements */
+/* Create a node that is basically a parent for other elements (list is
+	built with add_node) */
 node * mk_list(int key, node *list) {
 	node *result;
 	result = mk_node(key);
-	result->children = reverse_list(list);
+	result->children = close_list(list);
 	return result;
 }
 	
 /* Create a new node with position information */
-node * mk_pos_node(int key, char *string, unsigned int start, unsigned int stop) {
+node * mk_pos_node(int key, char *string, size_t start, size_t stop) {
 	node *result = mk_node(key);
 	if (string != NULL)
-		result->str = strdup(string);
-	
+		result->str = node_text(result, string, strlen(string));
+
+	result->start = start;
+	result->stop = stop;
 	return result;
 }
 
 /* Create a new string node with position information */
-node * mk_pos_str(char *string, unsigned int start, unsigned int stop) {
+node * mk_pos_str(char *string, size_t start, size_t stop) {
 	node *result = mk_str(string);
-	
+
+	result->start = start;
+	result->stop = stop;
 	return result;
 }
 
-/* Create a new list node with position information */
-node * mk_pos_list(int key, node *list, unsigned int start, unsigned int stop) {
+/* Create a new list node with position information -- greg's begin/end are
+	from the most recent capture, so widen them to cover the children */
+node * mk_pos_list(int key, node *list, size_t start, size_t stop) {
 	node *result = mk_list(key, list);
-	
+	node *step;
+
+	result->start = start;
+	result->stop = stop;
+
+	for (step = result->children; step != NULL; step = step->next)
+		widen_position(result, step);
+
 	return result;
 }
 
+/* Nodes created without a position are left at 0, 0 */
+bool has_position(node *n) {
+	return (n->start != 0) || (n->stop != 0);
+}
+
+/* fill_node_positions -- give container nodes built with mk_node/mk_list
+	(links, list items, etc.) the range covered by their children */
+void fill_node_positions(node *n) {
+	node *child;
+
+	while (n != NULL) {
+		fill_node_positions(n->children);
+
+		for (child = n->children; child != NULL; child = child->next)
+			widen_position(n, child);
+
+		n = n->next;
+	}
+}
+
 /* free just the current node and children*/
 void free_node(node *n) {
 	if (n == NULL)
 		return;
 	
-	if (n->str != NULL)
-		free(n->str);
-	n->str = NULL;
+	set_node_str(n, NULL);
 
 	free_link_data(n->link_data);
 	n->link_data = NULL;
@@ -143,7 +395,7 @@ void free_node(node *n) {
 		n->children = NULL;
 	}
 	n->next = NULL;
-	free(n);
+	free_record(NODE_RECORD, n);
 }
 
 /* free element and it's descendents/siblings */
@@ -180,6 +432,70 @@ node * cons(node *new, node *list) {
 	return list;
 }
 
+/*
+	The grammar builds lists front to back: it holds on to the last node,
+	whose next points round to the first, so adding at either end is as
+	cheap as cons and the finished list doesn't have to be reversed. An
+	empty list is NULL. mk_list() and friends take lists in this form and
+	close_list() turns one into an ordinary list.
+*/
+
+/* add_node -- add new (a single node) to the end of list; returns the list */
+node * add_node(node *list, node *new) {
+	if (new == NULL)
+		return list;
+
+	if (list == NULL) {
+		new->next = new;
+	} else {
+		new->next = list->next;
+		list->next = new;
+	}
+	return new;
+}
+
+/* add_node_first -- add new (a single node) to the front of list */
+node * add_node_first(node *list, node *new) {
+	if (new == NULL)
+		return list;
+
+	if (list == NULL) {
+		new->next = new;
+		return new;
+	}
+
+	new->next = list->next;
+	list->next = new;
+	return list;
+}
+
+/* join_lists -- the nodes of front followed by those of back */
+node * join_lists(node *front, node *back) {
+	node *first;
+
+	if (front == NULL)
+		return back;
+	if (back == NULL)
+		return front;
+
+	first = front->next;
+	front->next = back->next;
+	back->next = first;
+	return back;
+}
+
+/* close_list -- turn a list built with add_node into an ordinary list */
+node * close_list(node *list) {
+	node *first;
+
+	if (list == NULL)
+		return NULL;
+
+	first = list->next;
+	list->next = NULL;
+	return first;
+}
+
 /* reverse -- reverse a list to get it back into proper order */
 node * reverse_list(node *list) {
 	node *new = NULL;
@@ -219,22 +535,935 @@ void append_list(node *new, node *list) {
 	}
 }
 
+#pragma mark - RAW Views
+
+/*
+	Container blocks (list items, blockquotes, definitions, notes) are parsed
+	twice: once to find their extent, and again for their contents with the
+	indents and '>' markers stripped. Rather than copy those contents into a
+	RAW string, a view RAW node (str == NULL) holds a list of pieces: spans of
+	the document (STR nodes with no str, just start and stop), and the bits of
+	literal text the grammar adds ("\n", "\001" block separators). The nested
+	parse then reads straight from the document.
+*/
+
+static bool is_span(node *n) {
+	return (n->key == STR) && (n->str == NULL);
+}
+
+static bool is_view(node *n) {
+	return (n->key == RAW) && (n->str == NULL);
+}
+
+/* A span of the document -- it has no text of its own */
+static node * mk_span(size_t start, size_t stop) {
+	node *result = mk_node(STR);
+	result->start = start;
+	result->stop = stop;
+	return result;
+}
+
+/* Literal text of known length (doesn't scan past len, unlike my_strndup) */
+static node * mk_literal(const char *text, size_t len) {
+	node *result = mk_node(STR);
+	result->str = node_text(result, text, len);
+	return result;
+}
+
+/* Add piece to the end of view; tail tracks the last piece. Adjoining spans
+	are merged, and empty pieces dropped */
+static void add_piece(node *view, node **tail, node *piece) {
+	piece->next = NULL;
+
+	if (is_span(piece)) {
+		if (piece->stop <= piece->start) {
+			free_node(piece);
+			return;
+		}
+		if ((*tail != NULL) && is_span(*tail) && ((*tail)->stop == piece->start)) {
+			(*tail)->stop = piece->stop;
+			widen_position(view, *tail);
+			free_node(piece);
+			return;
+		}
+		widen_position(view, piece);
+	} else if ((piece->str == NULL) || (piece->str[0] == '\0')) {
+		free_node(piece);
+		return;
+	} else {
+		piece->key = STR;
+		piece->start = piece->stop = 0;
+	}
+
+	if (*tail == NULL)
+		view->children = piece;
+	else
+		(*tail)->next = piece;
+	*tail = piece;
+}
+
+/* Add the pieces of a list to view, flattening any views inside it */
+static void add_pieces(node *view, node **tail, node *list) {
+	node *next;
+
+	while (list != NULL) {
+		next = list->next;
+		if (is_view(list)) {
+			add_pieces(view, tail, list->children);
+			list->children = NULL;
+			free_node(list);
+		} else {
+			add_piece(view, tail, list);
+		}
+		list = next;
+	}
+}
+
+/* Find the last piece starting at or before pos */
+static view_piece * find_piece(view_piece *view, size_t count, size_t pos) {
+	size_t low = 0;
+	size_t high = count;
+	size_t mid;
+
+	while (high - low > 1) {
+		mid = (low + high) / 2;
+		if (view[mid].input <= pos)
+			low = mid;
+		else
+			high = mid;
+	}
+
+	return &view[low];
+}
+
+/* mk_view -- a RAW node for the input from begin to end that refers back to
+	the document rather than copying it. Inside a nested parse the range is
+	cut up along the pieces being parsed */
+node * mk_view(parser_data *data, size_t begin, size_t end) {
+	node *result = mk_node(RAW);
+	node *tail = NULL;
+	view_piece *piece;
+	size_t from = begin + data->offset;
+	size_t to = end + data->offset;
+	size_t a, b;
+
+	if (data->view == NULL) {
+		add_piece(result, &tail, mk_span(from, to));
+		return result;
+	}
+
+	if (data->view_count == 0)
+		return result;
+
+	for (piece = find_piece(data->view, data->view_count, from);
+		(piece < data->view + data->view_count) && (piece->input < to); piece++) {
+		a = (from > piece->input) ? from - piece->input : 0;
+		b = (to < piece->input + piece->length) ? to - piece->input : piece->length;
+		if (b <= a)
+			continue;
+
+		if (piece->literal)
+			add_piece(result, &tail, mk_literal(piece->text + a, b - a));
+		else
+			add_piece(result, &tail, mk_span(piece->source + a, piece->source + b));
+	}
+
+	return result;
+}
+
+/* mk_raw_from_list -- merge list (built with add_node) into a RAW view;
+	the counterpart of mk_str_from_list for container contents */
+node * mk_raw_from_list(node *list, bool extra_newline) {
+	node *result = mk_node(RAW);
+	node *tail = NULL;
+
+	add_pieces(result, &tail, close_list(list));
+
+	if (extra_newline)
+		add_piece(result, &tail, mk_str("\n"));
+
+	return result;
+}
+
+/* Blank, apart from any blockquote markers */
+static bool blank_line(const char *line, size_t len) {
+	while (len-- > 0) {
+		if ((line[len] != ' ') && (line[len] != '>') && (line[len] != '\n') && (line[len] != '\r'))
+			return false;
+	}
+	return true;
+}
+
+/* raw_string_to_view -- turn a RAW block that was built as a string (HTML
+	blocks, inline notes) into a view. Indents and '>' are only
+	ever stripped from the front of a line, so a line that is the tail of
+	the next document line becomes a span; anything else stays literal */
+void raw_string_to_view(node *raw, const char *document) {
+	char *str = raw->str;
+	const char *line = str;
+	const char *literal = str;
+	const char *cursor = NULL;
+	const char *eol;
+	const char *doc_eol;
+	const char *tail;
+	node *last = NULL;
+	size_t len, doc_len, prefix;
+	bool first = true;
+
+	if (str == NULL)
+		return;
+
+	if (has_position(raw) && (document != NULL))
+		cursor = document + raw->start;
+
+	raw->start = raw->stop = 0;
+
+	while (*line != '\0') {
+		if (*line == '\001') {
+			/* Keep block separators as pieces of their own */
+			add_piece(raw, &last, mk_literal(literal, line - literal));
+			add_piece(raw, &last, mk_str("\001"));
+			literal = ++line;
+			continue;
+		}
+
+		for (eol = line; (*eol != '\0') && (*eol != '\n') && (*eol != '\001'); eol++);
+		if (*eol == '\n')
+			eol++;
+		len = eol - line;
+
+		if ((cursor != NULL) && (*cursor != '\0')) {
+			doc_eol = strchr(cursor, '\n');
+			doc_eol = (doc_eol == NULL) ? cursor + strlen(cursor) : doc_eol + 1;
+			doc_len = doc_eol - cursor;
+			tail = doc_eol - len;
+
+			prefix = 0;
+			if ((len <= doc_len) && (memcmp(tail, line, len) == 0)
+				&& (!blank_line(tail, len) || blank_line(cursor, doc_len))) {
+				prefix = len;
+			} else if (first) {
+				/* The block starts where the string does, but may not end
+					with the document line (e.g. inline notes) */
+				tail = cursor;
+				while ((prefix < len) && (prefix < doc_len) && (cursor[prefix] == line[prefix]))
+					prefix++;
+			}
+
+			if (prefix > 0) {
+				add_piece(raw, &last, mk_literal(literal, line - literal));
+				add_piece(raw, &last, mk_span(tail - document, tail - document + prefix));
+				literal = line + prefix;
+				cursor = doc_eol;
+			}
+		}
+
+		first = false;
+		line = eol;
+	}
+
+	add_piece(raw, &last, mk_literal(literal, line - literal));
+	set_node_str(raw, NULL);
+}
+
+/* mk_view_map -- lay the pieces of a view end to end, as the nested parser
+	will see them. Literals are placed where they were added (the end of the
+	span before them) so that positions inside them still make sense */
+view_piece * mk_view_map(node *pieces, const char *document, size_t *count) {
+	view_piece *map;
+	node *step;
+	size_t i, j;
+	size_t input = 0;
+	size_t anchor = 0;
+	bool placed = false;
+
+	*count = 0;
+	for (step = pieces; step != NULL; step = step->next)
+		(*count)++;
+
+	map = malloc((*count + 1) * sizeof(view_piece));
+
+	for (i = 0, step = pieces; step != NULL; i++, step = step->next) {
+		map[i].input = input;
+
+		if (is_span(step)) {
+			map[i].text    = document + step->start;
+			map[i].length  = step->stop - step->start;
+			map[i].source  = step->start;
+			map[i].literal = false;
+
+			/* Leading literals belong where the first span starts */
+			for (j = 0; !placed && (j < i); j++)
+				map[j].source = step->start;
+			placed = true;
+			anchor = step->stop;
+		} else {
+			map[i].text    = step->str;
+			map[i].length  = strlen(step->str);
+			map[i].source  = anchor;
+			map[i].literal = true;
+		}
+
+		input += map[i].length;
+	}
+
+	return map;
+}
+
+/* Translate a position in the nested input into the document; end positions
+	are exclusive, so look at the character before them */
+static size_t map_view_offset(view_piece *view, size_t count, size_t pos, bool end) {
+	view_piece *piece;
+	size_t offset;
+
+	if (end && (pos > 0))
+		pos--;
+	else
+		end = false;
+
+	piece = find_piece(view, count, pos);
+	if (piece->literal)
+		return piece->source;
+
+	offset = pos - piece->input;
+	if (offset >= piece->length)
+		offset = piece->length - end;
+
+	return piece->source + offset + end;
+}
+
+/* map_view_positions -- nodes parsed from a view have positions within the
+	nested input; translate tree into document positions. Views inside the
+	tree already refer to the document, so leave them be */
+void map_view_positions(node *tree, view_piece *view, size_t count) {
+	node *n;
+
+	if (count == 0)
+		return;
+
+	for (n = tree; n != NULL; n = n->next) {
+		if (is_view(n))
+			continue;
+
+		if (has_position(n)) {
+			if (n->stop > n->start) {
+				n->start = map_view_offset(view, count, n->start, false);
+				n->stop = map_view_offset(view, count, n->stop, true);
+				if (n->stop < n->start)
+					n->stop = n->start;
+			} else {
+				n->start = n->stop = map_view_offset(view, count, n->start, false);
+			}
+		}
+		map_view_positions(n->children, view, count);
+	}
+}
+
+#pragma mark - Emphasis
+
+/*
+	With EXT_DELIMITER_EMPH, runs of '*' and '_' are left in the tree as
+	EMPHDELIM nodes, and resolve_emphasis() pairs them up in a single pass
+	over each inline list. Potential openers are kept on a stack for each
+	character, so each delimiter is pushed and popped at most once, and
+	there's no nested parse of the emphasized text. A closer that finds no
+	opener leaves a floor for its kind, so the same openers aren't searched
+	again.
+
+	This follows the grammar on the common cases (***x*** is strong around
+	em, emphasis stops at the end of a line, an open '_' may end inside a
+	word), but it is a dialect of its own at the edges, where it takes
+	CommonMark's rules instead: a run must be left- or right-flanking to
+	open or close (so "*_test.rb and *-test.rb" stays text), the rule of 3
+	applies, code spans and escapes bind tighter than emphasis (a *b\*c*
+	is <em>b*c</em>), and emphasis never straddles the end of a list item
+*/
+
+#define NO_SLOT ((size_t) -1)
+
+typedef struct {
+	node  *n;
+	size_t prev;                /* Neighbours still in the list */
+	size_t next;
+	size_t below;               /* Next opener down the same stack */
+	size_t count;               /* Delimiter characters left */
+	size_t length;              /* ... and in the whole run (rule of 3) */
+	bool   open;
+	bool   close;
+} delimiter_slot;
+
+static bool emph_space(char c) {
+	return (c == ' ') || (c == '\t') || (c == '\n') || (c == '\r') || (c == '\0');
+}
+
+static bool emph_punct(char c) {
+	return ispunct((unsigned char) c);
+}
+
+/* The character at pos in what data parsed -- a view's pieces, with the
+	indents and '>' markers already gone, or else the document */
+static char input_char(parser_data *data, size_t pos) {
+	view_piece *piece;
+
+	if (data->view == NULL)
+		return data->document[pos];
+
+	if (data->view_count == 0)
+		return '\0';
+
+	piece = find_piece(data->view, data->view_count, pos);
+	if ((pos < piece->input) || (pos - piece->input >= piece->length))
+		return '\0';
+
+	return piece->text[pos - piece->input];
+}
+
+/* Can this run open and/or close emphasis? Decided by the characters on
+	either side of it in the input (CommonMark's flanking rules) */
+static void delimiter_flanking(delimiter_slot *d, parser_data *data) {
+	char before = 'a';
+	char after = 'a';
+	bool left, right;
+
+	if ((data != NULL) && (data->document != NULL) && has_position(d->n)) {
+		before = (d->n->start > 0) ? input_char(data, d->n->start - 1) : ' ';
+		after = input_char(data, d->n->stop);
+	}
+
+	left = !emph_space(after) &&
+		(!emph_punct(after) || emph_space(before) || emph_punct(before));
+	right = !emph_space(before) &&
+		(!emph_punct(before) || emph_space(after) || emph_punct(after));
+
+	/* No intraword emphasis starts with underscores, but like the grammar's
+		EmphUl an open one may end inside a word (_foo_bar_) */
+	d->open = left;
+	d->close = right;
+	if (d->n->str[0] == '_')
+		d->open = left && (!right || emph_punct(before));
+}
+
+/* CommonMark's rule of 3: if either run can both open and close, their
+	lengths mustn't add up to a multiple of 3, unless both lengths are */
+static bool can_pair(delimiter_slot *o, delimiter_slot *c) {
+	if (!o->close && !c->open)
+		return true;
+
+	return ((o->length + c->length) % 3 != 0) ||
+		((o->length % 3 == 0) && (c->length % 3 == 0));
+}
+
+/* The nearest opener from top down to lowest that c can pair with */
+static size_t find_opener(delimiter_slot *slots, size_t top, size_t lowest, delimiter_slot *c) {
+	size_t o;
+
+	for (o = top; (o != NO_SLOT) && (o >= lowest); o = slots[o].below) {
+		if (can_pair(&slots[o], c))
+			return o;
+	}
+
+	return NO_SLOT;
+}
+
+static void unlink_slot(delimiter_slot *slots, size_t i, size_t *head) {
+	if (slots[i].prev == NO_SLOT)
+		*head = slots[i].next;
+	else
+		slots[slots[i].prev].next = slots[i].next;
+
+	if (slots[i].next != NO_SLOT)
+		slots[slots[i].next].prev = slots[i].prev;
+
+	free_node(slots[i].n);
+	slots[i].n = NULL;
+}
+
+/* resolve_emphasis -- pair up the EMPHDELIM runs in list, wrapping what lies
+	between each pair in EMPH or STRONG; leftovers become plain text.
+	Positions in list must still be relative to what data parsed.
+	Returns the new head of the list */
+node * resolve_emphasis(node *list, parser_data *data) {
+	delimiter_slot *slots;
+	node *step;
+	node *wrap;
+	size_t count = 0;
+	size_t delimiters = 0;
+	size_t stack[2] = { NO_SLOT, NO_SLOT };    /* '*' and '_' openers */
+	size_t floors[2][3][2];                    /* By closer's kind, length % 3, open */
+	size_t *bottom;
+	size_t head = 0;
+	size_t used, i, k, o, c, w, use;
+	int which;
+
+	for (step = list; step != NULL; step = step->next) {
+		count++;
+		if (step->key == EMPHDELIM)
+			delimiters += strlen(step->str);
+	}
+
+	if (delimiters == 0)
+		return list;
+
+	memset(floors, 0, sizeof(floors));
+
+	/* Every match uses at least two delimiter characters and adds a node */
+	slots = malloc((count + delimiters / 2) * sizeof(delimiter_slot));
+
+	for (i = 0, step = list; step != NULL; i++, step = step->next) {
+		slots[i].n = step;
+		slots[i].prev = (i == 0) ? NO_SLOT : i - 1;
+		slots[i].next = (step->next == NULL) ? NO_SLOT : i + 1;
+		slots[i].below = NO_SLOT;
+		slots[i].count = slots[i].length = 0;
+		slots[i].open = slots[i].close = false;
+
+		if (step->key == EMPHDELIM) {
+			slots[i].count = slots[i].length = strlen(step->str);
+			delimiter_flanking(&slots[i], data);
+		}
+	}
+	used = count;
+
+	for (c = head; c != NO_SLOT; c = slots[c].next) {
+		if (slots[c].n == NULL)
+			continue;
+
+		/* As in the grammar, emphasis doesn't run on past the end of a line */
+		if ((slots[c].n->key == LINEBREAK) || ((slots[c].n->key == SPACE) &&
+			(slots[c].n->str != NULL) && (slots[c].n->str[0] == '\n'))) {
+			stack[0] = stack[1] = NO_SLOT;
+			continue;
+		}
+
+		if (slots[c].n->key != EMPHDELIM)
+			continue;
+
+		which = (slots[c].n->str[0] == '_');
+
+		while (slots[c].close && (slots[c].count > 0)) {
+			bottom = &floors[which][slots[c].length % 3][slots[c].open];
+			o = find_opener(slots, stack[which], *bottom, &slots[c]);
+			if (o == NO_SLOT) {
+				/* Nothing below here will do for a closer like this */
+				*bottom = c;
+				break;
+			}
+			/* Strong goes outside when both runs are three or more long
+				(***x*** is <strong><em>), as in the grammar */
+			if ((slots[o].count >= 3) && (slots[c].count >= 3))
+				use = 1;
+			else
+				use = ((slots[o].count >= 2) && (slots[c].count >= 2)) ? 2 : 1;
+
+			/* Openers inside this pair can't be used now */
+			stack[which] = o;
+			while ((stack[!which] != NO_SLOT) && (stack[!which] > o))
+				stack[!which] = slots[stack[!which]].below;
+
+			wrap = mk_node((use == 2) ? STRONG : EMPH);
+
+			k = slots[o].next;
+			if (k != c) {
+				wrap->children = slots[k].n;
+				for (; slots[k].next != c; k = slots[k].next)
+					slots[k].n->next = slots[slots[k].next].n;
+				slots[k].n->next = NULL;
+			}
+
+			slots[o].count -= use;
+			slots[o].n->str[slots[o].count] = '\0';
+			slots[c].count -= use;
+			slots[c].n->str[slots[c].count] = '\0';
+
+			if (has_position(slots[o].n) && has_position(slots[c].n)) {
+				slots[o].n->stop -= use;
+				slots[c].n->start += use;
+				wrap->start = slots[o].n->stop;
+				wrap->stop = slots[c].n->start;
+			}
+
+			w = used++;
+			slots[w].n = wrap;
+			slots[w].prev = o;
+			slots[w].next = c;
+			slots[o].next = w;
+			slots[c].prev = w;
+
+			if (slots[o].count == 0) {
+				stack[which] = slots[o].below;
+				unlink_slot(slots, o, &head);
+			}
+		}
+
+		if (slots[c].count == 0) {
+			unlink_slot(slots, c, &head);
+		} else if (slots[c].open) {
+			slots[c].below = stack[which];
+			stack[which] = c;
+		}
+	}
+
+	/* Unmatched delimiters (including any now inside a wrapper) are text */
+	for (i = 0; i < count; i++) {
+		if ((slots[i].n != NULL) && (slots[i].n->key == EMPHDELIM))
+			slots[i].n->key = STR;
+	}
+
+	list = (head == NO_SLOT) ? NULL : slots[head].n;
+	for (i = head; i != NO_SLOT; i = slots[i].next)
+		slots[i].n->next = (slots[i].next == NO_SLOT) ? NULL : slots[slots[i].next].n;
+
+	free(slots);
+	return list;
+}
+
+/* resolve_all_emphasis -- resolve_emphasis() on every list in tree. Views
+	are left alone, to be resolved when their pieces are parsed */
+node * resolve_all_emphasis(node *tree, parser_data *data) {
+	node *n;
+
+	tree = resolve_emphasis(tree, data);
+	for (n = tree; n != NULL; n = n->next) {
+		if (!is_view(n))
+			n->children = resolve_all_emphasis(n->children, data);
+	}
+
+	return tree;
+}
+
+#pragma mark - HTML Blocks
+
+/*
+	Block-level HTML is recognized by reading the tag name once and looking it
+	up (ignoring case) in a hashed table, rather than trying a rule per tag.
+	The matching close tag is then found in one forward pass, counting nested
+	opens of the same tag -- the same block the old HtmlBlockOpenX (HtmlBlockX
+	| !HtmlBlockCloseX .)* HtmlBlockCloseX rules matched.
+*/
+
+typedef struct {
+	const char *name;
+	bool        nests;          /* Count nested blocks of the same tag */
+} html_block_tag;
+
+static const html_block_tag html_block_tags[] = {
+	{ "address", true },    { "article", true },    { "aside", true },
+	{ "canvas", true },     { "blockquote", true }, { "center", true },
+	{ "dir", true },        { "div", true },        { "dl", true },
+	{ "fieldset", true },   { "figure", true },     { "footer", true },
+	{ "form", true },       { "header", true },     { "hgroup", true },
+	{ "h1", true },         { "h2", true },         { "h3", true },
+	{ "h4", true },         { "h5", true },         { "h6", true },
+	{ "menu", true },       { "noframes", true },   { "noscript", true },
+	{ "ol", true },         { "pre", true },        { "progress", true },
+	{ "p", true },          { "section", true },    { "table", true },
+	{ "ul", true },         { "video", true },      { "dd", true },
+	{ "dt", true },         { "frameset", true },   { "li", true },
+	{ "tbody", true },      { "td", true },         { "tfoot", true },
+	{ "thead", true },      { "th", true },         { "tr", true },
+	{ "script", false },    { "head", false },      { "main", false },
+	{ "nav", false },       { "del", false },       { "ins", false },
+	{ "mark", false },
+};
+
+#define HTML_TAG_COUNT   ((int) (sizeof(html_block_tags) / sizeof(html_block_tag)))
+#define HTML_TAG_SLOTS   128            /* Power of two, well above HTML_TAG_COUNT */
+#define HTML_TAG_LONGEST 10             /* "blockquote" */
+
+static signed char html_tag_slots[HTML_TAG_SLOTS];
+
+static unsigned int html_tag_hash(const char *name, size_t length) {
+	return (unsigned int) (length * 31 + name[0] * 7 + name[length - 1]) & (HTML_TAG_SLOTS - 1);
+}
+
+/* build_html_tags -- fill the hash table (see ensure_tables) */
+static void build_html_tags(void) {
+	unsigned int slot;
+	int i;
+
+	memset(html_tag_slots, -1, sizeof(html_tag_slots));
+
+	for (i = 0; i < HTML_TAG_COUNT; i++) {
+		slot = html_tag_hash(html_block_tags[i].name, strlen(html_block_tags[i].name));
+		while (html_tag_slots[slot] != -1)
+			slot = (slot + 1) & (HTML_TAG_SLOTS - 1);
+		html_tag_slots[slot] = (signed char) i;
+	}
+}
+
+/* find_html_tag -- index of the block tag called name (any case), or -1 */
+static int find_html_tag(const char *name, size_t length) {
+	char lower[HTML_TAG_LONGEST];
+	unsigned int slot;
+	size_t i;
+	int tag;
+
+	if ((length == 0) || (length > HTML_TAG_LONGEST))
+		return -1;
+
+	for (i = 0; i < length; i++)
+		lower[i] = tolower((unsigned char) name[i]);
+
+	slot = html_tag_hash(lower, length);
+	while ((tag = html_tag_slots[slot]) != -1) {
+		if ((strncmp(html_block_tags[tag].name, lower, length) == 0) &&
+			(html_block_tags[tag].name[length] == '\0'))
+			return tag;
+		slot = (slot + 1) & (HTML_TAG_SLOTS - 1);
+	}
+
+	return -1;
+}
+
+/* The text being scanned -- reading past the end sets starved, since the
+	answer could change once there is more */
+typedef struct {
+	const char *text;
+	size_t      length;
+	bool        starved;
+} html_scan;
+
+#define HTML_NO_MATCH    ((size_t) -1)
+
+static int html_peek(html_scan *s, size_t i) {
+	if (i >= s->length) {
+		s->starved = true;
+		return -1;
+	}
+	return (unsigned char) s->text[i];
+}
+
+static bool html_alnum(int c) {
+	return ((c >= '0') && (c <= '9')) || ((c >= 'A') && (c <= 'Z')) || ((c >= 'a') && (c <= 'z'));
+}
+
+/* Nonspacechar */
+static bool html_nonspace(int c) {
+	return (c != -1) && (c != ' ') && (c != '\t') && (c != '\n') && (c != '\r');
+}
+
+/* Spnl */
+static size_t html_spnl(html_scan *s, size_t i) {
+	int c;
+
+	while (((c = html_peek(s, i)) == ' ') || (c == '\t'))
+		i++;
+
+	if (c == '\n') {
+		i++;
+	} else if (c == '\r') {
+		i++;
+		if (html_peek(s, i) == '\n')
+			i++;
+	} else {
+		return i;
+	}
+
+	while (((c = html_peek(s, i)) == ' ') || (c == '\t'))
+		i++;
+
+	return i;
+}
+
+/* Quoted */
+static size_t html_quoted(html_scan *s, size_t i) {
+	int quote = html_peek(s, i);
+	int c;
+
+	if ((quote != '"') && (quote != '\''))
+		return HTML_NO_MATCH;
+
+	for (i++; (c = html_peek(s, i)) != quote; i++) {
+		if (c == -1)
+			return HTML_NO_MATCH;
+	}
+
+	return i + 1;
+}
+
+/* HtmlAttribute */
+static size_t html_attribute(html_scan *s, size_t i) {
+	size_t start = i;
+	size_t value;
+	size_t end;
+	int c;
+
+	while (html_alnum(c = html_peek(s, i)) || (c == '-') || (c == ':'))
+		i++;
+
+	if (i == start)
+		return HTML_NO_MATCH;
+
+	i = html_spnl(s, i);
+
+	if (html_peek(s, i) == '=') {
+		value = html_spnl(s, i + 1);
+		end = html_quoted(s, value);
+
+		if (end == HTML_NO_MATCH) {
+			for (end = value; ((c = html_peek(s, end)) != '>') && html_nonspace(c); end++);
+			if (end == value)
+				end = HTML_NO_MATCH;
+		}
+
+		if (end != HTML_NO_MATCH)
+			i = end;
+	}
+
+	return html_spnl(s, i);
+}
+
+/* html_tag_name -- read the name at i, setting tag to its index (or -1) */
+static size_t html_tag_name(html_scan *s, size_t i, int *tag) {
+	size_t start = i;
+
+	while (html_alnum(html_peek(s, i)))
+		i++;
+
+	*tag = find_html_tag(&s->text[start], i - start);
+
+	return i;
+}
+
+/* '<' Spnl name Spnl HtmlAttribute* '>' */
+static size_t html_open_tag(html_scan *s, size_t i, int *tag) {
+	size_t next;
+
+	if (html_peek(s, i) != '<')
+		return HTML_NO_MATCH;
+
+	i = html_tag_name(s, html_spnl(s, i + 1), tag);
+	if (*tag == -1)
+		return HTML_NO_MATCH;
+
+	i = html_spnl(s, i);
+	while ((next = html_attribute(s, i)) != HTML_NO_MATCH)
+		i = next;
+
+	if (html_peek(s, i) != '>')
+		return HTML_NO_MATCH;
+
+	return i + 1;
+}
+
+/* '<' Spnl '/' name Spnl '>' */
+static size_t html_close_tag(html_scan *s, size_t i, int tag) {
+	int found;
+
+	if (html_peek(s, i) != '<')
+		return HTML_NO_MATCH;
+
+	i = html_spnl(s, i + 1);
+	if (html_peek(s, i) != '/')
+		return HTML_NO_MATCH;
+
+	i = html_tag_name(s, i + 1, &found);
+	if (found != tag)
+		return HTML_NO_MATCH;
+
+	i = html_spnl(s, i);
+	if (html_peek(s, i) != '>')
+		return HTML_NO_MATCH;
+
+	return i + 1;
+}
+
+/* scan_html_block -- length of the block-level HTML element at the start of
+	text, or 0 if there isn't one. With only, just that tag will do. If the
+	answer depends on what follows text, returns -1 unless complete says
+	there's nothing more. scanned is how far we had to look */
+long scan_html_block(const char *text, size_t length, bool complete, const char *only, size_t *scanned) {
+	html_scan s = { text, length, false };
+	size_t i, next;
+	int depth = 1;
+	int tag, found;
+
+	i = html_open_tag(&s, 0, &tag);
+
+	if ((i != HTML_NO_MATCH) && ((only == NULL) || (tag == find_html_tag(only, strlen(only))))) {
+		while (i < length) {
+			if (text[i] == '<') {
+				if (html_block_tags[tag].nests &&
+					((next = html_open_tag(&s, i, &found)) != HTML_NO_MATCH) && (found == tag)) {
+					depth++;
+					i = next;
+					continue;
+				}
+				if ((next = html_close_tag(&s, i, tag)) != HTML_NO_MATCH) {
+					i = next;
+					if (--depth == 0)
+						break;
+					continue;
+				}
+			}
+			i++;
+		}
+
+		if (depth > 0)
+			s.starved = true;
+	} else {
+		i = 0;
+	}
+
+	*scanned = (i > length) ? length : i;
+
+	if (s.starved && !complete)
+		return -1;
+
+	return (depth == 0) ? (long) i : 0;
+}
+
 #pragma mark - Parser Data
 
 /* Create parser data - this is where you stash stuff to communicate 
 	into and out of the parser */
 parser_data * mk_parser_data(const char *charbuf, unsigned long extensions) {
-	clock_t start = clock();
+	return mk_parser_data_range(charbuf, (charbuf == NULL) ? 0 : strlen(charbuf), extensions);
+}
 
+/* mk_parser_data_range -- parse only the first length bytes of charbuf */
+parser_data * mk_parser_data_range(const char *charbuf, size_t length, unsigned long extensions) {
 	parser_data *result = (parser_data *)malloc(sizeof(parser_data));
 	result->extensions = extensions;
 	result->charbuf    = charbuf;
+	result->charbuf_end = (charbuf == NULL) ? NULL : charbuf + length;
 	result->original   = charbuf;
+	result->document   = charbuf;
+	result->offset     = 0;
 	result->autolabels = NULL;
 	result->result     = NULL;
 	
 	result->parse_aborted = 0;
-	result->stop_time = start + 3 * CLOCKS_PER_SEC;	/* 3 second timeout */
+	result->fuel = default_fuel(result->charbuf_end - result->charbuf);
+
+	result->memo       = NULL;
+	result->memo_size  = 0;
+	result->memo_count = 0;
+	result->memo_limit = MEMO_MAX_ENTRIES + MEMO_ENTRIES_PER_BYTE *
+		(unsigned long)(result->charbuf_end - result->charbuf);
+
+	result->bracket_from  = 0;
+	result->bracket_to    = 0;
+	result->bracket_found = false;
+	result->close_before  = 0;
+	result->close_none_from = (size_t) -1;
+
+	result->scans            = NULL;
+	result->scan_size        = 0;
+	result->scan_count       = 0;
+	result->scan_visits      = NULL;
+	result->scan_visit_count = 0;
+	result->scan_visit_size  = 0;
+	result->scan_marks       = NULL;
+	result->scan_depth       = 0;
+	result->nesting          = 0;
+
+	result->view       = NULL;
+	result->view_count = 0;
+	result->view_next  = 0;
+
+	result->char_class = char_classes(extensions);
+	result->rule_starts = rule_start_table();
 	
 	return result;
 }
@@ -245,10 +1474,196 @@ void free_parser_data(parser_data *data) {
 /* don't do this - it's owned by someone else -- free(data->original); */
 	data->original = NULL;
 	data->charbuf = NULL;
+	data->charbuf_end = NULL;
+	free(data->memo);
+	free(data->scans);
+	free(data->scan_visits);
+	free(data->scan_marks);
 	
 	free(data);
 }
 
+/* Only these extensions change how a byte is classified */
+#define CLASS_EXT_SMART     0x1
+#define CLASS_EXT_NOTES     0x2
+#define CLASS_EXT_CRITIC    0x4
+#define CLASS_EXT_COMPAT    0x8
+#define CLASS_TABLE_COUNT   16
+
+static unsigned char class_tables[CLASS_TABLE_COUNT][256];
+
+/* build_class_table -- mirror the old SpecialChar, ExtendedSpecialChar,
+	NormalChar, NonPunctuation and Alphanumeric rules for one extension set */
+static void build_class_table(unsigned char *table, int variant) {
+	const char *special = "*_`&[]()<!#\\'\"?,;/.";
+	const char *punctuation = ".,?!;:";
+	int c;
+
+	memset(table, 0, 256);
+
+	for (; *special != '\0'; special++)
+		table[(unsigned char) *special] |= CHAR_SPECIAL;
+
+	if (variant & CLASS_EXT_SMART)
+		table['-'] |= CHAR_SPECIAL;
+	if (variant & CLASS_EXT_NOTES)
+		table['^'] |= CHAR_SPECIAL;
+	if (variant & CLASS_EXT_CRITIC)
+		table['{'] |= CHAR_SPECIAL;
+	if (!(variant & CLASS_EXT_COMPAT)) {
+		table['~'] |= CHAR_SPECIAL;
+		table['|'] |= CHAR_SPECIAL;
+	}
+
+	table[' ']  |= CHAR_SPACE;
+	table['\t'] |= CHAR_SPACE;
+	table['\n'] |= CHAR_NEWLINE;
+
+	/* '。' and '、' are E3 80 82 and E3 80 81 -- one byte isn't enough */
+	table[0xE3] |= CHAR_WIDE_LEAD;
+
+	for (c = 0; c < 256; c++) {
+		if (table[c] & (CHAR_SPECIAL | CHAR_SPACE | CHAR_NEWLINE | CHAR_WIDE_LEAD))
+			continue;
+		table[c] |= CHAR_NORMAL;
+		if ((c == '\0') || (strchr(punctuation, c) == NULL))
+			table[c] |= CHAR_NONPUNCT;
+	}
+
+	for (c = 0; c < 256; c++) {
+		if ((c >= '0' && c <= '9') || (c >= 'A' && c <= 'Z') ||
+			(c >= 'a' && c <= 'z') || (c >= 0x80))
+			table[c] |= CHAR_ALNUM;
+	}
+}
+
+/* The bytes each dispatched alternative can start with (NULL for any byte).
+	These are FIRST sets of the rules in parser.leg, so keep them in step
+	with the grammar -- a missing byte would change what gets parsed */
+static const struct {
+	const char *name;
+	const char *starts;
+} dispatch_rules[DISPATCH_RULE_COUNT] = {
+	[BLOCK_QUOTE]            = { "BlockQuote",          " >" },
+	[BLOCK_FENCED]           = { "Fenced",              " `" },
+	[BLOCK_VERBATIM]         = { "Verbatim",            " \t\n" },
+	[BLOCK_DEFINITION_LIST]  = { "DefinitionList",      NULL },
+	[BLOCK_GLOSSARY]         = { "Glossary",            " [" },
+	[BLOCK_NOTE]             = { "Note",                " [" },
+	[BLOCK_LINK_REFERENCE]   = { "LinkReference",       " [" },
+	[BLOCK_ABBREVIATION]     = { "Abbreviation",        "*" },
+	[BLOCK_HORIZONTAL_RULE]  = { "HorizontalRule",      " *-_" },
+	[BLOCK_HEADING_SECTION]  = { "HeadingSection",      NULL },
+	[BLOCK_HEADING]          = { "Heading",             NULL },
+	[BLOCK_ORDERED_LIST]     = { "OrderedList",         " *+-0123456789" },
+	[BLOCK_BULLET_LIST]      = { "BulletList",          " *+-0123456789" },
+	[BLOCK_HTML]             = { "HtmlBlock",           "<" },
+	[BLOCK_MARKDOWN_HTML]    = { "MarkdownHtmlBlock",   "<" },
+	[BLOCK_STYLE]            = { "StyleBlock",          "<" },
+	[BLOCK_TABLE]            = { "Table",               NULL },
+	[BLOCK_IMAGE]            = { "ImageBlock",          "!" },
+	[BLOCK_TOC]              = { "TOC",                 "{" },
+	[BLOCK_PARA]             = { "Para",                NULL },
+	[BLOCK_PLAIN]            = { "Plain",               NULL },
+	[INLINE_CRITIC]          = { "CriticMarkup",        "{" },
+	[INLINE_DOLLAR_MATH]     = { "DollarMath",          "$" },
+	[INLINE_STR]             = { "Str",                 NULL },
+	[INLINE_MATH_SPAN]       = { "MathSpan",            "\\" },
+	[INLINE_ENDLINE]         = { "Endline",             " \t\n\\" },
+	[INLINE_UL_OR_STAR_LINE] = { "UlOrStarLine",        " \t*_" },
+	[INLINE_SPACE]           = { "Space",               " \t" },
+	[INLINE_EMPH_DELIMITER]  = { "EmphDelimiter",       "*_" },
+	[INLINE_STRONG_AND_EMPH] = { "StrongAndEmph",       "*_" },
+	[INLINE_STRONG]          = { "Strong",              "*_" },
+	[INLINE_EMPH]            = { "Emph",                "*_" },
+	[INLINE_CITATION]        = { "CitationReference",   "[" },
+	[INLINE_VARIABLE]        = { "Variable",            "[" },
+	[INLINE_IMAGE]           = { "Image",               "!" },
+	[INLINE_LINK]            = { "Link",                "<[" },
+	[INLINE_NOTE_REFERENCE]  = { "NoteReference",       "[" },
+	[INLINE_CODE]            = { "Code",                "`" },
+	[INLINE_HTML_TAG_OPEN]   = { "MarkdownHtmlTagOpen", "<" },
+	[INLINE_RAW_HTML]        = { "RawHtml",             "<" },
+	[INLINE_ENTITY]          = { "Entity",              "&" },
+	[INLINE_ESCAPED_CHAR]    = { "EscapedChar",         "\\" },
+	[INLINE_SMART]           = { "Smart",               "\"'-.`" },
+	[INLINE_SYMBOL]          = { "Symbol",              NULL },
+};
+
+static unsigned long long rule_starts[256];
+
+static void build_rule_starts(void) {
+	const char *c;
+	int rule, i;
+
+	for (rule = 0; rule < DISPATCH_RULE_COUNT; rule++) {
+		if (dispatch_rules[rule].starts == NULL) {
+			for (i = 0; i < 256; i++)
+				rule_starts[i] |= RULE_BIT(rule);
+		} else {
+			for (c = dispatch_rules[rule].starts; *c != '\0'; c++)
+				rule_starts[(unsigned char) *c] |= RULE_BIT(rule);
+		}
+	}
+}
+
+static void build_tables(void) {
+	int i;
+
+	for (i = 0; i < CLASS_TABLE_COUNT; i++)
+		build_class_table(class_tables[i], i);
+
+	build_rule_starts();
+	build_html_tags();
+}
+
+/* Build the tables once, whichever thread gets here first */
+static void ensure_tables(void) {
+#ifdef MMD_NO_THREADS
+	static bool built = false;
+
+	if (!built) {
+		build_tables();
+		built = true;
+	}
+#else
+	static pthread_once_t once = PTHREAD_ONCE_INIT;
+
+	pthread_once(&once, build_tables);
+#endif
+}
+
+/* char_classes -- byte classification table for this extension set */
+const unsigned char * char_classes(unsigned long extensions) {
+	int variant = 0;
+
+	ensure_tables();
+
+	if (extension(EXT_SMART, extensions))
+		variant |= CLASS_EXT_SMART;
+	if (extension(EXT_NOTES, extensions))
+		variant |= CLASS_EXT_NOTES;
+	if (extension(EXT_CRITIC, extensions))
+		variant |= CLASS_EXT_CRITIC;
+	if (extension(EXT_COMPATIBILITY, extensions))
+		variant |= CLASS_EXT_COMPAT;
+
+	return class_tables[variant];
+}
+
+/* rule_start_table -- for each byte, the dispatched alternatives that could
+	start with it */
+const unsigned long long * rule_start_table(void) {
+	ensure_tables();
+
+	return rule_starts;
+}
+
+/* dispatch_rule_name -- for reporting */
+const char * dispatch_rule_name(int rule) {
+	return dispatch_rules[rule].name;
+}
+
 /* mk_scratch_pad -- store stuff here while exporting the result tree */
 void ran_start(long seed);
 scratch_pad * mk_scratch_pad(unsigned long extensions) {
@@ -258,12 +1673,26 @@ scratch_pad * mk_scratch_pad(unsigned long extensions) {
 	result->baseheaderlevel = 1;
 	result->printing_notes = 0;
 	result->notes       = mk_node(KEY_COUNTER);		/* Need empty need for trimming later */
-	result->used_notes  = mk_node(KEY_COUNTER);
+	result->note_index  = NULL;
+	result->note_index_size = 0;
+	result->used_notes  = NULL;
+	result->used_note_count = 0;
+	result->used_note_space = 0;
+	result->used_cite_count = 0;
 	result->links       = mk_node(KEY_COUNTER);
+	result->link_index  = NULL;
+	result->link_index_size = 0;
+	result->link_index_of = NULL;
 	result->glossary    = mk_node(KEY_COUNTER);
 	result->citations   = mk_node(KEY_COUNTER);
 	result->abbreviations = mk_node(KEY_COUNTER);
 	result->result_tree = NULL;
+	result->source      = NULL;
+	result->metadata    = NULL;
+	result->marks       = NULL;
+	result->mark_count  = 0;
+	result->mark_size   = 0;
+	result->toc         = NULL;
 	result->padded      = 2;
 	result->footnote_to_print = 0;
 	result->footnote_para_counter = 0;
@@ -301,6 +1730,7 @@ scratch_pad * mk_scratch_pad(unsigned long extensions) {
 	result->lyx_table_need_line = FALSE;      /* CRC - No table yet */
 	result->lyx_table_total_rows = 0;         /* CRC - No rows */
 	result->lyx_table_total_cols = 0;         /* CRC - No Columns */
+	result->lyx_anchors = NULL;
 	return result;
 }
 
@@ -310,11 +1740,17 @@ void free_scratch_pad(scratch_pad *scratch) {
 #endif
 	
 	free_node_tree(scratch->notes);
-	free_node_tree(scratch->used_notes);
+	free(scratch->note_index);
+	free(scratch->used_notes);
 	free_node_tree(scratch->links);
+	free(scratch->link_index);
 	free_node_tree(scratch->glossary);
 	free_node_tree(scratch->citations);
 	free_node_tree(scratch->abbreviations);
+	free_metadata_dict(scratch->metadata);
+	free(scratch->marks);
+	free_node_tree(scratch->toc);
+	free_node_tree(scratch->lyx_anchors);
 	
 	g_string_free(scratch->lyx_debug_pad, true);    /* CRC - initally, no indent */
 	
@@ -331,7 +1767,7 @@ void free_scratch_pad(scratch_pad *scratch) {
 }
 
 link_data * mk_link_data(char *label, char *source, char *title, node *attr) {
-	link_data *result = (link_data *)malloc(sizeof(link_data));
+	link_data *result = new_record(LINK_RECORD, sizeof(link_data));
 	if (label != NULL)
 		result->label = strdup(label);
 	else result->label = NULL;
@@ -360,7 +1796,7 @@ void free_link_data(link_data *l) {
 	free_node_tree(l->attr);
 	l->attr = NULL;
 	
-	free(l);
+	free_record(LINK_RECORD, l);
 }
 
 /* Check if the specified extension is flagged */
@@ -378,36 +1814,30 @@ bool extension(int ext, unsigned long extensions) {
    NOTE: This is still a bit experimental, and will be removed if it breaks things.
 */
 char *label_from_string(char *str) {
-	GString *out = g_string_new("");
-	char *label;
-	char *next_char;
+	char *label = malloc(strlen(str) + 1);
+
+	copy_label(label, str);
+	return label;
+}
 
-	while (*str != '\0') {
-		next_char = str;
-		next_char++;
+/* copy_label -- label_from_string into a buffer of at least strlen(str) + 1 */
+void copy_label(char *out, const char *str) {
+	for (; *str != '\0'; str++) {
 		/* Is this a multibyte character? */
-		if ((*next_char & 0xC0) == 0x80) {
-			g_string_append_c(out, *str);
-			while ((*next_char & 0xC0) == 0x80) {
-				str++;
-				/* fprintf(stderr, "multibyte\n"); */
-				g_string_append_c(out, *str);
-				next_char++;
-			}
+		if ((str[1] & 0xC0) == 0x80) {
+			*out++ = *str;
+			while ((str[1] & 0xC0) == 0x80)
+				*out++ = *++str;
 		}
-		
+
 		/* can relax on following characters */
-		else if ((*str >= '0' && *str <= '9') || (*str >= 'A' && *str <= 'Z')
-			|| (*str >= 'a' && *str <= 'z') || (*str == '.') || (*str== '_')
-			|| (*str== '-') || (*str== ':'))
-		{
-			g_string_append_c(out, tolower(*str));
-		}           
-		str++;
+		else if (((*str >= '0') && (*str <= '9')) || ((*str >= 'A') && (*str <= 'Z'))
+			|| ((*str >= 'a') && (*str <= 'z')) || (*str == '.') || (*str == '_')
+			|| (*str == '-') || (*str == ':')) {
+			*out++ = tolower(*str);
+		}
 	}
-	label = out->str;
-	g_string_free(out, false);
-	return label;
+	*out = '\0';
 }
 
 char *ascii_label_from_string(char *str) {
@@ -642,54 +2072,559 @@ void print_raw_node_tree(GString *out, node *n) {
 #endif
 }
 
+/* What preformat_text() changes besides tabs: a UTF-8 byte order mark is
+	dropped, and "\r\n" or a lone '\r' becomes '\n', so the grammar only ever
+	sees '\n' line endings */
+static const char utf8_bom[] = "\357\273\277";
+#define BOM_LENGTH  3
+
+static bool starts_with_bom(const char *text) {
+	return strncmp(text, utf8_bom, BOM_LENGTH) == 0;
+}
+
+/* preformat_length -- size of the preformatted text (without the padding)
+	and whether it differs from the source at all */
+static size_t preformat_length(const char *text, size_t length, bool *changed) {
+	size_t result = length;
+	size_t i = 0;
+
+	*changed = false;
+	if (starts_with_bom(text)) {
+		*changed = true;
+		result -= BOM_LENGTH;
+		i = BOM_LENGTH;
+	}
+
+	/* strcspn() is vectorized in any libc that matters */
+	while ((i += strcspn(text + i, "\t\r")) < length) {
+		*changed = true;
+		if (text[i] == '\t')
+			result += TABSTOP - 1;             /* at most */
+		else if (text[i + 1] == '\n')
+			result--;
+		i++;
+	}
+
+	return result;
+}
+
+/* preformat_start -- an empty buffer with room for size bytes of text (it
+	grows if more are appended) */
+void preformat_start(preformat_buffer *buf, size_t size) {
+	buf->size = (size < 64) ? 64 : size;
+	buf->str = malloc(buf->size + 3);
+	buf->length = 0;
+	buf->line = 0;
+	buf->checked = 0;
+	buf->after_cr = false;
+}
+
+static void preformat_reserve(preformat_buffer *buf, size_t extra) {
+	if (buf->length + extra <= buf->size)
+		return;
+
+	while (buf->length + extra > buf->size)
+		buf->size *= 2;
+	buf->str = realloc(buf->str, buf->size + 3);
+}
+
+/* preformat_append -- expand tabs and normalize line endings of the next
+	piece of text. Tab-free runs are copied in bulk; only a tab needs to know
+	its column, found by looking back (once) for the line start */
+void preformat_append(preformat_buffer *buf, const char *text, size_t length) {
+	const char *end = text + length;
+	const char *tab;
+	const char *cr;
+	const char *next;
+	size_t run;
+	size_t look;
+	int spaces;
+
+	if (length == 0)
+		return;
+
+	/* "\r\n" split between pieces is still one line ending */
+	if (buf->after_cr) {
+		buf->after_cr = false;
+		if (*text == '\n')
+			text++;
+	}
+
+	tab = memchr(text, '\t', end - text);
+	cr = memchr(text, '\r', end - text);
+
+	while (text < end) {
+		next = ((tab == NULL) || ((cr != NULL) && (cr < tab))) ? cr : tab;
+		run = ((next == NULL) ? end : next) - text;
+
+		preformat_reserve(buf, run + TABSTOP);
+		memcpy(buf->str + buf->length, text, run);
+		text += run;
+
+		if (next == NULL) {
+			buf->length += run;
+			break;
+		}
+
+		if (*next == '\r') {
+			buf->length += run;
+			buf->str[buf->length++] = '\n';
+			buf->line = buf->checked = buf->length;
+			text++;
+			if (text == end)
+				buf->after_cr = true;
+			else if (*text == '\n')
+				text++;
+			cr = memchr(text, '\r', end - text);
+			continue;
+		}
+
+		/* A tab -- columns count bytes, as they always have */
+		buf->length += run;
+		look = buf->length;
+		while ((look > buf->checked) && (buf->str[look - 1] != '\n'))
+			look--;
+		if (look > buf->checked)
+			buf->line = look;
+
+		spaces = TABSTOP - (int)((buf->length - buf->line) % TABSTOP);
+		memset(buf->str + buf->length, ' ', spaces);
+		buf->length += spaces;
+		buf->checked = buf->length;
+		text++;
+		tab = memchr(text, '\t', end - text);
+	}
+}
+
+/* preformat_finish -- add the padding the grammar expects; the buffer's
+	string is the caller's to free */
+char * preformat_finish(preformat_buffer *buf) {
+	memcpy(buf->str + buf->length, "\n\n", 3);
+	buf->length += 2;
+	return buf->str;
+}
+
+static char * preformat(const char *text, size_t length, size_t size) {
+	preformat_buffer buf;
+
+	preformat_start(&buf, size);
+	if (starts_with_bom(text))
+		preformat_append(&buf, text + BOM_LENGTH, length - BOM_LENGTH);
+	else
+		preformat_append(&buf, text, length);
+
+	return preformat_finish(&buf);
+}
+
 /* preformat_text - allocate and copy text buffer while
- * performing tab expansion. */
+ * performing tab expansion (and line ending cleanup, see above). */
 char * preformat_text(const char *text) {
-	GString *buf;
-	char next_char;
-	int charstotab;
-	char *out;
+	size_t length = strlen(text);
+	bool changed;
+	size_t size = preformat_length(text, length, &changed);
+
+	return(preformat(text, length, size));
+}
 
-	int len = 0;
+/* preformat_source -- like preformat_text(), but when the text needs no
+	changes and already ends in a blank line (so the padding would only add
+	more blank lines) it is handed back as is. Otherwise the copy is returned
+	in *copy for the caller to free (*copy is NULL for a view) */
+const char * preformat_source(const char *text, char **copy) {
+	size_t length = strlen(text);
+	bool changed;
+	size_t size = preformat_length(text, length, &changed);
+
+	if (!changed && (length >= 2) && (text[length - 1] == '\n') && (text[length - 2] == '\n')) {
+		*copy = NULL;
+		return text;
+	}
+
+	*copy = preformat(text, length, size);
+	return *copy;
+}
+
+/* Bytes of the source that preformat_text() replaced: a tab and the spaces
+	it became, or a BOM or the '\r' of "\r\n" that it dropped (start == stop) */
+typedef struct {
+	size_t source;
+	size_t length;
+	size_t start;
+	size_t stop;
+} format_span;
+
+static size_t map_format_offset(format_span *spans, size_t count, size_t pos, size_t limit) {
+	size_t low = 0;
+	size_t high = count;
+	size_t mid;
+	size_t result;
+
+	while (low < high) {
+		mid = (low + high) / 2;
+		if (spans[mid].start <= pos)
+			low = mid + 1;
+		else
+			high = mid;
+	}
+
+	if (low == 0)
+		result = pos;
+	else if (pos < spans[low - 1].stop)
+		result = spans[low - 1].source;
+	else
+		result = spans[low - 1].source + spans[low - 1].length + (pos - spans[low - 1].stop);
+
+	return (result > limit) ? limit : result;
+}
+
+static void map_format_positions(node *n, format_span *spans, size_t count, size_t limit) {
+	while (n != NULL) {
+		if (has_position(n)) {
+			if (n->stop > n->start) {
+				n->start = map_format_offset(spans, count, n->start, limit);
+				n->stop = map_format_offset(spans, count, n->stop - 1, limit) + 1;
+				if (n->stop > limit)
+					n->stop = limit;
+			} else {
+				n->start = n->stop = map_format_offset(spans, count, n->start, limit);
+			}
+		}
+		map_format_positions(n->children, spans, count, limit);
+		n = n->next;
+	}
+}
+
+static void add_format_span(format_span **spans, size_t *count, size_t *size,
+	size_t source, size_t length, size_t start, size_t stop) {
+	if (*count == *size) {
+		*size = (*size == 0) ? 64 : *size * 2;
+		*spans = realloc(*spans, *size * sizeof(format_span));
+	}
+	(*spans)[*count].source = source;
+	(*spans)[*count].length = length;
+	(*spans)[*count].start = start;
+	(*spans)[*count].stop = stop;
+	(*count)++;
+}
 
-	buf = g_string_new("");
+/* map_preformatted_positions -- translate positions in the output of
+	preformat_text() back to the source it was given (undo tab expansion and
+	line ending cleanup, and clamp the trailing newlines it adds) */
+void map_preformatted_positions(node *tree, const char *source) {
+	format_span *spans = NULL;
+	size_t count = 0;
+	size_t size = 0;
+	size_t in = 0;
+	size_t out = 0;
+	int charstotab = TABSTOP;
+
+	if (starts_with_bom(source)) {
+		add_format_span(&spans, &count, &size, 0, BOM_LENGTH, 0, 0);
+		in = BOM_LENGTH;
+	}
 
-	charstotab = TABSTOP;
-	while ((next_char = *text++) != '\0') {
-		switch (next_char) {
+	for (; source[in] != '\0'; in++) {
+		switch (source[in]) {
 			case '\t':
-				while (charstotab > 0)
-					g_string_append_c(buf, ' '), len++, charstotab--;
+				add_format_span(&spans, &count, &size, in, 1, out, out + charstotab);
+				out += charstotab;
+				charstotab = 0;
 				break;
+			case '\r':
+				if (source[in + 1] == '\n') {
+					add_format_span(&spans, &count, &size, in, 1, out, out);
+					break;
+				}
+				/* A lone '\r' is a newline of the same length */
 			case '\n':
-				g_string_append_c(buf, '\n'), len++, charstotab = TABSTOP;
+				out++;
+				charstotab = TABSTOP;
 				break;
 			default:
-				g_string_append_c(buf, next_char), len++, charstotab--;
+				out++;
+				charstotab--;
 		}
 		if (charstotab == 0)
 			charstotab = TABSTOP;
 	}
-	g_string_append_printf(buf, "\n\n");
-	out = buf->str;
-	g_string_free(buf,false);
-	return(out);
+
+	map_format_positions(tree, spans, count, in);
+	free(spans);
+}
+
+/* default_fuel -- budget used when the caller doesn't specify one */
+long default_fuel(size_t len) {
+	if (len > (LONG_MAX - FUEL_MINIMUM) / FUEL_PER_BYTE)
+		return LONG_MAX;
+
+	return FUEL_MINIMUM + (long) len * FUEL_PER_BYTE;
 }
 
-/* Don't let us get caught in "infinite" loop;
-	1 means we're ok 
-	0 means we're stuck -- abort */
+/* check_timeout -- slow path of burn_fuel() in the grammar, reached when the
+	budget is used up. Counting rule entries instead of calling clock() keeps
+	the limit reproducible and unaffected by other threads.
+	1 means we're ok, 0 means we're stuck -- abort */
 bool check_timeout(parser_data *data) {
 	/* Once we abort, keep aborting */
 	if (data->parse_aborted)
 		return 0;
-	if (clock() > data->stop_time) {
+	if (data->fuel <= 0) {
+		data->fuel = 0;
 		data->parse_aborted = 1;
 		return 0;
 	}
 	return 1;
 }
 
+#pragma mark - Memoization
+
+/* With EXT_MEMOIZE, selected rules remember the positions where they failed.
+	greg can't replay the thunks of a successful match, but failures leave
+	nothing behind, so skipping a repeated failed attempt is always safe and
+	that is where the exponential backtracking on nested '*', '[' and HTML
+	runs comes from. Keys are (position + 1) << MEMO_RULE_BITS | rule, so 0
+	marks an empty slot. */
+
+static unsigned long memo_slot(unsigned long key, unsigned long size) {
+	key ^= key >> 17;
+	key *= 0x45d9f3b;
+	key ^= key >> 13;
+	return key & (size - 1);
+}
+
+static bool memo_grow(parser_data *data) {
+	unsigned long new_size = (data->memo_size == 0) ? 1024 : data->memo_size * 2;
+	unsigned long *new_memo = calloc(new_size, sizeof(unsigned long));
+	unsigned long i, slot;
+
+	if (new_memo == NULL)
+		return 0;
+
+	for (i = 0; i < data->memo_size; i++) {
+		if (data->memo[i] != 0) {
+			slot = memo_slot(data->memo[i], new_size);
+			while (new_memo[slot] != 0)
+				slot = (slot + 1) & (new_size - 1);
+			new_memo[slot] = data->memo[i];
+		}
+	}
+
+	free(data->memo);
+	data->memo = new_memo;
+	data->memo_size = new_size;
+	return 1;
+}
+
+/* Return false if this rule already failed at this position */
+bool memo_check(parser_data *data, int rule, unsigned long pos) {
+	unsigned long key, slot;
+
+	if (data->memo_count == 0)
+		return 1;
+
+	key = ((pos + 1) << MEMO_RULE_BITS) | rule;
+	slot = memo_slot(key, data->memo_size);
+
+	while (data->memo[slot] != 0) {
+		if (data->memo[slot] == key)
+			return 0;
+		slot = (slot + 1) & (data->memo_size - 1);
+	}
+	return 1;
+}
+
+/* Record a failed attempt -- always returns false so that it can be used as
+	the last alternative of the rule */
+bool memo_note_failure(parser_data *data, int rule, unsigned long pos) {
+	unsigned long key, slot;
+
+	if (!extension(EXT_MEMOIZE, data->extensions))
+		return 0;
+
+	/* Table is full -- keep parsing without recording anything else */
+	if (data->memo_count >= data->memo_limit)
+		return 0;
+
+	if ((data->memo_count + 1) * 2 > data->memo_size) {
+		if (!memo_grow(data))
+			return 0;
+	}
+
+	key = ((pos + 1) << MEMO_RULE_BITS) | rule;
+	slot = memo_slot(key, data->memo_size);
+
+	while (data->memo[slot] != 0) {
+		if (data->memo[slot] == key)
+			return 0;
+		slot = (slot + 1) & (data->memo_size - 1);
+	}
+
+	data->memo[slot] = key;
+	data->memo_count++;
+	return 0;
+}
+
+/* Failures alone don't make nested '*' and '_' runs linear: every unclosed
+	delimiter scans on to the end of the paragraph, and the scans from each of
+	them cover the same ground. Two scans of the same kind that reach the same
+	position stop at the same place, so each scan remembers the positions it
+	passed, and once it stops they all point there -- a later scan that gets
+	to any of them jumps straight to the end. Like the failures, this is kept
+	for each parse -- a chunk can't use its parent's scans, as they may have
+	looked beyond the end of the chunk */
+
+static bool scan_grow(parser_data *data) {
+	unsigned long new_size = (data->scan_size == 0) ? 1024 : data->scan_size * 2;
+	scan_entry *new_scans = calloc(new_size, sizeof(scan_entry));
+	unsigned long i, slot;
+
+	if (new_scans == NULL)
+		return 0;
+
+	for (i = 0; i < data->scan_size; i++) {
+		if (data->scans[i].key != 0) {
+			slot = memo_slot(data->scans[i].key, new_size);
+			while (new_scans[slot].key != 0)
+				slot = (slot + 1) & (new_size - 1);
+			new_scans[slot] = data->scans[i];
+		}
+	}
+
+	free(data->scans);
+	data->scans = new_scans;
+	data->scan_size = new_size;
+	return 1;
+}
+
+static void scan_record(parser_data *data, unsigned long key, unsigned long end) {
+	unsigned long slot;
+
+	if ((data->scan_count + 1) * 2 > data->scan_size) {
+		if ((data->scan_count >= data->memo_limit) || !scan_grow(data))
+			return;
+	}
+
+	slot = memo_slot(key, data->scan_size);
+	while (data->scans[slot].key != 0) {
+		if (data->scans[slot].key == key)
+			return;
+		slot = (slot + 1) & (data->scan_size - 1);
+	}
+
+	data->scans[slot].key = key;
+	data->scans[slot].end = end;
+	data->scan_count++;
+}
+
+/* scan_known -- true (with end set) if a scan of this kind already passed pos */
+bool scan_known(parser_data *data, int rule, unsigned long pos, unsigned long *end) {
+	unsigned long key, slot;
+
+	if (data->scan_count == 0)
+		return 0;
+
+	key = ((pos + 1) << MEMO_RULE_BITS) | rule;
+	slot = memo_slot(key, data->scan_size);
+
+	while (data->scans[slot].key != 0) {
+		if (data->scans[slot].key == key) {
+			*end = data->scans[slot].end;
+			return 1;
+		}
+		slot = (slot + 1) & (data->scan_size - 1);
+	}
+	return 0;
+}
+
+/* scan_begin -- a scan starts here. False once emphasis and brackets are
+	nested NEST_MAX_DEPTH deep (counting enclosing chunks), which keeps the
+	recursion off the end of the stack. Each call is paired with scan_end()
+	or scan_abandon() */
+bool scan_begin(parser_data *data) {
+	if (!extension(EXT_MEMOIZE, data->extensions))
+		return 1;
+
+	if (data->scan_marks == NULL)
+		data->scan_marks = malloc(NEST_MAX_DEPTH * sizeof(unsigned long));
+
+	if ((data->scan_marks != NULL) && (data->scan_depth < NEST_MAX_DEPTH))
+		data->scan_marks[data->scan_depth] = data->scan_visit_count;
+
+	data->scan_depth++;
+	return (data->scan_marks != NULL) && (data->nesting + data->scan_depth <= NEST_MAX_DEPTH);
+}
+
+/* scan_visit -- the scan has got to pos; false (ending it) if an earlier
+	scan already went on from here */
+bool scan_visit(parser_data *data, int rule, unsigned long pos) {
+	unsigned long end;
+	unsigned long *new_visits;
+
+	if (!extension(EXT_MEMOIZE, data->extensions))
+		return 1;
+
+	if (scan_known(data, rule, pos, &end))
+		return 0;
+
+	if (data->scan_visit_count == data->scan_visit_size) {
+		new_visits = realloc(data->scan_visits, ((data->scan_visit_size == 0) ? 1024 : data->scan_visit_size * 2) * sizeof(unsigned long));
+		if (new_visits == NULL)
+			return 1;
+		data->scan_visits = new_visits;
+		data->scan_visit_size = (data->scan_visit_size == 0) ? 1024 : data->scan_visit_size * 2;
+	}
+
+	data->scan_visits[data->scan_visit_count++] = pos;
+	return 1;
+}
+
+/* scan_end -- the scan stopped at end (the caller has already followed any
+	earlier scan it ran into); point the positions it passed there */
+bool scan_end(parser_data *data, int rule, unsigned long end) {
+	unsigned long i, first;
+
+	if (!extension(EXT_MEMOIZE, data->extensions))
+		return 1;
+
+	first = data->scan_marks[--data->scan_depth];
+
+	for (i = first; i < data->scan_visit_count; i++)
+		scan_record(data, ((data->scan_visits[i] + 1) << MEMO_RULE_BITS) | rule, end);
+
+	data->scan_visit_count = first;
+	return 1;
+}
+
+/* scan_abandon -- the scan didn't get anywhere; always returns false */
+bool scan_abandon(parser_data *data) {
+	if (!extension(EXT_MEMOIZE, data->extensions))
+		return 0;
+
+	data->scan_depth--;
+	if ((data->scan_marks != NULL) && (data->scan_depth < NEST_MAX_DEPTH))
+		data->scan_visit_count = data->scan_marks[data->scan_depth];
+	return 0;
+}
+
+/* nest_enter -- a label or bracket starts here; false if that is too deep (see
+	scan_begin). Each successful call is paired with nest_leave() */
+bool nest_enter(parser_data *data) {
+	if (!extension(EXT_MEMOIZE, data->extensions))
+		return 1;
+
+	if (data->nesting + data->scan_depth >= NEST_MAX_DEPTH)
+		return 0;
+
+	data->scan_depth++;
+	return 1;
+}
+
+bool nest_leave(parser_data *data) {
+	if (extension(EXT_MEMOIZE, data->extensions))
+		data->scan_depth--;
+	return 1;
+}
+
 /* determine whether a certain element is contained within a given list */
 bool tree_contains_key(node *list, int key) {
 	node *step = NULL;
@@ -727,6 +2662,31 @@ int tree_contains_key_count(node *list, int key) {
 	return counter;
 }
 
+/* metadata_block_length -- metadata can't go past the first blank line, so
+	that's as much of source as we need to read it */
+size_t metadata_block_length(const char *source) {
+	const char *p = source;
+	bool blank;
+
+	while (*p != '\0') {
+		while ((*p == ' ') || (*p == '\t'))
+			p++;
+		blank = (*p == '\n') || (*p == '\r');
+
+		while ((*p != '\0') && (*p != '\n') && (*p != '\r'))
+			p++;
+		if ((p[0] == '\r') && (p[1] == '\n'))
+			p++;
+		if (*p != '\0')
+			p++;
+
+		if (blank)
+			break;
+	}
+
+	return p - source;
+}
+
 /* list all metadata keys, if present */
 char * metadata_keys(node *list) {
 	node *step = NULL;
@@ -845,6 +2805,20 @@ void trim_trailing_newlines(char *str) {
 	}
 }
 
+/* trimmed_string -- copy of str without trailing whitespace, for writers
+	that mustn't trim the tree itself; must be freed */
+char * trimmed_string(const char *str) {
+	char *result;
+
+	if (str == NULL)
+		return NULL;
+
+	result = strdup(str);
+	trim_trailing_whitespace(result);
+
+	return result;
+}
+
 /* Return version */
 char * mmd_version(void) {
 	char *result;
@@ -873,12 +2847,12 @@ node * copy_node(node *n) {
 	if (n == NULL)
 		return NULL;
 	else {
-		node *m = (node *) malloc(sizeof(node));
+		node *m = mk_node(n->key);
 
 		*m = *n;
 
 		if (n->str != NULL)
-			m->str = strdup(n->str);
+			m->str = node_text(m, n->str, strlen(n->str));
 
 		if (n->link_data != NULL) {
 			m->link_data = mk_link_data(n->link_data->label, n->link_data->source, n->link_data->title, copy_node_tree(n->link_data->attr));
@@ -917,4 +2891,195 @@ char * my_strndup(const char * source, size_t n) {
 	result[len] = '\0';
 
 	return result;
-}
\ No newline at end of file
+}
+
+
+#pragma mark - Metadata Dictionary
+
+/*
+	Writers look metadata up by key all through a document (every [%key]
+	variable, and a long list of keys in LyX), and metadata_for_key walks
+	the METAKEY list and builds two labels per step to answer each one.
+	mk_metadata_dict does that work once: keys are run through
+	label_from_string and values trimmed as metavalue_for_key would, and
+	both are copied into a block of text the dictionary owns, so writers
+	that reuse the tree's strings afterwards can't change what it says.
+
+	Nothing is added or changed after it is built.  The strings handed back
+	are borrowed -- don't change or free them.
+*/
+
+#define METADATA_KEY_BUFFER 256
+
+/* string_hash -- FNV-1a, for the lookup tables */
+unsigned long string_hash(const char *key) {
+	unsigned long hash = 2166136261UL;
+
+	while (*key != '\0')
+		hash = (hash ^ (unsigned char) *key++) * 16777619UL;
+
+	return hash;
+}
+
+static int lookup_metadata_entry(metadata_dict *dict, const char *key) {
+	size_t mask = dict->index_size - 1;
+	size_t i;
+
+	for (i = string_hash(key) & mask; dict->index[i] != -1; i = (i + 1) & mask) {
+		if (strcmp(dict->entries[dict->index[i]].key, key) == 0)
+			return dict->index[i];
+	}
+
+	return -1;
+}
+
+static size_t metadata_node_slot(node *n, size_t mask) {
+	return (((size_t) n >> 4) * 2654435761UL) & mask;
+}
+
+/* mk_metadata_dict -- index the first METADATA block in list (NULL if
+	there isn't one) */
+metadata_dict * mk_metadata_dict(node *list) {
+	metadata_dict *dict;
+	metadata_entry *e;
+	size_t text = 0;
+	size_t count = 0;
+	size_t mask;
+	size_t i;
+	node *step;
+
+	while ((list != NULL) && (list->key != METADATA))
+		list = list->next;
+
+	if (list == NULL)
+		return NULL;
+
+	for (step = list->children; step != NULL; step = step->next) {
+		count++;
+		text += strlen(step->str) + 1;
+		if ((step->children != NULL) && (step->children->str != NULL))
+			text += strlen(step->children->str) + 1;
+	}
+
+	dict = malloc(sizeof(metadata_dict));
+	dict->entries = malloc(count * sizeof(metadata_entry) + 1);
+	dict->count = 0;
+	dict->text = malloc(text + 1);
+	dict->index_size = 16;
+	while (dict->index_size < count * 2)
+		dict->index_size *= 2;
+	dict->index = malloc(dict->index_size * sizeof(int));
+	dict->node_index = malloc(dict->index_size * sizeof(int));
+	for (i = 0; i < dict->index_size; i++) {
+		dict->index[i] = -1;
+		dict->node_index[i] = -1;
+	}
+	mask = dict->index_size - 1;
+
+	text = 0;
+	for (step = list->children; step != NULL; step = step->next) {
+		e = &dict->entries[dict->count];
+		e->meta = step;
+		e->key = dict->text + text;
+		copy_label(e->key, step->str);
+		text += strlen(e->key) + 1;
+
+		e->value = NULL;
+		if ((step->children != NULL) && (step->children->str != NULL)) {
+			e->value = dict->text + text;
+			strcpy(e->value, step->children->str);
+			trim_trailing_whitespace(e->value);
+			text += strlen(e->value) + 1;
+		}
+
+		/* Keep the first of any duplicates, as metadata_for_key does */
+		for (i = string_hash(e->key) & mask; dict->index[i] != -1; i = (i + 1) & mask) {
+			if (strcmp(dict->entries[dict->index[i]].key, e->key) == 0)
+				break;
+		}
+
+		if (dict->index[i] == -1)
+			dict->index[i] = (int) dict->count;
+
+		for (i = metadata_node_slot(step, mask); dict->node_index[i] != -1; i = (i + 1) & mask)
+			;
+		dict->node_index[i] = (int) dict->count;
+
+		dict->count++;
+	}
+
+	return dict;
+}
+
+void free_metadata_dict(metadata_dict *dict) {
+	if (dict == NULL)
+		return;
+
+	free(dict->entries);
+	free(dict->index);
+	free(dict->node_index);
+	free(dict->text);
+	free(dict);
+}
+
+/* dict_metadata_for_key -- same as metadata_for_key, from a dictionary */
+node * dict_metadata_for_key(char *key, metadata_dict *dict) {
+	char buffer[METADATA_KEY_BUFFER];
+	char *label = buffer;
+	int i;
+
+	if ((dict == NULL) || (key == NULL))
+		return NULL;
+
+	if (strlen(key) >= METADATA_KEY_BUFFER)
+		label = malloc(strlen(key) + 1);
+
+	copy_label(label, key);
+	i = lookup_metadata_entry(dict, label);
+
+	if (label != buffer)
+		free(label);
+
+	return (i == -1) ? NULL : dict->entries[i].meta;
+}
+
+/* dict_metavalue_for_key -- the trimmed value for key, or NULL; unlike
+	metavalue_for_key, this is borrowed from dict */
+char * dict_metavalue_for_key(char *key, metadata_dict *dict) {
+	char buffer[METADATA_KEY_BUFFER];
+	char *label = buffer;
+	int i;
+
+	if ((dict == NULL) || (key == NULL))
+		return NULL;
+
+	if (strlen(key) >= METADATA_KEY_BUFFER)
+		label = malloc(strlen(key) + 1);
+
+	copy_label(label, key);
+	i = lookup_metadata_entry(dict, label);
+
+	if (label != buffer)
+		free(label);
+
+	return (i == -1) ? NULL : dict->entries[i].value;
+}
+
+/* dict_key_for_node -- the key the METAKEY node metakey is filed under
+	(borrowed), or NULL if it isn't in dict.  Writers use this rather than
+	relabel the tree's keys */
+char * dict_key_for_node(node *metakey, metadata_dict *dict) {
+	size_t mask;
+	size_t i;
+
+	if (dict == NULL)
+		return NULL;
+
+	mask = dict->index_size - 1;
+	for (i = metadata_node_slot(metakey, mask); dict->node_index[i] != -1; i = (i + 1) & mask) {
+		if (dict->entries[dict->node_index[i]].meta == metakey)
+			return dict->entries[dict->node_index[i]].key;
+	}
+
+	return NULL;
+}
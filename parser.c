@@ -0,0 +1,8885 @@
+/* A recursive-descent parser generated by greg 0.4.3 */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+struct _GREG;
+#define YYRULECOUNT 248
+
+/*
+
+	parser.leg -> parser.c -- Parse (Multi)Markdown plain text for
+		conversion into other formats
+	
+	(c) 2013-2015 Fletcher T. Penney (http://fletcherpenney.net/).
+
+	Derived from peg-multimarkdown, which was forked from peg-markdown,
+	which is (c) 2008 John MacFarlane (jgm at berkeley dot edu), and 
+	licensed under GNU GPL or MIT.
+
+	This program is free software; you can redistribute it and/or modify
+	it under the terms of the GNU General Public License or the MIT
+	license.  See LICENSE for details.
+	
+	This program is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+*/
+
+#include "parser.h"
+#include "writer.h"
+
+#ifndef MMD_NO_THREADS
+#include <pthread.h>
+#endif
+
+
+/* Define shortcuts to adding nodes, etc. */
+#define node(x)       mk_pos_node(x, NULL, src_pos(thunk->begin), src_pos(thunk->end))
+#define str(x)        mk_pos_str(x, src_pos(thunk->begin), src_pos(thunk->end))
+#define list(x,y)     mk_pos_list(x, y, src_pos(thunk->begin), src_pos(thunk->end))
+
+/* A RAW view of the captured text, for container contents (see mk_view) */
+#define view()        mk_view((parser_data *)G->data, thunk->begin, thunk->end)
+
+/* Positions are relative to the buffer we were handed -- adjust for nesting */
+#define src_pos(x)    ((x) + ((parser_data *)G->data)->offset)
+
+#define ext(x)        extension(x,((parser_data *)G->data)->extensions)
+
+/* Look up the class of the next byte (see char_classes) -- false at the end
+	of the input */
+#define char_is(x)    ((G->pos < G->limit || yyrefill(G)) && \
+	(((parser_data *)G->data)->char_class[(unsigned char) G->buf[G->pos]] & (x)))
+
+/* Count down the parse budget -- check_timeout() only runs once it is spent */
+#define burn_fuel()   (--((parser_data *)G->data)->fuel > 0 || check_timeout((parser_data *)G->data))
+
+/* First-byte dispatch -- only try an alternative if the next byte could
+	start it (see rule_start_table). Always true at the end of the input */
+#define may_start(x)  (!(G->pos < G->limit || yyrefill(G)) || \
+	(((parser_data *)G->data)->rule_starts[(unsigned char) G->buf[G->pos]] & RULE_BIT(x)))
+
+/* The same, keeping count for --parse-stats in a build with
+	-DMMD_PARSE_STATS. failed(x) marks an alternative that was tried and
+	didn't match (and fails itself) */
+#ifdef MMD_PARSE_STATS
+#define dispatch(x)   (rule_counts.tried[x]++, may_start(x) || (rule_counts.skipped[x]++, 0))
+#define failed(x)     (rule_counts.failed[x]++, 0)
+#else
+#define dispatch(x)   may_start(x)
+#define failed(x)     0
+#endif
+
+/* Consume the block-level HTML element at the current position (any block
+	tag if x is NULL) */
+#define html_block(x) match_html_block(G, x)
+
+struct _GREG;
+static int match_html_block(struct _GREG *G, const char *only);
+static int bracket_may_close(struct _GREG *G);
+static int bracket_follows(struct _GREG *G);
+static int skip_known_scan(struct _GREG *G, int rule, bool moved);
+static int finish_scan(struct _GREG *G, int rule);
+
+/* Stop calling yyparse() once the parse has been aborted */
+#define aborted(g)    (((parser_data *)(g)->data)->parse_aborted)
+
+/* Parse a nested chunk, drawing on the same budget as its parent. offset is
+	where source starts in the parent's buffer */
+node * parse_chunk(const char * source, unsigned long extensions, parser_data *parent, size_t offset);
+
+/* Packrat support (EXT_MEMOIZE) -- skip rules that already failed here.
+	greg moves pos back to 0 each time yyparse() returns, so key on the
+	position in the whole input */
+#define memo_ok(x)    memo_check((parser_data *)G->data, x, G->offset + G->pos)
+#define memo_fail(x)  memo_note_failure((parser_data *)G->data, x, G->offset + G->pos)
+
+/* ... and let the emphasis scans share their work (see scan_visit) */
+#define scan_skip(x)      skip_known_scan(G, x, 1)
+#define scan_reuse(x)     skip_known_scan(G, x, 0)
+#define scan_start()      scan_begin((parser_data *)G->data)
+#define scan_passed(x)    scan_visit((parser_data *)G->data, x, G->offset + G->pos)
+#define scan_stop(x)      finish_scan(G, x)
+#define scan_fail()       scan_abandon((parser_data *)G->data)
+
+#define YY_INPUT(buf, result, max_size, D) yy_input_func(buf, &result, max_size, (parser_data *)G->data)
+
+/* greg copies the text from begin to end before every predicate, so start
+	each capture empty -- otherwise the end of an earlier capture further on
+	(after backtracking) has the predicates copy out the rest of the input */
+#define YY_BEGIN ( G->begin = G->end = G->pos, 1)
+
+/* Count greg's buffer (re)allocations and context reuse for --parse-stats
+	-- only in a build with -DMMD_PARSE_STATS (see parser_context_stats) */
+#ifdef MMD_PARSE_STATS
+#define YY_ALLOC(N, D)       counted_alloc(N)
+#define YY_REALLOC(C, N, D)  counted_realloc(C, N)
+
+#ifdef MMD_NO_THREADS
+#define count_event(x)       ((*(x))++)
+#else
+#define count_event(x)       __sync_fetch_and_add((x), 1)
+#endif
+#else
+#define count_event(x)
+#endif
+
+static unsigned long greg_allocations = 0;
+static unsigned long contexts_created = 0;
+static unsigned long contexts_reused = 0;
+
+/* Attempts at the dispatched alternatives -- counted per thread, and added
+	to the totals by release_parser_contexts() */
+typedef struct {
+	unsigned long tried[DISPATCH_RULE_COUNT];
+	unsigned long skipped[DISPATCH_RULE_COUNT];
+	unsigned long failed[DISPATCH_RULE_COUNT];
+} rule_stats;
+
+static rule_stats rule_totals;
+
+#ifdef MMD_PARSE_STATS
+#ifdef MMD_NO_THREADS
+static rule_stats rule_counts;
+#else
+static __thread rule_stats rule_counts;
+#endif
+#endif
+
+#ifdef MMD_PARSE_STATS
+static void * counted_alloc(size_t size) {
+	count_event(&greg_allocations);
+	return malloc(size);
+}
+
+static void * counted_realloc(void *block, size_t size) {
+	count_event(&greg_allocations);
+	return realloc(block, size);
+}
+#endif
+
+/* redefine input buffer so that we draw from the specified source string 
+	to make it thread/reentrant safe -- hand greg as much as it has room for,
+	rather than one byte per call. When parsing a view, move on to the next
+	piece once the current one is used up */
+void yy_input_func(char *buf, int *result, int max_size, parser_data *data)
+{
+	size_t len = 0;
+
+	while ((data->charbuf == data->charbuf_end) && (data->view_next < data->view_count)) {
+		data->charbuf = data->view[data->view_next].text;
+		data->charbuf_end = data->charbuf + data->view[data->view_next].length;
+		data->view_next++;
+	}
+
+	if (data->charbuf != NULL) {
+		len = data->charbuf_end - data->charbuf;
+		if (len > (size_t) max_size)
+			len = max_size;
+
+		memcpy(buf, data->charbuf, len);
+		data->charbuf += len;
+	}
+
+	(*result) = (int) len;
+}
+
+
+#ifndef YY_ALLOC
+#define YY_ALLOC(N, D) malloc(N)
+#endif
+#ifndef YY_CALLOC
+#define YY_CALLOC(N, S, D) calloc(N, S)
+#endif
+#ifndef YY_REALLOC
+#define YY_REALLOC(B, N, D) realloc(B, N)
+#endif
+#ifndef YY_FREE
+#define YY_FREE free
+#endif
+#ifndef YY_LOCAL
+#define YY_LOCAL(T)	static T
+#endif
+#ifndef YY_ACTION
+#define YY_ACTION(T)	static T
+#endif
+#ifndef YY_RULE
+#define YY_RULE(T)	static T
+#endif
+#ifndef YY_PARSE
+#define YY_PARSE(T)	T
+#endif
+#ifndef YY_NAME
+#define YY_NAME(N) yy##N
+#endif
+#ifndef YY_INPUT
+#define YY_INPUT(buf, result, max_size, D)		\
+  {							\
+    int yyc= getchar();					\
+    result= (EOF == yyc) ? 0 : (*(buf)= yyc, 1);	\
+  }
+#endif
+#ifndef YY_BEGIN
+#define YY_BEGIN	( G->begin= G->pos, 1)
+#endif
+#ifndef YY_END
+#define YY_END		( G->end= G->pos, 1)
+#endif
+#ifdef YY_DEBUG
+# define yyprintf(args)	fprintf args
+#else
+# define yyprintf(args)
+#endif
+#ifndef YYSTYPE
+#define YYSTYPE	int
+#endif
+#ifndef YY_XTYPE
+#define YY_XTYPE void *
+#endif
+#ifndef YY_XVAR
+#define YY_XVAR yyxvar
+#endif
+
+#ifndef YY_STACK_SIZE
+#define YY_STACK_SIZE 128
+#endif
+
+#ifndef YY_BUFFER_START_SIZE
+#define YY_BUFFER_START_SIZE 1024
+#endif
+
+#ifndef YY_PART
+
+struct _yythunk; /* forward declaration */
+typedef void (*yyaction)(struct _GREG *G, char *yytext, int yyleng, struct _yythunk *thunkpos, YY_XTYPE YY_XVAR);
+typedef struct _yythunk { int begin, end;  yyaction  action;  struct _yythunk *next; } yythunk;
+
+typedef struct _GREG {
+  char *buf;
+  int buflen;
+  int   offset;
+  int   pos;
+  int   limit;
+  char *text;
+  int   textlen;
+  int   begin;
+  int   end;
+  yythunk *thunks;
+  int   thunkslen;
+  int thunkpos;
+  YYSTYPE ss;
+  YYSTYPE *val;
+  YYSTYPE *vals;
+  int valslen;
+  YY_XTYPE data;
+} GREG;
+
+#define yydata G->data
+#define yy G->ss
+
+YY_LOCAL(int) yyrefill(GREG *G)
+{
+  int yyn;
+  while (G->buflen - G->pos < 512)
+    {
+      G->buflen *= 2;
+      G->buf= (char*)YY_REALLOC(G->buf, G->buflen, G->data);
+    }
+  YY_INPUT((G->buf + G->pos), yyn, (G->buflen - G->pos), G->data);
+  if (!yyn) return 0;
+  G->limit += yyn;
+  return 1;
+}
+
+YY_LOCAL(int) yymatchDot(GREG *G)
+{
+  if (G->pos >= G->limit && !yyrefill(G)) return 0;
+  ++G->pos;
+  return 1;
+}
+
+YY_LOCAL(int) yymatchChar(GREG *G, int c)
+{
+  if (G->pos >= G->limit && !yyrefill(G)) return 0;
+  if ((unsigned char)G->buf[G->pos] == c)
+    {
+      ++G->pos;
+      yyprintf((stderr, "  ok   yymatchChar(%c) @ %s\n", c, G->buf+G->pos));
+      return 1;
+    }
+  yyprintf((stderr, "  fail yymatchChar(%c) @ %s\n", c, G->buf+G->pos));
+  return 0;
+}
+
+YY_LOCAL(int) yymatchString(GREG *G, const char *s)
+{
+  int yysav= G->pos;
+  while (*s)
+    {
+      if (G->pos >= G->limit && !yyrefill(G)) return 0;
+      if (G->buf[G->pos] != *s)
+        {
+          G->pos= yysav;
+          return 0;
+        }
+      ++s;
+      ++G->pos;
+    }
+  return 1;
+}
+
+YY_LOCAL(int) yymatchClass(GREG *G, unsigned char *bits)
+{
+  int c;
+  if (G->pos >= G->limit && !yyrefill(G)) return 0;
+  c= (unsigned char)G->buf[G->pos];
+  if (bits[c >> 3] & (1 << (c & 7)))
+    {
+      ++G->pos;
+      yyprintf((stderr, "  ok   yymatchClass @ %s\n", G->buf+G->pos));
+      return 1;
+    }
+  yyprintf((stderr, "  fail yymatchClass @ %s\n", G->buf+G->pos));
+  return 0;
+}
+
+YY_LOCAL(void) yyDo(GREG *G, yyaction action, int begin, int end)
+{
+  while (G->thunkpos >= G->thunkslen)
+    {
+      G->thunkslen *= 2;
+      G->thunks= (yythunk*)YY_REALLOC(G->thunks, sizeof(yythunk) * G->thunkslen, G->data);
+    }
+  G->thunks[G->thunkpos].begin=  begin;
+  G->thunks[G->thunkpos].end=    end;
+  G->thunks[G->thunkpos].action= action;
+  ++G->thunkpos;
+}
+
+YY_LOCAL(int) yyText(GREG *G, int begin, int end)
+{
+  int yyleng= end - begin;
+  if (yyleng <= 0)
+    yyleng= 0;
+  else
+    {
+      while (G->textlen < (yyleng + 1))
+	{
+	  G->textlen *= 2;
+	  G->text= (char*)YY_REALLOC(G->text, G->textlen, G->data);
+	}
+      memcpy(G->text, G->buf + begin, yyleng);
+    }
+  G->text[yyleng]= '\0';
+  return yyleng;
+}
+
+YY_LOCAL(void) yyDone(GREG *G)
+{
+  int pos;
+  for (pos= 0;  pos < G->thunkpos;  ++pos)
+    {
+      yythunk *thunk= &G->thunks[pos];
+      int yyleng= thunk->end ? yyText(G, thunk->begin, thunk->end) : thunk->begin;
+      yyprintf((stderr, "DO [%d] %p %s\n", pos, thunk->action, G->text));
+      thunk->action(G, G->text, yyleng, thunk, G->data);
+    }
+  G->thunkpos= 0;
+}
+
+YY_LOCAL(void) yyCommit(GREG *G)
+{
+  if ((G->limit -= G->pos))
+    {
+      memmove(G->buf, G->buf + G->pos, G->limit);
+    }
+  G->offset += G->pos;
+  G->begin -= G->pos;
+  G->end -= G->pos;
+  G->pos= G->thunkpos= 0;
+}
+
+YY_LOCAL(int) yyAccept(GREG *G, int tp0)
+{
+  if (tp0)
+    {
+      fprintf(stderr, "accept denied at %d\n", tp0);
+      return 0;
+    }
+  else
+    {
+      yyDone(G);
+      yyCommit(G);
+    }
+  return 1;
+}
+
+YY_LOCAL(void) yyPush(GREG *G, char *text, int count, yythunk *thunk, YY_XTYPE YY_XVAR)
+{
+  size_t off= (G->val - G->vals) + count;
+  if (off > (size_t) G->valslen)
+    {
+      while ((size_t) G->valslen < off + 1)
+        G->valslen *= 2;
+      G->vals= (YYSTYPE*)YY_REALLOC((void*)G->vals, sizeof(YYSTYPE) * G->valslen, G->data);
+      G->val= G->vals + off;
+    }
+  else
+    G->val += count;
+}
+YY_LOCAL(void) yyPop(GREG *G, char *text, int count, yythunk *thunk, YY_XTYPE YY_XVAR)	{ G->val -= count; }
+YY_LOCAL(void) yySet(GREG *G, char *text, int count, yythunk *thunk, YY_XTYPE YY_XVAR)	{ G->val[count]= G->ss; }
+
+#endif /* YY_PART */
+
+#define	YYACCEPT	yyAccept(G, yythunkpos0)
+YY_RULE(int) yy_Doc(GREG *G); /* 1 */
+YY_RULE(int) yy_MetaData(GREG *G); /* 2 */
+YY_RULE(int) yy_MetaDataKeyValue(GREG *G); /* 3 */
+YY_RULE(int) yy_MetaDataKey(GREG *G); /* 4 */
+YY_RULE(int) yy_SingleLineMetaKeyValue(GREG *G); /* 5 */
+YY_RULE(int) yy_MetaDataValue(GREG *G); /* 6 */
+YY_RULE(int) yy_YAMLStart(GREG *G); /* 7 */
+YY_RULE(int) yy_YAMLStop(GREG *G); /* 8 */
+YY_RULE(int) yy_DocForMetaDataOnly(GREG *G); /* 9 */
+YY_RULE(int) yy_Block(GREG *G); /* 10 */
+YY_RULE(int) yy_HeadingSectionBlock(GREG *G); /* 11 */
+YY_RULE(int) yy_TOC(GREG *G); /* 12 */
+YY_RULE(int) yy_Heading(GREG *G); /* 13 */
+YY_RULE(int) yy_HeadingSection(GREG *G); /* 14 */
+YY_RULE(int) yy_AtxInline(GREG *G); /* 15 */
+YY_RULE(int) yy_AtxStart(GREG *G); /* 16 */
+YY_RULE(int) yy_AtxHeading(GREG *G); /* 17 */
+YY_RULE(int) yy_SetextHeading(GREG *G); /* 18 */
+YY_RULE(int) yy_SetextBottom1(GREG *G); /* 19 */
+YY_RULE(int) yy_SetextBottom2(GREG *G); /* 20 */
+YY_RULE(int) yy_SetextHeading1(GREG *G); /* 21 */
+YY_RULE(int) yy_SetextHeading2(GREG *G); /* 22 */
+YY_RULE(int) yy_BlockQuote(GREG *G); /* 23 */
+YY_RULE(int) yy_BlockQuoteRaw(GREG *G); /* 24 */
+YY_RULE(int) yy_BlockQuoteMarker(GREG *G); /* 25 */
+YY_RULE(int) yy_BOM(GREG *G); /* 26 */
+YY_RULE(int) yy_Eof(GREG *G); /* 27 */
+YY_RULE(int) yy_Newline(GREG *G); /* 28 */
+YY_RULE(int) yy_Line(GREG *G); /* 29 */
+YY_RULE(int) yy_LineView(GREG *G); /* 30 */
+YY_RULE(int) yy_RawLine(GREG *G); /* 31 */
+YY_RULE(int) yy_NonMatchingRawLine(GREG *G); /* 32 */
+YY_RULE(int) yy_BlankLine(GREG *G); /* 33 */
+YY_RULE(int) yy_Sp(GREG *G); /* 34 */
+YY_RULE(int) yy_Spnl(GREG *G); /* 35 */
+YY_RULE(int) yy_Spacechar(GREG *G); /* 36 */
+YY_RULE(int) yy_Nonspacechar(GREG *G); /* 37 */
+YY_RULE(int) yy_NormalChar(GREG *G); /* 38 */
+YY_RULE(int) yy_SpecialChar(GREG *G); /* 39 */
+YY_RULE(int) yy_Punctuation(GREG *G); /* 40 */
+YY_RULE(int) yy_NonPunctuation(GREG *G); /* 41 */
+YY_RULE(int) yy_Quoted(GREG *G); /* 42 */
+YY_RULE(int) yy_HtmlAttribute(GREG *G); /* 43 */
+YY_RULE(int) yy_HtmlComment(GREG *G); /* 44 */
+YY_RULE(int) yy_HtmlTag(GREG *G); /* 45 */
+YY_RULE(int) yy_RawHtml(GREG *G); /* 46 */
+YY_RULE(int) yy_Alphanumeric(GREG *G); /* 47 */
+YY_RULE(int) yy_AlphanumericAscii(GREG *G); /* 48 */
+YY_RULE(int) yy_Digit(GREG *G); /* 49 */
+YY_RULE(int) yy_HexEntity(GREG *G); /* 50 */
+YY_RULE(int) yy_DecEntity(GREG *G); /* 51 */
+YY_RULE(int) yy_CharEntity(GREG *G); /* 52 */
+YY_RULE(int) yy_NonindentSpace(GREG *G); /* 53 */
+YY_RULE(int) yy_Indent(GREG *G); /* 54 */
+YY_RULE(int) yy_IndentedLine(GREG *G); /* 55 */
+YY_RULE(int) yy_OptionallyIndentedLine(GREG *G); /* 56 */
+YY_RULE(int) yy_Symbol(GREG *G); /* 57 */
+YY_RULE(int) yy_EscapedChar(GREG *G); /* 58 */
+YY_RULE(int) yy_Entity(GREG *G); /* 59 */
+YY_RULE(int) yy_Para(GREG *G); /* 60 */
+YY_RULE(int) yy_Plain(GREG *G); /* 61 */
+YY_RULE(int) yy_Inlines(GREG *G); /* 62 */
+YY_RULE(int) yy_Inline(GREG *G); /* 63 */
+YY_RULE(int) yy_InlineNoEmph(GREG *G); /* 64 */
+YY_RULE(int) yy_Space(GREG *G); /* 65 */
+YY_RULE(int) yy_Endline(GREG *G); /* 66 */
+YY_RULE(int) yy_NormalEndline(GREG *G); /* 67 */
+YY_RULE(int) yy_TerminalEndline(GREG *G); /* 68 */
+YY_RULE(int) yy_LineBreak(GREG *G); /* 69 */
+YY_RULE(int) yy_voidEndline(GREG *G); /* 70 */
+YY_RULE(int) yy_voidNormalEndline(GREG *G); /* 71 */
+YY_RULE(int) yy_Str(GREG *G); /* 72 */
+YY_RULE(int) yy_StrChunk(GREG *G); /* 73 */
+YY_RULE(int) yy_AposChunk(GREG *G); /* 74 */
+YY_RULE(int) yy_Superscript(GREG *G); /* 75 */
+YY_RULE(int) yy_Subscript(GREG *G); /* 76 */
+YY_RULE(int) yy_StartList(GREG *G); /* 77 */
+YY_RULE(int) yy_MathSpan(GREG *G); /* 78 */
+YY_RULE(int) yy_SingleDollarMathStart(GREG *G); /* 79 */
+YY_RULE(int) yy_SingleDollarMathEnd(GREG *G); /* 80 */
+YY_RULE(int) yy_SingleDollarMath(GREG *G); /* 81 */
+YY_RULE(int) yy_DoubleDollarMathStart(GREG *G); /* 82 */
+YY_RULE(int) yy_DoubleDollarMathEnd(GREG *G); /* 83 */
+YY_RULE(int) yy_DoubleDollarMath(GREG *G); /* 84 */
+YY_RULE(int) yy_DollarMath(GREG *G); /* 85 */
+YY_RULE(int) yy_UlOrStarLine(GREG *G); /* 86 */
+YY_RULE(int) yy_StarLine(GREG *G); /* 87 */
+YY_RULE(int) yy_UlLine(GREG *G); /* 88 */
+YY_RULE(int) yy_Whitespace(GREG *G); /* 89 */
+YY_RULE(int) yy_EmphDelimiter(GREG *G); /* 90 */
+YY_RULE(int) yy_Emph(GREG *G); /* 91 */
+YY_RULE(int) yy_EmphMatch(GREG *G); /* 92 */
+YY_RULE(int) yy_EmphStar(GREG *G); /* 93 */
+YY_RULE(int) yy_EmphUl(GREG *G); /* 94 */
+YY_RULE(int) yy_Strong(GREG *G); /* 95 */
+YY_RULE(int) yy_StrongMatch(GREG *G); /* 96 */
+YY_RULE(int) yy_StrongStar(GREG *G); /* 97 */
+YY_RULE(int) yy_StrongUl(GREG *G); /* 98 */
+YY_RULE(int) yy_StrongAndEmph(GREG *G); /* 99 */
+YY_RULE(int) yy_EmphAndStrongStar(GREG *G); /* 100 */
+YY_RULE(int) yy_PossibleEmphStrongStar(GREG *G); /* 101 */
+YY_RULE(int) yy_EmphAndStrongUl(GREG *G); /* 102 */
+YY_RULE(int) yy_PossibleEmphStrongUl(GREG *G); /* 103 */
+YY_RULE(int) yy_Link(GREG *G); /* 104 */
+YY_RULE(int) yy_ReferenceLink(GREG *G); /* 105 */
+YY_RULE(int) yy_ReferenceLinkDouble(GREG *G); /* 106 */
+YY_RULE(int) yy_ReferenceLinkSingle(GREG *G); /* 107 */
+YY_RULE(int) yy_CitationReference(GREG *G); /* 108 */
+YY_RULE(int) yy_CitationReferenceDouble(GREG *G); /* 109 */
+YY_RULE(int) yy_CitationReferenceSingle(GREG *G); /* 110 */
+YY_RULE(int) yy_RawCitationReference(GREG *G); /* 111 */
+YY_RULE(int) yy_Variable(GREG *G); /* 112 */
+YY_RULE(int) yy_ExplicitLink(GREG *G); /* 113 */
+YY_RULE(int) yy_Source(GREG *G); /* 114 */
+YY_RULE(int) yy_SourceContents(GREG *G); /* 115 */
+YY_RULE(int) yy_Title(GREG *G); /* 116 */
+YY_RULE(int) yy_TitleSingle(GREG *G); /* 117 */
+YY_RULE(int) yy_TitleDouble(GREG *G); /* 118 */
+YY_RULE(int) yy_AutoLink(GREG *G); /* 119 */
+YY_RULE(int) yy_AutoLinkUrl(GREG *G); /* 120 */
+YY_RULE(int) yy_AutoLinkEmail(GREG *G); /* 121 */
+YY_RULE(int) yy_LinkReference(GREG *G); /* 122 */
+YY_RULE(int) yy_Attributes(GREG *G); /* 123 */
+YY_RULE(int) yy_Attribute(GREG *G); /* 124 */
+YY_RULE(int) yy_AttrKey(GREG *G); /* 125 */
+YY_RULE(int) yy_AttrValue(GREG *G); /* 126 */
+YY_RULE(int) yy_RefSrc(GREG *G); /* 127 */
+YY_RULE(int) yy_RefTitle(GREG *G); /* 128 */
+YY_RULE(int) yy_EmptyTitle(GREG *G); /* 129 */
+YY_RULE(int) yy_RefTitleSingle(GREG *G); /* 130 */
+YY_RULE(int) yy_RefTitleDouble(GREG *G); /* 131 */
+YY_RULE(int) yy_RefTitleParens(GREG *G); /* 132 */
+YY_RULE(int) yy_QuotedValue(GREG *G); /* 133 */
+YY_RULE(int) yy_UnQuotedValue(GREG *G); /* 134 */
+YY_RULE(int) yy_Abbreviation(GREG *G); /* 135 */
+YY_RULE(int) yy_ImageBlock(GREG *G); /* 136 */
+YY_RULE(int) yy_Image(GREG *G); /* 137 */
+YY_RULE(int) yy_Label(GREG *G); /* 138 */
+YY_RULE(int) yy_LabelStart(GREG *G); /* 139 */
+YY_RULE(int) yy_AutoLabel(GREG *G); /* 140 */
+YY_RULE(int) yy_RawInline(GREG *G); /* 141 */
+YY_RULE(int) yy_NoteReference(GREG *G); /* 142 */
+YY_RULE(int) yy_Glossary(GREG *G); /* 143 */
+YY_RULE(int) yy_GlossaryTerm(GREG *G); /* 144 */
+YY_RULE(int) yy_GlossarySortKey(GREG *G); /* 145 */
+YY_RULE(int) yy_Ticks1(GREG *G); /* 146 */
+YY_RULE(int) yy_Ticks2(GREG *G); /* 147 */
+YY_RULE(int) yy_Ticks3(GREG *G); /* 148 */
+YY_RULE(int) yy_Ticks4(GREG *G); /* 149 */
+YY_RULE(int) yy_Ticks5(GREG *G); /* 150 */
+YY_RULE(int) yy_Code(GREG *G); /* 151 */
+YY_RULE(int) yy_FenceType(GREG *G); /* 152 */
+YY_RULE(int) yy_Fenced(GREG *G); /* 153 */
+YY_RULE(int) yy_Smart(GREG *G); /* 154 */
+YY_RULE(int) yy_Apostrophe(GREG *G); /* 155 */
+YY_RULE(int) yy_Ellipsis(GREG *G); /* 156 */
+YY_RULE(int) yy_Dash(GREG *G); /* 157 */
+YY_RULE(int) yy_EnDash(GREG *G); /* 158 */
+YY_RULE(int) yy_EmDash(GREG *G); /* 159 */
+YY_RULE(int) yy_SingleQuoteStart(GREG *G); /* 160 */
+YY_RULE(int) yy_SingleQuoteEnd(GREG *G); /* 161 */
+YY_RULE(int) yy_SingleQuoted(GREG *G); /* 162 */
+YY_RULE(int) yy_DoubleQuoteStart(GREG *G); /* 163 */
+YY_RULE(int) yy_DoubleQuoteEnd(GREG *G); /* 164 */
+YY_RULE(int) yy_DoubleQuoted(GREG *G); /* 165 */
+YY_RULE(int) yy_BackTickStart(GREG *G); /* 166 */
+YY_RULE(int) yy_BackTickEnd(GREG *G); /* 167 */
+YY_RULE(int) yy_BackTickQuoted(GREG *G); /* 168 */
+YY_RULE(int) yy_NonblankIndentedLine(GREG *G); /* 169 */
+YY_RULE(int) yy_VerbatimChunk(GREG *G); /* 170 */
+YY_RULE(int) yy_Verbatim(GREG *G); /* 171 */
+YY_RULE(int) yy_HorizontalRule(GREG *G); /* 172 */
+YY_RULE(int) yy_DefinitionList(GREG *G); /* 173 */
+YY_RULE(int) yy_TermLine(GREG *G); /* 174 */
+YY_RULE(int) yy_Term(GREG *G); /* 175 */
+YY_RULE(int) yy_Definition(GREG *G); /* 176 */
+YY_RULE(int) yy_Bullet(GREG *G); /* 177 */
+YY_RULE(int) yy_BulletNoSpace(GREG *G); /* 178 */
+YY_RULE(int) yy_BulletList(GREG *G); /* 179 */
+YY_RULE(int) yy_ListTight(GREG *G); /* 180 */
+YY_RULE(int) yy_ListLoose(GREG *G); /* 181 */
+YY_RULE(int) yy_ListItem(GREG *G); /* 182 */
+YY_RULE(int) yy_ListItemTight(GREG *G); /* 183 */
+YY_RULE(int) yy_EmptyList(GREG *G); /* 184 */
+YY_RULE(int) yy_ListBlock(GREG *G); /* 185 */
+YY_RULE(int) yy_ListContinuationBlock(GREG *G); /* 186 */
+YY_RULE(int) yy_Enumerator(GREG *G); /* 187 */
+YY_RULE(int) yy_EnumeratorNoSpace(GREG *G); /* 188 */
+YY_RULE(int) yy_OrderedList(GREG *G); /* 189 */
+YY_RULE(int) yy_ListBlockLine(GREG *G); /* 190 */
+YY_RULE(int) yy_HtmlBlockInTags(GREG *G); /* 191 */
+YY_RULE(int) yy_HtmlBlockScript(GREG *G); /* 192 */
+YY_RULE(int) yy_HtmlBlock(GREG *G); /* 193 */
+YY_RULE(int) yy_MarkdownHtmlBlock(GREG *G); /* 194 */
+YY_RULE(int) yy_MarkdownHtmlAttribute(GREG *G); /* 195 */
+YY_RULE(int) yy_MarkdownHtmlTagOpen(GREG *G); /* 196 */
+YY_RULE(int) yy_HtmlBlockSelfClosing(GREG *G); /* 197 */
+YY_RULE(int) yy_HtmlBlockType(GREG *G); /* 198 */
+YY_RULE(int) yy_StyleOpen(GREG *G); /* 199 */
+YY_RULE(int) yy_StyleClose(GREG *G); /* 200 */
+YY_RULE(int) yy_InStyleTags(GREG *G); /* 201 */
+YY_RULE(int) yy_StyleBlock(GREG *G); /* 202 */
+YY_RULE(int) yy_Table(GREG *G); /* 203 */
+YY_RULE(int) yy_TableBody(GREG *G); /* 204 */
+YY_RULE(int) yy_TableRow(GREG *G); /* 205 */
+YY_RULE(int) yy_TableLine(GREG *G); /* 206 */
+YY_RULE(int) yy_TableCell(GREG *G); /* 207 */
+YY_RULE(int) yy_ExtendedCell(GREG *G); /* 208 */
+YY_RULE(int) yy_FullCell(GREG *G); /* 209 */
+YY_RULE(int) yy_EmptyCell(GREG *G); /* 210 */
+YY_RULE(int) yy_SeparatorLine(GREG *G); /* 211 */
+YY_RULE(int) yy_HeaderAlignmentCell(GREG *G); /* 212 */
+YY_RULE(int) yy_AlignmentCell(GREG *G); /* 213 */
+YY_RULE(int) yy_LeftAlignWrap(GREG *G); /* 214 */
+YY_RULE(int) yy_LeftAlign(GREG *G); /* 215 */
+YY_RULE(int) yy_CenterAlignWrap(GREG *G); /* 216 */
+YY_RULE(int) yy_CenterAlign(GREG *G); /* 217 */
+YY_RULE(int) yy_RightAlignWrap(GREG *G); /* 218 */
+YY_RULE(int) yy_RightAlign(GREG *G); /* 219 */
+YY_RULE(int) yy_CellDivider(GREG *G); /* 220 */
+YY_RULE(int) yy_BracketedText(GREG *G); /* 221 */
+YY_RULE(int) yy_TableCaption(GREG *G); /* 222 */
+YY_RULE(int) yy_RawNoteReference(GREG *G); /* 223 */
+YY_RULE(int) yy_Note(GREG *G); /* 224 */
+YY_RULE(int) yy_RawNoteBlock(GREG *G); /* 225 */
+YY_RULE(int) yy_DocForOPML(GREG *G); /* 226 */
+YY_RULE(int) yy_OPMLBlock(GREG *G); /* 227 */
+YY_RULE(int) yy_OPMLHeadingSection(GREG *G); /* 228 */
+YY_RULE(int) yy_OPMLHeading(GREG *G); /* 229 */
+YY_RULE(int) yy_OPMLAtxHeading(GREG *G); /* 230 */
+YY_RULE(int) yy_OPMLSetextHeading(GREG *G); /* 231 */
+YY_RULE(int) yy_OPMLSetextHeading1(GREG *G); /* 232 */
+YY_RULE(int) yy_OPMLSetextHeading2(GREG *G); /* 233 */
+YY_RULE(int) yy_OPMLSectionBlock(GREG *G); /* 234 */
+YY_RULE(int) yy_OPMLPlain(GREG *G); /* 235 */
+YY_RULE(int) yy_DocForTOC(GREG *G); /* 236 */
+YY_RULE(int) yy_TOCBlock(GREG *G); /* 237 */
+YY_RULE(int) yy_TOCHeadingSection(GREG *G); /* 238 */
+YY_RULE(int) yy_TOCSectionBlock(GREG *G); /* 239 */
+YY_RULE(int) yy_TOCPlain(GREG *G); /* 240 */
+YY_RULE(int) yy_CriticMarkup(GREG *G); /* 241 */
+YY_RULE(int) yy_CriticAddition(GREG *G); /* 242 */
+YY_RULE(int) yy_CriticDeletion(GREG *G); /* 243 */
+YY_RULE(int) yy_CriticSubstitution(GREG *G); /* 244 */
+YY_RULE(int) yy_CriticSubstDel(GREG *G); /* 245 */
+YY_RULE(int) yy_CriticSubstAdd(GREG *G); /* 246 */
+YY_RULE(int) yy_CriticHighlight(GREG *G); /* 247 */
+YY_RULE(int) yy_CriticComment(GREG *G); /* 248 */
+
+YY_ACTION(void) yy_1_CriticComment(GREG *G, char *yytext, int yyleng, yythunk *thunk, YY_XTYPE YY_XVAR)
+{
+  yyprintf((stderr, "do yy_1_CriticComment\n"));
+   yy = str(yytext); yy->key = CRITICCOMMENT; ;
+}
+YY_ACTION(void) yy_1_CriticHighlight(GREG *G, char *yytext, int yyleng, yythunk *thunk, YY_XTYPE YY_XVAR)
+{
+  yyprintf((stderr, "do yy_1_CriticHighlight\n"));
+   yy = str(yytext); yy->key = CRITICHIGHLIGHT; ;
+}
+YY_ACTION(void) yy_1_CriticSubstAdd(GREG *G, char *yytext, int yyleng, yythunk *thunk, YY_XTYPE YY_XVAR)
+{
+  yyprintf((stderr, "do yy_1_CriticSubstAdd\n"));
+   yy = str(yytext); yy->key = CRITICADDITION; ;
+}
+YY_ACTION(void) yy_1_CriticSubstDel(GREG *G, char *yytext, int yyleng, yythunk *thunk, YY_XTYPE YY_XVAR)
+{
+  yyprintf((stderr, "do yy_1_CriticSubstDel\n"));
+   yy = str(yytext); yy->key = CRITICDELETION; ;
+}
+YY_ACTION(void) yy_3_CriticSubstitution(GREG *G, char *yytext, int yyleng, yythunk *thunk, YY_XTYPE YY_XVAR)
+{
+#define a G->val[-1]
+  yyprintf((stderr, "do yy_3_CriticSubstitution\n"));
+   yy = list(CRITICSUBSTITUTION, a); ;
+#undef a
+}
+YY_ACTION(void) yy_2_CriticSubstitution(GREG *G, char *yytext, int yyleng, yythunk *thunk, YY_XTYPE YY_XVAR)
+{
+#define a G->val[-1]
+  yyprintf((stderr, "do yy_2_CriticSubstitution\n"));
+   a = add_node(a, yy); ;
+#undef a
+}
+YY_ACTION(void) yy_1_CriticSubstitution(GREG *G, char *yytext, int yyleng, yythunk *thunk, YY_XTYPE YY_XVAR)
+{
+#define a G->val[-1]
+  yyprintf((stderr, "do yy_1_CriticSubstitution\n"));
+   a = add_node(a, yy); ;
+#undef a
+}
+YY_ACTION(void) yy_1_CriticDeletion(GREG *G, char *yytext, int yyleng, yythunk *thunk, YY_XTYPE YY_XVAR)
+{
+  yyprintf((stderr, "do yy_1_CriticDeletion\n"));
+   yy = str(yytext); yy->key = CRITICDELETION; ;
+}
+YY_ACTION(void) yy_1_CriticAddition(GREG *G, char *yytext, int yyleng, yythunk *thunk, YY_XTYPE YY_XVAR)
+{
+  yyprintf((stderr, "do yy_1_CriticAddition\n"));
+   yy = str(yytext); yy->key = CRITICADDITION; ;
+}
+YY_ACTION(void) yy_2_TOCPlain(GREG *G, char *yytext, int yyleng, yythunk *thunk, YY_XTYPE YY_XVAR)
+{
+#define y G->val[-1]
+#define z G->val[-2]
+  yyprintf((stderr, "do yy_2_TOCPlain\n"));
+   free_node_tree(z); ;
+#undef z
+#undef y
+}
+YY_ACTION(void) yy_1_TOCPlain(GREG *G, char *yytext, int yyleng, yythunk *thunk, YY_XTYPE YY_XVAR)
+{
+#define y G->val[-1]
+#define z G->val[-2]
+  yyprintf((stderr, "do yy_1_TOCPlain\n"));
+   free_node_tree(y); ;
+#undef z
+#undef y
+}
+YY_ACTION(void) yy_2_TOCHeadingSection(GREG *G, char *yytext, int yyleng, yythunk *thunk, YY_XTYPE YY_XVAR)
+{
+#define a G->val[-1]
+  yyprintf((stderr, "do yy_2_TOCHeadingSection\n"));
+   yy = mk_list(HEADINGSECTION, a); ;
+#undef a
+}
+YY_ACTION(void) yy_1_TOCHeadingSection(GREG *G, char *yytext, int yyleng, yythunk *thunk, YY_XTYPE YY_XVAR)
+{
+#define a G->val[-1]
+  yyprintf((stderr, "do yy_1_TOCHeadingSection\n"));
+   a = add_node(a, yy); ;
+#undef a
+}
+YY_ACTION(void) yy_3_DocForTOC(GREG *G, char *yytext, int yyleng, yythunk *thunk, YY_XTYPE YY_XVAR)
+{
+#define a G->val[-1]
+#define z G->val[-2]
+  yyprintf((stderr, "do yy_3_DocForTOC\n"));
+   ((parser_data *)G->data)->result = close_list(a); ;
+#undef z
+#undef a
+}
+YY_ACTION(void) yy_2_DocForTOC(GREG *G, char *yytext, int yyleng, yythunk *thunk, YY_XTYPE YY_XVAR)
+{
+#define a G->val[-1]
+#define z G->val[-2]
+  yyprintf((stderr, "do yy_2_DocForTOC\n"));
+   a = add_node(a, yy); ;
+#undef z
+#undef a
+}
+YY_ACTION(void) yy_1_DocForTOC(GREG *G, char *yytext, int yyleng, yythunk *thunk, YY_XTYPE YY_XVAR)
+{
+#define a G->val[-1]
+#define z G->val[-2]
+  yyprintf((stderr, "do yy_1_DocForTOC\n"));
+   free_node_tree(z); ;
+#undef z
+#undef a
+}
+YY_ACTION(void) yy_2_OPMLPlain(GREG *G, char *yytext, int yyleng, yythunk *thunk, YY_XTYPE YY_XVAR)
+{
+#define a G->val[-1]
+  yyprintf((stderr, "do yy_2_OPMLPlain\n"));
+   yy = mk_list(PLAIN, a); ;
+#undef a
+}
+YY_ACTION(void) yy_1_OPMLPlain(GREG *G, char *yytext, int yyleng, yythunk *thunk, YY_XTYPE YY_XVAR)
+{
+#define a G->val[-1]
+  yyprintf((stderr, "do yy_1_OPMLPlain\n"));
+   a = add_node(a, yy); ;
+#undef a
+}
+YY_ACTION(void) yy_1_OPMLSetextHeading2(GREG *G, char *yytext, int yyleng, yythunk *thunk, YY_XTYPE YY_XVAR)
+{
+  yyprintf((stderr, "do yy_1_OPMLSetextHeading2\n"));
+   yy = str(yytext); yy->key = H2; ;
+}
+YY_ACTION(void) yy_1_OPMLSetextHeading1(GREG *G, char *yytext, int yyleng, yythunk *thunk, YY_XTYPE YY_XVAR)
+{
+  yyprintf((stderr, "do yy_1_OPMLSetextHeading1\n"));
+   yy = str(yytext); yy->key = H1; ;
+}
+YY_ACTION(void) yy_1_OPMLAtxHeading(GREG *G, char *yytext, int yyleng, yythunk *thunk, YY_XTYPE YY_XVAR)
+{
+#define s G->val[-1]
+  yyprintf((stderr, "do yy_1_OPMLAtxHeading\n"));
+  
+			yy = str(yytext);
+			yy->key = s->key;
+			free_node(s);
+		;
+#undef s
+}
+YY_ACTION(void) yy_3_OPMLHeadingSection(GREG *G, char *yytext, int yyleng, yythunk *thunk, YY_XTYPE YY_XVAR)
+{
+#define a G->val[-1]
+  yyprintf((stderr, "do yy_3_OPMLHeadingSection\n"));
+   yy = mk_list(HEADINGSECTION, a);;
+#undef a
+}
+YY_ACTION(void) yy_2_OPMLHeadingSection(GREG *G, char *yytext, int yyleng, yythunk *thunk, YY_XTYPE YY_XVAR)
+{
+#define a G->val[-1]
+  yyprintf((stderr, "do yy_2_OPMLHeadingSection\n"));
+  a = add_node(a, yy); ;
+#undef a
+}
+YY_ACTION(void) yy_1_OPMLHeadingSection(GREG *G, char *yytext, int yyleng, yythunk *thunk, YY_XTYPE YY_XVAR)
+{
+#define a G->val[-1]
+  yyprintf((stderr, "do yy_1_OPMLHeadingSection\n"));
+   a = add_node(a, yy); ;
+#undef a
+}
+YY_ACTION(void) yy_3_DocForOPML(GREG *G, char *yytext, int yyleng, yythunk *thunk, YY_XTYPE YY_XVAR)
+{
+#define a G->val[-1]
+  yyprintf((stderr, "do yy_3_DocForOPML\n"));
+   ((parser_data *)G->data)->result = close_list(a); ;
+#undef a
+}
+YY_ACTION(void) yy_2_DocForOPML(GREG *G, char *yytext, int yyleng, yythunk *thunk, YY_XTYPE YY_XVAR)
+{
+#define a G->val[-1]
+  yyprintf((stderr, "do yy_2_DocForOPML\n"));
+   a = add_node(a, yy); ;
+#undef a
+}
+YY_ACTION(void) yy_1_DocForOPML(GREG *G, char *yytext, int yyleng, yythunk *thunk, YY_XTYPE YY_XVAR)
+{
+#define a G->val[-1]
+  yyprintf((stderr, "do yy_1_DocForOPML\n"));
+   a = add_node(a, yy); ;
+#undef a
+}
+YY_ACTION(void) yy_3_RawNoteBlock(GREG *G, char *yytext, int yyleng, yythunk *thunk, YY_XTYPE YY_XVAR)
+{
+#define a G->val[-1]
+  yyprintf((stderr, "do yy_3_RawNoteBlock\n"));
+   yy = mk_raw_from_list(a, true); ;
+#undef a
+}
+YY_ACTION(void) yy_2_RawNoteBlock(GREG *G, char *yytext, int yyleng, yythunk *thunk, YY_XTYPE YY_XVAR)
+{
+#define a G->val[-1]
+  yyprintf((stderr, "do yy_2_RawNoteBlock\n"));
+   a = add_node(a, view()); ;
+#undef a
+}
+YY_ACTION(void) yy_1_RawNoteBlock(GREG *G, char *yytext, int yyleng, yythunk *thunk, YY_XTYPE YY_XVAR)
+{
+#define a G->val[-1]
+  yyprintf((stderr, "do yy_1_RawNoteBlock\n"));
+   a = add_node(a, yy); ;
+#undef a
+}
+YY_ACTION(void) yy_3_Note(GREG *G, char *yytext, int yyleng, yythunk *thunk, YY_XTYPE YY_XVAR)
+{
+#define ref G->val[-1]
+#define a G->val[-2]
+  yyprintf((stderr, "do yy_3_Note\n"));
+  
+			node *label;
+			label = str(ref->str);
+			label->key = NOTELABEL;
+			a = add_node(a, label);
+			yy = list(NOTESOURCE, a);
+			yy->str = strdup(ref->str);
+			
+			free_node(ref);
+		;
+#undef a
+#undef ref
+}
+YY_ACTION(void) yy_2_Note(GREG *G, char *yytext, int yyleng, yythunk *thunk, YY_XTYPE YY_XVAR)
+{
+#define ref G->val[-1]
+#define a G->val[-2]
+  yyprintf((stderr, "do yy_2_Note\n"));
+   a = add_node(a, yy); ;
+#undef a
+#undef ref
+}
+YY_ACTION(void) yy_1_Note(GREG *G, char *yytext, int yyleng, yythunk *thunk, YY_XTYPE YY_XVAR)
+{
+#define ref G->val[-1]
+#define a G->val[-2]
+  yyprintf((stderr, "do yy_1_Note\n"));
+   a = add_node(a, yy); ;
+#undef a
+#undef ref
+}
+YY_ACTION(void) yy_1_RawNoteReference(GREG *G, char *yytext, int yyleng, yythunk *thunk, YY_XTYPE YY_XVAR)
+{
+  yyprintf((stderr, "do yy_1_RawNoteReference\n"));
+   yy = str(yytext); ;
+}
+YY_ACTION(void) yy_3_TableCaption(GREG *G, char *yytext, int yyleng, yythunk *thunk, YY_XTYPE YY_XVAR)
+{
+#define b G->val[-1]
+#define a G->val[-2]
+#define c G->val[-3]
+  yyprintf((stderr, "do yy_3_TableCaption\n"));
+  
+			yy = a;
+			yy->key = TABLECAPTION;
+
+			if ( (b != NULL) && (b->key == TABLELABEL) ) {
+				b->next = yy->children;
+				yy->children = b;
+			}
+		;
+#undef c
+#undef a
+#undef b
+}
+YY_ACTION(void) yy_2_TableCaption(GREG *G, char *yytext, int yyleng, yythunk *thunk, YY_XTYPE YY_XVAR)
+{
+#define b G->val[-1]
+#define a G->val[-2]
+#define c G->val[-3]
+  yyprintf((stderr, "do yy_2_TableCaption\n"));
+   b = c; b->key = TABLELABEL;;
+#undef c
+#undef a
+#undef b
+}
+YY_ACTION(void) yy_1_TableCaption(GREG *G, char *yytext, int yyleng, yythunk *thunk, YY_XTYPE YY_XVAR)
+{
+#define b G->val[-1]
+#define a G->val[-2]
+#define c G->val[-3]
+  yyprintf((stderr, "do yy_1_TableCaption\n"));
+  
+		yytext[strlen(yytext) - 1] = '\0';
+		a = parse_chunk(&yytext[1], ((parser_data *)G->data)->extensions, (parser_data *)G->data, thunk->begin + 1);
+	;
+#undef c
+#undef a
+#undef b
+}
+YY_ACTION(void) yy_1_RightAlign(GREG *G, char *yytext, int yyleng, yythunk *thunk, YY_XTYPE YY_XVAR)
+{
+  yyprintf((stderr, "do yy_1_RightAlign\n"));
+   yy = mk_str("r");;
+}
+YY_ACTION(void) yy_1_RightAlignWrap(GREG *G, char *yytext, int yyleng, yythunk *thunk, YY_XTYPE YY_XVAR)
+{
+  yyprintf((stderr, "do yy_1_RightAlignWrap\n"));
+   yy = mk_str("R");;
+}
+YY_ACTION(void) yy_1_CenterAlign(GREG *G, char *yytext, int yyleng, yythunk *thunk, YY_XTYPE YY_XVAR)
+{
+  yyprintf((stderr, "do yy_1_CenterAlign\n"));
+   yy = mk_str("c");;
+}
+YY_ACTION(void) yy_1_CenterAlignWrap(GREG *G, char *yytext, int yyleng, yythunk *thunk, YY_XTYPE YY_XVAR)
+{
+  yyprintf((stderr, "do yy_1_CenterAlignWrap\n"));
+   yy = mk_str("C");;
+}
+YY_ACTION(void) yy_1_LeftAlign(GREG *G, char *yytext, int yyleng, yythunk *thunk, YY_XTYPE YY_XVAR)
+{
+  yyprintf((stderr, "do yy_1_LeftAlign\n"));
+   yy = mk_str("l");;
+}
+YY_ACTION(void) yy_1_LeftAlignWrap(GREG *G, char *yytext, int yyleng, yythunk *thunk, YY_XTYPE YY_XVAR)
+{
+  yyprintf((stderr, "do yy_1_LeftAlignWrap\n"));
+   yy = mk_str("L");;
+}
+YY_ACTION(void) yy_3_SeparatorLine(GREG *G, char *yytext, int yyleng, yythunk *thunk, YY_XTYPE YY_XVAR)
+{
+#define a G->val[-1]
+  yyprintf((stderr, "do yy_3_SeparatorLine\n"));
+  
+			yy = mk_str_from_list(a,false);
+			yy->key = TABLESEPARATOR;
+		;
+#undef a
+}
+YY_ACTION(void) yy_2_SeparatorLine(GREG *G, char *yytext, int yyleng, yythunk *thunk, YY_XTYPE YY_XVAR)
+{
+#define a G->val[-1]
+  yyprintf((stderr, "do yy_2_SeparatorLine\n"));
+   a = add_node(a, yy); ;
+#undef a
+}
+YY_ACTION(void) yy_1_SeparatorLine(GREG *G, char *yytext, int yyleng, yythunk *thunk, YY_XTYPE YY_XVAR)
+{
+#define a G->val[-1]
+  yyprintf((stderr, "do yy_1_SeparatorLine\n"));
+   a = add_node(a, str("h")); a = add_node(a, yy);;
+#undef a
+}
+YY_ACTION(void) yy_1_EmptyCell(GREG *G, char *yytext, int yyleng, yythunk *thunk, YY_XTYPE YY_XVAR)
+{
+  yyprintf((stderr, "do yy_1_EmptyCell\n"));
+   yy = node(TABLECELL); ;
+}
+YY_ACTION(void) yy_2_FullCell(GREG *G, char *yytext, int yyleng, yythunk *thunk, YY_XTYPE YY_XVAR)
+{
+#define a G->val[-1]
+  yyprintf((stderr, "do yy_2_FullCell\n"));
+   yy = list(TABLECELL,a); ;
+#undef a
+}
+YY_ACTION(void) yy_1_FullCell(GREG *G, char *yytext, int yyleng, yythunk *thunk, YY_XTYPE YY_XVAR)
+{
+#define a G->val[-1]
+  yyprintf((stderr, "do yy_1_FullCell\n"));
+   a = add_node(a, yy);
+#undef a
+}
+YY_ACTION(void) yy_1_ExtendedCell(GREG *G, char *yytext, int yyleng, yythunk *thunk, YY_XTYPE YY_XVAR)
+{
+  yyprintf((stderr, "do yy_1_ExtendedCell\n"));
+  
+		node *span;
+		span = str(yytext);
+		span->key = CELLSPAN;
+		span->next = yy->children;
+		yy->children = span;
+    ;
+}
+YY_ACTION(void) yy_2_TableRow(GREG *G, char *yytext, int yyleng, yythunk *thunk, YY_XTYPE YY_XVAR)
+{
+#define a G->val[-1]
+  yyprintf((stderr, "do yy_2_TableRow\n"));
+   yy = list(TABLEROW, a); ;
+#undef a
+}
+YY_ACTION(void) yy_1_TableRow(GREG *G, char *yytext, int yyleng, yythunk *thunk, YY_XTYPE YY_XVAR)
+{
+#define a G->val[-1]
+  yyprintf((stderr, "do yy_1_TableRow\n"));
+   a = add_node(a, yy); ;
+#undef a
+}
+YY_ACTION(void) yy_2_TableBody(GREG *G, char *yytext, int yyleng, yythunk *thunk, YY_XTYPE YY_XVAR)
+{
+#define a G->val[-1]
+  yyprintf((stderr, "do yy_2_TableBody\n"));
+   yy = list(TABLEBODY, a);;
+#undef a
+}
+YY_ACTION(void) yy_1_TableBody(GREG *G, char *yytext, int yyleng, yythunk *thunk, YY_XTYPE YY_XVAR)
+{
+#define a G->val[-1]
+  yyprintf((stderr, "do yy_1_TableBody\n"));
+  a = add_node(a, yy);;
+#undef a
+}
+YY_ACTION(void) yy_7_Table(GREG *G, char *yytext, int yyleng, yythunk *thunk, YY_XTYPE YY_XVAR)
+{
+#define a G->val[-1]
+#define b G->val[-2]
+  yyprintf((stderr, "do yy_7_Table\n"));
+  
+			a = join_lists(b, a);
+			yy = list(TABLE, a);
+		;
+#undef b
+#undef a
+}
+YY_ACTION(void) yy_6_Table(GREG *G, char *yytext, int yyleng, yythunk *thunk, YY_XTYPE YY_XVAR)
+{
+#define a G->val[-1]
+#define b G->val[-2]
+  yyprintf((stderr, "do yy_6_Table\n"));
+   b = add_node(b, yy);;
+#undef b
+#undef a
+}
+YY_ACTION(void) yy_5_Table(GREG *G, char *yytext, int yyleng, yythunk *thunk, YY_XTYPE YY_XVAR)
+{
+#define a G->val[-1]
+#define b G->val[-2]
+  yyprintf((stderr, "do yy_5_Table\n"));
+   a = add_node(a, yy); ;
+#undef b
+#undef a
+}
+YY_ACTION(void) yy_4_Table(GREG *G, char *yytext, int yyleng, yythunk *thunk, YY_XTYPE YY_XVAR)
+{
+#define a G->val[-1]
+#define b G->val[-2]
+  yyprintf((stderr, "do yy_4_Table\n"));
+   a = add_node(a, yy);;
+#undef b
+#undef a
+}
+YY_ACTION(void) yy_3_Table(GREG *G, char *yytext, int yyleng, yythunk *thunk, YY_XTYPE YY_XVAR)
+{
+#define a G->val[-1]
+#define b G->val[-2]
+  yyprintf((stderr, "do yy_3_Table\n"));
+   a = add_node_first(a, yy); ;
+#undef b
+#undef a
+}
+YY_ACTION(void) yy_2_Table(GREG *G, char *yytext, int yyleng, yythunk *thunk, YY_XTYPE YY_XVAR)
+{
+#define a G->val[-1]
+#define b G->val[-2]
+  yyprintf((stderr, "do yy_2_Table\n"));
+   yy->key = TABLEHEAD; a = add_node(a, yy); ;
+#undef b
+#undef a
+}
+YY_ACTION(void) yy_1_Table(GREG *G, char *yytext, int yyleng, yythunk *thunk, YY_XTYPE YY_XVAR)
+{
+#define a G->val[-1]
+#define b G->val[-2]
+  yyprintf((stderr, "do yy_1_Table\n"));
+   b = add_node(b, yy);;
+#undef b
+#undef a
+}
+YY_ACTION(void) yy_1_StyleBlock(GREG *G, char *yytext, int yyleng, yythunk *thunk, YY_XTYPE YY_XVAR)
+{
+  yyprintf((stderr, "do yy_1_StyleBlock\n"));
+  
+			if (ext(EXT_FILTER_STYLES)) {
+				yy = mk_list(LIST, NULL);
+			} else {
+				yy = mk_str(yytext);
+				yy->key = HTMLBLOCK;
+			}
+		;
+}
+YY_ACTION(void) yy_6_MarkdownHtmlTagOpen(GREG *G, char *yytext, int yyleng, yythunk *thunk, YY_XTYPE YY_XVAR)
+{
+#define a G->val[-1]
+  yyprintf((stderr, "do yy_6_MarkdownHtmlTagOpen\n"));
+   yy = mk_str_from_list(a,false); yy->key = HTML; ;
+#undef a
+}
+YY_ACTION(void) yy_5_MarkdownHtmlTagOpen(GREG *G, char *yytext, int yyleng, yythunk *thunk, YY_XTYPE YY_XVAR)
+{
+#define a G->val[-1]
+  yyprintf((stderr, "do yy_5_MarkdownHtmlTagOpen\n"));
+   a = add_node(a, mk_str(">"));;
+#undef a
+}
+YY_ACTION(void) yy_4_MarkdownHtmlTagOpen(GREG *G, char *yytext, int yyleng, yythunk *thunk, YY_XTYPE YY_XVAR)
+{
+#define a G->val[-1]
+  yyprintf((stderr, "do yy_4_MarkdownHtmlTagOpen\n"));
+  a = add_node(a, mk_str(" "));
+				a = add_node(a, mk_str(yytext));;
+#undef a
+}
+YY_ACTION(void) yy_3_MarkdownHtmlTagOpen(GREG *G, char *yytext, int yyleng, yythunk *thunk, YY_XTYPE YY_XVAR)
+{
+#define a G->val[-1]
+  yyprintf((stderr, "do yy_3_MarkdownHtmlTagOpen\n"));
+  a = add_node(a, mk_str(" "));
+				a = add_node(a, mk_str(yytext));;
+#undef a
+}
+YY_ACTION(void) yy_2_MarkdownHtmlTagOpen(GREG *G, char *yytext, int yyleng, yythunk *thunk, YY_XTYPE YY_XVAR)
+{
+#define a G->val[-1]
+  yyprintf((stderr, "do yy_2_MarkdownHtmlTagOpen\n"));
+  a = add_node(a, mk_str(yytext));;
+#undef a
+}
+YY_ACTION(void) yy_1_MarkdownHtmlTagOpen(GREG *G, char *yytext, int yyleng, yythunk *thunk, YY_XTYPE YY_XVAR)
+{
+#define a G->val[-1]
+  yyprintf((stderr, "do yy_1_MarkdownHtmlTagOpen\n"));
+  a = add_node(a, mk_str("<"));;
+#undef a
+}
+YY_ACTION(void) yy_1_MarkdownHtmlBlock(GREG *G, char *yytext, int yyleng, yythunk *thunk, YY_XTYPE YY_XVAR)
+{
+  yyprintf((stderr, "do yy_1_MarkdownHtmlBlock\n"));
+   yy = str(yytext); yy->key = RAW; ;
+}
+YY_ACTION(void) yy_1_HtmlBlock(GREG *G, char *yytext, int yyleng, yythunk *thunk, YY_XTYPE YY_XVAR)
+{
+  yyprintf((stderr, "do yy_1_HtmlBlock\n"));
+  
+			if (ext(EXT_FILTER_HTML)) {
+				yy = mk_list(LIST, NULL);
+			} else {
+				yy = str(yytext);
+				if ( ext(EXT_PROCESS_HTML)) yy->key = RAW;
+				else yy->key = HTMLBLOCK;
+			}
+		;
+}
+YY_ACTION(void) yy_1_OrderedList(GREG *G, char *yytext, int yyleng, yythunk *thunk, YY_XTYPE YY_XVAR)
+{
+  yyprintf((stderr, "do yy_1_OrderedList\n"));
+   yy->key = ORDEREDLIST; ;
+}
+YY_ACTION(void) yy_3_ListContinuationBlock(GREG *G, char *yytext, int yyleng, yythunk *thunk, YY_XTYPE YY_XVAR)
+{
+#define a G->val[-1]
+  yyprintf((stderr, "do yy_3_ListContinuationBlock\n"));
+    yy = mk_raw_from_list(a, false); ;
+#undef a
+}
+YY_ACTION(void) yy_2_ListContinuationBlock(GREG *G, char *yytext, int yyleng, yythunk *thunk, YY_XTYPE YY_XVAR)
+{
+#define a G->val[-1]
+  yyprintf((stderr, "do yy_2_ListContinuationBlock\n"));
+   a = add_node(a, yy); ;
+#undef a
+}
+YY_ACTION(void) yy_1_ListContinuationBlock(GREG *G, char *yytext, int yyleng, yythunk *thunk, YY_XTYPE YY_XVAR)
+{
+#define a G->val[-1]
+  yyprintf((stderr, "do yy_1_ListContinuationBlock\n"));
+  
+			if (strlen(yytext) == 0)
+				a = add_node(a, str("\001")); /* block separator */
+			else
+				a = add_node(a, view());
+		;
+#undef a
+}
+YY_ACTION(void) yy_3_ListBlock(GREG *G, char *yytext, int yyleng, yythunk *thunk, YY_XTYPE YY_XVAR)
+{
+#define a G->val[-1]
+  yyprintf((stderr, "do yy_3_ListBlock\n"));
+   yy = mk_raw_from_list(a, false); ;
+#undef a
+}
+YY_ACTION(void) yy_2_ListBlock(GREG *G, char *yytext, int yyleng, yythunk *thunk, YY_XTYPE YY_XVAR)
+{
+#define a G->val[-1]
+  yyprintf((stderr, "do yy_2_ListBlock\n"));
+   a = add_node(a, yy); ;
+#undef a
+}
+YY_ACTION(void) yy_1_ListBlock(GREG *G, char *yytext, int yyleng, yythunk *thunk, YY_XTYPE YY_XVAR)
+{
+#define a G->val[-1]
+  yyprintf((stderr, "do yy_1_ListBlock\n"));
+   a = add_node(a, yy); ;
+#undef a
+}
+YY_ACTION(void) yy_1_EmptyList(GREG *G, char *yytext, int yyleng, yythunk *thunk, YY_XTYPE YY_XVAR)
+{
+  yyprintf((stderr, "do yy_1_EmptyList\n"));
+   yy = mk_str(""); ;
+}
+YY_ACTION(void) yy_3_ListItemTight(GREG *G, char *yytext, int yyleng, yythunk *thunk, YY_XTYPE YY_XVAR)
+{
+#define a G->val[-1]
+  yyprintf((stderr, "do yy_3_ListItemTight\n"));
+  
+			node *raw;
+			raw = mk_raw_from_list(a, false);
+			yy = node(LISTITEM);
+			yy->children = raw;
+		;
+#undef a
+}
+YY_ACTION(void) yy_2_ListItemTight(GREG *G, char *yytext, int yyleng, yythunk *thunk, YY_XTYPE YY_XVAR)
+{
+#define a G->val[-1]
+  yyprintf((stderr, "do yy_2_ListItemTight\n"));
+   a = add_node(a, yy); ;
+#undef a
+}
+YY_ACTION(void) yy_1_ListItemTight(GREG *G, char *yytext, int yyleng, yythunk *thunk, YY_XTYPE YY_XVAR)
+{
+#define a G->val[-1]
+  yyprintf((stderr, "do yy_1_ListItemTight\n"));
+   a = add_node(a, yy); ;
+#undef a
+}
+YY_ACTION(void) yy_3_ListItem(GREG *G, char *yytext, int yyleng, yythunk *thunk, YY_XTYPE YY_XVAR)
+{
+#define a G->val[-1]
+  yyprintf((stderr, "do yy_3_ListItem\n"));
+  
+			node *raw;
+			raw = mk_raw_from_list(a, false);
+			yy = node(LISTITEM);
+			yy->children = raw;
+		;
+#undef a
+}
+YY_ACTION(void) yy_2_ListItem(GREG *G, char *yytext, int yyleng, yythunk *thunk, YY_XTYPE YY_XVAR)
+{
+#define a G->val[-1]
+  yyprintf((stderr, "do yy_2_ListItem\n"));
+   a = add_node(a, yy); ;
+#undef a
+}
+YY_ACTION(void) yy_1_ListItem(GREG *G, char *yytext, int yyleng, yythunk *thunk, YY_XTYPE YY_XVAR)
+{
+#define a G->val[-1]
+  yyprintf((stderr, "do yy_1_ListItem\n"));
+   a = add_node(a, yy); ;
+#undef a
+}
+YY_ACTION(void) yy_2_ListLoose(GREG *G, char *yytext, int yyleng, yythunk *thunk, YY_XTYPE YY_XVAR)
+{
+#define a G->val[-1]
+#define b G->val[-2]
+  yyprintf((stderr, "do yy_2_ListLoose\n"));
+   yy = list(LIST, a); ;
+#undef b
+#undef a
+}
+YY_ACTION(void) yy_1_ListLoose(GREG *G, char *yytext, int yyleng, yythunk *thunk, YY_XTYPE YY_XVAR)
+{
+#define a G->val[-1]
+#define b G->val[-2]
+  yyprintf((stderr, "do yy_1_ListLoose\n"));
+  
+			/* In loose list, \n\n added to end of each element */
+			b->children = mk_raw_from_list(add_node(add_node(NULL, b->children), mk_str("\n\n")), false);
+			a = add_node(a, b);
+		;
+#undef b
+#undef a
+}
+YY_ACTION(void) yy_2_ListTight(GREG *G, char *yytext, int yyleng, yythunk *thunk, YY_XTYPE YY_XVAR)
+{
+#define a G->val[-1]
+  yyprintf((stderr, "do yy_2_ListTight\n"));
+   yy = list(LIST, a); ;
+#undef a
+}
+YY_ACTION(void) yy_1_ListTight(GREG *G, char *yytext, int yyleng, yythunk *thunk, YY_XTYPE YY_XVAR)
+{
+#define a G->val[-1]
+  yyprintf((stderr, "do yy_1_ListTight\n"));
+   a = add_node(a, yy); ;
+#undef a
+}
+YY_ACTION(void) yy_1_BulletList(GREG *G, char *yytext, int yyleng, yythunk *thunk, YY_XTYPE YY_XVAR)
+{
+  yyprintf((stderr, "do yy_1_BulletList\n"));
+   yy->key = BULLETLIST; ;
+}
+YY_ACTION(void) yy_7_Definition(GREG *G, char *yytext, int yyleng, yythunk *thunk, YY_XTYPE YY_XVAR)
+{
+#define a G->val[-1]
+#define b G->val[-2]
+  yyprintf((stderr, "do yy_7_Definition\n"));
+  
+			if (b != NULL) { a = add_node(a, b);}
+			node *raw = mk_raw_from_list(a, false);
+			yy = list(DEFINITION, add_node(NULL, raw));
+		;
+#undef b
+#undef a
+}
+YY_ACTION(void) yy_6_Definition(GREG *G, char *yytext, int yyleng, yythunk *thunk, YY_XTYPE YY_XVAR)
+{
+#define a G->val[-1]
+#define b G->val[-2]
+  yyprintf((stderr, "do yy_6_Definition\n"));
+   a = add_node(a, mk_str("\n"));;
+#undef b
+#undef a
+}
+YY_ACTION(void) yy_5_Definition(GREG *G, char *yytext, int yyleng, yythunk *thunk, YY_XTYPE YY_XVAR)
+{
+#define a G->val[-1]
+#define b G->val[-2]
+  yyprintf((stderr, "do yy_5_Definition\n"));
+   a = add_node(a, yy);;
+#undef b
+#undef a
+}
+YY_ACTION(void) yy_4_Definition(GREG *G, char *yytext, int yyleng, yythunk *thunk, YY_XTYPE YY_XVAR)
+{
+#define a G->val[-1]
+#define b G->val[-2]
+  yyprintf((stderr, "do yy_4_Definition\n"));
+  a = add_node(a, mk_str("\n"));;
+#undef b
+#undef a
+}
+YY_ACTION(void) yy_3_Definition(GREG *G, char *yytext, int yyleng, yythunk *thunk, YY_XTYPE YY_XVAR)
+{
+#define a G->val[-1]
+#define b G->val[-2]
+  yyprintf((stderr, "do yy_3_Definition\n"));
+   a = add_node(a, yy);;
+#undef b
+#undef a
+}
+YY_ACTION(void) yy_2_Definition(GREG *G, char *yytext, int yyleng, yythunk *thunk, YY_XTYPE YY_XVAR)
+{
+#define a G->val[-1]
+#define b G->val[-2]
+  yyprintf((stderr, "do yy_2_Definition\n"));
+   a = add_node(a, yy);;
+#undef b
+#undef a
+}
+YY_ACTION(void) yy_1_Definition(GREG *G, char *yytext, int yyleng, yythunk *thunk, YY_XTYPE YY_XVAR)
+{
+#define a G->val[-1]
+#define b G->val[-2]
+  yyprintf((stderr, "do yy_1_Definition\n"));
+   b = mk_str("\n"); ;
+#undef b
+#undef a
+}
+YY_ACTION(void) yy_2_Term(GREG *G, char *yytext, int yyleng, yythunk *thunk, YY_XTYPE YY_XVAR)
+{
+#define a G->val[-1]
+  yyprintf((stderr, "do yy_2_Term\n"));
+   yy = mk_list(TERM,a); ;
+#undef a
+}
+YY_ACTION(void) yy_1_Term(GREG *G, char *yytext, int yyleng, yythunk *thunk, YY_XTYPE YY_XVAR)
+{
+#define a G->val[-1]
+  yyprintf((stderr, "do yy_1_Term\n"));
+  a = add_node(a, yy);;
+#undef a
+}
+YY_ACTION(void) yy_3_DefinitionList(GREG *G, char *yytext, int yyleng, yythunk *thunk, YY_XTYPE YY_XVAR)
+{
+#define a G->val[-1]
+  yyprintf((stderr, "do yy_3_DefinitionList\n"));
+   yy = mk_list(LIST, a); yy->key = DEFLIST; ;
+#undef a
+}
+YY_ACTION(void) yy_2_DefinitionList(GREG *G, char *yytext, int yyleng, yythunk *thunk, YY_XTYPE YY_XVAR)
+{
+#define a G->val[-1]
+  yyprintf((stderr, "do yy_2_DefinitionList\n"));
+   a = add_node(a, yy);;
+#undef a
+}
+YY_ACTION(void) yy_1_DefinitionList(GREG *G, char *yytext, int yyleng, yythunk *thunk, YY_XTYPE YY_XVAR)
+{
+#define a G->val[-1]
+  yyprintf((stderr, "do yy_1_DefinitionList\n"));
+   a = add_node(a, yy); ;
+#undef a
+}
+YY_ACTION(void) yy_1_HorizontalRule(GREG *G, char *yytext, int yyleng, yythunk *thunk, YY_XTYPE YY_XVAR)
+{
+  yyprintf((stderr, "do yy_1_HorizontalRule\n"));
+   yy = mk_node(HRULE); ;
+}
+YY_ACTION(void) yy_2_Verbatim(GREG *G, char *yytext, int yyleng, yythunk *thunk, YY_XTYPE YY_XVAR)
+{
+#define a G->val[-1]
+  yyprintf((stderr, "do yy_2_Verbatim\n"));
+   yy = mk_str_from_list(a, false); yy->key = VERBATIM; ;
+#undef a
+}
+YY_ACTION(void) yy_1_Verbatim(GREG *G, char *yytext, int yyleng, yythunk *thunk, YY_XTYPE YY_XVAR)
+{
+#define a G->val[-1]
+  yyprintf((stderr, "do yy_1_Verbatim\n"));
+   a = add_node(a, yy); ;
+#undef a
+}
+YY_ACTION(void) yy_3_VerbatimChunk(GREG *G, char *yytext, int yyleng, yythunk *thunk, YY_XTYPE YY_XVAR)
+{
+#define a G->val[-1]
+  yyprintf((stderr, "do yy_3_VerbatimChunk\n"));
+   yy = mk_str_from_list(a, false); ;
+#undef a
+}
+YY_ACTION(void) yy_2_VerbatimChunk(GREG *G, char *yytext, int yyleng, yythunk *thunk, YY_XTYPE YY_XVAR)
+{
+#define a G->val[-1]
+  yyprintf((stderr, "do yy_2_VerbatimChunk\n"));
+   a = add_node(a, yy); ;
+#undef a
+}
+YY_ACTION(void) yy_1_VerbatimChunk(GREG *G, char *yytext, int yyleng, yythunk *thunk, YY_XTYPE YY_XVAR)
+{
+#define a G->val[-1]
+  yyprintf((stderr, "do yy_1_VerbatimChunk\n"));
+   a = add_node(a, mk_str("\n")); ;
+#undef a
+}
+YY_ACTION(void) yy_2_BackTickQuoted(GREG *G, char *yytext, int yyleng, yythunk *thunk, YY_XTYPE YY_XVAR)
+{
+#define a G->val[-1]
+#define b G->val[-2]
+  yyprintf((stderr, "do yy_2_BackTickQuoted\n"));
+   yy = mk_list(DOUBLEQUOTED, a); ;
+#undef b
+#undef a
+}
+YY_ACTION(void) yy_1_BackTickQuoted(GREG *G, char *yytext, int yyleng, yythunk *thunk, YY_XTYPE YY_XVAR)
+{
+#define a G->val[-1]
+#define b G->val[-2]
+  yyprintf((stderr, "do yy_1_BackTickQuoted\n"));
+   a = add_node(a, b); ;
+#undef b
+#undef a
+}
+YY_ACTION(void) yy_2_DoubleQuoted(GREG *G, char *yytext, int yyleng, yythunk *thunk, YY_XTYPE YY_XVAR)
+{
+#define a G->val[-1]
+#define b G->val[-2]
+  yyprintf((stderr, "do yy_2_DoubleQuoted\n"));
+   yy = mk_list(DOUBLEQUOTED, a); ;
+#undef b
+#undef a
+}
+YY_ACTION(void) yy_1_DoubleQuoted(GREG *G, char *yytext, int yyleng, yythunk *thunk, YY_XTYPE YY_XVAR)
+{
+#define a G->val[-1]
+#define b G->val[-2]
+  yyprintf((stderr, "do yy_1_DoubleQuoted\n"));
+   a = add_node(a, b); ;
+#undef b
+#undef a
+}
+YY_ACTION(void) yy_2_SingleQuoted(GREG *G, char *yytext, int yyleng, yythunk *thunk, YY_XTYPE YY_XVAR)
+{
+#define a G->val[-1]
+#define b G->val[-2]
+  yyprintf((stderr, "do yy_2_SingleQuoted\n"));
+   yy = mk_list(SINGLEQUOTED, a); ;
+#undef b
+#undef a
+}
+YY_ACTION(void) yy_1_SingleQuoted(GREG *G, char *yytext, int yyleng, yythunk *thunk, YY_XTYPE YY_XVAR)
+{
+#define a G->val[-1]
+#define b G->val[-2]
+  yyprintf((stderr, "do yy_1_SingleQuoted\n"));
+   a = add_node(a, b); ;
+#undef b
+#undef a
+}
+YY_ACTION(void) yy_1_EmDash(GREG *G, char *yytext, int yyleng, yythunk *thunk, YY_XTYPE YY_XVAR)
+{
+  yyprintf((stderr, "do yy_1_EmDash\n"));
+   yy = str(yytext); yy->key = EMDASH; ;
+}
+YY_ACTION(void) yy_1_EnDash(GREG *G, char *yytext, int yyleng, yythunk *thunk, YY_XTYPE YY_XVAR)
+{
+  yyprintf((stderr, "do yy_1_EnDash\n"));
+   yy = str(yytext); yy->key = ENDASH; ;
+}
+YY_ACTION(void) yy_1_Ellipsis(GREG *G, char *yytext, int yyleng, yythunk *thunk, YY_XTYPE YY_XVAR)
+{
+  yyprintf((stderr, "do yy_1_Ellipsis\n"));
+   yy = str(yytext); yy->key = ELLIPSIS; ;
+}
+YY_ACTION(void) yy_1_Apostrophe(GREG *G, char *yytext, int yyleng, yythunk *thunk, YY_XTYPE YY_XVAR)
+{
+  yyprintf((stderr, "do yy_1_Apostrophe\n"));
+   yy = str(yytext); yy->key = APOSTROPHE; ;
+}
+YY_ACTION(void) yy_1_Fenced(GREG *G, char *yytext, int yyleng, yythunk *thunk, YY_XTYPE YY_XVAR)
+{
+#define a G->val[-1]
+  yyprintf((stderr, "do yy_1_Fenced\n"));
+  
+		yy = str(yytext); yy->key = VERBATIMFENCE;
+		yy->children = a;
+	;
+#undef a
+}
+YY_ACTION(void) yy_1_FenceType(GREG *G, char *yytext, int yyleng, yythunk *thunk, YY_XTYPE YY_XVAR)
+{
+  yyprintf((stderr, "do yy_1_FenceType\n"));
+   yy = str(yytext); yy->key = VERBATIMTYPE; ;
+}
+YY_ACTION(void) yy_1_Code(GREG *G, char *yytext, int yyleng, yythunk *thunk, YY_XTYPE YY_XVAR)
+{
+  yyprintf((stderr, "do yy_1_Code\n"));
+   yy = str(yytext); yy->key = CODE; ;
+}
+YY_ACTION(void) yy_1_GlossarySortKey(GREG *G, char *yytext, int yyleng, yythunk *thunk, YY_XTYPE YY_XVAR)
+{
+  yyprintf((stderr, "do yy_1_GlossarySortKey\n"));
+   yy = mk_str(yytext); yy->key = GLOSSARYSORTKEY; ;
+}
+YY_ACTION(void) yy_1_GlossaryTerm(GREG *G, char *yytext, int yyleng, yythunk *thunk, YY_XTYPE YY_XVAR)
+{
+  yyprintf((stderr, "do yy_1_GlossaryTerm\n"));
+   
+		yy = mk_list(LIST, NULL);
+		yy->str = 0;
+		yy->children = mk_str(yytext);
+		yy->key = GLOSSARYTERM;
+	;
+}
+YY_ACTION(void) yy_5_Glossary(GREG *G, char *yytext, int yyleng, yythunk *thunk, YY_XTYPE YY_XVAR)
+{
+#define a G->val[-1]
+#define ref G->val[-2]
+  yyprintf((stderr, "do yy_5_Glossary\n"));
+  
+			node *label;
+			label = str(ref->str);
+			label->key = GLOSSARYLABEL;
+			a = add_node(a, label);
+			yy = list(GLOSSARYSOURCE, a);
+			yy->str = strdup(ref->str);
+			free_node(ref);
+		;
+#undef ref
+#undef a
+}
+YY_ACTION(void) yy_4_Glossary(GREG *G, char *yytext, int yyleng, yythunk *thunk, YY_XTYPE YY_XVAR)
+{
+#define a G->val[-1]
+#define ref G->val[-2]
+  yyprintf((stderr, "do yy_4_Glossary\n"));
+   a = add_node(a, yy); ;
+#undef ref
+#undef a
+}
+YY_ACTION(void) yy_3_Glossary(GREG *G, char *yytext, int yyleng, yythunk *thunk, YY_XTYPE YY_XVAR)
+{
+#define a G->val[-1]
+#define ref G->val[-2]
+  yyprintf((stderr, "do yy_3_Glossary\n"));
+   a = add_node(a, yy); ;
+#undef ref
+#undef a
+}
+YY_ACTION(void) yy_2_Glossary(GREG *G, char *yytext, int yyleng, yythunk *thunk, YY_XTYPE YY_XVAR)
+{
+#define a G->val[-1]
+#define ref G->val[-2]
+  yyprintf((stderr, "do yy_2_Glossary\n"));
+   a = add_node(a, yy); ;
+#undef ref
+#undef a
+}
+YY_ACTION(void) yy_1_Glossary(GREG *G, char *yytext, int yyleng, yythunk *thunk, YY_XTYPE YY_XVAR)
+{
+#define a G->val[-1]
+#define ref G->val[-2]
+  yyprintf((stderr, "do yy_1_Glossary\n"));
+   a = add_node(a, yy); ;
+#undef ref
+#undef a
+}
+YY_ACTION(void) yy_1_NoteReference(GREG *G, char *yytext, int yyleng, yythunk *thunk, YY_XTYPE YY_XVAR)
+{
+  yyprintf((stderr, "do yy_1_NoteReference\n"));
+  
+		/* Copy entire label, and ensure we are treated as a paragraph */
+		GString *original = g_string_new(yytext);
+		g_string_append_c(original,'\n');
+		g_string_append_c(original,'\n');
+
+		/* Create a note reference */
+		yy = str(yytext);
+		yy->key = NOTEREFERENCE;
+		
+		/* Include RAW version for parsing in case this is an inline footnote */
+		node *raw = str(original->str);
+		raw->key = RAW;
+		node *source = list(NOTESOURCE, add_node(NULL, raw));
+		source->str = strdup("");
+		
+		yy->children = source;
+
+		g_string_free(original, true);
+	;
+}
+YY_ACTION(void) yy_1_AutoLabel(GREG *G, char *yytext, int yyleng, yythunk *thunk, YY_XTYPE YY_XVAR)
+{
+  yyprintf((stderr, "do yy_1_AutoLabel\n"));
+  
+	node *ref;
+	yy = str(yytext);
+	yy->key = AUTOLABEL;
+	
+	/* And create a LINKREFERENCE so we can use it */
+	char *label = label_from_string(yytext);
+	GString *anchor = g_string_new(label);
+	g_string_prepend(anchor, "#");
+	ref = mk_link(NULL, label, anchor->str, NULL, NULL);
+
+	g_string_free(anchor, true);
+	free(label);
+	((parser_data *)G->data)->autolabels = cons(ref,((parser_data *)G->data)->autolabels);
+	ref->key = LINKREFERENCE;
+;
+}
+YY_ACTION(void) yy_2_Label(GREG *G, char *yytext, int yyleng, yythunk *thunk, YY_XTYPE YY_XVAR)
+{
+#define a G->val[-1]
+  yyprintf((stderr, "do yy_2_Label\n"));
+   yy = list(LIST, a); ;
+#undef a
+}
+YY_ACTION(void) yy_1_Label(GREG *G, char *yytext, int yyleng, yythunk *thunk, YY_XTYPE YY_XVAR)
+{
+#define a G->val[-1]
+  yyprintf((stderr, "do yy_1_Label\n"));
+   a = add_node(a, yy); ;
+#undef a
+}
+YY_ACTION(void) yy_1_Image(GREG *G, char *yytext, int yyleng, yythunk *thunk, YY_XTYPE YY_XVAR)
+{
+  yyprintf((stderr, "do yy_1_Image\n"));
+   yy->key = IMAGE; ;
+}
+YY_ACTION(void) yy_1_ImageBlock(GREG *G, char *yytext, int yyleng, yythunk *thunk, YY_XTYPE YY_XVAR)
+{
+  yyprintf((stderr, "do yy_1_ImageBlock\n"));
+   if (yy->key == IMAGE) yy->key = IMAGEBLOCK; ;
+}
+YY_ACTION(void) yy_1_Abbreviation(GREG *G, char *yytext, int yyleng, yythunk *thunk, YY_XTYPE YY_XVAR)
+{
+#define l G->val[-1]
+  yyprintf((stderr, "do yy_1_Abbreviation\n"));
+  
+		yy = str(yytext);
+		yy->key = ABBREVIATION;
+
+		yy->children = l;
+	;
+#undef l
+}
+YY_ACTION(void) yy_1_RefTitle(GREG *G, char *yytext, int yyleng, yythunk *thunk, YY_XTYPE YY_XVAR)
+{
+  yyprintf((stderr, "do yy_1_RefTitle\n"));
+   yy = str(yytext); yy->key = RAW; ;
+}
+YY_ACTION(void) yy_1_RefSrc(GREG *G, char *yytext, int yyleng, yythunk *thunk, YY_XTYPE YY_XVAR)
+{
+  yyprintf((stderr, "do yy_1_RefSrc\n"));
+  
+		char *tmp = strdup(yytext);
+		if ((tmp[0] == '<') &&
+			(tmp[strlen(tmp) - 1] == '>')) {
+			tmp[strlen(tmp) - 1] = '\0';
+			yy = str(&tmp[1]);
+		} else {
+			yy = str(yytext);
+		}
+		yy->key = HTML;
+		free(tmp);
+	;
+}
+YY_ACTION(void) yy_1_AttrValue(GREG *G, char *yytext, int yyleng, yythunk *thunk, YY_XTYPE YY_XVAR)
+{
+  yyprintf((stderr, "do yy_1_AttrValue\n"));
+   yy = str(yytext); yy->key = ATTRVALUE; ;
+}
+YY_ACTION(void) yy_1_AttrKey(GREG *G, char *yytext, int yyleng, yythunk *thunk, YY_XTYPE YY_XVAR)
+{
+  yyprintf((stderr, "do yy_1_AttrKey\n"));
+  
+		char *lab;
+		lab = label_from_string(yytext);
+		yy = mk_str(lab);
+		yy->key = ATTRKEY;
+		free(lab);
+	;
+}
+YY_ACTION(void) yy_1_Attribute(GREG *G, char *yytext, int yyleng, yythunk *thunk, YY_XTYPE YY_XVAR)
+{
+#define a G->val[-1]
+#define b G->val[-2]
+  yyprintf((stderr, "do yy_1_Attribute\n"));
+  
+		yy = a;
+		yy->children = b;
+	;
+#undef b
+#undef a
+}
+YY_ACTION(void) yy_2_Attributes(GREG *G, char *yytext, int yyleng, yythunk *thunk, YY_XTYPE YY_XVAR)
+{
+#define a G->val[-1]
+  yyprintf((stderr, "do yy_2_Attributes\n"));
+   yy = close_list(a); ;
+#undef a
+}
+YY_ACTION(void) yy_1_Attributes(GREG *G, char *yytext, int yyleng, yythunk *thunk, YY_XTYPE YY_XVAR)
+{
+#define a G->val[-1]
+  yyprintf((stderr, "do yy_1_Attributes\n"));
+   a = add_node(a, yy); ;
+#undef a
+}
+YY_ACTION(void) yy_2_LinkReference(GREG *G, char *yytext, int yyleng, yythunk *thunk, YY_XTYPE YY_XVAR)
+{
+#define a G->val[-1]
+#define l G->val[-2]
+#define s G->val[-3]
+#define t G->val[-4]
+  yyprintf((stderr, "do yy_2_LinkReference\n"));
+   
+			/* Get label for referencing */
+			GString *text = g_string_new("");
+			char *clean;
+			print_raw_node_tree(text, l->children);
+			clean = clean_string(text->str);
+			
+			if (a == NULL) {
+				/* no attributes */
+				yy = mk_link(NULL, clean, s->str, t->str, NULL);
+			} else {
+				yy = mk_link(NULL, clean, s->str, t->str, a);
+			}
+			g_string_free(text, TRUE);
+			free_node(s);
+			free_node(t);
+			free_node_tree(l);
+			free(clean);
+			yy->key = LINKREFERENCE;
+		;
+#undef t
+#undef s
+#undef l
+#undef a
+}
+YY_ACTION(void) yy_1_LinkReference(GREG *G, char *yytext, int yyleng, yythunk *thunk, YY_XTYPE YY_XVAR)
+{
+#define a G->val[-1]
+#define l G->val[-2]
+#define s G->val[-3]
+#define t G->val[-4]
+  yyprintf((stderr, "do yy_1_LinkReference\n"));
+   a = yy; ;
+#undef t
+#undef s
+#undef l
+#undef a
+}
+YY_ACTION(void) yy_1_AutoLinkEmail(GREG *G, char *yytext, int yyleng, yythunk *thunk, YY_XTYPE YY_XVAR)
+{
+  yyprintf((stderr, "do yy_1_AutoLinkEmail\n"));
+  
+		char *mailto = malloc(strlen(yytext) + 8);
+		sprintf(mailto, "mailto:%s", yytext);
+		yy = mk_link(str(yytext), NULL, mailto, NULL, NULL);
+		free(mailto);
+	;
+}
+YY_ACTION(void) yy_1_AutoLinkUrl(GREG *G, char *yytext, int yyleng, yythunk *thunk, YY_XTYPE YY_XVAR)
+{
+  yyprintf((stderr, "do yy_1_AutoLinkUrl\n"));
+  
+		yy = mk_link(str(yytext), NULL, yytext, NULL, NULL);
+	;
+}
+YY_ACTION(void) yy_1_Title(GREG *G, char *yytext, int yyleng, yythunk *thunk, YY_XTYPE YY_XVAR)
+{
+  yyprintf((stderr, "do yy_1_Title\n"));
+   yy = str(yytext); yy->key = TITLE; ;
+}
+YY_ACTION(void) yy_1_Source(GREG *G, char *yytext, int yyleng, yythunk *thunk, YY_XTYPE YY_XVAR)
+{
+  yyprintf((stderr, "do yy_1_Source\n"));
+   yy = str(yytext); yy->key = SOURCE; ;
+}
+YY_ACTION(void) yy_1_ExplicitLink(GREG *G, char *yytext, int yyleng, yythunk *thunk, YY_XTYPE YY_XVAR)
+{
+#define l G->val[-1]
+#define s G->val[-2]
+#define t G->val[-3]
+  yyprintf((stderr, "do yy_1_ExplicitLink\n"));
+  
+		yy = mk_link(l, NULL, s->str, t->str, NULL);
+		free_node_tree(s);
+		free_node_tree(t);
+	;
+#undef t
+#undef s
+#undef l
+}
+YY_ACTION(void) yy_1_Variable(GREG *G, char *yytext, int yyleng, yythunk *thunk, YY_XTYPE YY_XVAR)
+{
+  yyprintf((stderr, "do yy_1_Variable\n"));
+  
+		yy = str(yytext);
+		yy->key = VARIABLE;
+	;
+}
+YY_ACTION(void) yy_1_RawCitationReference(GREG *G, char *yytext, int yyleng, yythunk *thunk, YY_XTYPE YY_XVAR)
+{
+  yyprintf((stderr, "do yy_1_RawCitationReference\n"));
+   yy = str(yytext); ;
+}
+YY_ACTION(void) yy_1_CitationReferenceSingle(GREG *G, char *yytext, int yyleng, yythunk *thunk, YY_XTYPE YY_XVAR)
+{
+#define b G->val[-1]
+  yyprintf((stderr, "do yy_1_CitationReferenceSingle\n"));
+  
+		yy = mk_link(NULL, b->str, NULL, NULL, NULL);
+		yy->key = CITATION;
+		free_node_tree(b);
+	;
+#undef b
+}
+YY_ACTION(void) yy_1_CitationReferenceDouble(GREG *G, char *yytext, int yyleng, yythunk *thunk, YY_XTYPE YY_XVAR)
+{
+#define a G->val[-1]
+#define b G->val[-2]
+  yyprintf((stderr, "do yy_1_CitationReferenceDouble\n"));
+  
+		char *label;
+		label = label_from_node_tree(a);
+		yy = mk_link(a, b->str, NULL, NULL, NULL);
+		yy->key = CITATION;
+		
+		if (strcmp(label,"notcited") == 0)
+			yy->key = NOCITATION;
+		free(label);
+		free_node_tree(b);
+	;
+#undef b
+#undef a
+}
+YY_ACTION(void) yy_1_ReferenceLinkSingle(GREG *G, char *yytext, int yyleng, yythunk *thunk, YY_XTYPE YY_XVAR)
+{
+#define a G->val[-1]
+  yyprintf((stderr, "do yy_1_ReferenceLinkSingle\n"));
+  
+		yy = mk_link(a, NULL, NULL, NULL, NULL);
+		/* stash copy of raw source in case we need if */
+		yy->str = strdup(yytext);
+	;
+#undef a
+}
+YY_ACTION(void) yy_1_ReferenceLinkDouble(GREG *G, char *yytext, int yyleng, yythunk *thunk, YY_XTYPE YY_XVAR)
+{
+#define a G->val[-1]
+#define b G->val[-2]
+  yyprintf((stderr, "do yy_1_ReferenceLinkDouble\n"));
+  
+		GString *text = g_string_new("");
+		print_raw_node_tree(text, b->children);
+		yy = mk_link(a, text->str, NULL, NULL, NULL);
+		g_string_free(text, TRUE);
+		free_node_tree(b);
+	;
+#undef b
+#undef a
+}
+YY_ACTION(void) yy_2_EmphAndStrongUl(GREG *G, char *yytext, int yyleng, yythunk *thunk, YY_XTYPE YY_XVAR)
+{
+#define a G->val[-1]
+#define b G->val[-2]
+  yyprintf((stderr, "do yy_2_EmphAndStrongUl\n"));
+  
+			yy = list(EMPH, a); 
+		;
+#undef b
+#undef a
+}
+YY_ACTION(void) yy_1_EmphAndStrongUl(GREG *G, char *yytext, int yyleng, yythunk *thunk, YY_XTYPE YY_XVAR)
+{
+#define a G->val[-1]
+#define b G->val[-2]
+  yyprintf((stderr, "do yy_1_EmphAndStrongUl\n"));
+   a = add_node(a, b); ;
+#undef b
+#undef a
+}
+YY_ACTION(void) yy_2_EmphAndStrongStar(GREG *G, char *yytext, int yyleng, yythunk *thunk, YY_XTYPE YY_XVAR)
+{
+#define a G->val[-1]
+#define b G->val[-2]
+  yyprintf((stderr, "do yy_2_EmphAndStrongStar\n"));
+  
+			yy = list(EMPH, a);
+		;
+#undef b
+#undef a
+}
+YY_ACTION(void) yy_1_EmphAndStrongStar(GREG *G, char *yytext, int yyleng, yythunk *thunk, YY_XTYPE YY_XVAR)
+{
+#define a G->val[-1]
+#define b G->val[-2]
+  yyprintf((stderr, "do yy_1_EmphAndStrongStar\n"));
+   a = add_node(a, b); ;
+#undef b
+#undef a
+}
+YY_ACTION(void) yy_1_Strong(GREG *G, char *yytext, int yyleng, yythunk *thunk, YY_XTYPE YY_XVAR)
+{
+  yyprintf((stderr, "do yy_1_Strong\n"));
+  
+			yytext[strlen(yytext) - 2] = '\0';
+			/*
+				yy = parse_chunk(&yytext[2], ((parser_data *)G->data)->extensions | EXT_NO_STRONG, (parser_data *)G->data, thunk->begin + 2);
+			*/
+
+			yy = parse_chunk(&yytext[2], ((parser_data *)G->data)->extensions, (parser_data *)G->data, thunk->begin + 2);
+			if (yy != NULL)
+				yy->key = STRONG;
+		;
+}
+YY_ACTION(void) yy_1_Emph(GREG *G, char *yytext, int yyleng, yythunk *thunk, YY_XTYPE YY_XVAR)
+{
+  yyprintf((stderr, "do yy_1_Emph\n"));
+  
+		yytext[strlen(yytext) - 1] = '\0';
+		/*
+			yy = parse_chunk(&yytext[1], ((parser_data *)G->data)->extensions | EXT_NO_EMPH, (parser_data *)G->data, thunk->begin + 1);
+
+			Applying the EXT_NO_EMPH extension allows forbidding `<em> foo <em>bar</em> foo</em>`
+		*/
+
+		yy = parse_chunk(&yytext[1], ((parser_data *)G->data)->extensions, (parser_data *)G->data, thunk->begin + 1);
+		if (yy != NULL)
+			yy->key = EMPH;
+	;
+}
+YY_ACTION(void) yy_1_EmphDelimiter(GREG *G, char *yytext, int yyleng, yythunk *thunk, YY_XTYPE YY_XVAR)
+{
+  yyprintf((stderr, "do yy_1_EmphDelimiter\n"));
+   yy = str(yytext); yy->key = EMPHDELIM; ;
+}
+YY_ACTION(void) yy_1_UlOrStarLine(GREG *G, char *yytext, int yyleng, yythunk *thunk, YY_XTYPE YY_XVAR)
+{
+  yyprintf((stderr, "do yy_1_UlOrStarLine\n"));
+   yy = str(yytext); ;
+}
+YY_ACTION(void) yy_1_DoubleDollarMath(GREG *G, char *yytext, int yyleng, yythunk *thunk, YY_XTYPE YY_XVAR)
+{
+  yyprintf((stderr, "do yy_1_DoubleDollarMath\n"));
+   yy = str(yytext); yy->key = MATHSPAN; ;
+}
+YY_ACTION(void) yy_1_SingleDollarMath(GREG *G, char *yytext, int yyleng, yythunk *thunk, YY_XTYPE YY_XVAR)
+{
+  yyprintf((stderr, "do yy_1_SingleDollarMath\n"));
+   yy = str(yytext); yy->key = MATHSPAN; ;
+}
+YY_ACTION(void) yy_1_MathSpan(GREG *G, char *yytext, int yyleng, yythunk *thunk, YY_XTYPE YY_XVAR)
+{
+  yyprintf((stderr, "do yy_1_MathSpan\n"));
+  
+	/* Basically, these delimiters indicate math in LaTeX syntax, and the
+	   delimiters are compatible with MathJax and LaTeX
+	   ASCIIMathML is *not* supported */
+	yy = str(yytext);
+	yy->key = MATHSPAN;
+;
+}
+YY_ACTION(void) yy_1_StartList(GREG *G, char *yytext, int yyleng, yythunk *thunk, YY_XTYPE YY_XVAR)
+{
+  yyprintf((stderr, "do yy_1_StartList\n"));
+   yy = NULL; ;
+}
+YY_ACTION(void) yy_1_Subscript(GREG *G, char *yytext, int yyleng, yythunk *thunk, YY_XTYPE YY_XVAR)
+{
+  yyprintf((stderr, "do yy_1_Subscript\n"));
+   yy = str(yytext); yy->key = SUBSCRIPT; ;
+}
+YY_ACTION(void) yy_1_Superscript(GREG *G, char *yytext, int yyleng, yythunk *thunk, YY_XTYPE YY_XVAR)
+{
+  yyprintf((stderr, "do yy_1_Superscript\n"));
+   yy = str(yytext); yy->key = SUPERSCRIPT; ;
+}
+YY_ACTION(void) yy_1_AposChunk(GREG *G, char *yytext, int yyleng, yythunk *thunk, YY_XTYPE YY_XVAR)
+{
+  yyprintf((stderr, "do yy_1_AposChunk\n"));
+   yy = node(APOSTROPHE); ;
+}
+YY_ACTION(void) yy_1_StrChunk(GREG *G, char *yytext, int yyleng, yythunk *thunk, YY_XTYPE YY_XVAR)
+{
+  yyprintf((stderr, "do yy_1_StrChunk\n"));
+   yy = str(yytext); ;
+}
+YY_ACTION(void) yy_4_Str(GREG *G, char *yytext, int yyleng, yythunk *thunk, YY_XTYPE YY_XVAR)
+{
+#define a G->val[-1]
+  yyprintf((stderr, "do yy_4_Str\n"));
+   if (a->next == a) { yy = close_list(a); } else { yy = list(LIST, a); } ;
+#undef a
+}
+YY_ACTION(void) yy_3_Str(GREG *G, char *yytext, int yyleng, yythunk *thunk, YY_XTYPE YY_XVAR)
+{
+#define a G->val[-1]
+  yyprintf((stderr, "do yy_3_Str\n"));
+  a = add_node(a, yy); ;
+#undef a
+}
+YY_ACTION(void) yy_2_Str(GREG *G, char *yytext, int yyleng, yythunk *thunk, YY_XTYPE YY_XVAR)
+{
+#define a G->val[-1]
+  yyprintf((stderr, "do yy_2_Str\n"));
+   a = add_node(a, yy); ;
+#undef a
+}
+YY_ACTION(void) yy_1_Str(GREG *G, char *yytext, int yyleng, yythunk *thunk, YY_XTYPE YY_XVAR)
+{
+#define a G->val[-1]
+  yyprintf((stderr, "do yy_1_Str\n"));
+   a = add_node(a, str(yytext)); ;
+#undef a
+}
+YY_ACTION(void) yy_1_LineBreak(GREG *G, char *yytext, int yyleng, yythunk *thunk, YY_XTYPE YY_XVAR)
+{
+#define a G->val[-1]
+  yyprintf((stderr, "do yy_1_LineBreak\n"));
+   yy = a; yy->key = LINEBREAK; ;
+#undef a
+}
+YY_ACTION(void) yy_1_TerminalEndline(GREG *G, char *yytext, int yyleng, yythunk *thunk, YY_XTYPE YY_XVAR)
+{
+  yyprintf((stderr, "do yy_1_TerminalEndline\n"));
+   yy = NULL; ;
+}
+YY_ACTION(void) yy_1_NormalEndline(GREG *G, char *yytext, int yyleng, yythunk *thunk, YY_XTYPE YY_XVAR)
+{
+  yyprintf((stderr, "do yy_1_NormalEndline\n"));
+  
+			yy = str("\n");
+			yy->key = SPACE; 
+		;
+}
+YY_ACTION(void) yy_1_Space(GREG *G, char *yytext, int yyleng, yythunk *thunk, YY_XTYPE YY_XVAR)
+{
+  yyprintf((stderr, "do yy_1_Space\n"));
+   yy = str(" "); yy->key = SPACE; ;
+}
+YY_ACTION(void) yy_3_Inlines(GREG *G, char *yytext, int yyleng, yythunk *thunk, YY_XTYPE YY_XVAR)
+{
+#define a G->val[-1]
+#define c G->val[-2]
+  yyprintf((stderr, "do yy_3_Inlines\n"));
+   yy = list(LIST, a); ;
+#undef c
+#undef a
+}
+YY_ACTION(void) yy_2_Inlines(GREG *G, char *yytext, int yyleng, yythunk *thunk, YY_XTYPE YY_XVAR)
+{
+#define a G->val[-1]
+#define c G->val[-2]
+  yyprintf((stderr, "do yy_2_Inlines\n"));
+   a = add_node(a, c); ;
+#undef c
+#undef a
+}
+YY_ACTION(void) yy_1_Inlines(GREG *G, char *yytext, int yyleng, yythunk *thunk, YY_XTYPE YY_XVAR)
+{
+#define a G->val[-1]
+#define c G->val[-2]
+  yyprintf((stderr, "do yy_1_Inlines\n"));
+   a = add_node(a, yy); ;
+#undef c
+#undef a
+}
+YY_ACTION(void) yy_1_Plain(GREG *G, char *yytext, int yyleng, yythunk *thunk, YY_XTYPE YY_XVAR)
+{
+#define a G->val[-1]
+  yyprintf((stderr, "do yy_1_Plain\n"));
+   yy = a; yy->key = PLAIN; ;
+#undef a
+}
+YY_ACTION(void) yy_1_Para(GREG *G, char *yytext, int yyleng, yythunk *thunk, YY_XTYPE YY_XVAR)
+{
+#define a G->val[-1]
+  yyprintf((stderr, "do yy_1_Para\n"));
+   yy = a; yy->key = PARA; ;
+#undef a
+}
+YY_ACTION(void) yy_1_Entity(GREG *G, char *yytext, int yyleng, yythunk *thunk, YY_XTYPE YY_XVAR)
+{
+  yyprintf((stderr, "do yy_1_Entity\n"));
+   yy = str(yytext); yy->key = HTML; ;
+}
+YY_ACTION(void) yy_1_EscapedChar(GREG *G, char *yytext, int yyleng, yythunk *thunk, YY_XTYPE YY_XVAR)
+{
+  yyprintf((stderr, "do yy_1_EscapedChar\n"));
+   yy = str(yytext); ;
+}
+YY_ACTION(void) yy_1_Symbol(GREG *G, char *yytext, int yyleng, yythunk *thunk, YY_XTYPE YY_XVAR)
+{
+  yyprintf((stderr, "do yy_1_Symbol\n"));
+   yy = str(yytext); ;
+}
+YY_ACTION(void) yy_1_RawHtml(GREG *G, char *yytext, int yyleng, yythunk *thunk, YY_XTYPE YY_XVAR)
+{
+  yyprintf((stderr, "do yy_1_RawHtml\n"));
+  
+		if (ext(EXT_FILTER_HTML)) {
+			yy = list(LIST, NULL);
+		} else {
+			yy = str(yytext);
+			yy->key = HTML;
+		}
+	;
+}
+YY_ACTION(void) yy_1_LineView(GREG *G, char *yytext, int yyleng, yythunk *thunk, YY_XTYPE YY_XVAR)
+{
+  yyprintf((stderr, "do yy_1_LineView\n"));
+   yy = view(); ;
+}
+YY_ACTION(void) yy_1_Line(GREG *G, char *yytext, int yyleng, yythunk *thunk, YY_XTYPE YY_XVAR)
+{
+  yyprintf((stderr, "do yy_1_Line\n"));
+   yy = str(yytext); ;
+}
+YY_ACTION(void) yy_1_BlockQuoteMarker(GREG *G, char *yytext, int yyleng, yythunk *thunk, YY_XTYPE YY_XVAR)
+{
+  yyprintf((stderr, "do yy_1_BlockQuoteMarker\n"));
+   yy = str(yytext); yy->key = BLOCKQUOTEMARKER; ;
+}
+YY_ACTION(void) yy_4_BlockQuoteRaw(GREG *G, char *yytext, int yyleng, yythunk *thunk, YY_XTYPE YY_XVAR)
+{
+#define a G->val[-1]
+#define x G->val[-2]
+#define b G->val[-3]
+  yyprintf((stderr, "do yy_4_BlockQuoteRaw\n"));
+  
+			yy = x;
+			free_node_tree(x->next);
+			yy->next = NULL;
+			yy->children = mk_raw_from_list(a, true);
+		;
+#undef b
+#undef x
+#undef a
+}
+YY_ACTION(void) yy_3_BlockQuoteRaw(GREG *G, char *yytext, int yyleng, yythunk *thunk, YY_XTYPE YY_XVAR)
+{
+#define a G->val[-1]
+#define x G->val[-2]
+#define b G->val[-3]
+  yyprintf((stderr, "do yy_3_BlockQuoteRaw\n"));
+   a = add_node(a, mk_str("\n")); ;
+#undef b
+#undef x
+#undef a
+}
+YY_ACTION(void) yy_2_BlockQuoteRaw(GREG *G, char *yytext, int yyleng, yythunk *thunk, YY_XTYPE YY_XVAR)
+{
+#define a G->val[-1]
+#define x G->val[-2]
+#define b G->val[-3]
+  yyprintf((stderr, "do yy_2_BlockQuoteRaw\n"));
+   a = add_node(a, yy); ;
+#undef b
+#undef x
+#undef a
+}
+YY_ACTION(void) yy_1_BlockQuoteRaw(GREG *G, char *yytext, int yyleng, yythunk *thunk, YY_XTYPE YY_XVAR)
+{
+#define a G->val[-1]
+#define x G->val[-2]
+#define b G->val[-3]
+  yyprintf((stderr, "do yy_1_BlockQuoteRaw\n"));
+   a = add_node(a, yy); x = cons(b, x); ;
+#undef b
+#undef x
+#undef a
+}
+YY_ACTION(void) yy_1_BlockQuote(GREG *G, char *yytext, int yyleng, yythunk *thunk, YY_XTYPE YY_XVAR)
+{
+#define a G->val[-1]
+  yyprintf((stderr, "do yy_1_BlockQuote\n"));
+   yy = list(BLOCKQUOTE, add_node(NULL, a)); ;
+#undef a
+}
+YY_ACTION(void) yy_3_SetextHeading2(GREG *G, char *yytext, int yyleng, yythunk *thunk, YY_XTYPE YY_XVAR)
+{
+#define a G->val[-1]
+#define b G->val[-2]
+  yyprintf((stderr, "do yy_3_SetextHeading2\n"));
+   yy = list(H2, a); ;
+#undef b
+#undef a
+}
+YY_ACTION(void) yy_2_SetextHeading2(GREG *G, char *yytext, int yyleng, yythunk *thunk, YY_XTYPE YY_XVAR)
+{
+#define a G->val[-1]
+#define b G->val[-2]
+  yyprintf((stderr, "do yy_2_SetextHeading2\n"));
+   a = add_node_first(a, b); ;
+#undef b
+#undef a
+}
+YY_ACTION(void) yy_1_SetextHeading2(GREG *G, char *yytext, int yyleng, yythunk *thunk, YY_XTYPE YY_XVAR)
+{
+#define a G->val[-1]
+#define b G->val[-2]
+  yyprintf((stderr, "do yy_1_SetextHeading2\n"));
+   a = add_node(a, yy); ;
+#undef b
+#undef a
+}
+YY_ACTION(void) yy_3_SetextHeading1(GREG *G, char *yytext, int yyleng, yythunk *thunk, YY_XTYPE YY_XVAR)
+{
+#define a G->val[-1]
+#define b G->val[-2]
+  yyprintf((stderr, "do yy_3_SetextHeading1\n"));
+   yy = list(H1, a); ;
+#undef b
+#undef a
+}
+YY_ACTION(void) yy_2_SetextHeading1(GREG *G, char *yytext, int yyleng, yythunk *thunk, YY_XTYPE YY_XVAR)
+{
+#define a G->val[-1]
+#define b G->val[-2]
+  yyprintf((stderr, "do yy_2_SetextHeading1\n"));
+   a = add_node_first(a, b); ;
+#undef b
+#undef a
+}
+YY_ACTION(void) yy_1_SetextHeading1(GREG *G, char *yytext, int yyleng, yythunk *thunk, YY_XTYPE YY_XVAR)
+{
+#define a G->val[-1]
+#define b G->val[-2]
+  yyprintf((stderr, "do yy_1_SetextHeading1\n"));
+   a = add_node(a, yy); ;
+#undef b
+#undef a
+}
+YY_ACTION(void) yy_3_AtxHeading(GREG *G, char *yytext, int yyleng, yythunk *thunk, YY_XTYPE YY_XVAR)
+{
+#define s G->val[-1]
+#define a G->val[-2]
+#define b G->val[-3]
+  yyprintf((stderr, "do yy_3_AtxHeading\n"));
+   yy = list(s->key,a); free_node(s); ;
+#undef b
+#undef a
+#undef s
+}
+YY_ACTION(void) yy_2_AtxHeading(GREG *G, char *yytext, int yyleng, yythunk *thunk, YY_XTYPE YY_XVAR)
+{
+#define s G->val[-1]
+#define a G->val[-2]
+#define b G->val[-3]
+  yyprintf((stderr, "do yy_2_AtxHeading\n"));
+   a = add_node_first(a, b); ;
+#undef b
+#undef a
+#undef s
+}
+YY_ACTION(void) yy_1_AtxHeading(GREG *G, char *yytext, int yyleng, yythunk *thunk, YY_XTYPE YY_XVAR)
+{
+#define s G->val[-1]
+#define a G->val[-2]
+#define b G->val[-3]
+  yyprintf((stderr, "do yy_1_AtxHeading\n"));
+   a = add_node(a, yy); ;
+#undef b
+#undef a
+#undef s
+}
+YY_ACTION(void) yy_1_AtxStart(GREG *G, char *yytext, int yyleng, yythunk *thunk, YY_XTYPE YY_XVAR)
+{
+  yyprintf((stderr, "do yy_1_AtxStart\n"));
+   yy = node(H1 + ((int)strlen(yytext) - 1)); ;
+}
+YY_ACTION(void) yy_3_HeadingSection(GREG *G, char *yytext, int yyleng, yythunk *thunk, YY_XTYPE YY_XVAR)
+{
+#define a G->val[-1]
+  yyprintf((stderr, "do yy_3_HeadingSection\n"));
+   yy = list(HEADINGSECTION, a); ;
+#undef a
+}
+YY_ACTION(void) yy_2_HeadingSection(GREG *G, char *yytext, int yyleng, yythunk *thunk, YY_XTYPE YY_XVAR)
+{
+#define a G->val[-1]
+  yyprintf((stderr, "do yy_2_HeadingSection\n"));
+  a = add_node(a, yy); ;
+#undef a
+}
+YY_ACTION(void) yy_1_HeadingSection(GREG *G, char *yytext, int yyleng, yythunk *thunk, YY_XTYPE YY_XVAR)
+{
+#define a G->val[-1]
+  yyprintf((stderr, "do yy_1_HeadingSection\n"));
+   a = add_node(a, yy); ;
+#undef a
+}
+YY_ACTION(void) yy_1_TOC(GREG *G, char *yytext, int yyleng, yythunk *thunk, YY_XTYPE YY_XVAR)
+{
+  yyprintf((stderr, "do yy_1_TOC\n"));
+   yy = node(TOC); ;
+}
+YY_ACTION(void) yy_2_DocForMetaDataOnly(GREG *G, char *yytext, int yyleng, yythunk *thunk, YY_XTYPE YY_XVAR)
+{
+#define a G->val[-1]
+  yyprintf((stderr, "do yy_2_DocForMetaDataOnly\n"));
+  
+			((parser_data *)G->data)->result = close_list(a);
+		;
+#undef a
+}
+YY_ACTION(void) yy_1_DocForMetaDataOnly(GREG *G, char *yytext, int yyleng, yythunk *thunk, YY_XTYPE YY_XVAR)
+{
+#define a G->val[-1]
+  yyprintf((stderr, "do yy_1_DocForMetaDataOnly\n"));
+   a = add_node(a, yy); ;
+#undef a
+}
+YY_ACTION(void) yy_4_MetaDataValue(GREG *G, char *yytext, int yyleng, yythunk *thunk, YY_XTYPE YY_XVAR)
+{
+#define a G->val[-1]
+  yyprintf((stderr, "do yy_4_MetaDataValue\n"));
+  
+			yy = mk_str_from_list(a, false);
+			yy->key = METAVALUE;
+		;
+#undef a
+}
+YY_ACTION(void) yy_3_MetaDataValue(GREG *G, char *yytext, int yyleng, yythunk *thunk, YY_XTYPE YY_XVAR)
+{
+#define a G->val[-1]
+  yyprintf((stderr, "do yy_3_MetaDataValue\n"));
+   a = add_node(a, str(yytext)); ;
+#undef a
+}
+YY_ACTION(void) yy_2_MetaDataValue(GREG *G, char *yytext, int yyleng, yythunk *thunk, YY_XTYPE YY_XVAR)
+{
+#define a G->val[-1]
+  yyprintf((stderr, "do yy_2_MetaDataValue\n"));
+   a = add_node(a, str("\n")); ;
+#undef a
+}
+YY_ACTION(void) yy_1_MetaDataValue(GREG *G, char *yytext, int yyleng, yythunk *thunk, YY_XTYPE YY_XVAR)
+{
+#define a G->val[-1]
+  yyprintf((stderr, "do yy_1_MetaDataValue\n"));
+   a = add_node(a, str(yytext)); ;
+#undef a
+}
+YY_ACTION(void) yy_1_MetaDataKey(GREG *G, char *yytext, int yyleng, yythunk *thunk, YY_XTYPE YY_XVAR)
+{
+  yyprintf((stderr, "do yy_1_MetaDataKey\n"));
+  
+		yy = str(yytext);
+		yy->key = METAKEY;
+	;
+}
+YY_ACTION(void) yy_1_MetaDataKeyValue(GREG *G, char *yytext, int yyleng, yythunk *thunk, YY_XTYPE YY_XVAR)
+{
+#define a G->val[-1]
+#define b G->val[-2]
+  yyprintf((stderr, "do yy_1_MetaDataKeyValue\n"));
+  
+		yy = a;
+		yy->children = b;
+	;
+#undef b
+#undef a
+}
+YY_ACTION(void) yy_2_MetaData(GREG *G, char *yytext, int yyleng, yythunk *thunk, YY_XTYPE YY_XVAR)
+{
+#define a G->val[-1]
+  yyprintf((stderr, "do yy_2_MetaData\n"));
+   yy = list(METADATA, a); ;
+#undef a
+}
+YY_ACTION(void) yy_1_MetaData(GREG *G, char *yytext, int yyleng, yythunk *thunk, YY_XTYPE YY_XVAR)
+{
+#define a G->val[-1]
+  yyprintf((stderr, "do yy_1_MetaData\n"));
+   a = add_node(a, yy); ;
+#undef a
+}
+YY_ACTION(void) yy_3_Doc(GREG *G, char *yytext, int yyleng, yythunk *thunk, YY_XTYPE YY_XVAR)
+{
+#define a G->val[-1]
+#define b G->val[-2]
+  yyprintf((stderr, "do yy_3_Doc\n"));
+  
+			if (b!= NULL) a = add_node(a, b);
+			((parser_data *)G->data)->result = close_list(a);
+		;
+#undef b
+#undef a
+}
+YY_ACTION(void) yy_2_Doc(GREG *G, char *yytext, int yyleng, yythunk *thunk, YY_XTYPE YY_XVAR)
+{
+#define a G->val[-1]
+#define b G->val[-2]
+  yyprintf((stderr, "do yy_2_Doc\n"));
+   a = add_node(a, yy); ;
+#undef b
+#undef a
+}
+YY_ACTION(void) yy_1_Doc(GREG *G, char *yytext, int yyleng, yythunk *thunk, YY_XTYPE YY_XVAR)
+{
+#define a G->val[-1]
+#define b G->val[-2]
+  yyprintf((stderr, "do yy_1_Doc\n"));
+   a = add_node(a, yy); b = node(FOOTER); ;
+#undef b
+#undef a
+}
+
+YY_RULE(int) yy_CriticComment(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;
+  yyprintf((stderr, "%s\n", "CriticComment"));  if (!yymatchString(G, "{>>")) goto l1856;  yyText(G, G->begin, G->end);  if (!(YY_BEGIN)) goto l1856;
+  l1857:;	
+  {  int yypos1858= G->pos, yythunkpos1858= G->thunkpos;
+  {  int yypos1859= G->pos, yythunkpos1859= G->thunkpos;  if (!yymatchString(G, "<<}")) goto l1859;  goto l1858;
+  l1859:;	  G->pos= yypos1859; G->thunkpos= yythunkpos1859;
+  }  if (!yymatchDot(G)) goto l1858;  goto l1857;
+  l1858:;	  G->pos= yypos1858; G->thunkpos= yythunkpos1858;
+  }  yyText(G, G->begin, G->end);  if (!(YY_END)) goto l1856;  if (!yymatchString(G, "<<}")) goto l1856;  yyDo(G, yy_1_CriticComment, G->begin, G->end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "CriticComment", G->buf+G->pos));
+  return 1;
+  l1856:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "CriticComment", G->buf+G->pos));
+  return 0;
+}
+YY_RULE(int) yy_CriticHighlight(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;
+  yyprintf((stderr, "%s\n", "CriticHighlight"));  if (!yymatchString(G, "{==")) goto l1852;  yyText(G, G->begin, G->end);  if (!(YY_BEGIN)) goto l1852;
+  l1853:;	
+  {  int yypos1854= G->pos, yythunkpos1854= G->thunkpos;
+  {  int yypos1855= G->pos, yythunkpos1855= G->thunkpos;  if (!yymatchString(G, "==}")) goto l1855;  goto l1854;
+  l1855:;	  G->pos= yypos1855; G->thunkpos= yythunkpos1855;
+  }  if (!yymatchDot(G)) goto l1854;  goto l1853;
+  l1854:;	  G->pos= yypos1854; G->thunkpos= yythunkpos1854;
+  }  yyText(G, G->begin, G->end);  if (!(YY_END)) goto l1852;  if (!yymatchString(G, "==}")) goto l1852;  yyDo(G, yy_1_CriticHighlight, G->begin, G->end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "CriticHighlight", G->buf+G->pos));
+  return 1;
+  l1852:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "CriticHighlight", G->buf+G->pos));
+  return 0;
+}
+YY_RULE(int) yy_CriticSubstAdd(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;
+  yyprintf((stderr, "%s\n", "CriticSubstAdd"));  yyText(G, G->begin, G->end);  if (!(YY_BEGIN)) goto l1848;
+  l1849:;	
+  {  int yypos1850= G->pos, yythunkpos1850= G->thunkpos;
+  {  int yypos1851= G->pos, yythunkpos1851= G->thunkpos;  if (!yymatchString(G, "~~}")) goto l1851;  goto l1850;
+  l1851:;	  G->pos= yypos1851; G->thunkpos= yythunkpos1851;
+  }  if (!yymatchDot(G)) goto l1850;  goto l1849;
+  l1850:;	  G->pos= yypos1850; G->thunkpos= yythunkpos1850;
+  }  yyText(G, G->begin, G->end);  if (!(YY_END)) goto l1848;  yyDo(G, yy_1_CriticSubstAdd, G->begin, G->end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "CriticSubstAdd", G->buf+G->pos));
+  return 1;
+  l1848:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "CriticSubstAdd", G->buf+G->pos));
+  return 0;
+}
+YY_RULE(int) yy_CriticSubstDel(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;
+  yyprintf((stderr, "%s\n", "CriticSubstDel"));  yyText(G, G->begin, G->end);  if (!(YY_BEGIN)) goto l1844;
+  l1845:;	
+  {  int yypos1846= G->pos, yythunkpos1846= G->thunkpos;
+  {  int yypos1847= G->pos, yythunkpos1847= G->thunkpos;  if (!yymatchString(G, "~>")) goto l1847;  goto l1846;
+  l1847:;	  G->pos= yypos1847; G->thunkpos= yythunkpos1847;
+  }  if (!yymatchDot(G)) goto l1846;  goto l1845;
+  l1846:;	  G->pos= yypos1846; G->thunkpos= yythunkpos1846;
+  }  yyText(G, G->begin, G->end);  if (!(YY_END)) goto l1844;  yyDo(G, yy_1_CriticSubstDel, G->begin, G->end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "CriticSubstDel", G->buf+G->pos));
+  return 1;
+  l1844:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "CriticSubstDel", G->buf+G->pos));
+  return 0;
+}
+YY_RULE(int) yy_CriticSubstitution(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyDo(G, yyPush, 1, 0);
+  yyprintf((stderr, "%s\n", "CriticSubstitution"));  if (!yy_StartList(G)) goto l1843;  yyDo(G, yySet, -1, 0);  if (!yymatchString(G, "{~~")) goto l1843;  if (!yy_CriticSubstDel(G)) goto l1843;  yyDo(G, yy_1_CriticSubstitution, G->begin, G->end);  if (!yymatchString(G, "~>")) goto l1843;  if (!yy_CriticSubstAdd(G)) goto l1843;  yyDo(G, yy_2_CriticSubstitution, G->begin, G->end);  if (!yymatchString(G, "~~}")) goto l1843;  yyDo(G, yy_3_CriticSubstitution, G->begin, G->end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "CriticSubstitution", G->buf+G->pos));  yyDo(G, yyPop, 1, 0);
+  return 1;
+  l1843:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "CriticSubstitution", G->buf+G->pos));
+  return 0;
+}
+YY_RULE(int) yy_CriticDeletion(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;
+  yyprintf((stderr, "%s\n", "CriticDeletion"));  if (!yymatchString(G, "{--")) goto l1839;  yyText(G, G->begin, G->end);  if (!(YY_BEGIN)) goto l1839;
+  l1840:;	
+  {  int yypos1841= G->pos, yythunkpos1841= G->thunkpos;
+  {  int yypos1842= G->pos, yythunkpos1842= G->thunkpos;  if (!yymatchString(G, "--}")) goto l1842;  goto l1841;
+  l1842:;	  G->pos= yypos1842; G->thunkpos= yythunkpos1842;
+  }  if (!yymatchDot(G)) goto l1841;  goto l1840;
+  l1841:;	  G->pos= yypos1841; G->thunkpos= yythunkpos1841;
+  }  yyText(G, G->begin, G->end);  if (!(YY_END)) goto l1839;  if (!yymatchString(G, "--}")) goto l1839;  yyDo(G, yy_1_CriticDeletion, G->begin, G->end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "CriticDeletion", G->buf+G->pos));
+  return 1;
+  l1839:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "CriticDeletion", G->buf+G->pos));
+  return 0;
+}
+YY_RULE(int) yy_CriticAddition(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;
+  yyprintf((stderr, "%s\n", "CriticAddition"));  if (!yymatchString(G, "{++")) goto l1835;  yyText(G, G->begin, G->end);  if (!(YY_BEGIN)) goto l1835;
+  l1836:;	
+  {  int yypos1837= G->pos, yythunkpos1837= G->thunkpos;
+  {  int yypos1838= G->pos, yythunkpos1838= G->thunkpos;  if (!yymatchString(G, "++}")) goto l1838;  goto l1837;
+  l1838:;	  G->pos= yypos1838; G->thunkpos= yythunkpos1838;
+  }  if (!yymatchDot(G)) goto l1837;  goto l1836;
+  l1837:;	  G->pos= yypos1837; G->thunkpos= yythunkpos1837;
+  }  yyText(G, G->begin, G->end);  if (!(YY_END)) goto l1835;  if (!yymatchString(G, "++}")) goto l1835;  yyDo(G, yy_1_CriticAddition, G->begin, G->end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "CriticAddition", G->buf+G->pos));
+  return 1;
+  l1835:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "CriticAddition", G->buf+G->pos));
+  return 0;
+}
+YY_RULE(int) yy_CriticMarkup(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;
+  yyprintf((stderr, "%s\n", "CriticMarkup"));
+  {  int yypos1830= G->pos, yythunkpos1830= G->thunkpos;  if (!yy_CriticAddition(G)) goto l1831;  goto l1830;
+  l1831:;	  G->pos= yypos1830; G->thunkpos= yythunkpos1830;  if (!yy_CriticDeletion(G)) goto l1832;  goto l1830;
+  l1832:;	  G->pos= yypos1830; G->thunkpos= yythunkpos1830;  if (!yy_CriticSubstitution(G)) goto l1833;  goto l1830;
+  l1833:;	  G->pos= yypos1830; G->thunkpos= yythunkpos1830;  if (!yy_CriticHighlight(G)) goto l1834;  goto l1830;
+  l1834:;	  G->pos= yypos1830; G->thunkpos= yythunkpos1830;  if (!yy_CriticComment(G)) goto l1829;
+  }
+  l1830:;	
+  yyprintf((stderr, "  ok   %s @ %s\n", "CriticMarkup", G->buf+G->pos));
+  return 1;
+  l1829:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "CriticMarkup", G->buf+G->pos));
+  return 0;
+}
+YY_RULE(int) yy_TOCPlain(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyDo(G, yyPush, 2, 0);
+  yyprintf((stderr, "%s\n", "TOCPlain"));
+  {  int yypos1821= G->pos, yythunkpos1821= G->thunkpos;  if (!yy_Fenced(G)) goto l1822;  yyDo(G, yySet, -1, 0);  yyDo(G, yy_1_TOCPlain, G->begin, G->end);  goto l1821;
+  l1822:;	  G->pos= yypos1821; G->thunkpos= yythunkpos1821;
+  {  int yypos1823= G->pos, yythunkpos1823= G->thunkpos;  if (!yy_BlankLine(G)) goto l1823;  goto l1818;
+  l1823:;	  G->pos= yypos1823; G->thunkpos= yythunkpos1823;
+  }
+  {  int yypos1824= G->pos, yythunkpos1824= G->thunkpos;  if (!yy_Heading(G)) goto l1824;  goto l1818;
+  l1824:;	  G->pos= yypos1824; G->thunkpos= yythunkpos1824;
+  }  if (!yy_Line(G)) goto l1818;  yyDo(G, yySet, -2, 0);  yyDo(G, yy_2_TOCPlain, G->begin, G->end);
+  }
+  l1821:;	
+  l1819:;	
+  {  int yypos1820= G->pos, yythunkpos1820= G->thunkpos;
+  {  int yypos1825= G->pos, yythunkpos1825= G->thunkpos;  if (!yy_Fenced(G)) goto l1826;  yyDo(G, yySet, -1, 0);  yyDo(G, yy_1_TOCPlain, G->begin, G->end);  goto l1825;
+  l1826:;	  G->pos= yypos1825; G->thunkpos= yythunkpos1825;
+  {  int yypos1827= G->pos, yythunkpos1827= G->thunkpos;  if (!yy_BlankLine(G)) goto l1827;  goto l1820;
+  l1827:;	  G->pos= yypos1827; G->thunkpos= yythunkpos1827;
+  }
+  {  int yypos1828= G->pos, yythunkpos1828= G->thunkpos;  if (!yy_Heading(G)) goto l1828;  goto l1820;
+  l1828:;	  G->pos= yypos1828; G->thunkpos= yythunkpos1828;
+  }  if (!yy_Line(G)) goto l1820;  yyDo(G, yySet, -2, 0);  yyDo(G, yy_2_TOCPlain, G->begin, G->end);
+  }
+  l1825:;	  goto l1819;
+  l1820:;	  G->pos= yypos1820; G->thunkpos= yythunkpos1820;
+  }
+  yyprintf((stderr, "  ok   %s @ %s\n", "TOCPlain", G->buf+G->pos));  yyDo(G, yyPop, 2, 0);
+  return 1;
+  l1818:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "TOCPlain", G->buf+G->pos));
+  return 0;
+}
+YY_RULE(int) yy_TOCSectionBlock(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;
+  yyprintf((stderr, "%s\n", "TOCSectionBlock"));
+  l1815:;	
+  {  int yypos1816= G->pos, yythunkpos1816= G->thunkpos;  if (!yy_BlankLine(G)) goto l1816;  goto l1815;
+  l1816:;	  G->pos= yypos1816; G->thunkpos= yythunkpos1816;
+  }
+  {  int yypos1817= G->pos, yythunkpos1817= G->thunkpos;  if (!yy_Heading(G)) goto l1817;  goto l1814;
+  l1817:;	  G->pos= yypos1817; G->thunkpos= yythunkpos1817;
+  }  if (!yy_TOCPlain(G)) goto l1814;
+  yyprintf((stderr, "  ok   %s @ %s\n", "TOCSectionBlock", G->buf+G->pos));
+  return 1;
+  l1814:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "TOCSectionBlock", G->buf+G->pos));
+  return 0;
+}
+YY_RULE(int) yy_TOCHeadingSection(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyDo(G, yyPush, 1, 0);
+  yyprintf((stderr, "%s\n", "TOCHeadingSection"));  if (!yy_StartList(G)) goto l1811;  yyDo(G, yySet, -1, 0);  if (!yy_Heading(G)) goto l1811;  yyDo(G, yy_1_TOCHeadingSection, G->begin, G->end);
+  l1812:;	
+  {  int yypos1813= G->pos, yythunkpos1813= G->thunkpos;  if (!yy_TOCSectionBlock(G)) goto l1813;  goto l1812;
+  l1813:;	  G->pos= yypos1813; G->thunkpos= yythunkpos1813;
+  }  yyDo(G, yy_2_TOCHeadingSection, G->begin, G->end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "TOCHeadingSection", G->buf+G->pos));  yyDo(G, yyPop, 1, 0);
+  return 1;
+  l1811:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "TOCHeadingSection", G->buf+G->pos));
+  return 0;
+}
+YY_RULE(int) yy_TOCBlock(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;
+  yyprintf((stderr, "%s\n", "TOCBlock"));
+  l1809:;	
+  {  int yypos1810= G->pos, yythunkpos1810= G->thunkpos;  if (!yy_BlankLine(G)) goto l1810;  goto l1809;
+  l1810:;	  G->pos= yypos1810; G->thunkpos= yythunkpos1810;
+  }  if (!yy_TOCHeadingSection(G)) goto l1808;
+  yyprintf((stderr, "  ok   %s @ %s\n", "TOCBlock", G->buf+G->pos));
+  return 1;
+  l1808:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "TOCBlock", G->buf+G->pos));
+  return 0;
+}
+YY_RULE(int) yy_DocForTOC(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyDo(G, yyPush, 2, 0);
+  yyprintf((stderr, "%s\n", "DocForTOC"));
+  {  int yypos1794= G->pos, yythunkpos1794= G->thunkpos;  if (!yy_BOM(G)) goto l1794;  goto l1795;
+  l1794:;	  G->pos= yypos1794; G->thunkpos= yythunkpos1794;
+  }
+  l1795:;	  if (!yy_StartList(G)) goto l1793;  yyDo(G, yySet, -1, 0);
+  {  int yypos1796= G->pos, yythunkpos1796= G->thunkpos;
+  {  int yypos1798= G->pos, yythunkpos1798= G->thunkpos;
+  {  int yypos1799= G->pos, yythunkpos1799= G->thunkpos;  if (!yy_YAMLStart(G)) goto l1799;  goto l1800;
+  l1799:;	  G->pos= yypos1799; G->thunkpos= yythunkpos1799;
+  }
+  l1800:;	  if (!yy_MetaDataKey(G)) goto l1796;  if (!yy_Sp(G)) goto l1796;  if (!yymatchChar(G, ':')) goto l1796;  if (!yy_Sp(G)) goto l1796;
+  {  int yypos1801= G->pos, yythunkpos1801= G->thunkpos;  if (!yy_Newline(G)) goto l1801;  goto l1796;
+  l1801:;	  G->pos= yypos1801; G->thunkpos= yythunkpos1801;
+  }  G->pos= yypos1798; G->thunkpos= yythunkpos1798;
+  }  if (!yy_MetaData(G)) goto l1796;  yyDo(G, yySet, -2, 0);  yyDo(G, yy_1_DocForTOC, G->begin, G->end);  goto l1797;
+  l1796:;	  G->pos= yypos1796; G->thunkpos= yythunkpos1796;
+  }
+  l1797:;	
+  l1802:;	
+  {  int yypos1803= G->pos, yythunkpos1803= G->thunkpos;
+  {  int yypos1804= G->pos, yythunkpos1804= G->thunkpos;  if (!yy_TOCBlock(G)) goto l1805;  yyDo(G, yy_2_DocForTOC, G->begin, G->end);  goto l1804;
+  l1805:;	  G->pos= yypos1804; G->thunkpos= yythunkpos1804;  if (!yy_TOCPlain(G)) goto l1803;
+  }
+  l1804:;	  goto l1802;
+  l1803:;	  G->pos= yypos1803; G->thunkpos= yythunkpos1803;
+  }
+  l1806:;	
+  {  int yypos1807= G->pos, yythunkpos1807= G->thunkpos;  if (!yy_BlankLine(G)) goto l1807;  goto l1806;
+  l1807:;	  G->pos= yypos1807; G->thunkpos= yythunkpos1807;
+  }  yyDo(G, yy_3_DocForTOC, G->begin, G->end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "DocForTOC", G->buf+G->pos));  yyDo(G, yyPop, 2, 0);
+  return 1;
+  l1793:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "DocForTOC", G->buf+G->pos));
+  return 0;
+}
+YY_RULE(int) yy_OPMLPlain(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyDo(G, yyPush, 1, 0);
+  yyprintf((stderr, "%s\n", "OPMLPlain"));  if (!yy_StartList(G)) goto l1786;  yyDo(G, yySet, -1, 0);
+  {  int yypos1789= G->pos, yythunkpos1789= G->thunkpos;  if (!yy_BlankLine(G)) goto l1789;  goto l1786;
+  l1789:;	  G->pos= yypos1789; G->thunkpos= yythunkpos1789;
+  }
+  {  int yypos1790= G->pos, yythunkpos1790= G->thunkpos;  if (!yy_Heading(G)) goto l1790;  goto l1786;
+  l1790:;	  G->pos= yypos1790; G->thunkpos= yythunkpos1790;
+  }  if (!yy_Line(G)) goto l1786;  yyDo(G, yy_1_OPMLPlain, G->begin, G->end);
+  l1787:;	
+  {  int yypos1788= G->pos, yythunkpos1788= G->thunkpos;
+  {  int yypos1791= G->pos, yythunkpos1791= G->thunkpos;  if (!yy_BlankLine(G)) goto l1791;  goto l1788;
+  l1791:;	  G->pos= yypos1791; G->thunkpos= yythunkpos1791;
+  }
+  {  int yypos1792= G->pos, yythunkpos1792= G->thunkpos;  if (!yy_Heading(G)) goto l1792;  goto l1788;
+  l1792:;	  G->pos= yypos1792; G->thunkpos= yythunkpos1792;
+  }  if (!yy_Line(G)) goto l1788;  yyDo(G, yy_1_OPMLPlain, G->begin, G->end);  goto l1787;
+  l1788:;	  G->pos= yypos1788; G->thunkpos= yythunkpos1788;
+  }  yyDo(G, yy_2_OPMLPlain, G->begin, G->end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "OPMLPlain", G->buf+G->pos));  yyDo(G, yyPop, 1, 0);
+  return 1;
+  l1786:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "OPMLPlain", G->buf+G->pos));
+  return 0;
+}
+YY_RULE(int) yy_OPMLSectionBlock(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;
+  yyprintf((stderr, "%s\n", "OPMLSectionBlock"));
+  l1783:;	
+  {  int yypos1784= G->pos, yythunkpos1784= G->thunkpos;  if (!yy_BlankLine(G)) goto l1784;  goto l1783;
+  l1784:;	  G->pos= yypos1784; G->thunkpos= yythunkpos1784;
+  }
+  {  int yypos1785= G->pos, yythunkpos1785= G->thunkpos;  if (!yy_OPMLHeading(G)) goto l1785;  goto l1782;
+  l1785:;	  G->pos= yypos1785; G->thunkpos= yythunkpos1785;
+  }  if (!yy_OPMLPlain(G)) goto l1782;
+  yyprintf((stderr, "  ok   %s @ %s\n", "OPMLSectionBlock", G->buf+G->pos));
+  return 1;
+  l1782:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "OPMLSectionBlock", G->buf+G->pos));
+  return 0;
+}
+YY_RULE(int) yy_OPMLSetextHeading2(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;
+  yyprintf((stderr, "%s\n", "OPMLSetextHeading2"));  yyText(G, G->begin, G->end);  if (!(YY_BEGIN)) goto l1778;
+  l1779:;	
+  {  int yypos1780= G->pos, yythunkpos1780= G->thunkpos;
+  {  int yypos1781= G->pos, yythunkpos1781= G->thunkpos;  if (!yymatchChar(G, '\012')) goto l1781;  goto l1780;
+  l1781:;	  G->pos= yypos1781; G->thunkpos= yythunkpos1781;
+  }  if (!yymatchDot(G)) goto l1780;  goto l1779;
+  l1780:;	  G->pos= yypos1780; G->thunkpos= yythunkpos1780;
+  }  yyText(G, G->begin, G->end);  if (!(YY_END)) goto l1778;  if (!yy_Newline(G)) goto l1778;  if (!yy_SetextBottom2(G)) goto l1778;  yyDo(G, yy_1_OPMLSetextHeading2, G->begin, G->end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "OPMLSetextHeading2", G->buf+G->pos));
+  return 1;
+  l1778:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "OPMLSetextHeading2", G->buf+G->pos));
+  return 0;
+}
+YY_RULE(int) yy_OPMLSetextHeading1(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;
+  yyprintf((stderr, "%s\n", "OPMLSetextHeading1"));  yyText(G, G->begin, G->end);  if (!(YY_BEGIN)) goto l1774;
+  l1775:;	
+  {  int yypos1776= G->pos, yythunkpos1776= G->thunkpos;
+  {  int yypos1777= G->pos, yythunkpos1777= G->thunkpos;  if (!yymatchChar(G, '\012')) goto l1777;  goto l1776;
+  l1777:;	  G->pos= yypos1777; G->thunkpos= yythunkpos1777;
+  }  if (!yymatchDot(G)) goto l1776;  goto l1775;
+  l1776:;	  G->pos= yypos1776; G->thunkpos= yythunkpos1776;
+  }  yyText(G, G->begin, G->end);  if (!(YY_END)) goto l1774;  if (!yy_Newline(G)) goto l1774;  if (!yy_SetextBottom1(G)) goto l1774;  yyDo(G, yy_1_OPMLSetextHeading1, G->begin, G->end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "OPMLSetextHeading1", G->buf+G->pos));
+  return 1;
+  l1774:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "OPMLSetextHeading1", G->buf+G->pos));
+  return 0;
+}
+YY_RULE(int) yy_OPMLSetextHeading(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;
+  yyprintf((stderr, "%s\n", "OPMLSetextHeading"));
+  {  int yypos1772= G->pos, yythunkpos1772= G->thunkpos;  if (!yy_OPMLSetextHeading1(G)) goto l1773;  goto l1772;
+  l1773:;	  G->pos= yypos1772; G->thunkpos= yythunkpos1772;  if (!yy_OPMLSetextHeading2(G)) goto l1771;
+  }
+  l1772:;	
+  yyprintf((stderr, "  ok   %s @ %s\n", "OPMLSetextHeading", G->buf+G->pos));
+  return 1;
+  l1771:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "OPMLSetextHeading", G->buf+G->pos));
+  return 0;
+}
+YY_RULE(int) yy_OPMLAtxHeading(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyDo(G, yyPush, 1, 0);
+  yyprintf((stderr, "%s\n", "OPMLAtxHeading"));
+  {  int yypos1760= G->pos, yythunkpos1760= G->thunkpos;  if (!yy_Heading(G)) goto l1759;  G->pos= yypos1760; G->thunkpos= yythunkpos1760;
+  }  if (!yy_AtxStart(G)) goto l1759;  yyDo(G, yySet, -1, 0);  if (!yy_Sp(G)) goto l1759;  yyText(G, G->begin, G->end);  if (!(YY_BEGIN)) goto l1759;
+  l1761:;	
+  {  int yypos1762= G->pos, yythunkpos1762= G->thunkpos;
+  {  int yypos1763= G->pos, yythunkpos1763= G->thunkpos;  if (!yy_Newline(G)) goto l1763;  goto l1762;
+  l1763:;	  G->pos= yypos1763; G->thunkpos= yythunkpos1763;
+  }
+  {  int yypos1764= G->pos, yythunkpos1764= G->thunkpos;  if (!yy_Sp(G)) goto l1764;
+  l1765:;	
+  {  int yypos1766= G->pos, yythunkpos1766= G->thunkpos;  if (!yymatchChar(G, '#')) goto l1766;  goto l1765;
+  l1766:;	  G->pos= yypos1766; G->thunkpos= yythunkpos1766;
+  }  if (!yy_Sp(G)) goto l1764;  if (!yy_Newline(G)) goto l1764;  goto l1762;
+  l1764:;	  G->pos= yypos1764; G->thunkpos= yythunkpos1764;
+  }  if (!yymatchDot(G)) goto l1762;  goto l1761;
+  l1762:;	  G->pos= yypos1762; G->thunkpos= yythunkpos1762;
+  }  yyText(G, G->begin, G->end);  if (!(YY_END)) goto l1759;
+  {  int yypos1767= G->pos, yythunkpos1767= G->thunkpos;  if (!yy_Sp(G)) goto l1767;  if (!yymatchChar(G, '#')) goto l1767;
+  l1769:;	
+  {  int yypos1770= G->pos, yythunkpos1770= G->thunkpos;  if (!yymatchChar(G, '#')) goto l1770;  goto l1769;
+  l1770:;	  G->pos= yypos1770; G->thunkpos= yythunkpos1770;
+  }  goto l1768;
+  l1767:;	  G->pos= yypos1767; G->thunkpos= yythunkpos1767;
+  }
+  l1768:;	  if (!yy_Sp(G)) goto l1759;  if (!yy_Newline(G)) goto l1759;  yyDo(G, yy_1_OPMLAtxHeading, G->begin, G->end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "OPMLAtxHeading", G->buf+G->pos));  yyDo(G, yyPop, 1, 0);
+  return 1;
+  l1759:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "OPMLAtxHeading", G->buf+G->pos));
+  return 0;
+}
+YY_RULE(int) yy_OPMLHeading(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;
+  yyprintf((stderr, "%s\n", "OPMLHeading"));
+  {  int yypos1757= G->pos, yythunkpos1757= G->thunkpos;  if (!yy_OPMLAtxHeading(G)) goto l1758;  goto l1757;
+  l1758:;	  G->pos= yypos1757; G->thunkpos= yythunkpos1757;  if (!yy_OPMLSetextHeading(G)) goto l1756;
+  }
+  l1757:;	
+  yyprintf((stderr, "  ok   %s @ %s\n", "OPMLHeading", G->buf+G->pos));
+  return 1;
+  l1756:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "OPMLHeading", G->buf+G->pos));
+  return 0;
+}
+YY_RULE(int) yy_OPMLHeadingSection(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyDo(G, yyPush, 1, 0);
+  yyprintf((stderr, "%s\n", "OPMLHeadingSection"));  if (!yy_StartList(G)) goto l1753;  yyDo(G, yySet, -1, 0);  if (!yy_OPMLHeading(G)) goto l1753;  yyDo(G, yy_1_OPMLHeadingSection, G->begin, G->end);
+  l1754:;	
+  {  int yypos1755= G->pos, yythunkpos1755= G->thunkpos;  if (!yy_OPMLSectionBlock(G)) goto l1755;  yyDo(G, yy_2_OPMLHeadingSection, G->begin, G->end);  goto l1754;
+  l1755:;	  G->pos= yypos1755; G->thunkpos= yythunkpos1755;
+  }  yyDo(G, yy_3_OPMLHeadingSection, G->begin, G->end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "OPMLHeadingSection", G->buf+G->pos));  yyDo(G, yyPop, 1, 0);
+  return 1;
+  l1753:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "OPMLHeadingSection", G->buf+G->pos));
+  return 0;
+}
+YY_RULE(int) yy_OPMLBlock(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;
+  yyprintf((stderr, "%s\n", "OPMLBlock"));
+  l1749:;	
+  {  int yypos1750= G->pos, yythunkpos1750= G->thunkpos;  if (!yy_BlankLine(G)) goto l1750;  goto l1749;
+  l1750:;	  G->pos= yypos1750; G->thunkpos= yythunkpos1750;
+  }
+  {  int yypos1751= G->pos, yythunkpos1751= G->thunkpos;  if (!yy_OPMLHeadingSection(G)) goto l1752;  goto l1751;
+  l1752:;	  G->pos= yypos1751; G->thunkpos= yythunkpos1751;  if (!yy_OPMLPlain(G)) goto l1748;
+  }
+  l1751:;	
+  yyprintf((stderr, "  ok   %s @ %s\n", "OPMLBlock", G->buf+G->pos));
+  return 1;
+  l1748:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "OPMLBlock", G->buf+G->pos));
+  return 0;
+}
+YY_RULE(int) yy_DocForOPML(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyDo(G, yyPush, 1, 0);
+  yyprintf((stderr, "%s\n", "DocForOPML"));
+  {  int yypos1736= G->pos, yythunkpos1736= G->thunkpos;  if (!yy_BOM(G)) goto l1736;  goto l1737;
+  l1736:;	  G->pos= yypos1736; G->thunkpos= yythunkpos1736;
+  }
+  l1737:;	  if (!yy_StartList(G)) goto l1735;  yyDo(G, yySet, -1, 0);
+  {  int yypos1738= G->pos, yythunkpos1738= G->thunkpos;  yyText(G, G->begin, G->end);  if (!( !ext(EXT_COMPATIBILITY) )) goto l1738;
+  {  int yypos1740= G->pos, yythunkpos1740= G->thunkpos;
+  {  int yypos1741= G->pos, yythunkpos1741= G->thunkpos;  if (!yy_YAMLStart(G)) goto l1741;  goto l1742;
+  l1741:;	  G->pos= yypos1741; G->thunkpos= yythunkpos1741;
+  }
+  l1742:;	  if (!yy_MetaDataKey(G)) goto l1738;  if (!yy_Sp(G)) goto l1738;  if (!yymatchChar(G, ':')) goto l1738;  if (!yy_Sp(G)) goto l1738;
+  {  int yypos1743= G->pos, yythunkpos1743= G->thunkpos;  if (!yy_Newline(G)) goto l1743;  goto l1738;
+  l1743:;	  G->pos= yypos1743; G->thunkpos= yythunkpos1743;
+  }  G->pos= yypos1740; G->thunkpos= yythunkpos1740;
+  }  if (!yy_MetaData(G)) goto l1738;  yyDo(G, yy_1_DocForOPML, G->begin, G->end);  goto l1739;
+  l1738:;	  G->pos= yypos1738; G->thunkpos= yythunkpos1738;
+  }
+  l1739:;	
+  l1744:;	
+  {  int yypos1745= G->pos, yythunkpos1745= G->thunkpos;  if (!yy_OPMLBlock(G)) goto l1745;  yyDo(G, yy_2_DocForOPML, G->begin, G->end);  goto l1744;
+  l1745:;	  G->pos= yypos1745; G->thunkpos= yythunkpos1745;
+  }
+  l1746:;	
+  {  int yypos1747= G->pos, yythunkpos1747= G->thunkpos;  if (!yy_BlankLine(G)) goto l1747;  goto l1746;
+  l1747:;	  G->pos= yypos1747; G->thunkpos= yythunkpos1747;
+  }  yyDo(G, yy_3_DocForOPML, G->begin, G->end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "DocForOPML", G->buf+G->pos));  yyDo(G, yyPop, 1, 0);
+  return 1;
+  l1735:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "DocForOPML", G->buf+G->pos));
+  return 0;
+}
+YY_RULE(int) yy_RawNoteBlock(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyDo(G, yyPush, 1, 0);
+  yyprintf((stderr, "%s\n", "RawNoteBlock"));  if (!yy_StartList(G)) goto l1726;  yyDo(G, yySet, -1, 0);
+  {  int yypos1729= G->pos, yythunkpos1729= G->thunkpos;  if (!yy_BlankLine(G)) goto l1729;  goto l1726;
+  l1729:;	  G->pos= yypos1729; G->thunkpos= yythunkpos1729;
+  }
+  {  int yypos1730= G->pos, yythunkpos1730= G->thunkpos;  if (!yy_NonindentSpace(G)) goto l1730;  if (!yy_RawNoteReference(G)) goto l1730;  if (!yymatchChar(G, ':')) goto l1730;  goto l1726;
+  l1730:;	  G->pos= yypos1730; G->thunkpos= yythunkpos1730;
+  }  if (!yy_OptionallyIndentedLine(G)) goto l1726;  yyDo(G, yy_1_RawNoteBlock, G->begin, G->end);
+  l1727:;	
+  {  int yypos1728= G->pos, yythunkpos1728= G->thunkpos;
+  {  int yypos1731= G->pos, yythunkpos1731= G->thunkpos;  if (!yy_BlankLine(G)) goto l1731;  goto l1728;
+  l1731:;	  G->pos= yypos1731; G->thunkpos= yythunkpos1731;
+  }
+  {  int yypos1732= G->pos, yythunkpos1732= G->thunkpos;  if (!yy_NonindentSpace(G)) goto l1732;  if (!yy_RawNoteReference(G)) goto l1732;  if (!yymatchChar(G, ':')) goto l1732;  goto l1728;
+  l1732:;	  G->pos= yypos1732; G->thunkpos= yythunkpos1732;
+  }  if (!yy_OptionallyIndentedLine(G)) goto l1728;  yyDo(G, yy_1_RawNoteBlock, G->begin, G->end);  goto l1727;
+  l1728:;	  G->pos= yypos1728; G->thunkpos= yythunkpos1728;
+  }  yyText(G, G->begin, G->end);  if (!(YY_BEGIN)) goto l1726;
+  l1733:;	
+  {  int yypos1734= G->pos, yythunkpos1734= G->thunkpos;  if (!yy_BlankLine(G)) goto l1734;  goto l1733;
+  l1734:;	  G->pos= yypos1734; G->thunkpos= yythunkpos1734;
+  }  yyText(G, G->begin, G->end);  if (!(YY_END)) goto l1726;  yyDo(G, yy_2_RawNoteBlock, G->begin, G->end);  yyDo(G, yy_3_RawNoteBlock, G->begin, G->end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "RawNoteBlock", G->buf+G->pos));  yyDo(G, yyPop, 1, 0);
+  return 1;
+  l1726:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "RawNoteBlock", G->buf+G->pos));
+  return 0;
+}
+YY_RULE(int) yy_Note(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyDo(G, yyPush, 2, 0);
+  yyprintf((stderr, "%s\n", "Note"));  yyText(G, G->begin, G->end);  if (!( ext(EXT_NOTES) )) goto l1722;  if (!yy_NonindentSpace(G)) goto l1722;  if (!yy_RawNoteReference(G)) goto l1722;  yyDo(G, yySet, -1, 0);  if (!yymatchChar(G, ':')) goto l1722;  if (!yy_Sp(G)) goto l1722;  if (!yy_StartList(G)) goto l1722;  yyDo(G, yySet, -2, 0);  if (!yy_RawNoteBlock(G)) goto l1722;  yyDo(G, yy_1_Note, G->begin, G->end);
+  l1723:;	
+  {  int yypos1724= G->pos, yythunkpos1724= G->thunkpos;
+  {  int yypos1725= G->pos, yythunkpos1725= G->thunkpos;  if (!yy_Indent(G)) goto l1724;  G->pos= yypos1725; G->thunkpos= yythunkpos1725;
+  }  if (!yy_RawNoteBlock(G)) goto l1724;  yyDo(G, yy_2_Note, G->begin, G->end);  goto l1723;
+  l1724:;	  G->pos= yypos1724; G->thunkpos= yythunkpos1724;
+  }  yyDo(G, yy_3_Note, G->begin, G->end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "Note", G->buf+G->pos));  yyDo(G, yyPop, 2, 0);
+  return 1;
+  l1722:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "Note", G->buf+G->pos));
+  return 0;
+}
+YY_RULE(int) yy_RawNoteReference(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;
+  yyprintf((stderr, "%s\n", "RawNoteReference"));
+  {  int yypos1714= G->pos, yythunkpos1714= G->thunkpos;  if (!yymatchString(G, "[^")) goto l1715;  goto l1714;
+  l1715:;	  G->pos= yypos1714; G->thunkpos= yythunkpos1714;  if (!yymatchString(G, "[#")) goto l1713;
+  }
+  l1714:;	  yyText(G, G->begin, G->end);  if (!(YY_BEGIN)) goto l1713;
+  {  int yypos1718= G->pos, yythunkpos1718= G->thunkpos;  if (!yy_Newline(G)) goto l1718;  goto l1713;
+  l1718:;	  G->pos= yypos1718; G->thunkpos= yythunkpos1718;
+  }
+  {  int yypos1719= G->pos, yythunkpos1719= G->thunkpos;  if (!yymatchChar(G, ']')) goto l1719;  goto l1713;
+  l1719:;	  G->pos= yypos1719; G->thunkpos= yythunkpos1719;
+  }  if (!yymatchDot(G)) goto l1713;
+  l1716:;	
+  {  int yypos1717= G->pos, yythunkpos1717= G->thunkpos;
+  {  int yypos1720= G->pos, yythunkpos1720= G->thunkpos;  if (!yy_Newline(G)) goto l1720;  goto l1717;
+  l1720:;	  G->pos= yypos1720; G->thunkpos= yythunkpos1720;
+  }
+  {  int yypos1721= G->pos, yythunkpos1721= G->thunkpos;  if (!yymatchChar(G, ']')) goto l1721;  goto l1717;
+  l1721:;	  G->pos= yypos1721; G->thunkpos= yythunkpos1721;
+  }  if (!yymatchDot(G)) goto l1717;  goto l1716;
+  l1717:;	  G->pos= yypos1717; G->thunkpos= yythunkpos1717;
+  }  yyText(G, G->begin, G->end);  if (!(YY_END)) goto l1713;  if (!yymatchChar(G, ']')) goto l1713;  yyDo(G, yy_1_RawNoteReference, G->begin, G->end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "RawNoteReference", G->buf+G->pos));
+  return 1;
+  l1713:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "RawNoteReference", G->buf+G->pos));
+  return 0;
+}
+YY_RULE(int) yy_TableCaption(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyDo(G, yyPush, 3, 0);
+  yyprintf((stderr, "%s\n", "TableCaption"));  if (!yy_StartList(G)) goto l1710;  yyDo(G, yySet, -1, 0);  if (!yy_StartList(G)) goto l1710;  yyDo(G, yySet, -2, 0);  yyText(G, G->begin, G->end);  if (!(YY_BEGIN)) goto l1710;  if (!yy_BracketedText(G)) goto l1710;  yyText(G, G->begin, G->end);  if (!(YY_END)) goto l1710;  yyDo(G, yy_1_TableCaption, G->begin, G->end);
+  {  int yypos1711= G->pos, yythunkpos1711= G->thunkpos;  if (!yy_AutoLabel(G)) goto l1711;  yyDo(G, yySet, -3, 0);  yyDo(G, yy_2_TableCaption, G->begin, G->end);  goto l1712;
+  l1711:;	  G->pos= yypos1711; G->thunkpos= yythunkpos1711;
+  }
+  l1712:;	  if (!yy_Sp(G)) goto l1710;  if (!yy_Newline(G)) goto l1710;  yyDo(G, yy_3_TableCaption, G->begin, G->end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "TableCaption", G->buf+G->pos));  yyDo(G, yyPop, 3, 0);
+  return 1;
+  l1710:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "TableCaption", G->buf+G->pos));
+  return 0;
+}
+YY_RULE(int) yy_BracketedText(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;
+  yyprintf((stderr, "%s\n", "BracketedText"));
+  {  int yypos1702= G->pos, yythunkpos1702= G->thunkpos;  yyText(G, G->begin, G->end);  if (!( memo_ok(MEMO_BRACKETED_TEXT) )) goto l1703;  if (!yymatchChar(G, '[')) goto l1703;  yyText(G, G->begin, G->end);  if (!( nest_enter((parser_data *)G->data) )) goto l1703;
+  l1704:;	
+  {  int yypos1705= G->pos, yythunkpos1705= G->thunkpos;
+  {  int yypos1706= G->pos, yythunkpos1706= G->thunkpos;
+  {  int yypos1708= G->pos, yythunkpos1708= G->thunkpos;  if (!yymatchChar(G, '[')) goto l1708;  goto l1707;
+  l1708:;	  G->pos= yypos1708; G->thunkpos= yythunkpos1708;
+  }
+  {  int yypos1709= G->pos, yythunkpos1709= G->thunkpos;  if (!yymatchChar(G, ']')) goto l1709;  goto l1707;
+  l1709:;	  G->pos= yypos1709; G->thunkpos= yythunkpos1709;
+  }  if (!yymatchDot(G)) goto l1707;  goto l1706;
+  l1707:;	  G->pos= yypos1706; G->thunkpos= yythunkpos1706;  if (!yy_BracketedText(G)) goto l1705;
+  }
+  l1706:;	  goto l1704;
+  l1705:;	  G->pos= yypos1705; G->thunkpos= yythunkpos1705;
+  }  yyText(G, G->begin, G->end);  if (!( nest_leave((parser_data *)G->data) )) goto l1703;  if (!yymatchChar(G, ']')) goto l1703;  goto l1702;
+  l1703:;	  G->pos= yypos1702; G->thunkpos= yythunkpos1702;  yyText(G, G->begin, G->end);  if (!( memo_fail(MEMO_BRACKETED_TEXT) )) goto l1701;
+  }
+  l1702:;	
+  yyprintf((stderr, "  ok   %s @ %s\n", "BracketedText", G->buf+G->pos));
+  return 1;
+  l1701:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "BracketedText", G->buf+G->pos));
+  return 0;
+}
+YY_RULE(int) yy_CellDivider(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;
+  yyprintf((stderr, "%s\n", "CellDivider"));  if (!yymatchChar(G, '|')) goto l1700;
+  yyprintf((stderr, "  ok   %s @ %s\n", "CellDivider", G->buf+G->pos));
+  return 1;
+  l1700:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "CellDivider", G->buf+G->pos));
+  return 0;
+}
+YY_RULE(int) yy_RightAlign(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;
+  yyprintf((stderr, "%s\n", "RightAlign"));
+  {  int yypos1690= G->pos, yythunkpos1690= G->thunkpos;  if (!yymatchChar(G, '-')) goto l1691;
+  l1692:;	
+  {  int yypos1693= G->pos, yythunkpos1693= G->thunkpos;  if (!yymatchChar(G, '-')) goto l1693;  goto l1692;
+  l1693:;	  G->pos= yypos1693; G->thunkpos= yythunkpos1693;
+  }  goto l1690;
+  l1691:;	  G->pos= yypos1690; G->thunkpos= yythunkpos1690;  if (!yymatchChar(G, '=')) goto l1689;
+  l1694:;	
+  {  int yypos1695= G->pos, yythunkpos1695= G->thunkpos;  if (!yymatchChar(G, '=')) goto l1695;  goto l1694;
+  l1695:;	  G->pos= yypos1695; G->thunkpos= yythunkpos1695;
+  }
+  }
+  l1690:;	  if (!yymatchChar(G, ':')) goto l1689;
+  {  int yypos1696= G->pos, yythunkpos1696= G->thunkpos;
+  {  int yypos1697= G->pos, yythunkpos1697= G->thunkpos;  if (!yymatchChar(G, '-')) goto l1697;  goto l1689;
+  l1697:;	  G->pos= yypos1697; G->thunkpos= yythunkpos1697;
+  }
+  {  int yypos1698= G->pos, yythunkpos1698= G->thunkpos;  if (!yymatchChar(G, '=')) goto l1698;  goto l1689;
+  l1698:;	  G->pos= yypos1698; G->thunkpos= yythunkpos1698;
+  }
+  {  int yypos1699= G->pos, yythunkpos1699= G->thunkpos;  if (!yymatchChar(G, ':')) goto l1699;  goto l1689;
+  l1699:;	  G->pos= yypos1699; G->thunkpos= yythunkpos1699;
+  }  G->pos= yypos1696; G->thunkpos= yythunkpos1696;
+  }  yyDo(G, yy_1_RightAlign, G->begin, G->end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "RightAlign", G->buf+G->pos));
+  return 1;
+  l1689:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "RightAlign", G->buf+G->pos));
+  return 0;
+}
+YY_RULE(int) yy_RightAlignWrap(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;
+  yyprintf((stderr, "%s\n", "RightAlignWrap"));
+  {  int yypos1679= G->pos, yythunkpos1679= G->thunkpos;  if (!yymatchChar(G, '-')) goto l1680;
+  l1681:;	
+  {  int yypos1682= G->pos, yythunkpos1682= G->thunkpos;  if (!yymatchChar(G, '-')) goto l1682;  goto l1681;
+  l1682:;	  G->pos= yypos1682; G->thunkpos= yythunkpos1682;
+  }  goto l1679;
+  l1680:;	  G->pos= yypos1679; G->thunkpos= yythunkpos1679;  if (!yymatchChar(G, '=')) goto l1678;
+  l1683:;	
+  {  int yypos1684= G->pos, yythunkpos1684= G->thunkpos;  if (!yymatchChar(G, '=')) goto l1684;  goto l1683;
+  l1684:;	  G->pos= yypos1684; G->thunkpos= yythunkpos1684;
+  }
+  }
+  l1679:;	  if (!yymatchChar(G, ':')) goto l1678;  if (!yymatchChar(G, '+')) goto l1678;
+  {  int yypos1685= G->pos, yythunkpos1685= G->thunkpos;
+  {  int yypos1686= G->pos, yythunkpos1686= G->thunkpos;  if (!yymatchChar(G, '-')) goto l1686;  goto l1678;
+  l1686:;	  G->pos= yypos1686; G->thunkpos= yythunkpos1686;
+  }
+  {  int yypos1687= G->pos, yythunkpos1687= G->thunkpos;  if (!yymatchChar(G, '=')) goto l1687;  goto l1678;
+  l1687:;	  G->pos= yypos1687; G->thunkpos= yythunkpos1687;
+  }
+  {  int yypos1688= G->pos, yythunkpos1688= G->thunkpos;  if (!yymatchChar(G, ':')) goto l1688;  goto l1678;
+  l1688:;	  G->pos= yypos1688; G->thunkpos= yythunkpos1688;
+  }  G->pos= yypos1685; G->thunkpos= yythunkpos1685;
+  }  yyDo(G, yy_1_RightAlignWrap, G->begin, G->end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "RightAlignWrap", G->buf+G->pos));
+  return 1;
+  l1678:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "RightAlignWrap", G->buf+G->pos));
+  return 0;
+}
+YY_RULE(int) yy_CenterAlign(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;
+  yyprintf((stderr, "%s\n", "CenterAlign"));  if (!yymatchChar(G, ':')) goto l1665;
+  {  int yypos1666= G->pos, yythunkpos1666= G->thunkpos;
+  {  int yypos1668= G->pos, yythunkpos1668= G->thunkpos;  if (!yymatchChar(G, '-')) goto l1669;
+  l1670:;	
+  {  int yypos1671= G->pos, yythunkpos1671= G->thunkpos;  if (!yymatchChar(G, '-')) goto l1671;  goto l1670;
+  l1671:;	  G->pos= yypos1671; G->thunkpos= yythunkpos1671;
+  }  goto l1668;
+  l1669:;	  G->pos= yypos1668; G->thunkpos= yythunkpos1668;  if (!yymatchChar(G, '=')) goto l1666;
+  l1672:;	
+  {  int yypos1673= G->pos, yythunkpos1673= G->thunkpos;  if (!yymatchChar(G, '=')) goto l1673;  goto l1672;
+  l1673:;	  G->pos= yypos1673; G->thunkpos= yythunkpos1673;
+  }
+  }
+  l1668:;	  goto l1667;
+  l1666:;	  G->pos= yypos1666; G->thunkpos= yythunkpos1666;
+  }
+  l1667:;	  if (!yymatchChar(G, ':')) goto l1665;
+  {  int yypos1674= G->pos, yythunkpos1674= G->thunkpos;
+  {  int yypos1675= G->pos, yythunkpos1675= G->thunkpos;  if (!yymatchChar(G, '-')) goto l1675;  goto l1665;
+  l1675:;	  G->pos= yypos1675; G->thunkpos= yythunkpos1675;
+  }
+  {  int yypos1676= G->pos, yythunkpos1676= G->thunkpos;  if (!yymatchChar(G, '=')) goto l1676;  goto l1665;
+  l1676:;	  G->pos= yypos1676; G->thunkpos= yythunkpos1676;
+  }
+  {  int yypos1677= G->pos, yythunkpos1677= G->thunkpos;  if (!yymatchChar(G, ':')) goto l1677;  goto l1665;
+  l1677:;	  G->pos= yypos1677; G->thunkpos= yythunkpos1677;
+  }  G->pos= yypos1674; G->thunkpos= yythunkpos1674;
+  }  yyDo(G, yy_1_CenterAlign, G->begin, G->end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "CenterAlign", G->buf+G->pos));
+  return 1;
+  l1665:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "CenterAlign", G->buf+G->pos));
+  return 0;
+}
+YY_RULE(int) yy_CenterAlignWrap(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;
+  yyprintf((stderr, "%s\n", "CenterAlignWrap"));  if (!yymatchChar(G, ':')) goto l1652;
+  {  int yypos1653= G->pos, yythunkpos1653= G->thunkpos;
+  {  int yypos1655= G->pos, yythunkpos1655= G->thunkpos;  if (!yymatchChar(G, '-')) goto l1656;
+  l1657:;	
+  {  int yypos1658= G->pos, yythunkpos1658= G->thunkpos;  if (!yymatchChar(G, '-')) goto l1658;  goto l1657;
+  l1658:;	  G->pos= yypos1658; G->thunkpos= yythunkpos1658;
+  }  goto l1655;
+  l1656:;	  G->pos= yypos1655; G->thunkpos= yythunkpos1655;  if (!yymatchChar(G, '=')) goto l1653;
+  l1659:;	
+  {  int yypos1660= G->pos, yythunkpos1660= G->thunkpos;  if (!yymatchChar(G, '=')) goto l1660;  goto l1659;
+  l1660:;	  G->pos= yypos1660; G->thunkpos= yythunkpos1660;
+  }
+  }
+  l1655:;	  goto l1654;
+  l1653:;	  G->pos= yypos1653; G->thunkpos= yythunkpos1653;
+  }
+  l1654:;	  if (!yymatchChar(G, '+')) goto l1652;  if (!yymatchChar(G, ':')) goto l1652;
+  {  int yypos1661= G->pos, yythunkpos1661= G->thunkpos;
+  {  int yypos1662= G->pos, yythunkpos1662= G->thunkpos;  if (!yymatchChar(G, '-')) goto l1662;  goto l1652;
+  l1662:;	  G->pos= yypos1662; G->thunkpos= yythunkpos1662;
+  }
+  {  int yypos1663= G->pos, yythunkpos1663= G->thunkpos;  if (!yymatchChar(G, '=')) goto l1663;  goto l1652;
+  l1663:;	  G->pos= yypos1663; G->thunkpos= yythunkpos1663;
+  }
+  {  int yypos1664= G->pos, yythunkpos1664= G->thunkpos;  if (!yymatchChar(G, ':')) goto l1664;  goto l1652;
+  l1664:;	  G->pos= yypos1664; G->thunkpos= yythunkpos1664;
+  }  G->pos= yypos1661; G->thunkpos= yythunkpos1661;
+  }  yyDo(G, yy_1_CenterAlignWrap, G->begin, G->end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "CenterAlignWrap", G->buf+G->pos));
+  return 1;
+  l1652:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "CenterAlignWrap", G->buf+G->pos));
+  return 0;
+}
+YY_RULE(int) yy_LeftAlign(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;
+  yyprintf((stderr, "%s\n", "LeftAlign"));
+  {  int yypos1641= G->pos, yythunkpos1641= G->thunkpos;  if (!yymatchChar(G, ':')) goto l1641;  goto l1642;
+  l1641:;	  G->pos= yypos1641; G->thunkpos= yythunkpos1641;
+  }
+  l1642:;	
+  {  int yypos1643= G->pos, yythunkpos1643= G->thunkpos;  if (!yymatchChar(G, '-')) goto l1644;
+  l1645:;	
+  {  int yypos1646= G->pos, yythunkpos1646= G->thunkpos;  if (!yymatchChar(G, '-')) goto l1646;  goto l1645;
+  l1646:;	  G->pos= yypos1646; G->thunkpos= yythunkpos1646;
+  }  goto l1643;
+  l1644:;	  G->pos= yypos1643; G->thunkpos= yythunkpos1643;  if (!yymatchChar(G, '=')) goto l1640;
+  l1647:;	
+  {  int yypos1648= G->pos, yythunkpos1648= G->thunkpos;  if (!yymatchChar(G, '=')) goto l1648;  goto l1647;
+  l1648:;	  G->pos= yypos1648; G->thunkpos= yythunkpos1648;
+  }
+  }
+  l1643:;	
+  {  int yypos1649= G->pos, yythunkpos1649= G->thunkpos;
+  {  int yypos1650= G->pos, yythunkpos1650= G->thunkpos;  if (!yymatchChar(G, '-')) goto l1650;  goto l1640;
+  l1650:;	  G->pos= yypos1650; G->thunkpos= yythunkpos1650;
+  }
+  {  int yypos1651= G->pos, yythunkpos1651= G->thunkpos;  if (!yymatchChar(G, ':')) goto l1651;  goto l1640;
+  l1651:;	  G->pos= yypos1651; G->thunkpos= yythunkpos1651;
+  }  G->pos= yypos1649; G->thunkpos= yythunkpos1649;
+  }  yyDo(G, yy_1_LeftAlign, G->begin, G->end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "LeftAlign", G->buf+G->pos));
+  return 1;
+  l1640:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "LeftAlign", G->buf+G->pos));
+  return 0;
+}
+YY_RULE(int) yy_LeftAlignWrap(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;
+  yyprintf((stderr, "%s\n", "LeftAlignWrap"));
+  {  int yypos1628= G->pos, yythunkpos1628= G->thunkpos;  if (!yymatchChar(G, ':')) goto l1628;  goto l1629;
+  l1628:;	  G->pos= yypos1628; G->thunkpos= yythunkpos1628;
+  }
+  l1629:;	
+  {  int yypos1630= G->pos, yythunkpos1630= G->thunkpos;  if (!yymatchChar(G, '-')) goto l1631;
+  l1632:;	
+  {  int yypos1633= G->pos, yythunkpos1633= G->thunkpos;  if (!yymatchChar(G, '-')) goto l1633;  goto l1632;
+  l1633:;	  G->pos= yypos1633; G->thunkpos= yythunkpos1633;
+  }  goto l1630;
+  l1631:;	  G->pos= yypos1630; G->thunkpos= yythunkpos1630;  if (!yymatchChar(G, '=')) goto l1627;
+  l1634:;	
+  {  int yypos1635= G->pos, yythunkpos1635= G->thunkpos;  if (!yymatchChar(G, '=')) goto l1635;  goto l1634;
+  l1635:;	  G->pos= yypos1635; G->thunkpos= yythunkpos1635;
+  }
+  }
+  l1630:;	  if (!yymatchChar(G, '+')) goto l1627;
+  {  int yypos1636= G->pos, yythunkpos1636= G->thunkpos;
+  {  int yypos1637= G->pos, yythunkpos1637= G->thunkpos;  if (!yymatchChar(G, '-')) goto l1637;  goto l1627;
+  l1637:;	  G->pos= yypos1637; G->thunkpos= yythunkpos1637;
+  }
+  {  int yypos1638= G->pos, yythunkpos1638= G->thunkpos;  if (!yymatchChar(G, '=')) goto l1638;  goto l1627;
+  l1638:;	  G->pos= yypos1638; G->thunkpos= yythunkpos1638;
+  }
+  {  int yypos1639= G->pos, yythunkpos1639= G->thunkpos;  if (!yymatchChar(G, ':')) goto l1639;  goto l1627;
+  l1639:;	  G->pos= yypos1639; G->thunkpos= yythunkpos1639;
+  }  G->pos= yypos1636; G->thunkpos= yythunkpos1636;
+  }  yyDo(G, yy_1_LeftAlignWrap, G->begin, G->end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "LeftAlignWrap", G->buf+G->pos));
+  return 1;
+  l1627:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "LeftAlignWrap", G->buf+G->pos));
+  return 0;
+}
+YY_RULE(int) yy_AlignmentCell(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;
+  yyprintf((stderr, "%s\n", "AlignmentCell"));  if (!yy_Sp(G)) goto l1617;
+  {  int yypos1618= G->pos, yythunkpos1618= G->thunkpos;  if (!yy_CellDivider(G)) goto l1618;  goto l1617;
+  l1618:;	  G->pos= yypos1618; G->thunkpos= yythunkpos1618;
+  }
+  {  int yypos1619= G->pos, yythunkpos1619= G->thunkpos;  if (!yy_LeftAlignWrap(G)) goto l1620;  goto l1619;
+  l1620:;	  G->pos= yypos1619; G->thunkpos= yythunkpos1619;  if (!yy_CenterAlignWrap(G)) goto l1621;  goto l1619;
+  l1621:;	  G->pos= yypos1619; G->thunkpos= yythunkpos1619;  if (!yy_RightAlignWrap(G)) goto l1622;  goto l1619;
+  l1622:;	  G->pos= yypos1619; G->thunkpos= yythunkpos1619;  if (!yy_LeftAlign(G)) goto l1623;  goto l1619;
+  l1623:;	  G->pos= yypos1619; G->thunkpos= yythunkpos1619;  if (!yy_CenterAlign(G)) goto l1624;  goto l1619;
+  l1624:;	  G->pos= yypos1619; G->thunkpos= yythunkpos1619;  if (!yy_RightAlign(G)) goto l1617;
+  }
+  l1619:;	  if (!yy_Sp(G)) goto l1617;
+  {  int yypos1625= G->pos, yythunkpos1625= G->thunkpos;  if (!yy_CellDivider(G)) goto l1625;  goto l1626;
+  l1625:;	  G->pos= yypos1625; G->thunkpos= yythunkpos1625;
+  }
+  l1626:;	
+  yyprintf((stderr, "  ok   %s @ %s\n", "AlignmentCell", G->buf+G->pos));
+  return 1;
+  l1617:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "AlignmentCell", G->buf+G->pos));
+  return 0;
+}
+YY_RULE(int) yy_HeaderAlignmentCell(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;
+  yyprintf((stderr, "%s\n", "HeaderAlignmentCell"));  if (!yy_Sp(G)) goto l1612;
+  {  int yypos1613= G->pos, yythunkpos1613= G->thunkpos;  if (!yymatchChar(G, ':')) goto l1613;  goto l1614;
+  l1613:;	  G->pos= yypos1613; G->thunkpos= yythunkpos1613;
+  }
+  l1614:;	  if (!yymatchChar(G, '=')) goto l1612;
+  l1615:;	
+  {  int yypos1616= G->pos, yythunkpos1616= G->thunkpos;  if (!yymatchChar(G, '=')) goto l1616;  goto l1615;
+  l1616:;	  G->pos= yypos1616; G->thunkpos= yythunkpos1616;
+  }
+  yyprintf((stderr, "  ok   %s @ %s\n", "HeaderAlignmentCell", G->buf+G->pos));
+  return 1;
+  l1612:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "HeaderAlignmentCell", G->buf+G->pos));
+  return 0;
+}
+YY_RULE(int) yy_SeparatorLine(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyDo(G, yyPush, 1, 0);
+  yyprintf((stderr, "%s\n", "SeparatorLine"));  if (!yy_StartList(G)) goto l1600;  yyDo(G, yySet, -1, 0);
+  {  int yypos1601= G->pos, yythunkpos1601= G->thunkpos;  if (!yy_TableLine(G)) goto l1600;  G->pos= yypos1601; G->thunkpos= yythunkpos1601;
+  }
+  {  int yypos1602= G->pos, yythunkpos1602= G->thunkpos;  if (!yy_CellDivider(G)) goto l1602;  goto l1603;
+  l1602:;	  G->pos= yypos1602; G->thunkpos= yythunkpos1602;
+  }
+  l1603:;	
+  {  int yypos1606= G->pos, yythunkpos1606= G->thunkpos;
+  {  int yypos1608= G->pos, yythunkpos1608= G->thunkpos;  if (!yy_HeaderAlignmentCell(G)) goto l1607;  G->pos= yypos1608; G->thunkpos= yythunkpos1608;
+  }  if (!yy_AlignmentCell(G)) goto l1607;  yyDo(G, yy_1_SeparatorLine, G->begin, G->end);  goto l1606;
+  l1607:;	  G->pos= yypos1606; G->thunkpos= yythunkpos1606;  if (!yy_AlignmentCell(G)) goto l1600;  yyDo(G, yy_2_SeparatorLine, G->begin, G->end);
+  }
+  l1606:;	
+  l1604:;	
+  {  int yypos1605= G->pos, yythunkpos1605= G->thunkpos;
+  {  int yypos1609= G->pos, yythunkpos1609= G->thunkpos;
+  {  int yypos1611= G->pos, yythunkpos1611= G->thunkpos;  if (!yy_HeaderAlignmentCell(G)) goto l1610;  G->pos= yypos1611; G->thunkpos= yythunkpos1611;
+  }  if (!yy_AlignmentCell(G)) goto l1610;  yyDo(G, yy_1_SeparatorLine, G->begin, G->end);  goto l1609;
+  l1610:;	  G->pos= yypos1609; G->thunkpos= yythunkpos1609;  if (!yy_AlignmentCell(G)) goto l1605;  yyDo(G, yy_2_SeparatorLine, G->begin, G->end);
+  }
+  l1609:;	  goto l1604;
+  l1605:;	  G->pos= yypos1605; G->thunkpos= yythunkpos1605;
+  }  if (!yy_Sp(G)) goto l1600;  if (!yy_Newline(G)) goto l1600;  yyDo(G, yy_3_SeparatorLine, G->begin, G->end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "SeparatorLine", G->buf+G->pos));  yyDo(G, yyPop, 1, 0);
+  return 1;
+  l1600:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "SeparatorLine", G->buf+G->pos));
+  return 0;
+}
+YY_RULE(int) yy_EmptyCell(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;
+  yyprintf((stderr, "%s\n", "EmptyCell"));  yyText(G, G->begin, G->end);  if (!(YY_BEGIN)) goto l1599;  if (!yy_Sp(G)) goto l1599;  yyText(G, G->begin, G->end);  if (!(YY_END)) goto l1599;  if (!yy_CellDivider(G)) goto l1599;  yyDo(G, yy_1_EmptyCell, G->begin, G->end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "EmptyCell", G->buf+G->pos));
+  return 1;
+  l1599:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "EmptyCell", G->buf+G->pos));
+  return 0;
+}
+YY_RULE(int) yy_FullCell(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyDo(G, yyPush, 1, 0);
+  yyprintf((stderr, "%s\n", "FullCell"));  if (!yy_Sp(G)) goto l1584;  if (!yy_StartList(G)) goto l1584;  yyDo(G, yySet, -1, 0);
+  {  int yypos1587= G->pos, yythunkpos1587= G->thunkpos;  if (!yy_Newline(G)) goto l1587;  goto l1584;
+  l1587:;	  G->pos= yypos1587; G->thunkpos= yythunkpos1587;
+  }
+  {  int yypos1588= G->pos, yythunkpos1588= G->thunkpos;  if (!yy_Endline(G)) goto l1588;  goto l1584;
+  l1588:;	  G->pos= yypos1588; G->thunkpos= yythunkpos1588;
+  }
+  {  int yypos1589= G->pos, yythunkpos1589= G->thunkpos;  if (!yy_CellDivider(G)) goto l1589;  goto l1584;
+  l1589:;	  G->pos= yypos1589; G->thunkpos= yythunkpos1589;
+  }
+  {  int yypos1590= G->pos, yythunkpos1590= G->thunkpos;  if (!yy_Sp(G)) goto l1590;
+  {  int yypos1591= G->pos, yythunkpos1591= G->thunkpos;  if (!yy_CellDivider(G)) goto l1590;  G->pos= yypos1591; G->thunkpos= yythunkpos1591;
+  }  goto l1584;
+  l1590:;	  G->pos= yypos1590; G->thunkpos= yythunkpos1590;
+  }  if (!yy_Inline(G)) goto l1584;  yyDo(G, yy_1_FullCell, G->begin, G->end);
+  l1585:;	
+  {  int yypos1586= G->pos, yythunkpos1586= G->thunkpos;
+  {  int yypos1592= G->pos, yythunkpos1592= G->thunkpos;  if (!yy_Newline(G)) goto l1592;  goto l1586;
+  l1592:;	  G->pos= yypos1592; G->thunkpos= yythunkpos1592;
+  }
+  {  int yypos1593= G->pos, yythunkpos1593= G->thunkpos;  if (!yy_Endline(G)) goto l1593;  goto l1586;
+  l1593:;	  G->pos= yypos1593; G->thunkpos= yythunkpos1593;
+  }
+  {  int yypos1594= G->pos, yythunkpos1594= G->thunkpos;  if (!yy_CellDivider(G)) goto l1594;  goto l1586;
+  l1594:;	  G->pos= yypos1594; G->thunkpos= yythunkpos1594;
+  }
+  {  int yypos1595= G->pos, yythunkpos1595= G->thunkpos;  if (!yy_Sp(G)) goto l1595;
+  {  int yypos1596= G->pos, yythunkpos1596= G->thunkpos;  if (!yy_CellDivider(G)) goto l1595;  G->pos= yypos1596; G->thunkpos= yythunkpos1596;
+  }  goto l1586;
+  l1595:;	  G->pos= yypos1595; G->thunkpos= yythunkpos1595;
+  }  if (!yy_Inline(G)) goto l1586;  yyDo(G, yy_1_FullCell, G->begin, G->end);  goto l1585;
+  l1586:;	  G->pos= yypos1586; G->thunkpos= yythunkpos1586;
+  }  yyText(G, G->begin, G->end);  if (!(YY_BEGIN)) goto l1584;  if (!yy_Sp(G)) goto l1584;  yyText(G, G->begin, G->end);  if (!(YY_END)) goto l1584;
+  {  int yypos1597= G->pos, yythunkpos1597= G->thunkpos;  if (!yy_CellDivider(G)) goto l1597;  goto l1598;
+  l1597:;	  G->pos= yypos1597; G->thunkpos= yythunkpos1597;
+  }
+  l1598:;	  yyDo(G, yy_2_FullCell, G->begin, G->end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "FullCell", G->buf+G->pos));  yyDo(G, yyPop, 1, 0);
+  return 1;
+  l1584:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "FullCell", G->buf+G->pos));
+  return 0;
+}
+YY_RULE(int) yy_ExtendedCell(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;
+  yyprintf((stderr, "%s\n", "ExtendedCell"));
+  {  int yypos1580= G->pos, yythunkpos1580= G->thunkpos;  if (!yy_EmptyCell(G)) goto l1581;  goto l1580;
+  l1581:;	  G->pos= yypos1580; G->thunkpos= yythunkpos1580;  if (!yy_FullCell(G)) goto l1579;
+  }
+  l1580:;	  yyText(G, G->begin, G->end);  if (!(YY_BEGIN)) goto l1579;  if (!yy_CellDivider(G)) goto l1579;
+  l1582:;	
+  {  int yypos1583= G->pos, yythunkpos1583= G->thunkpos;  if (!yy_CellDivider(G)) goto l1583;  goto l1582;
+  l1583:;	  G->pos= yypos1583; G->thunkpos= yythunkpos1583;
+  }  yyText(G, G->begin, G->end);  if (!(YY_END)) goto l1579;  yyDo(G, yy_1_ExtendedCell, G->begin, G->end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "ExtendedCell", G->buf+G->pos));
+  return 1;
+  l1579:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "ExtendedCell", G->buf+G->pos));
+  return 0;
+}
+YY_RULE(int) yy_TableCell(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;
+  yyprintf((stderr, "%s\n", "TableCell"));
+  {  int yypos1576= G->pos, yythunkpos1576= G->thunkpos;  if (!yy_ExtendedCell(G)) goto l1577;  goto l1576;
+  l1577:;	  G->pos= yypos1576; G->thunkpos= yythunkpos1576;  if (!yy_EmptyCell(G)) goto l1578;  goto l1576;
+  l1578:;	  G->pos= yypos1576; G->thunkpos= yythunkpos1576;  if (!yy_FullCell(G)) goto l1575;
+  }
+  l1576:;	
+  yyprintf((stderr, "  ok   %s @ %s\n", "TableCell", G->buf+G->pos));
+  return 1;
+  l1575:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "TableCell", G->buf+G->pos));
+  return 0;
+}
+YY_RULE(int) yy_TableLine(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;
+  yyprintf((stderr, "%s\n", "TableLine"));
+  l1571:;	
+  {  int yypos1572= G->pos, yythunkpos1572= G->thunkpos;
+  {  int yypos1573= G->pos, yythunkpos1573= G->thunkpos;  if (!yy_Newline(G)) goto l1573;  goto l1572;
+  l1573:;	  G->pos= yypos1573; G->thunkpos= yythunkpos1573;
+  }
+  {  int yypos1574= G->pos, yythunkpos1574= G->thunkpos;  if (!yy_CellDivider(G)) goto l1574;  goto l1572;
+  l1574:;	  G->pos= yypos1574; G->thunkpos= yythunkpos1574;
+  }  if (!yymatchDot(G)) goto l1572;  goto l1571;
+  l1572:;	  G->pos= yypos1572; G->thunkpos= yythunkpos1572;
+  }  if (!yy_CellDivider(G)) goto l1570;
+  yyprintf((stderr, "  ok   %s @ %s\n", "TableLine", G->buf+G->pos));
+  return 1;
+  l1570:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "TableLine", G->buf+G->pos));
+  return 0;
+}
+YY_RULE(int) yy_TableRow(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyDo(G, yyPush, 1, 0);
+  yyprintf((stderr, "%s\n", "TableRow"));  if (!yy_StartList(G)) goto l1563;  yyDo(G, yySet, -1, 0);
+  {  int yypos1564= G->pos, yythunkpos1564= G->thunkpos;  if (!yy_SeparatorLine(G)) goto l1564;  goto l1563;
+  l1564:;	  G->pos= yypos1564; G->thunkpos= yythunkpos1564;
+  }
+  {  int yypos1565= G->pos, yythunkpos1565= G->thunkpos;  if (!yy_TableLine(G)) goto l1563;  G->pos= yypos1565; G->thunkpos= yythunkpos1565;
+  }
+  {  int yypos1566= G->pos, yythunkpos1566= G->thunkpos;  if (!yy_CellDivider(G)) goto l1566;  goto l1567;
+  l1566:;	  G->pos= yypos1566; G->thunkpos= yythunkpos1566;
+  }
+  l1567:;	  if (!yy_TableCell(G)) goto l1563;  yyDo(G, yy_1_TableRow, G->begin, G->end);
+  l1568:;	
+  {  int yypos1569= G->pos, yythunkpos1569= G->thunkpos;  if (!yy_TableCell(G)) goto l1569;  yyDo(G, yy_1_TableRow, G->begin, G->end);  goto l1568;
+  l1569:;	  G->pos= yypos1569; G->thunkpos= yythunkpos1569;
+  }  if (!yy_Sp(G)) goto l1563;  yyText(G, G->begin, G->end);  if (!(YY_BEGIN)) goto l1563;  if (!yy_Newline(G)) goto l1563;  yyText(G, G->begin, G->end);  if (!(YY_END)) goto l1563;  yyDo(G, yy_2_TableRow, G->begin, G->end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "TableRow", G->buf+G->pos));  yyDo(G, yyPop, 1, 0);
+  return 1;
+  l1563:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "TableRow", G->buf+G->pos));
+  return 0;
+}
+YY_RULE(int) yy_TableBody(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyDo(G, yyPush, 1, 0);
+  yyprintf((stderr, "%s\n", "TableBody"));  if (!yy_StartList(G)) goto l1560;  yyDo(G, yySet, -1, 0);  if (!yy_TableRow(G)) goto l1560;  yyDo(G, yy_1_TableBody, G->begin, G->end);
+  l1561:;	
+  {  int yypos1562= G->pos, yythunkpos1562= G->thunkpos;  if (!yy_TableRow(G)) goto l1562;  yyDo(G, yy_1_TableBody, G->begin, G->end);  goto l1561;
+  l1562:;	  G->pos= yypos1562; G->thunkpos= yythunkpos1562;
+  }  yyDo(G, yy_2_TableBody, G->begin, G->end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "TableBody", G->buf+G->pos));  yyDo(G, yyPop, 1, 0);
+  return 1;
+  l1560:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "TableBody", G->buf+G->pos));
+  return 0;
+}
+YY_RULE(int) yy_Table(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyDo(G, yyPush, 2, 0);
+  yyprintf((stderr, "%s\n", "Table"));  if (!yy_StartList(G)) goto l1542;  yyDo(G, yySet, -1, 0);  if (!yy_StartList(G)) goto l1542;  yyDo(G, yySet, -2, 0);
+  {  int yypos1543= G->pos, yythunkpos1543= G->thunkpos;  if (!yy_TableCaption(G)) goto l1543;  yyDo(G, yy_1_Table, G->begin, G->end);  goto l1544;
+  l1543:;	  G->pos= yypos1543; G->thunkpos= yythunkpos1543;
+  }
+  l1544:;	
+  {  int yypos1545= G->pos, yythunkpos1545= G->thunkpos;  if (!yy_TableBody(G)) goto l1545;  yyDo(G, yy_2_Table, G->begin, G->end);  goto l1546;
+  l1545:;	  G->pos= yypos1545; G->thunkpos= yythunkpos1545;
+  }
+  l1546:;	  if (!yy_SeparatorLine(G)) goto l1542;  yyDo(G, yy_3_Table, G->begin, G->end);  if (!yy_TableBody(G)) goto l1542;  yyDo(G, yy_4_Table, G->begin, G->end);
+  l1547:;	
+  {  int yypos1548= G->pos, yythunkpos1548= G->thunkpos;  if (!yy_BlankLine(G)) goto l1548;
+  {  int yypos1549= G->pos, yythunkpos1549= G->thunkpos;  if (!yy_TableCaption(G)) goto l1549;  goto l1548;
+  l1549:;	  G->pos= yypos1549; G->thunkpos= yythunkpos1549;
+  }  if (!yy_TableBody(G)) goto l1548;  yyDo(G, yy_5_Table, G->begin, G->end);
+  {  int yypos1550= G->pos, yythunkpos1550= G->thunkpos;
+  {  int yypos1551= G->pos, yythunkpos1551= G->thunkpos;  if (!yy_TableCaption(G)) goto l1552;  goto l1551;
+  l1552:;	  G->pos= yypos1551; G->thunkpos= yythunkpos1551;  if (!yy_BlankLine(G)) goto l1553;  goto l1551;
+  l1553:;	  G->pos= yypos1551; G->thunkpos= yythunkpos1551;  if (!yy_Heading(G)) goto l1548;
+  }
+  l1551:;	  G->pos= yypos1550; G->thunkpos= yythunkpos1550;
+  }  goto l1547;
+  l1548:;	  G->pos= yypos1548; G->thunkpos= yythunkpos1548;
+  }
+  {  int yypos1554= G->pos, yythunkpos1554= G->thunkpos;  if (!yy_TableCaption(G)) goto l1555;  yyDo(G, yy_6_Table, G->begin, G->end);
+  {  int yypos1556= G->pos, yythunkpos1556= G->thunkpos;  if (!yy_BlankLine(G)) goto l1555;  G->pos= yypos1556; G->thunkpos= yythunkpos1556;
+  }  goto l1554;
+  l1555:;	  G->pos= yypos1554; G->thunkpos= yythunkpos1554;
+  {  int yypos1558= G->pos, yythunkpos1558= G->thunkpos;  if (!yy_BlankLine(G)) goto l1557;  G->pos= yypos1558; G->thunkpos= yythunkpos1558;
+  }  goto l1554;
+  l1557:;	  G->pos= yypos1554; G->thunkpos= yythunkpos1554;
+  {  int yypos1559= G->pos, yythunkpos1559= G->thunkpos;  if (!yy_Heading(G)) goto l1542;  G->pos= yypos1559; G->thunkpos= yythunkpos1559;
+  }
+  }
+  l1554:;	  yyDo(G, yy_7_Table, G->begin, G->end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "Table", G->buf+G->pos));  yyDo(G, yyPop, 2, 0);
+  return 1;
+  l1542:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "Table", G->buf+G->pos));
+  return 0;
+}
+YY_RULE(int) yy_StyleBlock(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;
+  yyprintf((stderr, "%s\n", "StyleBlock"));  yyText(G, G->begin, G->end);  if (!(YY_BEGIN)) goto l1539;  if (!yy_InStyleTags(G)) goto l1539;  yyText(G, G->begin, G->end);  if (!(YY_END)) goto l1539;
+  l1540:;	
+  {  int yypos1541= G->pos, yythunkpos1541= G->thunkpos;  if (!yy_BlankLine(G)) goto l1541;  goto l1540;
+  l1541:;	  G->pos= yypos1541; G->thunkpos= yythunkpos1541;
+  }  yyDo(G, yy_1_StyleBlock, G->begin, G->end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "StyleBlock", G->buf+G->pos));
+  return 1;
+  l1539:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "StyleBlock", G->buf+G->pos));
+  return 0;
+}
+YY_RULE(int) yy_InStyleTags(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;
+  yyprintf((stderr, "%s\n", "InStyleTags"));  if (!yy_StyleOpen(G)) goto l1535;
+  l1536:;	
+  {  int yypos1537= G->pos, yythunkpos1537= G->thunkpos;
+  {  int yypos1538= G->pos, yythunkpos1538= G->thunkpos;  if (!yy_StyleClose(G)) goto l1538;  goto l1537;
+  l1538:;	  G->pos= yypos1538; G->thunkpos= yythunkpos1538;
+  }  if (!yymatchDot(G)) goto l1537;  goto l1536;
+  l1537:;	  G->pos= yypos1537; G->thunkpos= yythunkpos1537;
+  }  if (!yy_StyleClose(G)) goto l1535;
+  yyprintf((stderr, "  ok   %s @ %s\n", "InStyleTags", G->buf+G->pos));
+  return 1;
+  l1535:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "InStyleTags", G->buf+G->pos));
+  return 0;
+}
+YY_RULE(int) yy_StyleClose(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;
+  yyprintf((stderr, "%s\n", "StyleClose"));  if (!yymatchChar(G, '<')) goto l1532;  if (!yy_Spnl(G)) goto l1532;  if (!yymatchChar(G, '/')) goto l1532;
+  {  int yypos1533= G->pos, yythunkpos1533= G->thunkpos;  if (!yymatchString(G, "style")) goto l1534;  goto l1533;
+  l1534:;	  G->pos= yypos1533; G->thunkpos= yythunkpos1533;  if (!yymatchString(G, "STYLE")) goto l1532;
+  }
+  l1533:;	  if (!yy_Spnl(G)) goto l1532;  if (!yymatchChar(G, '>')) goto l1532;
+  yyprintf((stderr, "  ok   %s @ %s\n", "StyleClose", G->buf+G->pos));
+  return 1;
+  l1532:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "StyleClose", G->buf+G->pos));
+  return 0;
+}
+YY_RULE(int) yy_StyleOpen(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;
+  yyprintf((stderr, "%s\n", "StyleOpen"));  if (!yymatchChar(G, '<')) goto l1527;  if (!yy_Spnl(G)) goto l1527;
+  {  int yypos1528= G->pos, yythunkpos1528= G->thunkpos;  if (!yymatchString(G, "style")) goto l1529;  goto l1528;
+  l1529:;	  G->pos= yypos1528; G->thunkpos= yythunkpos1528;  if (!yymatchString(G, "STYLE")) goto l1527;
+  }
+  l1528:;	  if (!yy_Spnl(G)) goto l1527;
+  l1530:;	
+  {  int yypos1531= G->pos, yythunkpos1531= G->thunkpos;  if (!yy_HtmlAttribute(G)) goto l1531;  goto l1530;
+  l1531:;	  G->pos= yypos1531; G->thunkpos= yythunkpos1531;
+  }  if (!yymatchChar(G, '>')) goto l1527;
+  yyprintf((stderr, "  ok   %s @ %s\n", "StyleOpen", G->buf+G->pos));
+  return 1;
+  l1527:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "StyleOpen", G->buf+G->pos));
+  return 0;
+}
+YY_RULE(int) yy_HtmlBlockType(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;
+  yyprintf((stderr, "%s\n", "HtmlBlockType"));
+  {  int yypos1457= G->pos, yythunkpos1457= G->thunkpos;  if (!yymatchString(G, "address")) goto l1458;  goto l1457;
+  l1458:;	  G->pos= yypos1457; G->thunkpos= yythunkpos1457;  if (!yymatchString(G, "blockquote")) goto l1459;  goto l1457;
+  l1459:;	  G->pos= yypos1457; G->thunkpos= yythunkpos1457;  if (!yymatchString(G, "center")) goto l1460;  goto l1457;
+  l1460:;	  G->pos= yypos1457; G->thunkpos= yythunkpos1457;  if (!yymatchString(G, "dir")) goto l1461;  goto l1457;
+  l1461:;	  G->pos= yypos1457; G->thunkpos= yythunkpos1457;  if (!yymatchString(G, "div")) goto l1462;  goto l1457;
+  l1462:;	  G->pos= yypos1457; G->thunkpos= yythunkpos1457;  if (!yymatchString(G, "dl")) goto l1463;  goto l1457;
+  l1463:;	  G->pos= yypos1457; G->thunkpos= yythunkpos1457;  if (!yymatchString(G, "fieldset")) goto l1464;  goto l1457;
+  l1464:;	  G->pos= yypos1457; G->thunkpos= yythunkpos1457;  if (!yymatchString(G, "form")) goto l1465;  goto l1457;
+  l1465:;	  G->pos= yypos1457; G->thunkpos= yythunkpos1457;  if (!yymatchString(G, "h1")) goto l1466;  goto l1457;
+  l1466:;	  G->pos= yypos1457; G->thunkpos= yythunkpos1457;  if (!yymatchString(G, "h2")) goto l1467;  goto l1457;
+  l1467:;	  G->pos= yypos1457; G->thunkpos= yythunkpos1457;  if (!yymatchString(G, "h3")) goto l1468;  goto l1457;
+  l1468:;	  G->pos= yypos1457; G->thunkpos= yythunkpos1457;  if (!yymatchString(G, "h4")) goto l1469;  goto l1457;
+  l1469:;	  G->pos= yypos1457; G->thunkpos= yythunkpos1457;  if (!yymatchString(G, "h5")) goto l1470;  goto l1457;
+  l1470:;	  G->pos= yypos1457; G->thunkpos= yythunkpos1457;  if (!yymatchString(G, "h6")) goto l1471;  goto l1457;
+  l1471:;	  G->pos= yypos1457; G->thunkpos= yythunkpos1457;  if (!yymatchString(G, "hr")) goto l1472;  goto l1457;
+  l1472:;	  G->pos= yypos1457; G->thunkpos= yythunkpos1457;  if (!yymatchString(G, "isindex")) goto l1473;  goto l1457;
+  l1473:;	  G->pos= yypos1457; G->thunkpos= yythunkpos1457;  if (!yymatchString(G, "menu")) goto l1474;  goto l1457;
+  l1474:;	  G->pos= yypos1457; G->thunkpos= yythunkpos1457;  if (!yymatchString(G, "noframes")) goto l1475;  goto l1457;
+  l1475:;	  G->pos= yypos1457; G->thunkpos= yythunkpos1457;  if (!yymatchString(G, "noscript")) goto l1476;  goto l1457;
+  l1476:;	  G->pos= yypos1457; G->thunkpos= yythunkpos1457;  if (!yymatchString(G, "ol")) goto l1477;  goto l1457;
+  l1477:;	  G->pos= yypos1457; G->thunkpos= yythunkpos1457;  if (!yymatchString(G, "pre")) goto l1478;  goto l1457;
+  l1478:;	  G->pos= yypos1457; G->thunkpos= yythunkpos1457;  if (!yymatchChar(G, 'p')) goto l1479;  goto l1457;
+  l1479:;	  G->pos= yypos1457; G->thunkpos= yythunkpos1457;  if (!yymatchString(G, "table")) goto l1480;  goto l1457;
+  l1480:;	  G->pos= yypos1457; G->thunkpos= yythunkpos1457;  if (!yymatchString(G, "ul")) goto l1481;  goto l1457;
+  l1481:;	  G->pos= yypos1457; G->thunkpos= yythunkpos1457;  if (!yymatchString(G, "dd")) goto l1482;  goto l1457;
+  l1482:;	  G->pos= yypos1457; G->thunkpos= yythunkpos1457;  if (!yymatchString(G, "dt")) goto l1483;  goto l1457;
+  l1483:;	  G->pos= yypos1457; G->thunkpos= yythunkpos1457;  if (!yymatchString(G, "frameset")) goto l1484;  goto l1457;
+  l1484:;	  G->pos= yypos1457; G->thunkpos= yythunkpos1457;  if (!yymatchString(G, "li")) goto l1485;  goto l1457;
+  l1485:;	  G->pos= yypos1457; G->thunkpos= yythunkpos1457;  if (!yymatchString(G, "tbody")) goto l1486;  goto l1457;
+  l1486:;	  G->pos= yypos1457; G->thunkpos= yythunkpos1457;  if (!yymatchString(G, "td")) goto l1487;  goto l1457;
+  l1487:;	  G->pos= yypos1457; G->thunkpos= yythunkpos1457;  if (!yymatchString(G, "tfoot")) goto l1488;  goto l1457;
+  l1488:;	  G->pos= yypos1457; G->thunkpos= yythunkpos1457;  if (!yymatchString(G, "th")) goto l1489;  goto l1457;
+  l1489:;	  G->pos= yypos1457; G->thunkpos= yythunkpos1457;  if (!yymatchString(G, "thead")) goto l1490;  goto l1457;
+  l1490:;	  G->pos= yypos1457; G->thunkpos= yythunkpos1457;  if (!yymatchString(G, "tr")) goto l1491;  goto l1457;
+  l1491:;	  G->pos= yypos1457; G->thunkpos= yythunkpos1457;  if (!yymatchString(G, "script")) goto l1492;  goto l1457;
+  l1492:;	  G->pos= yypos1457; G->thunkpos= yythunkpos1457;  if (!yymatchString(G, "ADDRESS")) goto l1493;  goto l1457;
+  l1493:;	  G->pos= yypos1457; G->thunkpos= yythunkpos1457;  if (!yymatchString(G, "BLOCKQUOTE")) goto l1494;  goto l1457;
+  l1494:;	  G->pos= yypos1457; G->thunkpos= yythunkpos1457;  if (!yymatchString(G, "CENTER")) goto l1495;  goto l1457;
+  l1495:;	  G->pos= yypos1457; G->thunkpos= yythunkpos1457;  if (!yymatchString(G, "DIR")) goto l1496;  goto l1457;
+  l1496:;	  G->pos= yypos1457; G->thunkpos= yythunkpos1457;  if (!yymatchString(G, "DIV")) goto l1497;  goto l1457;
+  l1497:;	  G->pos= yypos1457; G->thunkpos= yythunkpos1457;  if (!yymatchString(G, "DL")) goto l1498;  goto l1457;
+  l1498:;	  G->pos= yypos1457; G->thunkpos= yythunkpos1457;  if (!yymatchString(G, "FIELDSET")) goto l1499;  goto l1457;
+  l1499:;	  G->pos= yypos1457; G->thunkpos= yythunkpos1457;  if (!yymatchString(G, "FORM")) goto l1500;  goto l1457;
+  l1500:;	  G->pos= yypos1457; G->thunkpos= yythunkpos1457;  if (!yymatchString(G, "H1")) goto l1501;  goto l1457;
+  l1501:;	  G->pos= yypos1457; G->thunkpos= yythunkpos1457;  if (!yymatchString(G, "H2")) goto l1502;  goto l1457;
+  l1502:;	  G->pos= yypos1457; G->thunkpos= yythunkpos1457;  if (!yymatchString(G, "H3")) goto l1503;  goto l1457;
+  l1503:;	  G->pos= yypos1457; G->thunkpos= yythunkpos1457;  if (!yymatchString(G, "H4")) goto l1504;  goto l1457;
+  l1504:;	  G->pos= yypos1457; G->thunkpos= yythunkpos1457;  if (!yymatchString(G, "H5")) goto l1505;  goto l1457;
+  l1505:;	  G->pos= yypos1457; G->thunkpos= yythunkpos1457;  if (!yymatchString(G, "H6")) goto l1506;  goto l1457;
+  l1506:;	  G->pos= yypos1457; G->thunkpos= yythunkpos1457;  if (!yymatchString(G, "HR")) goto l1507;  goto l1457;
+  l1507:;	  G->pos= yypos1457; G->thunkpos= yythunkpos1457;  if (!yymatchString(G, "ISINDEX")) goto l1508;  goto l1457;
+  l1508:;	  G->pos= yypos1457; G->thunkpos= yythunkpos1457;  if (!yymatchString(G, "MENU")) goto l1509;  goto l1457;
+  l1509:;	  G->pos= yypos1457; G->thunkpos= yythunkpos1457;  if (!yymatchString(G, "NOFRAMES")) goto l1510;  goto l1457;
+  l1510:;	  G->pos= yypos1457; G->thunkpos= yythunkpos1457;  if (!yymatchString(G, "NOSCRIPT")) goto l1511;  goto l1457;
+  l1511:;	  G->pos= yypos1457; G->thunkpos= yythunkpos1457;  if (!yymatchString(G, "OL")) goto l1512;  goto l1457;
+  l1512:;	  G->pos= yypos1457; G->thunkpos= yythunkpos1457;  if (!yymatchString(G, "PRE")) goto l1513;  goto l1457;
+  l1513:;	  G->pos= yypos1457; G->thunkpos= yythunkpos1457;  if (!yymatchChar(G, 'P')) goto l1514;  goto l1457;
+  l1514:;	  G->pos= yypos1457; G->thunkpos= yythunkpos1457;  if (!yymatchString(G, "TABLE")) goto l1515;  goto l1457;
+  l1515:;	  G->pos= yypos1457; G->thunkpos= yythunkpos1457;  if (!yymatchString(G, "UL")) goto l1516;  goto l1457;
+  l1516:;	  G->pos= yypos1457; G->thunkpos= yythunkpos1457;  if (!yymatchString(G, "DD")) goto l1517;  goto l1457;
+  l1517:;	  G->pos= yypos1457; G->thunkpos= yythunkpos1457;  if (!yymatchString(G, "DT")) goto l1518;  goto l1457;
+  l1518:;	  G->pos= yypos1457; G->thunkpos= yythunkpos1457;  if (!yymatchString(G, "FRAMESET")) goto l1519;  goto l1457;
+  l1519:;	  G->pos= yypos1457; G->thunkpos= yythunkpos1457;  if (!yymatchString(G, "LI")) goto l1520;  goto l1457;
+  l1520:;	  G->pos= yypos1457; G->thunkpos= yythunkpos1457;  if (!yymatchString(G, "TBODY")) goto l1521;  goto l1457;
+  l1521:;	  G->pos= yypos1457; G->thunkpos= yythunkpos1457;  if (!yymatchString(G, "TD")) goto l1522;  goto l1457;
+  l1522:;	  G->pos= yypos1457; G->thunkpos= yythunkpos1457;  if (!yymatchString(G, "TFOOT")) goto l1523;  goto l1457;
+  l1523:;	  G->pos= yypos1457; G->thunkpos= yythunkpos1457;  if (!yymatchString(G, "TH")) goto l1524;  goto l1457;
+  l1524:;	  G->pos= yypos1457; G->thunkpos= yythunkpos1457;  if (!yymatchString(G, "THEAD")) goto l1525;  goto l1457;
+  l1525:;	  G->pos= yypos1457; G->thunkpos= yythunkpos1457;  if (!yymatchString(G, "TR")) goto l1526;  goto l1457;
+  l1526:;	  G->pos= yypos1457; G->thunkpos= yythunkpos1457;  if (!yymatchString(G, "SCRIPT")) goto l1456;
+  }
+  l1457:;	
+  yyprintf((stderr, "  ok   %s @ %s\n", "HtmlBlockType", G->buf+G->pos));
+  return 1;
+  l1456:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "HtmlBlockType", G->buf+G->pos));
+  return 0;
+}
+YY_RULE(int) yy_HtmlBlockSelfClosing(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;
+  yyprintf((stderr, "%s\n", "HtmlBlockSelfClosing"));  if (!yymatchChar(G, '<')) goto l1453;  if (!yy_Spnl(G)) goto l1453;  if (!yy_HtmlBlockType(G)) goto l1453;  if (!yy_Spnl(G)) goto l1453;
+  l1454:;	
+  {  int yypos1455= G->pos, yythunkpos1455= G->thunkpos;  if (!yy_HtmlAttribute(G)) goto l1455;  goto l1454;
+  l1455:;	  G->pos= yypos1455; G->thunkpos= yythunkpos1455;
+  }  if (!yymatchChar(G, '/')) goto l1453;  if (!yy_Spnl(G)) goto l1453;  if (!yymatchChar(G, '>')) goto l1453;
+  yyprintf((stderr, "  ok   %s @ %s\n", "HtmlBlockSelfClosing", G->buf+G->pos));
+  return 1;
+  l1453:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "HtmlBlockSelfClosing", G->buf+G->pos));
+  return 0;
+}
+YY_RULE(int) yy_MarkdownHtmlTagOpen(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyDo(G, yyPush, 1, 0);
+  yyprintf((stderr, "%s\n", "MarkdownHtmlTagOpen"));  if (!yy_StartList(G)) goto l1446;  yyDo(G, yySet, -1, 0);  if (!yymatchChar(G, '<')) goto l1446;  yyDo(G, yy_1_MarkdownHtmlTagOpen, G->begin, G->end);  if (!yy_Spnl(G)) goto l1446;  yyText(G, G->begin, G->end);  if (!(YY_BEGIN)) goto l1446;  if (!yy_HtmlBlockType(G)) goto l1446;  yyText(G, G->begin, G->end);  if (!(YY_END)) goto l1446;  yyDo(G, yy_2_MarkdownHtmlTagOpen, G->begin, G->end);
+  {  int yypos1447= G->pos, yythunkpos1447= G->thunkpos;  if (!yy_Spacechar(G)) goto l1446;  G->pos= yypos1447; G->thunkpos= yythunkpos1447;
+  }  if (!yy_Spnl(G)) goto l1446;
+  l1448:;	
+  {  int yypos1449= G->pos, yythunkpos1449= G->thunkpos;
+  {  int yypos1450= G->pos, yythunkpos1450= G->thunkpos;  if (!yy_MarkdownHtmlAttribute(G)) goto l1450;  goto l1449;
+  l1450:;	  G->pos= yypos1450; G->thunkpos= yythunkpos1450;
+  }  yyText(G, G->begin, G->end);  if (!(YY_BEGIN)) goto l1449;  if (!yy_HtmlAttribute(G)) goto l1449;  yyText(G, G->begin, G->end);  if (!(YY_END)) goto l1449;  yyDo(G, yy_3_MarkdownHtmlTagOpen, G->begin, G->end);  goto l1448;
+  l1449:;	  G->pos= yypos1449; G->thunkpos= yythunkpos1449;
+  }  if (!yy_MarkdownHtmlAttribute(G)) goto l1446;
+  l1451:;	
+  {  int yypos1452= G->pos, yythunkpos1452= G->thunkpos;  yyText(G, G->begin, G->end);  if (!(YY_BEGIN)) goto l1452;  if (!yy_HtmlAttribute(G)) goto l1452;  yyText(G, G->begin, G->end);  if (!(YY_END)) goto l1452;  yyDo(G, yy_4_MarkdownHtmlTagOpen, G->begin, G->end);  goto l1451;
+  l1452:;	  G->pos= yypos1452; G->thunkpos= yythunkpos1452;
+  }  if (!yymatchChar(G, '>')) goto l1446;  yyDo(G, yy_5_MarkdownHtmlTagOpen, G->begin, G->end);  yyDo(G, yy_6_MarkdownHtmlTagOpen, G->begin, G->end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "MarkdownHtmlTagOpen", G->buf+G->pos));  yyDo(G, yyPop, 1, 0);
+  return 1;
+  l1446:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "MarkdownHtmlTagOpen", G->buf+G->pos));
+  return 0;
+}
+YY_RULE(int) yy_MarkdownHtmlAttribute(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;
+  yyprintf((stderr, "%s\n", "MarkdownHtmlAttribute"));
+  {  int yypos1440= G->pos, yythunkpos1440= G->thunkpos;  if (!yymatchString(G, "markdown")) goto l1441;  goto l1440;
+  l1441:;	  G->pos= yypos1440; G->thunkpos= yythunkpos1440;  if (!yymatchString(G, "MARKDOWN")) goto l1439;
+  }
+  l1440:;	  if (!yy_Spnl(G)) goto l1439;  if (!yymatchChar(G, '=')) goto l1439;  if (!yy_Spnl(G)) goto l1439;
+  {  int yypos1442= G->pos, yythunkpos1442= G->thunkpos;  if (!yymatchChar(G, '"')) goto l1442;  if (!yy_Spnl(G)) goto l1442;  goto l1443;
+  l1442:;	  G->pos= yypos1442; G->thunkpos= yythunkpos1442;
+  }
+  l1443:;	  if (!yymatchChar(G, '1')) goto l1439;
+  {  int yypos1444= G->pos, yythunkpos1444= G->thunkpos;  if (!yy_Spnl(G)) goto l1444;  if (!yymatchChar(G, '"')) goto l1444;  goto l1445;
+  l1444:;	  G->pos= yypos1444; G->thunkpos= yythunkpos1444;
+  }
+  l1445:;	  if (!yy_Spnl(G)) goto l1439;
+  yyprintf((stderr, "  ok   %s @ %s\n", "MarkdownHtmlAttribute", G->buf+G->pos));
+  return 1;
+  l1439:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "MarkdownHtmlAttribute", G->buf+G->pos));
+  return 0;
+}
+YY_RULE(int) yy_MarkdownHtmlBlock(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;
+  yyprintf((stderr, "%s\n", "MarkdownHtmlBlock"));
+  {  int yypos1433= G->pos, yythunkpos1433= G->thunkpos;  if (!yy_MarkdownHtmlTagOpen(G)) goto l1432;  G->pos= yypos1433; G->thunkpos= yythunkpos1433;
+  }  yyText(G, G->begin, G->end);  if (!(YY_BEGIN)) goto l1432;
+  {  int yypos1434= G->pos, yythunkpos1434= G->thunkpos;  if (!yy_HtmlBlockInTags(G)) goto l1435;  goto l1434;
+  l1435:;	  G->pos= yypos1434; G->thunkpos= yythunkpos1434;  if (!yy_HtmlComment(G)) goto l1436;  goto l1434;
+  l1436:;	  G->pos= yypos1434; G->thunkpos= yythunkpos1434;  if (!yy_HtmlBlockSelfClosing(G)) goto l1432;
+  }
+  l1434:;	  yyText(G, G->begin, G->end);  if (!(YY_END)) goto l1432;  if (!yy_BlankLine(G)) goto l1432;
+  l1437:;	
+  {  int yypos1438= G->pos, yythunkpos1438= G->thunkpos;  if (!yy_BlankLine(G)) goto l1438;  goto l1437;
+  l1438:;	  G->pos= yypos1438; G->thunkpos= yythunkpos1438;
+  }  yyDo(G, yy_1_MarkdownHtmlBlock, G->begin, G->end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "MarkdownHtmlBlock", G->buf+G->pos));
+  return 1;
+  l1432:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "MarkdownHtmlBlock", G->buf+G->pos));
+  return 0;
+}
+YY_RULE(int) yy_HtmlBlock(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;
+  yyprintf((stderr, "%s\n", "HtmlBlock"));
+  {  int yypos1426= G->pos, yythunkpos1426= G->thunkpos;  if (!yy_MarkdownHtmlTagOpen(G)) goto l1426;  goto l1425;
+  l1426:;	  G->pos= yypos1426; G->thunkpos= yythunkpos1426;
+  }  yyText(G, G->begin, G->end);  if (!(YY_BEGIN)) goto l1425;
+  {  int yypos1427= G->pos, yythunkpos1427= G->thunkpos;  if (!yy_HtmlBlockInTags(G)) goto l1428;  goto l1427;
+  l1428:;	  G->pos= yypos1427; G->thunkpos= yythunkpos1427;  if (!yy_HtmlComment(G)) goto l1429;  goto l1427;
+  l1429:;	  G->pos= yypos1427; G->thunkpos= yythunkpos1427;  if (!yy_HtmlBlockSelfClosing(G)) goto l1425;
+  }
+  l1427:;	  yyText(G, G->begin, G->end);  if (!(YY_END)) goto l1425;  if (!yy_BlankLine(G)) goto l1425;
+  l1430:;	
+  {  int yypos1431= G->pos, yythunkpos1431= G->thunkpos;  if (!yy_BlankLine(G)) goto l1431;  goto l1430;
+  l1431:;	  G->pos= yypos1431; G->thunkpos= yythunkpos1431;
+  }  yyDo(G, yy_1_HtmlBlock, G->begin, G->end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "HtmlBlock", G->buf+G->pos));
+  return 1;
+  l1425:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "HtmlBlock", G->buf+G->pos));
+  return 0;
+}
+YY_RULE(int) yy_HtmlBlockScript(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;
+  yyprintf((stderr, "%s\n", "HtmlBlockScript"));
+  {  int yypos1424= G->pos, yythunkpos1424= G->thunkpos;  if (!yymatchChar(G, '<')) goto l1423;  G->pos= yypos1424; G->thunkpos= yythunkpos1424;
+  }  yyText(G, G->begin, G->end);  if (!( html_block("script") )) goto l1423;
+  yyprintf((stderr, "  ok   %s @ %s\n", "HtmlBlockScript", G->buf+G->pos));
+  return 1;
+  l1423:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "HtmlBlockScript", G->buf+G->pos));
+  return 0;
+}
+YY_RULE(int) yy_HtmlBlockInTags(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;
+  yyprintf((stderr, "%s\n", "HtmlBlockInTags"));
+  {  int yypos1420= G->pos, yythunkpos1420= G->thunkpos;  yyText(G, G->begin, G->end);  if (!( memo_ok(MEMO_HTML_BLOCK_IN_TAGS) )) goto l1421;
+  {  int yypos1422= G->pos, yythunkpos1422= G->thunkpos;  if (!yymatchChar(G, '<')) goto l1421;  G->pos= yypos1422; G->thunkpos= yythunkpos1422;
+  }  yyText(G, G->begin, G->end);  if (!( html_block(NULL) )) goto l1421;  goto l1420;
+  l1421:;	  G->pos= yypos1420; G->thunkpos= yythunkpos1420;  yyText(G, G->begin, G->end);  if (!( memo_fail(MEMO_HTML_BLOCK_IN_TAGS) )) goto l1419;
+  }
+  l1420:;	
+  yyprintf((stderr, "  ok   %s @ %s\n", "HtmlBlockInTags", G->buf+G->pos));
+  return 1;
+  l1419:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "HtmlBlockInTags", G->buf+G->pos));
+  return 0;
+}
+YY_RULE(int) yy_ListBlockLine(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;
+  yyprintf((stderr, "%s\n", "ListBlockLine"));
+  {  int yypos1407= G->pos, yythunkpos1407= G->thunkpos;  if (!yy_BlankLine(G)) goto l1407;  goto l1406;
+  l1407:;	  G->pos= yypos1407; G->thunkpos= yythunkpos1407;
+  }
+  {  int yypos1408= G->pos, yythunkpos1408= G->thunkpos;  if (!yy_Heading(G)) goto l1408;  goto l1406;
+  l1408:;	  G->pos= yypos1408; G->thunkpos= yythunkpos1408;
+  }
+  {  int yypos1409= G->pos, yythunkpos1409= G->thunkpos;
+  {  int yypos1410= G->pos, yythunkpos1410= G->thunkpos;  if (!yy_Indent(G)) goto l1410;  goto l1411;
+  l1410:;	  G->pos= yypos1410; G->thunkpos= yythunkpos1410;
+  }
+  l1411:;	
+  {  int yypos1412= G->pos, yythunkpos1412= G->thunkpos;  if (!yy_Bullet(G)) goto l1413;  goto l1412;
+  l1413:;	  G->pos= yypos1412; G->thunkpos= yythunkpos1412;  if (!yy_Enumerator(G)) goto l1414;  goto l1412;
+  l1414:;	  G->pos= yypos1412; G->thunkpos= yythunkpos1412;  if (!yy_BulletNoSpace(G)) goto l1415;
+  {  int yypos1416= G->pos, yythunkpos1416= G->thunkpos;  if (!yy_EmptyList(G)) goto l1415;  G->pos= yypos1416; G->thunkpos= yythunkpos1416;
+  }  goto l1412;
+  l1415:;	  G->pos= yypos1412; G->thunkpos= yythunkpos1412;  if (!yy_EnumeratorNoSpace(G)) goto l1409;
+  {  int yypos1417= G->pos, yythunkpos1417= G->thunkpos;  if (!yy_EmptyList(G)) goto l1409;  G->pos= yypos1417; G->thunkpos= yythunkpos1417;
+  }
+  }
+  l1412:;	  goto l1406;
+  l1409:;	  G->pos= yypos1409; G->thunkpos= yythunkpos1409;
+  }
+  {  int yypos1418= G->pos, yythunkpos1418= G->thunkpos;  if (!yy_HorizontalRule(G)) goto l1418;  goto l1406;
+  l1418:;	  G->pos= yypos1418; G->thunkpos= yythunkpos1418;
+  }  if (!yy_OptionallyIndentedLine(G)) goto l1406;
+  yyprintf((stderr, "  ok   %s @ %s\n", "ListBlockLine", G->buf+G->pos));
+  return 1;
+  l1406:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "ListBlockLine", G->buf+G->pos));
+  return 0;
+}
+YY_RULE(int) yy_OrderedList(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;
+  yyprintf((stderr, "%s\n", "OrderedList"));
+  {  int yypos1403= G->pos, yythunkpos1403= G->thunkpos;  if (!yy_Enumerator(G)) goto l1402;  G->pos= yypos1403; G->thunkpos= yythunkpos1403;
+  }
+  {  int yypos1404= G->pos, yythunkpos1404= G->thunkpos;  if (!yy_ListTight(G)) goto l1405;  goto l1404;
+  l1405:;	  G->pos= yypos1404; G->thunkpos= yythunkpos1404;  if (!yy_ListLoose(G)) goto l1402;
+  }
+  l1404:;	  yyDo(G, yy_1_OrderedList, G->begin, G->end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "OrderedList", G->buf+G->pos));
+  return 1;
+  l1402:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "OrderedList", G->buf+G->pos));
+  return 0;
+}
+YY_RULE(int) yy_EnumeratorNoSpace(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;
+  yyprintf((stderr, "%s\n", "EnumeratorNoSpace"));  if (!yy_NonindentSpace(G)) goto l1399;  if (!yymatchClass(G, (unsigned char *)"\000\000\000\000\000\000\377\003\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l1399;
+  l1400:;	
+  {  int yypos1401= G->pos, yythunkpos1401= G->thunkpos;  if (!yymatchClass(G, (unsigned char *)"\000\000\000\000\000\000\377\003\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l1401;  goto l1400;
+  l1401:;	  G->pos= yypos1401; G->thunkpos= yythunkpos1401;
+  }  if (!yymatchChar(G, '.')) goto l1399;
+  yyprintf((stderr, "  ok   %s @ %s\n", "EnumeratorNoSpace", G->buf+G->pos));
+  return 1;
+  l1399:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "EnumeratorNoSpace", G->buf+G->pos));
+  return 0;
+}
+YY_RULE(int) yy_Enumerator(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;
+  yyprintf((stderr, "%s\n", "Enumerator"));  if (!yy_NonindentSpace(G)) goto l1394;  if (!yymatchClass(G, (unsigned char *)"\000\000\000\000\000\000\377\003\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l1394;
+  l1395:;	
+  {  int yypos1396= G->pos, yythunkpos1396= G->thunkpos;  if (!yymatchClass(G, (unsigned char *)"\000\000\000\000\000\000\377\003\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l1396;  goto l1395;
+  l1396:;	  G->pos= yypos1396; G->thunkpos= yythunkpos1396;
+  }  if (!yymatchChar(G, '.')) goto l1394;  if (!yy_Spacechar(G)) goto l1394;
+  l1397:;	
+  {  int yypos1398= G->pos, yythunkpos1398= G->thunkpos;  if (!yy_Spacechar(G)) goto l1398;  goto l1397;
+  l1398:;	  G->pos= yypos1398; G->thunkpos= yythunkpos1398;
+  }
+  yyprintf((stderr, "  ok   %s @ %s\n", "Enumerator", G->buf+G->pos));
+  return 1;
+  l1394:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "Enumerator", G->buf+G->pos));
+  return 0;
+}
+YY_RULE(int) yy_ListContinuationBlock(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyDo(G, yyPush, 1, 0);
+  yyprintf((stderr, "%s\n", "ListContinuationBlock"));  if (!yy_StartList(G)) goto l1387;  yyDo(G, yySet, -1, 0);  yyText(G, G->begin, G->end);  if (!(YY_BEGIN)) goto l1387;
+  l1388:;	
+  {  int yypos1389= G->pos, yythunkpos1389= G->thunkpos;  if (!yy_BlankLine(G)) goto l1389;  goto l1388;
+  l1389:;	  G->pos= yypos1389; G->thunkpos= yythunkpos1389;
+  }  yyText(G, G->begin, G->end);  if (!(YY_END)) goto l1387;  yyDo(G, yy_1_ListContinuationBlock, G->begin, G->end);  if (!yy_Indent(G)) goto l1387;
+  {  int yypos1392= G->pos, yythunkpos1392= G->thunkpos;  if (!yy_BlankLine(G)) goto l1392;  goto l1387;
+  l1392:;	  G->pos= yypos1392; G->thunkpos= yythunkpos1392;
+  }  if (!yy_ListBlock(G)) goto l1387;  yyDo(G, yy_2_ListContinuationBlock, G->begin, G->end);
+  l1390:;	
+  {  int yypos1391= G->pos, yythunkpos1391= G->thunkpos;  if (!yy_Indent(G)) goto l1391;
+  {  int yypos1393= G->pos, yythunkpos1393= G->thunkpos;  if (!yy_BlankLine(G)) goto l1393;  goto l1391;
+  l1393:;	  G->pos= yypos1393; G->thunkpos= yythunkpos1393;
+  }  if (!yy_ListBlock(G)) goto l1391;  yyDo(G, yy_2_ListContinuationBlock, G->begin, G->end);  goto l1390;
+  l1391:;	  G->pos= yypos1391; G->thunkpos= yythunkpos1391;
+  }  yyDo(G, yy_3_ListContinuationBlock, G->begin, G->end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "ListContinuationBlock", G->buf+G->pos));  yyDo(G, yyPop, 1, 0);
+  return 1;
+  l1387:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "ListContinuationBlock", G->buf+G->pos));
+  return 0;
+}
+YY_RULE(int) yy_ListBlock(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyDo(G, yyPush, 1, 0);
+  yyprintf((stderr, "%s\n", "ListBlock"));  if (!yy_StartList(G)) goto l1381;  yyDo(G, yySet, -1, 0);
+  {  int yypos1382= G->pos, yythunkpos1382= G->thunkpos;  if (!yy_EmptyList(G)) goto l1383;  goto l1382;
+  l1383:;	  G->pos= yypos1382; G->thunkpos= yythunkpos1382;
+  {  int yypos1384= G->pos, yythunkpos1384= G->thunkpos;  if (!yy_Heading(G)) goto l1384;  goto l1381;
+  l1384:;	  G->pos= yypos1384; G->thunkpos= yythunkpos1384;
+  }  if (!yy_LineView(G)) goto l1381;
+  }
+  l1382:;	  yyDo(G, yy_1_ListBlock, G->begin, G->end);
+  l1385:;	
+  {  int yypos1386= G->pos, yythunkpos1386= G->thunkpos;  if (!yy_ListBlockLine(G)) goto l1386;  yyDo(G, yy_2_ListBlock, G->begin, G->end);  goto l1385;
+  l1386:;	  G->pos= yypos1386; G->thunkpos= yythunkpos1386;
+  }  yyDo(G, yy_3_ListBlock, G->begin, G->end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "ListBlock", G->buf+G->pos));  yyDo(G, yyPop, 1, 0);
+  return 1;
+  l1381:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "ListBlock", G->buf+G->pos));
+  return 0;
+}
+YY_RULE(int) yy_EmptyList(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;
+  yyprintf((stderr, "%s\n", "EmptyList"));  if (!yy_BlankLine(G)) goto l1380;  yyDo(G, yy_1_EmptyList, G->begin, G->end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "EmptyList", G->buf+G->pos));
+  return 1;
+  l1380:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "EmptyList", G->buf+G->pos));
+  return 0;
+}
+YY_RULE(int) yy_ListItemTight(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyDo(G, yyPush, 1, 0);
+  yyprintf((stderr, "%s\n", "ListItemTight"));
+  {  int yypos1370= G->pos, yythunkpos1370= G->thunkpos;  if (!yy_Bullet(G)) goto l1371;  goto l1370;
+  l1371:;	  G->pos= yypos1370; G->thunkpos= yythunkpos1370;  if (!yy_Enumerator(G)) goto l1372;  goto l1370;
+  l1372:;	  G->pos= yypos1370; G->thunkpos= yythunkpos1370;  if (!yy_BulletNoSpace(G)) goto l1373;
+  {  int yypos1374= G->pos, yythunkpos1374= G->thunkpos;  if (!yy_EmptyList(G)) goto l1373;  G->pos= yypos1374; G->thunkpos= yythunkpos1374;
+  }  goto l1370;
+  l1373:;	  G->pos= yypos1370; G->thunkpos= yythunkpos1370;  if (!yy_EnumeratorNoSpace(G)) goto l1369;
+  {  int yypos1375= G->pos, yythunkpos1375= G->thunkpos;  if (!yy_EmptyList(G)) goto l1369;  G->pos= yypos1375; G->thunkpos= yythunkpos1375;
+  }
+  }
+  l1370:;	  if (!yy_StartList(G)) goto l1369;  yyDo(G, yySet, -1, 0);  if (!yy_ListBlock(G)) goto l1369;  yyDo(G, yy_1_ListItemTight, G->begin, G->end);
+  l1376:;	
+  {  int yypos1377= G->pos, yythunkpos1377= G->thunkpos;
+  {  int yypos1378= G->pos, yythunkpos1378= G->thunkpos;  if (!yy_BlankLine(G)) goto l1378;  goto l1377;
+  l1378:;	  G->pos= yypos1378; G->thunkpos= yythunkpos1378;
+  }  if (!yy_ListContinuationBlock(G)) goto l1377;  yyDo(G, yy_2_ListItemTight, G->begin, G->end);  goto l1376;
+  l1377:;	  G->pos= yypos1377; G->thunkpos= yythunkpos1377;
+  }
+  {  int yypos1379= G->pos, yythunkpos1379= G->thunkpos;  if (!yy_ListContinuationBlock(G)) goto l1379;  goto l1369;
+  l1379:;	  G->pos= yypos1379; G->thunkpos= yythunkpos1379;
+  }  yyDo(G, yy_3_ListItemTight, G->begin, G->end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "ListItemTight", G->buf+G->pos));  yyDo(G, yyPop, 1, 0);
+  return 1;
+  l1369:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "ListItemTight", G->buf+G->pos));
+  return 0;
+}
+YY_RULE(int) yy_ListItem(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyDo(G, yyPush, 1, 0);
+  yyprintf((stderr, "%s\n", "ListItem"));  yyText(G, G->begin, G->end);  if (!(YY_BEGIN)) goto l1360;
+  {  int yypos1361= G->pos, yythunkpos1361= G->thunkpos;  if (!yy_Bullet(G)) goto l1362;  goto l1361;
+  l1362:;	  G->pos= yypos1361; G->thunkpos= yythunkpos1361;  if (!yy_Enumerator(G)) goto l1363;  goto l1361;
+  l1363:;	  G->pos= yypos1361; G->thunkpos= yythunkpos1361;  if (!yy_BulletNoSpace(G)) goto l1364;
+  {  int yypos1365= G->pos, yythunkpos1365= G->thunkpos;  if (!yy_EmptyList(G)) goto l1364;  G->pos= yypos1365; G->thunkpos= yythunkpos1365;
+  }  goto l1361;
+  l1364:;	  G->pos= yypos1361; G->thunkpos= yythunkpos1361;  if (!yy_EnumeratorNoSpace(G)) goto l1360;
+  {  int yypos1366= G->pos, yythunkpos1366= G->thunkpos;  if (!yy_EmptyList(G)) goto l1360;  G->pos= yypos1366; G->thunkpos= yythunkpos1366;
+  }
+  }
+  l1361:;	  yyText(G, G->begin, G->end);  if (!(YY_END)) goto l1360;  if (!yy_StartList(G)) goto l1360;  yyDo(G, yySet, -1, 0);  if (!yy_ListBlock(G)) goto l1360;  yyDo(G, yy_1_ListItem, G->begin, G->end);
+  l1367:;	
+  {  int yypos1368= G->pos, yythunkpos1368= G->thunkpos;  if (!yy_ListContinuationBlock(G)) goto l1368;  yyDo(G, yy_2_ListItem, G->begin, G->end);  goto l1367;
+  l1368:;	  G->pos= yypos1368; G->thunkpos= yythunkpos1368;
+  }  yyDo(G, yy_3_ListItem, G->begin, G->end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "ListItem", G->buf+G->pos));  yyDo(G, yyPop, 1, 0);
+  return 1;
+  l1360:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "ListItem", G->buf+G->pos));
+  return 0;
+}
+YY_RULE(int) yy_ListLoose(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyDo(G, yyPush, 2, 0);
+  yyprintf((stderr, "%s\n", "ListLoose"));  if (!yy_StartList(G)) goto l1353;  yyDo(G, yySet, -1, 0);  if (!yy_ListItem(G)) goto l1353;  yyDo(G, yySet, -2, 0);
+  l1356:;	
+  {  int yypos1357= G->pos, yythunkpos1357= G->thunkpos;  if (!yy_BlankLine(G)) goto l1357;  goto l1356;
+  l1357:;	  G->pos= yypos1357; G->thunkpos= yythunkpos1357;
+  }  yyDo(G, yy_1_ListLoose, G->begin, G->end);
+  l1354:;	
+  {  int yypos1355= G->pos, yythunkpos1355= G->thunkpos;  if (!yy_ListItem(G)) goto l1355;  yyDo(G, yySet, -2, 0);
+  l1358:;	
+  {  int yypos1359= G->pos, yythunkpos1359= G->thunkpos;  if (!yy_BlankLine(G)) goto l1359;  goto l1358;
+  l1359:;	  G->pos= yypos1359; G->thunkpos= yythunkpos1359;
+  }  yyDo(G, yy_1_ListLoose, G->begin, G->end);  goto l1354;
+  l1355:;	  G->pos= yypos1355; G->thunkpos= yythunkpos1355;
+  }  yyDo(G, yy_2_ListLoose, G->begin, G->end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "ListLoose", G->buf+G->pos));  yyDo(G, yyPop, 2, 0);
+  return 1;
+  l1353:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "ListLoose", G->buf+G->pos));
+  return 0;
+}
+YY_RULE(int) yy_ListTight(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyDo(G, yyPush, 1, 0);
+  yyprintf((stderr, "%s\n", "ListTight"));  if (!yy_StartList(G)) goto l1341;  yyDo(G, yySet, -1, 0);  if (!yy_ListItemTight(G)) goto l1341;  yyDo(G, yy_1_ListTight, G->begin, G->end);
+  l1342:;	
+  {  int yypos1343= G->pos, yythunkpos1343= G->thunkpos;  if (!yy_ListItemTight(G)) goto l1343;  yyDo(G, yy_1_ListTight, G->begin, G->end);  goto l1342;
+  l1343:;	  G->pos= yypos1343; G->thunkpos= yythunkpos1343;
+  }
+  l1344:;	
+  {  int yypos1345= G->pos, yythunkpos1345= G->thunkpos;  if (!yy_BlankLine(G)) goto l1345;  goto l1344;
+  l1345:;	  G->pos= yypos1345; G->thunkpos= yythunkpos1345;
+  }
+  {  int yypos1346= G->pos, yythunkpos1346= G->thunkpos;
+  {  int yypos1347= G->pos, yythunkpos1347= G->thunkpos;  if (!yy_Bullet(G)) goto l1348;  goto l1347;
+  l1348:;	  G->pos= yypos1347; G->thunkpos= yythunkpos1347;  if (!yy_Enumerator(G)) goto l1349;  goto l1347;
+  l1349:;	  G->pos= yypos1347; G->thunkpos= yythunkpos1347;  if (!yy_BulletNoSpace(G)) goto l1350;
+  {  int yypos1351= G->pos, yythunkpos1351= G->thunkpos;  if (!yy_EmptyList(G)) goto l1350;  G->pos= yypos1351; G->thunkpos= yythunkpos1351;
+  }  goto l1347;
+  l1350:;	  G->pos= yypos1347; G->thunkpos= yythunkpos1347;  if (!yy_EnumeratorNoSpace(G)) goto l1346;
+  {  int yypos1352= G->pos, yythunkpos1352= G->thunkpos;  if (!yy_EmptyList(G)) goto l1346;  G->pos= yypos1352; G->thunkpos= yythunkpos1352;
+  }
+  }
+  l1347:;	  goto l1341;
+  l1346:;	  G->pos= yypos1346; G->thunkpos= yythunkpos1346;
+  }  yyDo(G, yy_2_ListTight, G->begin, G->end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "ListTight", G->buf+G->pos));  yyDo(G, yyPop, 1, 0);
+  return 1;
+  l1341:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "ListTight", G->buf+G->pos));
+  return 0;
+}
+YY_RULE(int) yy_BulletList(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;
+  yyprintf((stderr, "%s\n", "BulletList"));
+  {  int yypos1338= G->pos, yythunkpos1338= G->thunkpos;  if (!yy_Bullet(G)) goto l1337;  G->pos= yypos1338; G->thunkpos= yythunkpos1338;
+  }
+  {  int yypos1339= G->pos, yythunkpos1339= G->thunkpos;  if (!yy_ListTight(G)) goto l1340;  goto l1339;
+  l1340:;	  G->pos= yypos1339; G->thunkpos= yythunkpos1339;  if (!yy_ListLoose(G)) goto l1337;
+  }
+  l1339:;	  yyDo(G, yy_1_BulletList, G->begin, G->end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "BulletList", G->buf+G->pos));
+  return 1;
+  l1337:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "BulletList", G->buf+G->pos));
+  return 0;
+}
+YY_RULE(int) yy_BulletNoSpace(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;
+  yyprintf((stderr, "%s\n", "BulletNoSpace"));
+  {  int yypos1333= G->pos, yythunkpos1333= G->thunkpos;  if (!yy_HorizontalRule(G)) goto l1333;  goto l1332;
+  l1333:;	  G->pos= yypos1333; G->thunkpos= yythunkpos1333;
+  }  if (!yy_NonindentSpace(G)) goto l1332;
+  {  int yypos1334= G->pos, yythunkpos1334= G->thunkpos;  if (!yymatchChar(G, '+')) goto l1335;  goto l1334;
+  l1335:;	  G->pos= yypos1334; G->thunkpos= yythunkpos1334;  if (!yymatchChar(G, '*')) goto l1336;  goto l1334;
+  l1336:;	  G->pos= yypos1334; G->thunkpos= yythunkpos1334;  if (!yymatchChar(G, '-')) goto l1332;
+  }
+  l1334:;	
+  yyprintf((stderr, "  ok   %s @ %s\n", "BulletNoSpace", G->buf+G->pos));
+  return 1;
+  l1332:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "BulletNoSpace", G->buf+G->pos));
+  return 0;
+}
+YY_RULE(int) yy_Bullet(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;
+  yyprintf((stderr, "%s\n", "Bullet"));
+  {  int yypos1326= G->pos, yythunkpos1326= G->thunkpos;  if (!yy_HorizontalRule(G)) goto l1326;  goto l1325;
+  l1326:;	  G->pos= yypos1326; G->thunkpos= yythunkpos1326;
+  }  if (!yy_NonindentSpace(G)) goto l1325;
+  {  int yypos1327= G->pos, yythunkpos1327= G->thunkpos;  if (!yymatchChar(G, '+')) goto l1328;  goto l1327;
+  l1328:;	  G->pos= yypos1327; G->thunkpos= yythunkpos1327;  if (!yymatchChar(G, '*')) goto l1329;  goto l1327;
+  l1329:;	  G->pos= yypos1327; G->thunkpos= yythunkpos1327;  if (!yymatchChar(G, '-')) goto l1325;
+  }
+  l1327:;	  if (!yy_Spacechar(G)) goto l1325;
+  l1330:;	
+  {  int yypos1331= G->pos, yythunkpos1331= G->thunkpos;  if (!yy_Spacechar(G)) goto l1331;  goto l1330;
+  l1331:;	  G->pos= yypos1331; G->thunkpos= yythunkpos1331;
+  }
+  yyprintf((stderr, "  ok   %s @ %s\n", "Bullet", G->buf+G->pos));
+  return 1;
+  l1325:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "Bullet", G->buf+G->pos));
+  return 0;
+}
+YY_RULE(int) yy_Definition(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyDo(G, yyPush, 2, 0);
+  yyprintf((stderr, "%s\n", "Definition"));  if (!yy_StartList(G)) goto l1314;  yyDo(G, yySet, -1, 0);  if (!yy_StartList(G)) goto l1314;  yyDo(G, yySet, -2, 0);
+  {  int yypos1315= G->pos, yythunkpos1315= G->thunkpos;  if (!yy_BlankLine(G)) goto l1315;  yyDo(G, yy_1_Definition, G->begin, G->end);  goto l1316;
+  l1315:;	  G->pos= yypos1315; G->thunkpos= yythunkpos1315;
+  }
+  l1316:;	  if (!yy_NonindentSpace(G)) goto l1314;  if (!yymatchChar(G, ':')) goto l1314;  if (!yy_Sp(G)) goto l1314;  if (!yy_LineView(G)) goto l1314;  yyDo(G, yy_2_Definition, G->begin, G->end);
+  l1317:;	
+  {  int yypos1318= G->pos, yythunkpos1318= G->thunkpos;
+  {  int yypos1319= G->pos, yythunkpos1319= G->thunkpos;  if (!yymatchChar(G, ':')) goto l1319;  goto l1318;
+  l1319:;	  G->pos= yypos1319; G->thunkpos= yythunkpos1319;
+  }
+  {  int yypos1320= G->pos, yythunkpos1320= G->thunkpos;  if (!yy_BlankLine(G)) goto l1320;  goto l1318;
+  l1320:;	  G->pos= yypos1320; G->thunkpos= yythunkpos1320;
+  }  if (!yy_LineView(G)) goto l1318;  yyDo(G, yy_3_Definition, G->begin, G->end);  goto l1317;
+  l1318:;	  G->pos= yypos1318; G->thunkpos= yythunkpos1318;
+  }
+  l1321:;	
+  {  int yypos1322= G->pos, yythunkpos1322= G->thunkpos;  if (!yy_BlankLine(G)) goto l1322;  yyDo(G, yy_4_Definition, G->begin, G->end);  if (!yy_Indent(G)) goto l1322;  if (!yy_LineView(G)) goto l1322;  yyDo(G, yy_5_Definition, G->begin, G->end);
+  l1323:;	
+  {  int yypos1324= G->pos, yythunkpos1324= G->thunkpos;  if (!yy_Indent(G)) goto l1324;  if (!yy_LineView(G)) goto l1324;  yyDo(G, yy_5_Definition, G->begin, G->end);  goto l1323;
+  l1324:;	  G->pos= yypos1324; G->thunkpos= yythunkpos1324;
+  }  yyDo(G, yy_6_Definition, G->begin, G->end);  goto l1321;
+  l1322:;	  G->pos= yypos1322; G->thunkpos= yythunkpos1322;
+  }  yyDo(G, yy_7_Definition, G->begin, G->end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "Definition", G->buf+G->pos));  yyDo(G, yyPop, 2, 0);
+  return 1;
+  l1314:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "Definition", G->buf+G->pos));
+  return 0;
+}
+YY_RULE(int) yy_Term(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyDo(G, yyPush, 1, 0);
+  yyprintf((stderr, "%s\n", "Term"));  if (!yy_StartList(G)) goto l1305;  yyDo(G, yySet, -1, 0);
+  {  int yypos1306= G->pos, yythunkpos1306= G->thunkpos;  if (!yy_BlankLine(G)) goto l1306;  goto l1305;
+  l1306:;	  G->pos= yypos1306; G->thunkpos= yythunkpos1306;
+  }
+  {  int yypos1307= G->pos, yythunkpos1307= G->thunkpos;  if (!yymatchChar(G, ':')) goto l1307;  goto l1305;
+  l1307:;	  G->pos= yypos1307; G->thunkpos= yythunkpos1307;
+  }
+  {  int yypos1310= G->pos, yythunkpos1310= G->thunkpos;  if (!yy_Newline(G)) goto l1310;  goto l1305;
+  l1310:;	  G->pos= yypos1310; G->thunkpos= yythunkpos1310;
+  }
+  {  int yypos1311= G->pos, yythunkpos1311= G->thunkpos;  if (!yy_Endline(G)) goto l1311;  goto l1305;
+  l1311:;	  G->pos= yypos1311; G->thunkpos= yythunkpos1311;
+  }  if (!yy_Inline(G)) goto l1305;  yyDo(G, yy_1_Term, G->begin, G->end);
+  l1308:;	
+  {  int yypos1309= G->pos, yythunkpos1309= G->thunkpos;
+  {  int yypos1312= G->pos, yythunkpos1312= G->thunkpos;  if (!yy_Newline(G)) goto l1312;  goto l1309;
+  l1312:;	  G->pos= yypos1312; G->thunkpos= yythunkpos1312;
+  }
+  {  int yypos1313= G->pos, yythunkpos1313= G->thunkpos;  if (!yy_Endline(G)) goto l1313;  goto l1309;
+  l1313:;	  G->pos= yypos1313; G->thunkpos= yythunkpos1313;
+  }  if (!yy_Inline(G)) goto l1309;  yyDo(G, yy_1_Term, G->begin, G->end);  goto l1308;
+  l1309:;	  G->pos= yypos1309; G->thunkpos= yythunkpos1309;
+  }  if (!yy_Sp(G)) goto l1305;  if (!yy_Newline(G)) goto l1305;  yyDo(G, yy_2_Term, G->begin, G->end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "Term", G->buf+G->pos));  yyDo(G, yyPop, 1, 0);
+  return 1;
+  l1305:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "Term", G->buf+G->pos));
+  return 0;
+}
+YY_RULE(int) yy_TermLine(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;
+  yyprintf((stderr, "%s\n", "TermLine"));
+  {  int yypos1300= G->pos, yythunkpos1300= G->thunkpos;  if (!yymatchChar(G, ':')) goto l1300;  goto l1299;
+  l1300:;	  G->pos= yypos1300; G->thunkpos= yythunkpos1300;
+  }
+  {  int yypos1301= G->pos, yythunkpos1301= G->thunkpos;  if (!yy_BlankLine(G)) goto l1301;  goto l1299;
+  l1301:;	  G->pos= yypos1301; G->thunkpos= yythunkpos1301;
+  }
+  l1302:;	
+  {  int yypos1303= G->pos, yythunkpos1303= G->thunkpos;
+  {  int yypos1304= G->pos, yythunkpos1304= G->thunkpos;  if (!yy_Newline(G)) goto l1304;  goto l1303;
+  l1304:;	  G->pos= yypos1304; G->thunkpos= yythunkpos1304;
+  }  if (!yymatchDot(G)) goto l1303;  goto l1302;
+  l1303:;	  G->pos= yypos1303; G->thunkpos= yythunkpos1303;
+  }  if (!yy_Newline(G)) goto l1299;
+  yyprintf((stderr, "  ok   %s @ %s\n", "TermLine", G->buf+G->pos));
+  return 1;
+  l1299:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "TermLine", G->buf+G->pos));
+  return 0;
+}
+YY_RULE(int) yy_DefinitionList(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyDo(G, yyPush, 1, 0);
+  yyprintf((stderr, "%s\n", "DefinitionList"));  if (!yy_StartList(G)) goto l1275;  yyDo(G, yySet, -1, 0);
+  {  int yypos1276= G->pos, yythunkpos1276= G->thunkpos;  if (!yy_TermLine(G)) goto l1275;
+  l1277:;	
+  {  int yypos1278= G->pos, yythunkpos1278= G->thunkpos;  if (!yy_TermLine(G)) goto l1278;  goto l1277;
+  l1278:;	  G->pos= yypos1278; G->thunkpos= yythunkpos1278;
+  }
+  {  int yypos1279= G->pos, yythunkpos1279= G->thunkpos;  if (!yy_Newline(G)) goto l1279;  goto l1280;
+  l1279:;	  G->pos= yypos1279; G->thunkpos= yythunkpos1279;
+  }
+  l1280:;	  if (!yy_NonindentSpace(G)) goto l1275;  if (!yymatchChar(G, ':')) goto l1275;  G->pos= yypos1276; G->thunkpos= yythunkpos1276;
+  }  if (!yy_Term(G)) goto l1275;  yyDo(G, yy_1_DefinitionList, G->begin, G->end);
+  l1283:;	
+  {  int yypos1284= G->pos, yythunkpos1284= G->thunkpos;  if (!yy_Term(G)) goto l1284;  yyDo(G, yy_1_DefinitionList, G->begin, G->end);  goto l1283;
+  l1284:;	  G->pos= yypos1284; G->thunkpos= yythunkpos1284;
+  }
+  {  int yypos1285= G->pos, yythunkpos1285= G->thunkpos;  if (!yy_BlankLine(G)) goto l1285;  goto l1286;
+  l1285:;	  G->pos= yypos1285; G->thunkpos= yythunkpos1285;
+  }
+  l1286:;	  if (!yy_Definition(G)) goto l1275;  yyDo(G, yy_2_DefinitionList, G->begin, G->end);
+  l1287:;	
+  {  int yypos1288= G->pos, yythunkpos1288= G->thunkpos;  if (!yy_Definition(G)) goto l1288;  yyDo(G, yy_2_DefinitionList, G->begin, G->end);  goto l1287;
+  l1288:;	  G->pos= yypos1288; G->thunkpos= yythunkpos1288;
+  }
+  l1289:;	
+  {  int yypos1290= G->pos, yythunkpos1290= G->thunkpos;  if (!yy_BlankLine(G)) goto l1290;  goto l1289;
+  l1290:;	  G->pos= yypos1290; G->thunkpos= yythunkpos1290;
+  }
+  l1281:;	
+  {  int yypos1282= G->pos, yythunkpos1282= G->thunkpos;  if (!yy_Term(G)) goto l1282;  yyDo(G, yy_1_DefinitionList, G->begin, G->end);
+  l1291:;	
+  {  int yypos1292= G->pos, yythunkpos1292= G->thunkpos;  if (!yy_Term(G)) goto l1292;  yyDo(G, yy_1_DefinitionList, G->begin, G->end);  goto l1291;
+  l1292:;	  G->pos= yypos1292; G->thunkpos= yythunkpos1292;
+  }
+  {  int yypos1293= G->pos, yythunkpos1293= G->thunkpos;  if (!yy_BlankLine(G)) goto l1293;  goto l1294;
+  l1293:;	  G->pos= yypos1293; G->thunkpos= yythunkpos1293;
+  }
+  l1294:;	  if (!yy_Definition(G)) goto l1282;  yyDo(G, yy_2_DefinitionList, G->begin, G->end);
+  l1295:;	
+  {  int yypos1296= G->pos, yythunkpos1296= G->thunkpos;  if (!yy_Definition(G)) goto l1296;  yyDo(G, yy_2_DefinitionList, G->begin, G->end);  goto l1295;
+  l1296:;	  G->pos= yypos1296; G->thunkpos= yythunkpos1296;
+  }
+  l1297:;	
+  {  int yypos1298= G->pos, yythunkpos1298= G->thunkpos;  if (!yy_BlankLine(G)) goto l1298;  goto l1297;
+  l1298:;	  G->pos= yypos1298; G->thunkpos= yythunkpos1298;
+  }  goto l1281;
+  l1282:;	  G->pos= yypos1282; G->thunkpos= yythunkpos1282;
+  }  yyDo(G, yy_3_DefinitionList, G->begin, G->end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "DefinitionList", G->buf+G->pos));  yyDo(G, yyPop, 1, 0);
+  return 1;
+  l1275:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "DefinitionList", G->buf+G->pos));
+  return 0;
+}
+YY_RULE(int) yy_HorizontalRule(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;
+  yyprintf((stderr, "%s\n", "HorizontalRule"));  if (!yy_NonindentSpace(G)) goto l1263;
+  {  int yypos1264= G->pos, yythunkpos1264= G->thunkpos;  if (!yymatchChar(G, '*')) goto l1265;  if (!yy_Sp(G)) goto l1265;  if (!yymatchChar(G, '*')) goto l1265;  if (!yy_Sp(G)) goto l1265;  if (!yymatchChar(G, '*')) goto l1265;
+  l1266:;	
+  {  int yypos1267= G->pos, yythunkpos1267= G->thunkpos;  if (!yy_Sp(G)) goto l1267;  if (!yymatchChar(G, '*')) goto l1267;  goto l1266;
+  l1267:;	  G->pos= yypos1267; G->thunkpos= yythunkpos1267;
+  }  goto l1264;
+  l1265:;	  G->pos= yypos1264; G->thunkpos= yythunkpos1264;  if (!yymatchChar(G, '-')) goto l1268;  if (!yy_Sp(G)) goto l1268;  if (!yymatchChar(G, '-')) goto l1268;  if (!yy_Sp(G)) goto l1268;  if (!yymatchChar(G, '-')) goto l1268;
+  l1269:;	
+  {  int yypos1270= G->pos, yythunkpos1270= G->thunkpos;  if (!yy_Sp(G)) goto l1270;  if (!yymatchChar(G, '-')) goto l1270;  goto l1269;
+  l1270:;	  G->pos= yypos1270; G->thunkpos= yythunkpos1270;
+  }  goto l1264;
+  l1268:;	  G->pos= yypos1264; G->thunkpos= yythunkpos1264;  if (!yymatchChar(G, '_')) goto l1263;  if (!yy_Sp(G)) goto l1263;  if (!yymatchChar(G, '_')) goto l1263;  if (!yy_Sp(G)) goto l1263;  if (!yymatchChar(G, '_')) goto l1263;
+  l1271:;	
+  {  int yypos1272= G->pos, yythunkpos1272= G->thunkpos;  if (!yy_Sp(G)) goto l1272;  if (!yymatchChar(G, '_')) goto l1272;  goto l1271;
+  l1272:;	  G->pos= yypos1272; G->thunkpos= yythunkpos1272;
+  }
+  }
+  l1264:;	  if (!yy_Sp(G)) goto l1263;  if (!yy_Newline(G)) goto l1263;
+  l1273:;	
+  {  int yypos1274= G->pos, yythunkpos1274= G->thunkpos;  if (!yy_BlankLine(G)) goto l1274;  goto l1273;
+  l1274:;	  G->pos= yypos1274; G->thunkpos= yythunkpos1274;
+  }  yyDo(G, yy_1_HorizontalRule, G->begin, G->end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "HorizontalRule", G->buf+G->pos));
+  return 1;
+  l1263:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "HorizontalRule", G->buf+G->pos));
+  return 0;
+}
+YY_RULE(int) yy_Verbatim(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyDo(G, yyPush, 1, 0);
+  yyprintf((stderr, "%s\n", "Verbatim"));
+  l1257:;	
+  {  int yypos1258= G->pos, yythunkpos1258= G->thunkpos;  if (!yy_BlankLine(G)) goto l1258;  goto l1257;
+  l1258:;	  G->pos= yypos1258; G->thunkpos= yythunkpos1258;
+  }  if (!yy_StartList(G)) goto l1256;  yyDo(G, yySet, -1, 0);  if (!yy_VerbatimChunk(G)) goto l1256;  yyDo(G, yy_1_Verbatim, G->begin, G->end);
+  l1259:;	
+  {  int yypos1260= G->pos, yythunkpos1260= G->thunkpos;  if (!yy_VerbatimChunk(G)) goto l1260;  yyDo(G, yy_1_Verbatim, G->begin, G->end);  goto l1259;
+  l1260:;	  G->pos= yypos1260; G->thunkpos= yythunkpos1260;
+  }
+  l1261:;	
+  {  int yypos1262= G->pos, yythunkpos1262= G->thunkpos;  if (!yy_BlankLine(G)) goto l1262;  goto l1261;
+  l1262:;	  G->pos= yypos1262; G->thunkpos= yythunkpos1262;
+  }  yyDo(G, yy_2_Verbatim, G->begin, G->end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "Verbatim", G->buf+G->pos));  yyDo(G, yyPop, 1, 0);
+  return 1;
+  l1256:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "Verbatim", G->buf+G->pos));
+  return 0;
+}
+YY_RULE(int) yy_VerbatimChunk(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyDo(G, yyPush, 1, 0);
+  yyprintf((stderr, "%s\n", "VerbatimChunk"));  if (!yy_StartList(G)) goto l1251;  yyDo(G, yySet, -1, 0);
+  l1252:;	
+  {  int yypos1253= G->pos, yythunkpos1253= G->thunkpos;  if (!yy_BlankLine(G)) goto l1253;  yyDo(G, yy_1_VerbatimChunk, G->begin, G->end);  goto l1252;
+  l1253:;	  G->pos= yypos1253; G->thunkpos= yythunkpos1253;
+  }  if (!yy_NonblankIndentedLine(G)) goto l1251;  yyDo(G, yy_2_VerbatimChunk, G->begin, G->end);
+  l1254:;	
+  {  int yypos1255= G->pos, yythunkpos1255= G->thunkpos;  if (!yy_NonblankIndentedLine(G)) goto l1255;  yyDo(G, yy_2_VerbatimChunk, G->begin, G->end);  goto l1254;
+  l1255:;	  G->pos= yypos1255; G->thunkpos= yythunkpos1255;
+  }  yyDo(G, yy_3_VerbatimChunk, G->begin, G->end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "VerbatimChunk", G->buf+G->pos));  yyDo(G, yyPop, 1, 0);
+  return 1;
+  l1251:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "VerbatimChunk", G->buf+G->pos));
+  return 0;
+}
+YY_RULE(int) yy_NonblankIndentedLine(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;
+  yyprintf((stderr, "%s\n", "NonblankIndentedLine"));
+  {  int yypos1250= G->pos, yythunkpos1250= G->thunkpos;  if (!yy_BlankLine(G)) goto l1250;  goto l1249;
+  l1250:;	  G->pos= yypos1250; G->thunkpos= yythunkpos1250;
+  }  if (!yy_IndentedLine(G)) goto l1249;
+  yyprintf((stderr, "  ok   %s @ %s\n", "NonblankIndentedLine", G->buf+G->pos));
+  return 1;
+  l1249:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "NonblankIndentedLine", G->buf+G->pos));
+  return 0;
+}
+YY_RULE(int) yy_BackTickQuoted(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyDo(G, yyPush, 2, 0);
+  yyprintf((stderr, "%s\n", "BackTickQuoted"));  if (!yy_BackTickStart(G)) goto l1244;  if (!yy_StartList(G)) goto l1244;  yyDo(G, yySet, -1, 0);
+  l1245:;	
+  {  int yypos1246= G->pos, yythunkpos1246= G->thunkpos;
+  {  int yypos1247= G->pos, yythunkpos1247= G->thunkpos;  if (!yy_DoubleQuoteEnd(G)) goto l1247;  goto l1246;
+  l1247:;	  G->pos= yypos1247; G->thunkpos= yythunkpos1247;
+  }
+  {  int yypos1248= G->pos, yythunkpos1248= G->thunkpos;  if (!yy_BackTickEnd(G)) goto l1248;  goto l1246;
+  l1248:;	  G->pos= yypos1248; G->thunkpos= yythunkpos1248;
+  }  if (!yy_Inline(G)) goto l1246;  yyDo(G, yySet, -2, 0);  yyDo(G, yy_1_BackTickQuoted, G->begin, G->end);  goto l1245;
+  l1246:;	  G->pos= yypos1246; G->thunkpos= yythunkpos1246;
+  }  if (!yy_BackTickEnd(G)) goto l1244;  yyDo(G, yy_2_BackTickQuoted, G->begin, G->end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "BackTickQuoted", G->buf+G->pos));  yyDo(G, yyPop, 2, 0);
+  return 1;
+  l1244:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "BackTickQuoted", G->buf+G->pos));
+  return 0;
+}
+YY_RULE(int) yy_BackTickEnd(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;
+  yyprintf((stderr, "%s\n", "BackTickEnd"));  if (!yymatchString(G, "''")) goto l1243;
+  yyprintf((stderr, "  ok   %s @ %s\n", "BackTickEnd", G->buf+G->pos));
+  return 1;
+  l1243:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "BackTickEnd", G->buf+G->pos));
+  return 0;
+}
+YY_RULE(int) yy_BackTickStart(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;
+  yyprintf((stderr, "%s\n", "BackTickStart"));  if (!yymatchString(G, "``")) goto l1242;
+  yyprintf((stderr, "  ok   %s @ %s\n", "BackTickStart", G->buf+G->pos));
+  return 1;
+  l1242:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "BackTickStart", G->buf+G->pos));
+  return 0;
+}
+YY_RULE(int) yy_DoubleQuoted(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyDo(G, yyPush, 2, 0);
+  yyprintf((stderr, "%s\n", "DoubleQuoted"));  if (!yy_DoubleQuoteStart(G)) goto l1236;  if (!yy_StartList(G)) goto l1236;  yyDo(G, yySet, -1, 0);
+  l1237:;	
+  {  int yypos1238= G->pos, yythunkpos1238= G->thunkpos;
+  {  int yypos1239= G->pos, yythunkpos1239= G->thunkpos;  if (!yy_DoubleQuoteEnd(G)) goto l1239;  goto l1238;
+  l1239:;	  G->pos= yypos1239; G->thunkpos= yythunkpos1239;
+  }
+  {  int yypos1240= G->pos, yythunkpos1240= G->thunkpos;  if (!yy_BackTickEnd(G)) goto l1240;  goto l1238;
+  l1240:;	  G->pos= yypos1240; G->thunkpos= yythunkpos1240;
+  }
+  {  int yypos1241= G->pos, yythunkpos1241= G->thunkpos;  if (!yy_BackTickStart(G)) goto l1241;  goto l1238;
+  l1241:;	  G->pos= yypos1241; G->thunkpos= yythunkpos1241;
+  }  if (!yy_Inline(G)) goto l1238;  yyDo(G, yySet, -2, 0);  yyDo(G, yy_1_DoubleQuoted, G->begin, G->end);  goto l1237;
+  l1238:;	  G->pos= yypos1238; G->thunkpos= yythunkpos1238;
+  }  if (!yy_DoubleQuoteEnd(G)) goto l1236;  yyDo(G, yy_2_DoubleQuoted, G->begin, G->end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "DoubleQuoted", G->buf+G->pos));  yyDo(G, yyPop, 2, 0);
+  return 1;
+  l1236:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "DoubleQuoted", G->buf+G->pos));
+  return 0;
+}
+YY_RULE(int) yy_DoubleQuoteEnd(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;
+  yyprintf((stderr, "%s\n", "DoubleQuoteEnd"));  if (!yymatchChar(G, '"')) goto l1235;
+  yyprintf((stderr, "  ok   %s @ %s\n", "DoubleQuoteEnd", G->buf+G->pos));
+  return 1;
+  l1235:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "DoubleQuoteEnd", G->buf+G->pos));
+  return 0;
+}
+YY_RULE(int) yy_DoubleQuoteStart(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;
+  yyprintf((stderr, "%s\n", "DoubleQuoteStart"));  if (!yymatchChar(G, '"')) goto l1234;
+  yyprintf((stderr, "  ok   %s @ %s\n", "DoubleQuoteStart", G->buf+G->pos));
+  return 1;
+  l1234:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "DoubleQuoteStart", G->buf+G->pos));
+  return 0;
+}
+YY_RULE(int) yy_SingleQuoted(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyDo(G, yyPush, 2, 0);
+  yyprintf((stderr, "%s\n", "SingleQuoted"));  if (!yy_SingleQuoteStart(G)) goto l1230;  if (!yy_StartList(G)) goto l1230;  yyDo(G, yySet, -1, 0);
+  l1231:;	
+  {  int yypos1232= G->pos, yythunkpos1232= G->thunkpos;
+  {  int yypos1233= G->pos, yythunkpos1233= G->thunkpos;  if (!yy_SingleQuoteEnd(G)) goto l1233;  goto l1232;
+  l1233:;	  G->pos= yypos1233; G->thunkpos= yythunkpos1233;
+  }  if (!yy_Inline(G)) goto l1232;  yyDo(G, yySet, -2, 0);  yyDo(G, yy_1_SingleQuoted, G->begin, G->end);  goto l1231;
+  l1232:;	  G->pos= yypos1232; G->thunkpos= yythunkpos1232;
+  }  if (!yy_SingleQuoteEnd(G)) goto l1230;  yyDo(G, yy_2_SingleQuoted, G->begin, G->end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "SingleQuoted", G->buf+G->pos));  yyDo(G, yyPop, 2, 0);
+  return 1;
+  l1230:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "SingleQuoted", G->buf+G->pos));
+  return 0;
+}
+YY_RULE(int) yy_SingleQuoteEnd(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;
+  yyprintf((stderr, "%s\n", "SingleQuoteEnd"));  if (!yymatchChar(G, '\'')) goto l1228;
+  {  int yypos1229= G->pos, yythunkpos1229= G->thunkpos;  if (!yy_Alphanumeric(G)) goto l1229;  goto l1228;
+  l1229:;	  G->pos= yypos1229; G->thunkpos= yythunkpos1229;
+  }
+  yyprintf((stderr, "  ok   %s @ %s\n", "SingleQuoteEnd", G->buf+G->pos));
+  return 1;
+  l1228:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "SingleQuoteEnd", G->buf+G->pos));
+  return 0;
+}
+YY_RULE(int) yy_SingleQuoteStart(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;
+  yyprintf((stderr, "%s\n", "SingleQuoteStart"));  if (!yymatchChar(G, '\'')) goto l1224;
+  {  int yypos1225= G->pos, yythunkpos1225= G->thunkpos;
+  {  int yypos1226= G->pos, yythunkpos1226= G->thunkpos;  if (!yy_Spacechar(G)) goto l1227;  goto l1226;
+  l1227:;	  G->pos= yypos1226; G->thunkpos= yythunkpos1226;  if (!yy_Newline(G)) goto l1225;
+  }
+  l1226:;	  goto l1224;
+  l1225:;	  G->pos= yypos1225; G->thunkpos= yythunkpos1225;
+  }
+  yyprintf((stderr, "  ok   %s @ %s\n", "SingleQuoteStart", G->buf+G->pos));
+  return 1;
+  l1224:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "SingleQuoteStart", G->buf+G->pos));
+  return 0;
+}
+YY_RULE(int) yy_EmDash(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;
+  yyprintf((stderr, "%s\n", "EmDash"));  yyText(G, G->begin, G->end);  if (!(YY_BEGIN)) goto l1223;  if (!yymatchString(G, "---")) goto l1223;  yyText(G, G->begin, G->end);  if (!(YY_END)) goto l1223;  yyDo(G, yy_1_EmDash, G->begin, G->end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "EmDash", G->buf+G->pos));
+  return 1;
+  l1223:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "EmDash", G->buf+G->pos));
+  return 0;
+}
+YY_RULE(int) yy_EnDash(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;
+  yyprintf((stderr, "%s\n", "EnDash"));  yyText(G, G->begin, G->end);  if (!(YY_BEGIN)) goto l1219;
+  {  int yypos1220= G->pos, yythunkpos1220= G->thunkpos;  if (!yymatchString(G, "--")) goto l1221;  goto l1220;
+  l1221:;	  G->pos= yypos1220; G->thunkpos= yythunkpos1220;  if (!yymatchChar(G, '-')) goto l1219;
+  {  int yypos1222= G->pos, yythunkpos1222= G->thunkpos;  if (!yy_Digit(G)) goto l1219;  G->pos= yypos1222; G->thunkpos= yythunkpos1222;
+  }
+  }
+  l1220:;	  yyText(G, G->begin, G->end);  if (!(YY_END)) goto l1219;  yyDo(G, yy_1_EnDash, G->begin, G->end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "EnDash", G->buf+G->pos));
+  return 1;
+  l1219:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "EnDash", G->buf+G->pos));
+  return 0;
+}
+YY_RULE(int) yy_Dash(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;
+  yyprintf((stderr, "%s\n", "Dash"));
+  {  int yypos1217= G->pos, yythunkpos1217= G->thunkpos;  if (!yy_EmDash(G)) goto l1218;  goto l1217;
+  l1218:;	  G->pos= yypos1217; G->thunkpos= yythunkpos1217;  if (!yy_EnDash(G)) goto l1216;
+  }
+  l1217:;	
+  yyprintf((stderr, "  ok   %s @ %s\n", "Dash", G->buf+G->pos));
+  return 1;
+  l1216:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "Dash", G->buf+G->pos));
+  return 0;
+}
+YY_RULE(int) yy_Ellipsis(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;
+  yyprintf((stderr, "%s\n", "Ellipsis"));  yyText(G, G->begin, G->end);  if (!(YY_BEGIN)) goto l1213;
+  {  int yypos1214= G->pos, yythunkpos1214= G->thunkpos;  if (!yymatchString(G, "...")) goto l1215;  goto l1214;
+  l1215:;	  G->pos= yypos1214; G->thunkpos= yythunkpos1214;  if (!yymatchString(G, ". . .")) goto l1213;
+  }
+  l1214:;	  yyText(G, G->begin, G->end);  if (!(YY_END)) goto l1213;  yyDo(G, yy_1_Ellipsis, G->begin, G->end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "Ellipsis", G->buf+G->pos));
+  return 1;
+  l1213:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "Ellipsis", G->buf+G->pos));
+  return 0;
+}
+YY_RULE(int) yy_Apostrophe(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;
+  yyprintf((stderr, "%s\n", "Apostrophe"));  yyText(G, G->begin, G->end);  if (!(YY_BEGIN)) goto l1212;  if (!yymatchChar(G, '\'')) goto l1212;  yyText(G, G->begin, G->end);  if (!(YY_END)) goto l1212;  yyDo(G, yy_1_Apostrophe, G->begin, G->end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "Apostrophe", G->buf+G->pos));
+  return 1;
+  l1212:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "Apostrophe", G->buf+G->pos));
+  return 0;
+}
+YY_RULE(int) yy_Smart(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;
+  yyprintf((stderr, "%s\n", "Smart"));  yyText(G, G->begin, G->end);  if (!( ext(EXT_SMART) )) goto l1205;
+  {  int yypos1206= G->pos, yythunkpos1206= G->thunkpos;  if (!yy_Ellipsis(G)) goto l1207;  goto l1206;
+  l1207:;	  G->pos= yypos1206; G->thunkpos= yythunkpos1206;  if (!yy_Dash(G)) goto l1208;  goto l1206;
+  l1208:;	  G->pos= yypos1206; G->thunkpos= yythunkpos1206;  if (!yy_SingleQuoted(G)) goto l1209;  goto l1206;
+  l1209:;	  G->pos= yypos1206; G->thunkpos= yythunkpos1206;  if (!yy_DoubleQuoted(G)) goto l1210;  goto l1206;
+  l1210:;	  G->pos= yypos1206; G->thunkpos= yythunkpos1206;  if (!yy_BackTickQuoted(G)) goto l1211;  goto l1206;
+  l1211:;	  G->pos= yypos1206; G->thunkpos= yythunkpos1206;  if (!yy_Apostrophe(G)) goto l1205;
+  }
+  l1206:;	
+  yyprintf((stderr, "  ok   %s @ %s\n", "Smart", G->buf+G->pos));
+  return 1;
+  l1205:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "Smart", G->buf+G->pos));
+  return 0;
+}
+YY_RULE(int) yy_Fenced(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyDo(G, yyPush, 1, 0);
+  yyprintf((stderr, "%s\n", "Fenced"));  if (!yy_NonindentSpace(G)) goto l1192;
+  {  int yypos1193= G->pos, yythunkpos1193= G->thunkpos;  if (!yy_Ticks3(G)) goto l1194;  if (!yy_FenceType(G)) goto l1194;  yyDo(G, yySet, -1, 0);  yyText(G, G->begin, G->end);  if (!(YY_BEGIN)) goto l1194;
+  l1195:;	
+  {  int yypos1196= G->pos, yythunkpos1196= G->thunkpos;
+  {  int yypos1197= G->pos, yythunkpos1197= G->thunkpos;  if (!yy_NonindentSpace(G)) goto l1197;  if (!yy_Ticks3(G)) goto l1197;  goto l1196;
+  l1197:;	  G->pos= yypos1197; G->thunkpos= yythunkpos1197;
+  }  if (!yy_NonMatchingRawLine(G)) goto l1196;  goto l1195;
+  l1196:;	  G->pos= yypos1196; G->thunkpos= yythunkpos1196;
+  }  yyText(G, G->begin, G->end);  if (!(YY_END)) goto l1194;  if (!yy_NonindentSpace(G)) goto l1194;  if (!yy_Ticks3(G)) goto l1194;  if (!yy_Sp(G)) goto l1194;  if (!yy_Newline(G)) goto l1194;  goto l1193;
+  l1194:;	  G->pos= yypos1193; G->thunkpos= yythunkpos1193;  if (!yy_Ticks4(G)) goto l1198;  if (!yy_FenceType(G)) goto l1198;  yyDo(G, yySet, -1, 0);  yyText(G, G->begin, G->end);  if (!(YY_BEGIN)) goto l1198;
+  l1199:;	
+  {  int yypos1200= G->pos, yythunkpos1200= G->thunkpos;
+  {  int yypos1201= G->pos, yythunkpos1201= G->thunkpos;  if (!yy_NonindentSpace(G)) goto l1201;  if (!yy_Ticks4(G)) goto l1201;  goto l1200;
+  l1201:;	  G->pos= yypos1201; G->thunkpos= yythunkpos1201;
+  }  if (!yy_NonMatchingRawLine(G)) goto l1200;  goto l1199;
+  l1200:;	  G->pos= yypos1200; G->thunkpos= yythunkpos1200;
+  }  yyText(G, G->begin, G->end);  if (!(YY_END)) goto l1198;  if (!yy_NonindentSpace(G)) goto l1198;  if (!yy_Ticks4(G)) goto l1198;  if (!yy_Sp(G)) goto l1198;  if (!yy_Newline(G)) goto l1198;  goto l1193;
+  l1198:;	  G->pos= yypos1193; G->thunkpos= yythunkpos1193;  if (!yy_Ticks5(G)) goto l1192;  if (!yy_FenceType(G)) goto l1192;  yyDo(G, yySet, -1, 0);  yyText(G, G->begin, G->end);  if (!(YY_BEGIN)) goto l1192;
+  l1202:;	
+  {  int yypos1203= G->pos, yythunkpos1203= G->thunkpos;
+  {  int yypos1204= G->pos, yythunkpos1204= G->thunkpos;  if (!yy_NonindentSpace(G)) goto l1204;  if (!yy_Ticks5(G)) goto l1204;  goto l1203;
+  l1204:;	  G->pos= yypos1204; G->thunkpos= yythunkpos1204;
+  }  if (!yy_NonMatchingRawLine(G)) goto l1203;  goto l1202;
+  l1203:;	  G->pos= yypos1203; G->thunkpos= yythunkpos1203;
+  }  yyText(G, G->begin, G->end);  if (!(YY_END)) goto l1192;  if (!yy_NonindentSpace(G)) goto l1192;  if (!yy_Ticks5(G)) goto l1192;  if (!yy_Sp(G)) goto l1192;  if (!yy_Newline(G)) goto l1192;
+  }
+  l1193:;	  yyDo(G, yy_1_Fenced, G->begin, G->end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "Fenced", G->buf+G->pos));  yyDo(G, yyPop, 1, 0);
+  return 1;
+  l1192:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "Fenced", G->buf+G->pos));
+  return 0;
+}
+YY_RULE(int) yy_FenceType(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;
+  yyprintf((stderr, "%s\n", "FenceType"));  if (!yy_Sp(G)) goto l1186;
+  {  int yypos1187= G->pos, yythunkpos1187= G->thunkpos;
+  l1188:;	
+  {  int yypos1189= G->pos, yythunkpos1189= G->thunkpos;
+  {  int yypos1190= G->pos, yythunkpos1190= G->thunkpos;  if (!yymatchChar(G, '\012')) goto l1190;  goto l1189;
+  l1190:;	  G->pos= yypos1190; G->thunkpos= yythunkpos1190;
+  }
+  {  int yypos1191= G->pos, yythunkpos1191= G->thunkpos;  if (!yymatchChar(G, '`')) goto l1191;  goto l1189;
+  l1191:;	  G->pos= yypos1191; G->thunkpos= yythunkpos1191;
+  }  if (!yymatchDot(G)) goto l1189;  goto l1188;
+  l1189:;	  G->pos= yypos1189; G->thunkpos= yythunkpos1189;
+  }  if (!yy_Newline(G)) goto l1186;  G->pos= yypos1187; G->thunkpos= yythunkpos1187;
+  }  if (!yy_RawLine(G)) goto l1186;  yyDo(G, yy_1_FenceType, G->begin, G->end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "FenceType", G->buf+G->pos));
+  return 1;
+  l1186:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "FenceType", G->buf+G->pos));
+  return 0;
+}
+YY_RULE(int) yy_Code(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;
+  yyprintf((stderr, "%s\n", "Code"));
+  {  int yypos1031= G->pos, yythunkpos1031= G->thunkpos;  if (!yy_Ticks1(G)) goto l1032;  if (!yy_Sp(G)) goto l1032;  yyText(G, G->begin, G->end);  if (!(YY_BEGIN)) goto l1032;
+  {  int yypos1035= G->pos, yythunkpos1035= G->thunkpos;
+  {  int yypos1039= G->pos, yythunkpos1039= G->thunkpos;  if (!yymatchChar(G, '`')) goto l1039;  goto l1036;
+  l1039:;	  G->pos= yypos1039; G->thunkpos= yythunkpos1039;
+  }  if (!yy_Nonspacechar(G)) goto l1036;
+  l1037:;	
+  {  int yypos1038= G->pos, yythunkpos1038= G->thunkpos;
+  {  int yypos1040= G->pos, yythunkpos1040= G->thunkpos;  if (!yymatchChar(G, '`')) goto l1040;  goto l1038;
+  l1040:;	  G->pos= yypos1040; G->thunkpos= yythunkpos1040;
+  }  if (!yy_Nonspacechar(G)) goto l1038;  goto l1037;
+  l1038:;	  G->pos= yypos1038; G->thunkpos= yythunkpos1038;
+  }  goto l1035;
+  l1036:;	  G->pos= yypos1035; G->thunkpos= yythunkpos1035;
+  {  int yypos1042= G->pos, yythunkpos1042= G->thunkpos;  if (!yy_Ticks1(G)) goto l1042;  goto l1041;
+  l1042:;	  G->pos= yypos1042; G->thunkpos= yythunkpos1042;
+  }  if (!yymatchChar(G, '`')) goto l1041;
+  l1043:;	
+  {  int yypos1044= G->pos, yythunkpos1044= G->thunkpos;  if (!yymatchChar(G, '`')) goto l1044;  goto l1043;
+  l1044:;	  G->pos= yypos1044; G->thunkpos= yythunkpos1044;
+  }  goto l1035;
+  l1041:;	  G->pos= yypos1035; G->thunkpos= yythunkpos1035;
+  {  int yypos1045= G->pos, yythunkpos1045= G->thunkpos;  if (!yy_Sp(G)) goto l1045;  if (!yy_Ticks1(G)) goto l1045;  goto l1032;
+  l1045:;	  G->pos= yypos1045; G->thunkpos= yythunkpos1045;
+  }
+  {  int yypos1046= G->pos, yythunkpos1046= G->thunkpos;  if (!yy_Spacechar(G)) goto l1047;  goto l1046;
+  l1047:;	  G->pos= yypos1046; G->thunkpos= yythunkpos1046;  if (!yy_Newline(G)) goto l1032;
+  {  int yypos1048= G->pos, yythunkpos1048= G->thunkpos;  if (!yy_BlankLine(G)) goto l1048;  goto l1032;
+  l1048:;	  G->pos= yypos1048; G->thunkpos= yythunkpos1048;
+  }
+  }
+  l1046:;	
+  }
+  l1035:;	
+  l1033:;	
+  {  int yypos1034= G->pos, yythunkpos1034= G->thunkpos;
+  {  int yypos1049= G->pos, yythunkpos1049= G->thunkpos;
+  {  int yypos1053= G->pos, yythunkpos1053= G->thunkpos;  if (!yymatchChar(G, '`')) goto l1053;  goto l1050;
+  l1053:;	  G->pos= yypos1053; G->thunkpos= yythunkpos1053;
+  }  if (!yy_Nonspacechar(G)) goto l1050;
+  l1051:;	
+  {  int yypos1052= G->pos, yythunkpos1052= G->thunkpos;
+  {  int yypos1054= G->pos, yythunkpos1054= G->thunkpos;  if (!yymatchChar(G, '`')) goto l1054;  goto l1052;
+  l1054:;	  G->pos= yypos1054; G->thunkpos= yythunkpos1054;
+  }  if (!yy_Nonspacechar(G)) goto l1052;  goto l1051;
+  l1052:;	  G->pos= yypos1052; G->thunkpos= yythunkpos1052;
+  }  goto l1049;
+  l1050:;	  G->pos= yypos1049; G->thunkpos= yythunkpos1049;
+  {  int yypos1056= G->pos, yythunkpos1056= G->thunkpos;  if (!yy_Ticks1(G)) goto l1056;  goto l1055;
+  l1056:;	  G->pos= yypos1056; G->thunkpos= yythunkpos1056;
+  }  if (!yymatchChar(G, '`')) goto l1055;
+  l1057:;	
+  {  int yypos1058= G->pos, yythunkpos1058= G->thunkpos;  if (!yymatchChar(G, '`')) goto l1058;  goto l1057;
+  l1058:;	  G->pos= yypos1058; G->thunkpos= yythunkpos1058;
+  }  goto l1049;
+  l1055:;	  G->pos= yypos1049; G->thunkpos= yythunkpos1049;
+  {  int yypos1059= G->pos, yythunkpos1059= G->thunkpos;  if (!yy_Sp(G)) goto l1059;  if (!yy_Ticks1(G)) goto l1059;  goto l1034;
+  l1059:;	  G->pos= yypos1059; G->thunkpos= yythunkpos1059;
+  }
+  {  int yypos1060= G->pos, yythunkpos1060= G->thunkpos;  if (!yy_Spacechar(G)) goto l1061;  goto l1060;
+  l1061:;	  G->pos= yypos1060; G->thunkpos= yythunkpos1060;  if (!yy_Newline(G)) goto l1034;
+  {  int yypos1062= G->pos, yythunkpos1062= G->thunkpos;  if (!yy_BlankLine(G)) goto l1062;  goto l1034;
+  l1062:;	  G->pos= yypos1062; G->thunkpos= yythunkpos1062;
+  }
+  }
+  l1060:;	
+  }
+  l1049:;	  goto l1033;
+  l1034:;	  G->pos= yypos1034; G->thunkpos= yythunkpos1034;
+  }  yyText(G, G->begin, G->end);  if (!(YY_END)) goto l1032;  if (!yy_Sp(G)) goto l1032;  if (!yy_Ticks1(G)) goto l1032;  goto l1031;
+  l1032:;	  G->pos= yypos1031; G->thunkpos= yythunkpos1031;  if (!yy_Ticks2(G)) goto l1063;  if (!yy_Sp(G)) goto l1063;  yyText(G, G->begin, G->end);  if (!(YY_BEGIN)) goto l1063;
+  {  int yypos1066= G->pos, yythunkpos1066= G->thunkpos;
+  {  int yypos1070= G->pos, yythunkpos1070= G->thunkpos;  if (!yymatchChar(G, '`')) goto l1070;  goto l1067;
+  l1070:;	  G->pos= yypos1070; G->thunkpos= yythunkpos1070;
+  }  if (!yy_Nonspacechar(G)) goto l1067;
+  l1068:;	
+  {  int yypos1069= G->pos, yythunkpos1069= G->thunkpos;
+  {  int yypos1071= G->pos, yythunkpos1071= G->thunkpos;  if (!yymatchChar(G, '`')) goto l1071;  goto l1069;
+  l1071:;	  G->pos= yypos1071; G->thunkpos= yythunkpos1071;
+  }  if (!yy_Nonspacechar(G)) goto l1069;  goto l1068;
+  l1069:;	  G->pos= yypos1069; G->thunkpos= yythunkpos1069;
+  }  goto l1066;
+  l1067:;	  G->pos= yypos1066; G->thunkpos= yythunkpos1066;
+  {  int yypos1073= G->pos, yythunkpos1073= G->thunkpos;  if (!yy_Ticks2(G)) goto l1073;  goto l1072;
+  l1073:;	  G->pos= yypos1073; G->thunkpos= yythunkpos1073;
+  }  if (!yymatchChar(G, '`')) goto l1072;
+  l1074:;	
+  {  int yypos1075= G->pos, yythunkpos1075= G->thunkpos;  if (!yymatchChar(G, '`')) goto l1075;  goto l1074;
+  l1075:;	  G->pos= yypos1075; G->thunkpos= yythunkpos1075;
+  }  goto l1066;
+  l1072:;	  G->pos= yypos1066; G->thunkpos= yythunkpos1066;
+  {  int yypos1076= G->pos, yythunkpos1076= G->thunkpos;  if (!yy_Sp(G)) goto l1076;  if (!yy_Ticks2(G)) goto l1076;  goto l1063;
+  l1076:;	  G->pos= yypos1076; G->thunkpos= yythunkpos1076;
+  }
+  {  int yypos1077= G->pos, yythunkpos1077= G->thunkpos;  if (!yy_Spacechar(G)) goto l1078;  goto l1077;
+  l1078:;	  G->pos= yypos1077; G->thunkpos= yythunkpos1077;  if (!yy_Newline(G)) goto l1063;
+  {  int yypos1079= G->pos, yythunkpos1079= G->thunkpos;  if (!yy_BlankLine(G)) goto l1079;  goto l1063;
+  l1079:;	  G->pos= yypos1079; G->thunkpos= yythunkpos1079;
+  }
+  }
+  l1077:;	
+  }
+  l1066:;	
+  l1064:;	
+  {  int yypos1065= G->pos, yythunkpos1065= G->thunkpos;
+  {  int yypos1080= G->pos, yythunkpos1080= G->thunkpos;
+  {  int yypos1084= G->pos, yythunkpos1084= G->thunkpos;  if (!yymatchChar(G, '`')) goto l1084;  goto l1081;
+  l1084:;	  G->pos= yypos1084; G->thunkpos= yythunkpos1084;
+  }  if (!yy_Nonspacechar(G)) goto l1081;
+  l1082:;	
+  {  int yypos1083= G->pos, yythunkpos1083= G->thunkpos;
+  {  int yypos1085= G->pos, yythunkpos1085= G->thunkpos;  if (!yymatchChar(G, '`')) goto l1085;  goto l1083;
+  l1085:;	  G->pos= yypos1085; G->thunkpos= yythunkpos1085;
+  }  if (!yy_Nonspacechar(G)) goto l1083;  goto l1082;
+  l1083:;	  G->pos= yypos1083; G->thunkpos= yythunkpos1083;
+  }  goto l1080;
+  l1081:;	  G->pos= yypos1080; G->thunkpos= yythunkpos1080;
+  {  int yypos1087= G->pos, yythunkpos1087= G->thunkpos;  if (!yy_Ticks2(G)) goto l1087;  goto l1086;
+  l1087:;	  G->pos= yypos1087; G->thunkpos= yythunkpos1087;
+  }  if (!yymatchChar(G, '`')) goto l1086;
+  l1088:;	
+  {  int yypos1089= G->pos, yythunkpos1089= G->thunkpos;  if (!yymatchChar(G, '`')) goto l1089;  goto l1088;
+  l1089:;	  G->pos= yypos1089; G->thunkpos= yythunkpos1089;
+  }  goto l1080;
+  l1086:;	  G->pos= yypos1080; G->thunkpos= yythunkpos1080;
+  {  int yypos1090= G->pos, yythunkpos1090= G->thunkpos;  if (!yy_Sp(G)) goto l1090;  if (!yy_Ticks2(G)) goto l1090;  goto l1065;
+  l1090:;	  G->pos= yypos1090; G->thunkpos= yythunkpos1090;
+  }
+  {  int yypos1091= G->pos, yythunkpos1091= G->thunkpos;  if (!yy_Spacechar(G)) goto l1092;  goto l1091;
+  l1092:;	  G->pos= yypos1091; G->thunkpos= yythunkpos1091;  if (!yy_Newline(G)) goto l1065;
+  {  int yypos1093= G->pos, yythunkpos1093= G->thunkpos;  if (!yy_BlankLine(G)) goto l1093;  goto l1065;
+  l1093:;	  G->pos= yypos1093; G->thunkpos= yythunkpos1093;
+  }
+  }
+  l1091:;	
+  }
+  l1080:;	  goto l1064;
+  l1065:;	  G->pos= yypos1065; G->thunkpos= yythunkpos1065;
+  }  yyText(G, G->begin, G->end);  if (!(YY_END)) goto l1063;  if (!yy_Sp(G)) goto l1063;  if (!yy_Ticks2(G)) goto l1063;  goto l1031;
+  l1063:;	  G->pos= yypos1031; G->thunkpos= yythunkpos1031;  if (!yy_Ticks3(G)) goto l1094;  if (!yy_Sp(G)) goto l1094;  yyText(G, G->begin, G->end);  if (!(YY_BEGIN)) goto l1094;
+  {  int yypos1097= G->pos, yythunkpos1097= G->thunkpos;
+  {  int yypos1101= G->pos, yythunkpos1101= G->thunkpos;  if (!yymatchChar(G, '`')) goto l1101;  goto l1098;
+  l1101:;	  G->pos= yypos1101; G->thunkpos= yythunkpos1101;
+  }  if (!yy_Nonspacechar(G)) goto l1098;
+  l1099:;	
+  {  int yypos1100= G->pos, yythunkpos1100= G->thunkpos;
+  {  int yypos1102= G->pos, yythunkpos1102= G->thunkpos;  if (!yymatchChar(G, '`')) goto l1102;  goto l1100;
+  l1102:;	  G->pos= yypos1102; G->thunkpos= yythunkpos1102;
+  }  if (!yy_Nonspacechar(G)) goto l1100;  goto l1099;
+  l1100:;	  G->pos= yypos1100; G->thunkpos= yythunkpos1100;
+  }  goto l1097;
+  l1098:;	  G->pos= yypos1097; G->thunkpos= yythunkpos1097;
+  {  int yypos1104= G->pos, yythunkpos1104= G->thunkpos;  if (!yy_Ticks3(G)) goto l1104;  goto l1103;
+  l1104:;	  G->pos= yypos1104; G->thunkpos= yythunkpos1104;
+  }  if (!yymatchChar(G, '`')) goto l1103;
+  l1105:;	
+  {  int yypos1106= G->pos, yythunkpos1106= G->thunkpos;  if (!yymatchChar(G, '`')) goto l1106;  goto l1105;
+  l1106:;	  G->pos= yypos1106; G->thunkpos= yythunkpos1106;
+  }  goto l1097;
+  l1103:;	  G->pos= yypos1097; G->thunkpos= yythunkpos1097;
+  {  int yypos1107= G->pos, yythunkpos1107= G->thunkpos;  if (!yy_Sp(G)) goto l1107;  if (!yy_Ticks3(G)) goto l1107;  goto l1094;
+  l1107:;	  G->pos= yypos1107; G->thunkpos= yythunkpos1107;
+  }
+  {  int yypos1108= G->pos, yythunkpos1108= G->thunkpos;  if (!yy_Spacechar(G)) goto l1109;  goto l1108;
+  l1109:;	  G->pos= yypos1108; G->thunkpos= yythunkpos1108;  if (!yy_Newline(G)) goto l1094;
+  {  int yypos1110= G->pos, yythunkpos1110= G->thunkpos;  if (!yy_BlankLine(G)) goto l1110;  goto l1094;
+  l1110:;	  G->pos= yypos1110; G->thunkpos= yythunkpos1110;
+  }
+  }
+  l1108:;	
+  }
+  l1097:;	
+  l1095:;	
+  {  int yypos1096= G->pos, yythunkpos1096= G->thunkpos;
+  {  int yypos1111= G->pos, yythunkpos1111= G->thunkpos;
+  {  int yypos1115= G->pos, yythunkpos1115= G->thunkpos;  if (!yymatchChar(G, '`')) goto l1115;  goto l1112;
+  l1115:;	  G->pos= yypos1115; G->thunkpos= yythunkpos1115;
+  }  if (!yy_Nonspacechar(G)) goto l1112;
+  l1113:;	
+  {  int yypos1114= G->pos, yythunkpos1114= G->thunkpos;
+  {  int yypos1116= G->pos, yythunkpos1116= G->thunkpos;  if (!yymatchChar(G, '`')) goto l1116;  goto l1114;
+  l1116:;	  G->pos= yypos1116; G->thunkpos= yythunkpos1116;
+  }  if (!yy_Nonspacechar(G)) goto l1114;  goto l1113;
+  l1114:;	  G->pos= yypos1114; G->thunkpos= yythunkpos1114;
+  }  goto l1111;
+  l1112:;	  G->pos= yypos1111; G->thunkpos= yythunkpos1111;
+  {  int yypos1118= G->pos, yythunkpos1118= G->thunkpos;  if (!yy_Ticks3(G)) goto l1118;  goto l1117;
+  l1118:;	  G->pos= yypos1118; G->thunkpos= yythunkpos1118;
+  }  if (!yymatchChar(G, '`')) goto l1117;
+  l1119:;	
+  {  int yypos1120= G->pos, yythunkpos1120= G->thunkpos;  if (!yymatchChar(G, '`')) goto l1120;  goto l1119;
+  l1120:;	  G->pos= yypos1120; G->thunkpos= yythunkpos1120;
+  }  goto l1111;
+  l1117:;	  G->pos= yypos1111; G->thunkpos= yythunkpos1111;
+  {  int yypos1121= G->pos, yythunkpos1121= G->thunkpos;  if (!yy_Sp(G)) goto l1121;  if (!yy_Ticks3(G)) goto l1121;  goto l1096;
+  l1121:;	  G->pos= yypos1121; G->thunkpos= yythunkpos1121;
+  }
+  {  int yypos1122= G->pos, yythunkpos1122= G->thunkpos;  if (!yy_Spacechar(G)) goto l1123;  goto l1122;
+  l1123:;	  G->pos= yypos1122; G->thunkpos= yythunkpos1122;  if (!yy_Newline(G)) goto l1096;
+  {  int yypos1124= G->pos, yythunkpos1124= G->thunkpos;  if (!yy_BlankLine(G)) goto l1124;  goto l1096;
+  l1124:;	  G->pos= yypos1124; G->thunkpos= yythunkpos1124;
+  }
+  }
+  l1122:;	
+  }
+  l1111:;	  goto l1095;
+  l1096:;	  G->pos= yypos1096; G->thunkpos= yythunkpos1096;
+  }  yyText(G, G->begin, G->end);  if (!(YY_END)) goto l1094;  if (!yy_Sp(G)) goto l1094;  if (!yy_Ticks3(G)) goto l1094;  goto l1031;
+  l1094:;	  G->pos= yypos1031; G->thunkpos= yythunkpos1031;  if (!yy_Ticks4(G)) goto l1125;  if (!yy_Sp(G)) goto l1125;  yyText(G, G->begin, G->end);  if (!(YY_BEGIN)) goto l1125;
+  {  int yypos1128= G->pos, yythunkpos1128= G->thunkpos;
+  {  int yypos1132= G->pos, yythunkpos1132= G->thunkpos;  if (!yymatchChar(G, '`')) goto l1132;  goto l1129;
+  l1132:;	  G->pos= yypos1132; G->thunkpos= yythunkpos1132;
+  }  if (!yy_Nonspacechar(G)) goto l1129;
+  l1130:;	
+  {  int yypos1131= G->pos, yythunkpos1131= G->thunkpos;
+  {  int yypos1133= G->pos, yythunkpos1133= G->thunkpos;  if (!yymatchChar(G, '`')) goto l1133;  goto l1131;
+  l1133:;	  G->pos= yypos1133; G->thunkpos= yythunkpos1133;
+  }  if (!yy_Nonspacechar(G)) goto l1131;  goto l1130;
+  l1131:;	  G->pos= yypos1131; G->thunkpos= yythunkpos1131;
+  }  goto l1128;
+  l1129:;	  G->pos= yypos1128; G->thunkpos= yythunkpos1128;
+  {  int yypos1135= G->pos, yythunkpos1135= G->thunkpos;  if (!yy_Ticks4(G)) goto l1135;  goto l1134;
+  l1135:;	  G->pos= yypos1135; G->thunkpos= yythunkpos1135;
+  }  if (!yymatchChar(G, '`')) goto l1134;
+  l1136:;	
+  {  int yypos1137= G->pos, yythunkpos1137= G->thunkpos;  if (!yymatchChar(G, '`')) goto l1137;  goto l1136;
+  l1137:;	  G->pos= yypos1137; G->thunkpos= yythunkpos1137;
+  }  goto l1128;
+  l1134:;	  G->pos= yypos1128; G->thunkpos= yythunkpos1128;
+  {  int yypos1138= G->pos, yythunkpos1138= G->thunkpos;  if (!yy_Sp(G)) goto l1138;  if (!yy_Ticks4(G)) goto l1138;  goto l1125;
+  l1138:;	  G->pos= yypos1138; G->thunkpos= yythunkpos1138;
+  }
+  {  int yypos1139= G->pos, yythunkpos1139= G->thunkpos;  if (!yy_Spacechar(G)) goto l1140;  goto l1139;
+  l1140:;	  G->pos= yypos1139; G->thunkpos= yythunkpos1139;  if (!yy_Newline(G)) goto l1125;
+  {  int yypos1141= G->pos, yythunkpos1141= G->thunkpos;  if (!yy_BlankLine(G)) goto l1141;  goto l1125;
+  l1141:;	  G->pos= yypos1141; G->thunkpos= yythunkpos1141;
+  }
+  }
+  l1139:;	
+  }
+  l1128:;	
+  l1126:;	
+  {  int yypos1127= G->pos, yythunkpos1127= G->thunkpos;
+  {  int yypos1142= G->pos, yythunkpos1142= G->thunkpos;
+  {  int yypos1146= G->pos, yythunkpos1146= G->thunkpos;  if (!yymatchChar(G, '`')) goto l1146;  goto l1143;
+  l1146:;	  G->pos= yypos1146; G->thunkpos= yythunkpos1146;
+  }  if (!yy_Nonspacechar(G)) goto l1143;
+  l1144:;	
+  {  int yypos1145= G->pos, yythunkpos1145= G->thunkpos;
+  {  int yypos1147= G->pos, yythunkpos1147= G->thunkpos;  if (!yymatchChar(G, '`')) goto l1147;  goto l1145;
+  l1147:;	  G->pos= yypos1147; G->thunkpos= yythunkpos1147;
+  }  if (!yy_Nonspacechar(G)) goto l1145;  goto l1144;
+  l1145:;	  G->pos= yypos1145; G->thunkpos= yythunkpos1145;
+  }  goto l1142;
+  l1143:;	  G->pos= yypos1142; G->thunkpos= yythunkpos1142;
+  {  int yypos1149= G->pos, yythunkpos1149= G->thunkpos;  if (!yy_Ticks4(G)) goto l1149;  goto l1148;
+  l1149:;	  G->pos= yypos1149; G->thunkpos= yythunkpos1149;
+  }  if (!yymatchChar(G, '`')) goto l1148;
+  l1150:;	
+  {  int yypos1151= G->pos, yythunkpos1151= G->thunkpos;  if (!yymatchChar(G, '`')) goto l1151;  goto l1150;
+  l1151:;	  G->pos= yypos1151; G->thunkpos= yythunkpos1151;
+  }  goto l1142;
+  l1148:;	  G->pos= yypos1142; G->thunkpos= yythunkpos1142;
+  {  int yypos1152= G->pos, yythunkpos1152= G->thunkpos;  if (!yy_Sp(G)) goto l1152;  if (!yy_Ticks4(G)) goto l1152;  goto l1127;
+  l1152:;	  G->pos= yypos1152; G->thunkpos= yythunkpos1152;
+  }
+  {  int yypos1153= G->pos, yythunkpos1153= G->thunkpos;  if (!yy_Spacechar(G)) goto l1154;  goto l1153;
+  l1154:;	  G->pos= yypos1153; G->thunkpos= yythunkpos1153;  if (!yy_Newline(G)) goto l1127;
+  {  int yypos1155= G->pos, yythunkpos1155= G->thunkpos;  if (!yy_BlankLine(G)) goto l1155;  goto l1127;
+  l1155:;	  G->pos= yypos1155; G->thunkpos= yythunkpos1155;
+  }
+  }
+  l1153:;	
+  }
+  l1142:;	  goto l1126;
+  l1127:;	  G->pos= yypos1127; G->thunkpos= yythunkpos1127;
+  }  yyText(G, G->begin, G->end);  if (!(YY_END)) goto l1125;  if (!yy_Sp(G)) goto l1125;  if (!yy_Ticks4(G)) goto l1125;  goto l1031;
+  l1125:;	  G->pos= yypos1031; G->thunkpos= yythunkpos1031;  if (!yy_Ticks5(G)) goto l1030;  if (!yy_Sp(G)) goto l1030;  yyText(G, G->begin, G->end);  if (!(YY_BEGIN)) goto l1030;
+  {  int yypos1158= G->pos, yythunkpos1158= G->thunkpos;
+  {  int yypos1162= G->pos, yythunkpos1162= G->thunkpos;  if (!yymatchChar(G, '`')) goto l1162;  goto l1159;
+  l1162:;	  G->pos= yypos1162; G->thunkpos= yythunkpos1162;
+  }  if (!yy_Nonspacechar(G)) goto l1159;
+  l1160:;	
+  {  int yypos1161= G->pos, yythunkpos1161= G->thunkpos;
+  {  int yypos1163= G->pos, yythunkpos1163= G->thunkpos;  if (!yymatchChar(G, '`')) goto l1163;  goto l1161;
+  l1163:;	  G->pos= yypos1163; G->thunkpos= yythunkpos1163;
+  }  if (!yy_Nonspacechar(G)) goto l1161;  goto l1160;
+  l1161:;	  G->pos= yypos1161; G->thunkpos= yythunkpos1161;
+  }  goto l1158;
+  l1159:;	  G->pos= yypos1158; G->thunkpos= yythunkpos1158;
+  {  int yypos1165= G->pos, yythunkpos1165= G->thunkpos;  if (!yy_Ticks5(G)) goto l1165;  goto l1164;
+  l1165:;	  G->pos= yypos1165; G->thunkpos= yythunkpos1165;
+  }  if (!yymatchChar(G, '`')) goto l1164;
+  l1166:;	
+  {  int yypos1167= G->pos, yythunkpos1167= G->thunkpos;  if (!yymatchChar(G, '`')) goto l1167;  goto l1166;
+  l1167:;	  G->pos= yypos1167; G->thunkpos= yythunkpos1167;
+  }  goto l1158;
+  l1164:;	  G->pos= yypos1158; G->thunkpos= yythunkpos1158;
+  {  int yypos1168= G->pos, yythunkpos1168= G->thunkpos;  if (!yy_Sp(G)) goto l1168;  if (!yy_Ticks5(G)) goto l1168;  goto l1030;
+  l1168:;	  G->pos= yypos1168; G->thunkpos= yythunkpos1168;
+  }
+  {  int yypos1169= G->pos, yythunkpos1169= G->thunkpos;  if (!yy_Spacechar(G)) goto l1170;  goto l1169;
+  l1170:;	  G->pos= yypos1169; G->thunkpos= yythunkpos1169;  if (!yy_Newline(G)) goto l1030;
+  {  int yypos1171= G->pos, yythunkpos1171= G->thunkpos;  if (!yy_BlankLine(G)) goto l1171;  goto l1030;
+  l1171:;	  G->pos= yypos1171; G->thunkpos= yythunkpos1171;
+  }
+  }
+  l1169:;	
+  }
+  l1158:;	
+  l1156:;	
+  {  int yypos1157= G->pos, yythunkpos1157= G->thunkpos;
+  {  int yypos1172= G->pos, yythunkpos1172= G->thunkpos;
+  {  int yypos1176= G->pos, yythunkpos1176= G->thunkpos;  if (!yymatchChar(G, '`')) goto l1176;  goto l1173;
+  l1176:;	  G->pos= yypos1176; G->thunkpos= yythunkpos1176;
+  }  if (!yy_Nonspacechar(G)) goto l1173;
+  l1174:;	
+  {  int yypos1175= G->pos, yythunkpos1175= G->thunkpos;
+  {  int yypos1177= G->pos, yythunkpos1177= G->thunkpos;  if (!yymatchChar(G, '`')) goto l1177;  goto l1175;
+  l1177:;	  G->pos= yypos1177; G->thunkpos= yythunkpos1177;
+  }  if (!yy_Nonspacechar(G)) goto l1175;  goto l1174;
+  l1175:;	  G->pos= yypos1175; G->thunkpos= yythunkpos1175;
+  }  goto l1172;
+  l1173:;	  G->pos= yypos1172; G->thunkpos= yythunkpos1172;
+  {  int yypos1179= G->pos, yythunkpos1179= G->thunkpos;  if (!yy_Ticks5(G)) goto l1179;  goto l1178;
+  l1179:;	  G->pos= yypos1179; G->thunkpos= yythunkpos1179;
+  }  if (!yymatchChar(G, '`')) goto l1178;
+  l1180:;	
+  {  int yypos1181= G->pos, yythunkpos1181= G->thunkpos;  if (!yymatchChar(G, '`')) goto l1181;  goto l1180;
+  l1181:;	  G->pos= yypos1181; G->thunkpos= yythunkpos1181;
+  }  goto l1172;
+  l1178:;	  G->pos= yypos1172; G->thunkpos= yythunkpos1172;
+  {  int yypos1182= G->pos, yythunkpos1182= G->thunkpos;  if (!yy_Sp(G)) goto l1182;  if (!yy_Ticks5(G)) goto l1182;  goto l1157;
+  l1182:;	  G->pos= yypos1182; G->thunkpos= yythunkpos1182;
+  }
+  {  int yypos1183= G->pos, yythunkpos1183= G->thunkpos;  if (!yy_Spacechar(G)) goto l1184;  goto l1183;
+  l1184:;	  G->pos= yypos1183; G->thunkpos= yythunkpos1183;  if (!yy_Newline(G)) goto l1157;
+  {  int yypos1185= G->pos, yythunkpos1185= G->thunkpos;  if (!yy_BlankLine(G)) goto l1185;  goto l1157;
+  l1185:;	  G->pos= yypos1185; G->thunkpos= yythunkpos1185;
+  }
+  }
+  l1183:;	
+  }
+  l1172:;	  goto l1156;
+  l1157:;	  G->pos= yypos1157; G->thunkpos= yythunkpos1157;
+  }  yyText(G, G->begin, G->end);  if (!(YY_END)) goto l1030;  if (!yy_Sp(G)) goto l1030;  if (!yy_Ticks5(G)) goto l1030;
+  }
+  l1031:;	  yyDo(G, yy_1_Code, G->begin, G->end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "Code", G->buf+G->pos));
+  return 1;
+  l1030:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "Code", G->buf+G->pos));
+  return 0;
+}
+YY_RULE(int) yy_Ticks5(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;
+  yyprintf((stderr, "%s\n", "Ticks5"));  if (!yymatchString(G, "`````")) goto l1028;
+  {  int yypos1029= G->pos, yythunkpos1029= G->thunkpos;  if (!yymatchChar(G, '`')) goto l1029;  goto l1028;
+  l1029:;	  G->pos= yypos1029; G->thunkpos= yythunkpos1029;
+  }
+  yyprintf((stderr, "  ok   %s @ %s\n", "Ticks5", G->buf+G->pos));
+  return 1;
+  l1028:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "Ticks5", G->buf+G->pos));
+  return 0;
+}
+YY_RULE(int) yy_Ticks4(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;
+  yyprintf((stderr, "%s\n", "Ticks4"));  if (!yymatchString(G, "````")) goto l1026;
+  {  int yypos1027= G->pos, yythunkpos1027= G->thunkpos;  if (!yymatchChar(G, '`')) goto l1027;  goto l1026;
+  l1027:;	  G->pos= yypos1027; G->thunkpos= yythunkpos1027;
+  }
+  yyprintf((stderr, "  ok   %s @ %s\n", "Ticks4", G->buf+G->pos));
+  return 1;
+  l1026:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "Ticks4", G->buf+G->pos));
+  return 0;
+}
+YY_RULE(int) yy_Ticks3(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;
+  yyprintf((stderr, "%s\n", "Ticks3"));  if (!yymatchString(G, "```")) goto l1024;
+  {  int yypos1025= G->pos, yythunkpos1025= G->thunkpos;  if (!yymatchChar(G, '`')) goto l1025;  goto l1024;
+  l1025:;	  G->pos= yypos1025; G->thunkpos= yythunkpos1025;
+  }
+  yyprintf((stderr, "  ok   %s @ %s\n", "Ticks3", G->buf+G->pos));
+  return 1;
+  l1024:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "Ticks3", G->buf+G->pos));
+  return 0;
+}
+YY_RULE(int) yy_Ticks2(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;
+  yyprintf((stderr, "%s\n", "Ticks2"));  if (!yymatchString(G, "``")) goto l1022;
+  {  int yypos1023= G->pos, yythunkpos1023= G->thunkpos;  if (!yymatchChar(G, '`')) goto l1023;  goto l1022;
+  l1023:;	  G->pos= yypos1023; G->thunkpos= yythunkpos1023;
+  }
+  yyprintf((stderr, "  ok   %s @ %s\n", "Ticks2", G->buf+G->pos));
+  return 1;
+  l1022:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "Ticks2", G->buf+G->pos));
+  return 0;
+}
+YY_RULE(int) yy_Ticks1(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;
+  yyprintf((stderr, "%s\n", "Ticks1"));  if (!yymatchChar(G, '`')) goto l1020;
+  {  int yypos1021= G->pos, yythunkpos1021= G->thunkpos;  if (!yymatchChar(G, '`')) goto l1021;  goto l1020;
+  l1021:;	  G->pos= yypos1021; G->thunkpos= yythunkpos1021;
+  }
+  yyprintf((stderr, "  ok   %s @ %s\n", "Ticks1", G->buf+G->pos));
+  return 1;
+  l1020:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "Ticks1", G->buf+G->pos));
+  return 0;
+}
+YY_RULE(int) yy_GlossarySortKey(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;
+  yyprintf((stderr, "%s\n", "GlossarySortKey"));  if (!yymatchChar(G, '(')) goto l1015;  yyText(G, G->begin, G->end);  if (!(YY_BEGIN)) goto l1015;
+  l1016:;	
+  {  int yypos1017= G->pos, yythunkpos1017= G->thunkpos;
+  {  int yypos1018= G->pos, yythunkpos1018= G->thunkpos;  if (!yymatchChar(G, ')')) goto l1018;  goto l1017;
+  l1018:;	  G->pos= yypos1018; G->thunkpos= yythunkpos1018;
+  }
+  {  int yypos1019= G->pos, yythunkpos1019= G->thunkpos;  if (!yy_Newline(G)) goto l1019;  goto l1017;
+  l1019:;	  G->pos= yypos1019; G->thunkpos= yythunkpos1019;
+  }  if (!yymatchDot(G)) goto l1017;  goto l1016;
+  l1017:;	  G->pos= yypos1017; G->thunkpos= yythunkpos1017;
+  }  yyText(G, G->begin, G->end);  if (!(YY_END)) goto l1015;  if (!yymatchChar(G, ')')) goto l1015;  yyDo(G, yy_1_GlossarySortKey, G->begin, G->end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "GlossarySortKey", G->buf+G->pos));
+  return 1;
+  l1015:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "GlossarySortKey", G->buf+G->pos));
+  return 0;
+}
+YY_RULE(int) yy_GlossaryTerm(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;
+  yyprintf((stderr, "%s\n", "GlossaryTerm"));  yyText(G, G->begin, G->end);  if (!(YY_BEGIN)) goto l1008;
+  {  int yypos1011= G->pos, yythunkpos1011= G->thunkpos;  if (!yy_Newline(G)) goto l1011;  goto l1008;
+  l1011:;	  G->pos= yypos1011; G->thunkpos= yythunkpos1011;
+  }
+  {  int yypos1012= G->pos, yythunkpos1012= G->thunkpos;  if (!yymatchChar(G, '(')) goto l1012;  goto l1008;
+  l1012:;	  G->pos= yypos1012; G->thunkpos= yythunkpos1012;
+  }  if (!yymatchDot(G)) goto l1008;
+  l1009:;	
+  {  int yypos1010= G->pos, yythunkpos1010= G->thunkpos;
+  {  int yypos1013= G->pos, yythunkpos1013= G->thunkpos;  if (!yy_Newline(G)) goto l1013;  goto l1010;
+  l1013:;	  G->pos= yypos1013; G->thunkpos= yythunkpos1013;
+  }
+  {  int yypos1014= G->pos, yythunkpos1014= G->thunkpos;  if (!yymatchChar(G, '(')) goto l1014;  goto l1010;
+  l1014:;	  G->pos= yypos1014; G->thunkpos= yythunkpos1014;
+  }  if (!yymatchDot(G)) goto l1010;  goto l1009;
+  l1010:;	  G->pos= yypos1010; G->thunkpos= yythunkpos1010;
+  }  yyText(G, G->begin, G->end);  if (!(YY_END)) goto l1008;  yyDo(G, yy_1_GlossaryTerm, G->begin, G->end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "GlossaryTerm", G->buf+G->pos));
+  return 1;
+  l1008:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "GlossaryTerm", G->buf+G->pos));
+  return 0;
+}
+YY_RULE(int) yy_Glossary(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyDo(G, yyPush, 2, 0);
+  yyprintf((stderr, "%s\n", "Glossary"));  yyText(G, G->begin, G->end);  if (!( ext(EXT_NOTES) )) goto l1002;  if (!yy_StartList(G)) goto l1002;  yyDo(G, yySet, -1, 0);  if (!yy_NonindentSpace(G)) goto l1002;  if (!yy_RawNoteReference(G)) goto l1002;  yyDo(G, yySet, -2, 0);  if (!yymatchChar(G, ':')) goto l1002;  if (!yy_Sp(G)) goto l1002;  if (!yymatchString(G, "glossary:")) goto l1002;  if (!yy_Sp(G)) goto l1002;  if (!yy_GlossaryTerm(G)) goto l1002;  yyDo(G, yy_1_Glossary, G->begin, G->end);
+  {  int yypos1003= G->pos, yythunkpos1003= G->thunkpos;  if (!yy_GlossarySortKey(G)) goto l1003;  yyDo(G, yy_2_Glossary, G->begin, G->end);  goto l1004;
+  l1003:;	  G->pos= yypos1003; G->thunkpos= yythunkpos1003;
+  }
+  l1004:;	  if (!yy_Newline(G)) goto l1002;  if (!yy_RawNoteBlock(G)) goto l1002;  yyDo(G, yy_3_Glossary, G->begin, G->end);
+  l1005:;	
+  {  int yypos1006= G->pos, yythunkpos1006= G->thunkpos;
+  {  int yypos1007= G->pos, yythunkpos1007= G->thunkpos;  if (!yy_Indent(G)) goto l1006;  G->pos= yypos1007; G->thunkpos= yythunkpos1007;
+  }  if (!yy_RawNoteBlock(G)) goto l1006;  yyDo(G, yy_4_Glossary, G->begin, G->end);  goto l1005;
+  l1006:;	  G->pos= yypos1006; G->thunkpos= yythunkpos1006;
+  }  yyDo(G, yy_5_Glossary, G->begin, G->end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "Glossary", G->buf+G->pos));  yyDo(G, yyPop, 2, 0);
+  return 1;
+  l1002:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "Glossary", G->buf+G->pos));
+  return 0;
+}
+YY_RULE(int) yy_NoteReference(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;
+  yyprintf((stderr, "%s\n", "NoteReference"));  yyText(G, G->begin, G->end);  if (!( ext(EXT_NOTES) )) goto l995;  if (!yymatchString(G, "[^")) goto l995;  yyText(G, G->begin, G->end);  if (!( bracket_follows(G) )) goto l995;  yyText(G, G->begin, G->end);  if (!(YY_BEGIN)) goto l995;
+  {  int yypos998= G->pos, yythunkpos998= G->thunkpos;  if (!yy_Newline(G)) goto l998;  if (!yy_BlankLine(G)) goto l998;  goto l995;
+  l998:;	  G->pos= yypos998; G->thunkpos= yythunkpos998;
+  }
+  {  int yypos999= G->pos, yythunkpos999= G->thunkpos;  if (!yymatchChar(G, ']')) goto l999;  goto l995;
+  l999:;	  G->pos= yypos999; G->thunkpos= yythunkpos999;
+  }  if (!yy_RawInline(G)) goto l995;
+  l996:;	
+  {  int yypos997= G->pos, yythunkpos997= G->thunkpos;
+  {  int yypos1000= G->pos, yythunkpos1000= G->thunkpos;  if (!yy_Newline(G)) goto l1000;  if (!yy_BlankLine(G)) goto l1000;  goto l997;
+  l1000:;	  G->pos= yypos1000; G->thunkpos= yythunkpos1000;
+  }
+  {  int yypos1001= G->pos, yythunkpos1001= G->thunkpos;  if (!yymatchChar(G, ']')) goto l1001;  goto l997;
+  l1001:;	  G->pos= yypos1001; G->thunkpos= yythunkpos1001;
+  }  if (!yy_RawInline(G)) goto l997;  goto l996;
+  l997:;	  G->pos= yypos997; G->thunkpos= yythunkpos997;
+  }  yyText(G, G->begin, G->end);  if (!(YY_END)) goto l995;  if (!yymatchChar(G, ']')) goto l995;  yyDo(G, yy_1_NoteReference, G->begin, G->end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "NoteReference", G->buf+G->pos));
+  return 1;
+  l995:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "NoteReference", G->buf+G->pos));
+  return 0;
+}
+YY_RULE(int) yy_RawInline(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;
+  yyprintf((stderr, "%s\n", "RawInline"));
+  {  int yypos990= G->pos, yythunkpos990= G->thunkpos;  if (!yymatchChar(G, '[')) goto l991;
+  l992:;	
+  {  int yypos993= G->pos, yythunkpos993= G->thunkpos;
+  {  int yypos994= G->pos, yythunkpos994= G->thunkpos;  if (!yymatchChar(G, ']')) goto l994;  goto l993;
+  l994:;	  G->pos= yypos994; G->thunkpos= yythunkpos994;
+  }  if (!yymatchDot(G)) goto l993;  goto l992;
+  l993:;	  G->pos= yypos993; G->thunkpos= yythunkpos993;
+  }  if (!yymatchChar(G, ']')) goto l991;  goto l990;
+  l991:;	  G->pos= yypos990; G->thunkpos= yythunkpos990;  if (!yymatchDot(G)) goto l989;
+  }
+  l990:;	
+  yyprintf((stderr, "  ok   %s @ %s\n", "RawInline", G->buf+G->pos));
+  return 1;
+  l989:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "RawInline", G->buf+G->pos));
+  return 0;
+}
+YY_RULE(int) yy_AutoLabel(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;
+  yyprintf((stderr, "%s\n", "AutoLabel"));  if (!yymatchChar(G, '[')) goto l972;  yyText(G, G->begin, G->end);  if (!(YY_BEGIN)) goto l972;
+  {  int yypos973= G->pos, yythunkpos973= G->thunkpos;  if (!yy_Newline(G)) goto l973;  goto l972;
+  l973:;	  G->pos= yypos973; G->thunkpos= yythunkpos973;
+  }
+  {  int yypos974= G->pos, yythunkpos974= G->thunkpos;  if (!yymatchChar(G, '^')) goto l974;  goto l972;
+  l974:;	  G->pos= yypos974; G->thunkpos= yythunkpos974;
+  }
+  {  int yypos975= G->pos, yythunkpos975= G->thunkpos;  if (!yymatchChar(G, '#')) goto l975;  goto l972;
+  l975:;	  G->pos= yypos975; G->thunkpos= yythunkpos975;
+  }
+  {  int yypos976= G->pos, yythunkpos976= G->thunkpos;  if (!yymatchChar(G, '%')) goto l976;  goto l972;
+  l976:;	  G->pos= yypos976; G->thunkpos= yythunkpos976;
+  }  if (!yymatchDot(G)) goto l972;
+  {  int yypos979= G->pos, yythunkpos979= G->thunkpos;  if (!yy_Newline(G)) goto l979;  goto l972;
+  l979:;	  G->pos= yypos979; G->thunkpos= yythunkpos979;
+  }
+  {  int yypos980= G->pos, yythunkpos980= G->thunkpos;  if (!yymatchChar(G, ']')) goto l980;  goto l972;
+  l980:;	  G->pos= yypos980; G->thunkpos= yythunkpos980;
+  }
+  {  int yypos981= G->pos, yythunkpos981= G->thunkpos;  if (!yymatchChar(G, '[')) goto l981;  goto l972;
+  l981:;	  G->pos= yypos981; G->thunkpos= yythunkpos981;
+  }  if (!yymatchDot(G)) goto l972;
+  l977:;	
+  {  int yypos978= G->pos, yythunkpos978= G->thunkpos;
+  {  int yypos982= G->pos, yythunkpos982= G->thunkpos;  if (!yy_Newline(G)) goto l982;  goto l978;
+  l982:;	  G->pos= yypos982; G->thunkpos= yythunkpos982;
+  }
+  {  int yypos983= G->pos, yythunkpos983= G->thunkpos;  if (!yymatchChar(G, ']')) goto l983;  goto l978;
+  l983:;	  G->pos= yypos983; G->thunkpos= yythunkpos983;
+  }
+  {  int yypos984= G->pos, yythunkpos984= G->thunkpos;  if (!yymatchChar(G, '[')) goto l984;  goto l978;
+  l984:;	  G->pos= yypos984; G->thunkpos= yythunkpos984;
+  }  if (!yymatchDot(G)) goto l978;  goto l977;
+  l978:;	  G->pos= yypos978; G->thunkpos= yythunkpos978;
+  }  yyText(G, G->begin, G->end);  if (!(YY_END)) goto l972;  if (!yymatchChar(G, ']')) goto l972;
+  {  int yypos985= G->pos, yythunkpos985= G->thunkpos;
+  {  int yypos986= G->pos, yythunkpos986= G->thunkpos;  if (!yy_Sp(G)) goto l986;
+  {  int yypos987= G->pos, yythunkpos987= G->thunkpos;  if (!yymatchChar(G, '(')) goto l988;  goto l987;
+  l988:;	  G->pos= yypos987; G->thunkpos= yythunkpos987;  if (!yymatchChar(G, '[')) goto l986;
+  }
+  l987:;	  goto l972;
+  l986:;	  G->pos= yypos986; G->thunkpos= yythunkpos986;
+  }  G->pos= yypos985; G->thunkpos= yythunkpos985;
+  }  yyDo(G, yy_1_AutoLabel, G->begin, G->end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "AutoLabel", G->buf+G->pos));
+  return 1;
+  l972:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "AutoLabel", G->buf+G->pos));
+  return 0;
+}
+YY_RULE(int) yy_LabelStart(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;
+  yyprintf((stderr, "%s\n", "LabelStart"));
+  {  int yypos966= G->pos, yythunkpos966= G->thunkpos;  if (!yymatchChar(G, '[')) goto l966;  goto l965;
+  l966:;	  G->pos= yypos966; G->thunkpos= yythunkpos966;
+  }
+  {  int yypos967= G->pos, yythunkpos967= G->thunkpos;
+  {  int yypos969= G->pos, yythunkpos969= G->thunkpos;  if (!yymatchChar(G, '^')) goto l969;  goto l968;
+  l969:;	  G->pos= yypos969; G->thunkpos= yythunkpos969;
+  }
+  {  int yypos970= G->pos, yythunkpos970= G->thunkpos;  if (!yymatchChar(G, '#')) goto l970;  goto l968;
+  l970:;	  G->pos= yypos970; G->thunkpos= yythunkpos970;
+  }  yyText(G, G->begin, G->end);  if (!( ext(EXT_NOTES) )) goto l968;  goto l967;
+  l968:;	  G->pos= yypos967; G->thunkpos= yythunkpos967;
+  {  int yypos971= G->pos, yythunkpos971= G->thunkpos;  if (!yymatchDot(G)) goto l965;  G->pos= yypos971; G->thunkpos= yythunkpos971;
+  }  yyText(G, G->begin, G->end);  if (!( !ext(EXT_NOTES) )) goto l965;
+  }
+  l967:;	
+  yyprintf((stderr, "  ok   %s @ %s\n", "LabelStart", G->buf+G->pos));
+  return 1;
+  l965:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "LabelStart", G->buf+G->pos));
+  return 0;
+}
+YY_RULE(int) yy_Label(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyDo(G, yyPush, 1, 0);
+  yyprintf((stderr, "%s\n", "Label"));
+  {  int yypos959= G->pos, yythunkpos959= G->thunkpos;  yyText(G, G->begin, G->end);  if (!( memo_ok(MEMO_LABEL) )) goto l960;  yyText(G, G->begin, G->end);  if (!(YY_BEGIN)) goto l960;  if (!yymatchChar(G, '[')) goto l960;  yyText(G, G->begin, G->end);  if (!( bracket_may_close(G) )) goto l960;  if (!yy_LabelStart(G)) goto l960;  yyText(G, G->begin, G->end);  if (!( nest_enter((parser_data *)G->data) )) goto l960;  if (!yy_StartList(G)) goto l960;  yyDo(G, yySet, -1, 0);
+  l961:;	
+  {  int yypos962= G->pos, yythunkpos962= G->thunkpos;
+  {  int yypos963= G->pos, yythunkpos963= G->thunkpos;  if (!yymatchChar(G, ']')) goto l963;  goto l962;
+  l963:;	  G->pos= yypos963; G->thunkpos= yythunkpos963;
+  }  yyText(G, G->begin, G->end);  if (!( memo_ok(MEMO_LABEL_TEXT) )) goto l962;  if (!yy_Inline(G)) goto l962;  yyDo(G, yy_1_Label, G->begin, G->end);  goto l961;
+  l962:;	  G->pos= yypos962; G->thunkpos= yythunkpos962;
+  }  yyText(G, G->begin, G->end);  if (!( nest_leave((parser_data *)G->data) )) goto l960;  if (!yymatchChar(G, ']')) goto l960;  yyText(G, G->begin, G->end);  if (!(YY_END)) goto l960;  yyDo(G, yy_2_Label, G->begin, G->end);  goto l959;
+  l960:;	  G->pos= yypos959; G->thunkpos= yythunkpos959;  if (!yymatchChar(G, '[')) goto l964;  if (!yy_LabelStart(G)) goto l964;  yyText(G, G->begin, G->end);  if (!( memo_fail(MEMO_LABEL_TEXT) )) goto l964;  goto l959;
+  l964:;	  G->pos= yypos959; G->thunkpos= yythunkpos959;  yyText(G, G->begin, G->end);  if (!( memo_fail(MEMO_LABEL) )) goto l958;
+  }
+  l959:;	
+  yyprintf((stderr, "  ok   %s @ %s\n", "Label", G->buf+G->pos));  yyDo(G, yyPop, 1, 0);
+  return 1;
+  l958:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "Label", G->buf+G->pos));
+  return 0;
+}
+YY_RULE(int) yy_Image(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;
+  yyprintf((stderr, "%s\n", "Image"));  if (!yymatchChar(G, '!')) goto l956;
+  {  int yypos957= G->pos, yythunkpos957= G->thunkpos;  if (!yy_AutoLink(G)) goto l957;  goto l956;
+  l957:;	  G->pos= yypos957; G->thunkpos= yythunkpos957;
+  }  if (!yy_Link(G)) goto l956;  yyDo(G, yy_1_Image, G->begin, G->end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "Image", G->buf+G->pos));
+  return 1;
+  l956:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "Image", G->buf+G->pos));
+  return 0;
+}
+YY_RULE(int) yy_ImageBlock(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;
+  yyprintf((stderr, "%s\n", "ImageBlock"));  if (!yy_Image(G)) goto l953;  if (!yy_Sp(G)) goto l953;  if (!yy_Newline(G)) goto l953;  if (!yy_BlankLine(G)) goto l953;
+  l954:;	
+  {  int yypos955= G->pos, yythunkpos955= G->thunkpos;  if (!yy_BlankLine(G)) goto l955;  goto l954;
+  l955:;	  G->pos= yypos955; G->thunkpos= yythunkpos955;
+  }  yyDo(G, yy_1_ImageBlock, G->begin, G->end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "ImageBlock", G->buf+G->pos));
+  return 1;
+  l953:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "ImageBlock", G->buf+G->pos));
+  return 0;
+}
+YY_RULE(int) yy_Abbreviation(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyDo(G, yyPush, 1, 0);
+  yyprintf((stderr, "%s\n", "Abbreviation"));  if (!yymatchChar(G, '*')) goto l952;  if (!yy_Label(G)) goto l952;  yyDo(G, yySet, -1, 0);  if (!yy_Sp(G)) goto l952;  if (!yymatchChar(G, ':')) goto l952;  if (!yy_Sp(G)) goto l952;  if (!yy_RawLine(G)) goto l952;  yyDo(G, yy_1_Abbreviation, G->begin, G->end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "Abbreviation", G->buf+G->pos));  yyDo(G, yyPop, 1, 0);
+  return 1;
+  l952:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "Abbreviation", G->buf+G->pos));
+  return 0;
+}
+YY_RULE(int) yy_UnQuotedValue(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;
+  yyprintf((stderr, "%s\n", "UnQuotedValue"));  yyText(G, G->begin, G->end);  if (!(YY_BEGIN)) goto l945;
+  {  int yypos948= G->pos, yythunkpos948= G->thunkpos;  if (!yy_AlphanumericAscii(G)) goto l949;  goto l948;
+  l949:;	  G->pos= yypos948; G->thunkpos= yythunkpos948;  if (!yymatchChar(G, '.')) goto l945;
+  }
+  l948:;	
+  l946:;	
+  {  int yypos947= G->pos, yythunkpos947= G->thunkpos;
+  {  int yypos950= G->pos, yythunkpos950= G->thunkpos;  if (!yy_AlphanumericAscii(G)) goto l951;  goto l950;
+  l951:;	  G->pos= yypos950; G->thunkpos= yythunkpos950;  if (!yymatchChar(G, '.')) goto l947;
+  }
+  l950:;	  goto l946;
+  l947:;	  G->pos= yypos947; G->thunkpos= yythunkpos947;
+  }  yyText(G, G->begin, G->end);  if (!(YY_END)) goto l945;
+  yyprintf((stderr, "  ok   %s @ %s\n", "UnQuotedValue", G->buf+G->pos));
+  return 1;
+  l945:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "UnQuotedValue", G->buf+G->pos));
+  return 0;
+}
+YY_RULE(int) yy_QuotedValue(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;
+  yyprintf((stderr, "%s\n", "QuotedValue"));  if (!yymatchChar(G, '"')) goto l941;  yyText(G, G->begin, G->end);  if (!(YY_BEGIN)) goto l941;
+  l942:;	
+  {  int yypos943= G->pos, yythunkpos943= G->thunkpos;
+  {  int yypos944= G->pos, yythunkpos944= G->thunkpos;  if (!yymatchChar(G, '"')) goto l944;  goto l943;
+  l944:;	  G->pos= yypos944; G->thunkpos= yythunkpos944;
+  }  if (!yymatchDot(G)) goto l943;  goto l942;
+  l943:;	  G->pos= yypos943; G->thunkpos= yythunkpos943;
+  }  yyText(G, G->begin, G->end);  if (!(YY_END)) goto l941;  if (!yymatchChar(G, '"')) goto l941;
+  yyprintf((stderr, "  ok   %s @ %s\n", "QuotedValue", G->buf+G->pos));
+  return 1;
+  l941:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "QuotedValue", G->buf+G->pos));
+  return 0;
+}
+YY_RULE(int) yy_RefTitleParens(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;
+  yyprintf((stderr, "%s\n", "RefTitleParens"));  if (!yy_Spnl(G)) goto l932;  if (!yymatchChar(G, '(')) goto l932;  yyText(G, G->begin, G->end);  if (!(YY_BEGIN)) goto l932;
+  l933:;	
+  {  int yypos934= G->pos, yythunkpos934= G->thunkpos;
+  {  int yypos935= G->pos, yythunkpos935= G->thunkpos;
+  {  int yypos936= G->pos, yythunkpos936= G->thunkpos;  if (!yymatchChar(G, ')')) goto l937;  if (!yy_Sp(G)) goto l937;  if (!yy_Newline(G)) goto l937;  goto l936;
+  l937:;	  G->pos= yypos936; G->thunkpos= yythunkpos936;  if (!yy_Newline(G)) goto l938;  goto l936;
+  l938:;	  G->pos= yypos936; G->thunkpos= yythunkpos936;  yyText(G, G->begin, G->end);  if (!( !ext(EXT_COMPATIBILITY) )) goto l935;  if (!yymatchChar(G, ')')) goto l935;  if (!yy_Sp(G)) goto l935;  if (!yy_AlphanumericAscii(G)) goto l935;
+  l939:;	
+  {  int yypos940= G->pos, yythunkpos940= G->thunkpos;  if (!yy_AlphanumericAscii(G)) goto l940;  goto l939;
+  l940:;	  G->pos= yypos940; G->thunkpos= yythunkpos940;
+  }  if (!yymatchChar(G, '=')) goto l935;
+  }
+  l936:;	  goto l934;
+  l935:;	  G->pos= yypos935; G->thunkpos= yythunkpos935;
+  }  if (!yymatchDot(G)) goto l934;  goto l933;
+  l934:;	  G->pos= yypos934; G->thunkpos= yythunkpos934;
+  }  yyText(G, G->begin, G->end);  if (!(YY_END)) goto l932;  if (!yymatchChar(G, ')')) goto l932;
+  yyprintf((stderr, "  ok   %s @ %s\n", "RefTitleParens", G->buf+G->pos));
+  return 1;
+  l932:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "RefTitleParens", G->buf+G->pos));
+  return 0;
+}
+YY_RULE(int) yy_RefTitleDouble(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;
+  yyprintf((stderr, "%s\n", "RefTitleDouble"));  if (!yy_Spnl(G)) goto l923;  if (!yymatchChar(G, '"')) goto l923;  yyText(G, G->begin, G->end);  if (!(YY_BEGIN)) goto l923;
+  l924:;	
+  {  int yypos925= G->pos, yythunkpos925= G->thunkpos;
+  {  int yypos926= G->pos, yythunkpos926= G->thunkpos;
+  {  int yypos927= G->pos, yythunkpos927= G->thunkpos;  if (!yymatchChar(G, '"')) goto l928;  if (!yy_Sp(G)) goto l928;  if (!yy_Newline(G)) goto l928;  goto l927;
+  l928:;	  G->pos= yypos927; G->thunkpos= yythunkpos927;  if (!yy_Newline(G)) goto l929;  goto l927;
+  l929:;	  G->pos= yypos927; G->thunkpos= yythunkpos927;  yyText(G, G->begin, G->end);  if (!( !ext(EXT_COMPATIBILITY) )) goto l926;  if (!yymatchChar(G, '"')) goto l926;  if (!yy_Sp(G)) goto l926;  if (!yy_AlphanumericAscii(G)) goto l926;
+  l930:;	
+  {  int yypos931= G->pos, yythunkpos931= G->thunkpos;  if (!yy_AlphanumericAscii(G)) goto l931;  goto l930;
+  l931:;	  G->pos= yypos931; G->thunkpos= yythunkpos931;
+  }  if (!yymatchChar(G, '=')) goto l926;
+  }
+  l927:;	  goto l925;
+  l926:;	  G->pos= yypos926; G->thunkpos= yythunkpos926;
+  }  if (!yymatchDot(G)) goto l925;  goto l924;
+  l925:;	  G->pos= yypos925; G->thunkpos= yythunkpos925;
+  }  yyText(G, G->begin, G->end);  if (!(YY_END)) goto l923;  if (!yymatchChar(G, '"')) goto l923;
+  yyprintf((stderr, "  ok   %s @ %s\n", "RefTitleDouble", G->buf+G->pos));
+  return 1;
+  l923:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "RefTitleDouble", G->buf+G->pos));
+  return 0;
+}
+YY_RULE(int) yy_RefTitleSingle(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;
+  yyprintf((stderr, "%s\n", "RefTitleSingle"));  if (!yy_Spnl(G)) goto l914;  if (!yymatchChar(G, '\'')) goto l914;  yyText(G, G->begin, G->end);  if (!(YY_BEGIN)) goto l914;
+  l915:;	
+  {  int yypos916= G->pos, yythunkpos916= G->thunkpos;
+  {  int yypos917= G->pos, yythunkpos917= G->thunkpos;
+  {  int yypos918= G->pos, yythunkpos918= G->thunkpos;  if (!yymatchChar(G, '\'')) goto l919;  if (!yy_Sp(G)) goto l919;  if (!yy_Newline(G)) goto l919;  goto l918;
+  l919:;	  G->pos= yypos918; G->thunkpos= yythunkpos918;  if (!yy_Newline(G)) goto l920;  goto l918;
+  l920:;	  G->pos= yypos918; G->thunkpos= yythunkpos918;  yyText(G, G->begin, G->end);  if (!( !ext(EXT_COMPATIBILITY) )) goto l917;  if (!yymatchChar(G, '\'')) goto l917;  if (!yy_Sp(G)) goto l917;  if (!yy_AlphanumericAscii(G)) goto l917;
+  l921:;	
+  {  int yypos922= G->pos, yythunkpos922= G->thunkpos;  if (!yy_AlphanumericAscii(G)) goto l922;  goto l921;
+  l922:;	  G->pos= yypos922; G->thunkpos= yythunkpos922;
+  }  if (!yymatchChar(G, '=')) goto l917;
+  }
+  l918:;	  goto l916;
+  l917:;	  G->pos= yypos917; G->thunkpos= yythunkpos917;
+  }  if (!yymatchDot(G)) goto l916;  goto l915;
+  l916:;	  G->pos= yypos916; G->thunkpos= yythunkpos916;
+  }  yyText(G, G->begin, G->end);  if (!(YY_END)) goto l914;  if (!yymatchChar(G, '\'')) goto l914;
+  yyprintf((stderr, "  ok   %s @ %s\n", "RefTitleSingle", G->buf+G->pos));
+  return 1;
+  l914:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "RefTitleSingle", G->buf+G->pos));
+  return 0;
+}
+YY_RULE(int) yy_EmptyTitle(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;
+  yyprintf((stderr, "%s\n", "EmptyTitle"));  yyText(G, G->begin, G->end);  if (!(YY_BEGIN)) goto l913;  if (!yymatchString(G, "")) goto l913;  yyText(G, G->begin, G->end);  if (!(YY_END)) goto l913;
+  yyprintf((stderr, "  ok   %s @ %s\n", "EmptyTitle", G->buf+G->pos));
+  return 1;
+  l913:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "EmptyTitle", G->buf+G->pos));
+  return 0;
+}
+YY_RULE(int) yy_RefTitle(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;
+  yyprintf((stderr, "%s\n", "RefTitle"));
+  {  int yypos909= G->pos, yythunkpos909= G->thunkpos;  if (!yy_RefTitleSingle(G)) goto l910;  goto l909;
+  l910:;	  G->pos= yypos909; G->thunkpos= yythunkpos909;  if (!yy_RefTitleDouble(G)) goto l911;  goto l909;
+  l911:;	  G->pos= yypos909; G->thunkpos= yythunkpos909;  if (!yy_RefTitleParens(G)) goto l912;  goto l909;
+  l912:;	  G->pos= yypos909; G->thunkpos= yythunkpos909;  if (!yy_EmptyTitle(G)) goto l908;
+  }
+  l909:;	  yyDo(G, yy_1_RefTitle, G->begin, G->end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "RefTitle", G->buf+G->pos));
+  return 1;
+  l908:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "RefTitle", G->buf+G->pos));
+  return 0;
+}
+YY_RULE(int) yy_RefSrc(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;
+  yyprintf((stderr, "%s\n", "RefSrc"));
+  {  int yypos900= G->pos, yythunkpos900= G->thunkpos;  if (!yymatchChar(G, '<')) goto l901;  yyText(G, G->begin, G->end);  if (!(YY_BEGIN)) goto l901;
+  {  int yypos904= G->pos, yythunkpos904= G->thunkpos;  if (!yymatchChar(G, '>')) goto l904;  goto l901;
+  l904:;	  G->pos= yypos904; G->thunkpos= yythunkpos904;
+  }  if (!yy_Nonspacechar(G)) goto l901;
+  l902:;	
+  {  int yypos903= G->pos, yythunkpos903= G->thunkpos;
+  {  int yypos905= G->pos, yythunkpos905= G->thunkpos;  if (!yymatchChar(G, '>')) goto l905;  goto l903;
+  l905:;	  G->pos= yypos905; G->thunkpos= yythunkpos905;
+  }  if (!yy_Nonspacechar(G)) goto l903;  goto l902;
+  l903:;	  G->pos= yypos903; G->thunkpos= yythunkpos903;
+  }  yyText(G, G->begin, G->end);  if (!(YY_END)) goto l901;  if (!yymatchChar(G, '>')) goto l901;  goto l900;
+  l901:;	  G->pos= yypos900; G->thunkpos= yythunkpos900;  yyText(G, G->begin, G->end);  if (!(YY_BEGIN)) goto l899;  if (!yy_Nonspacechar(G)) goto l899;
+  l906:;	
+  {  int yypos907= G->pos, yythunkpos907= G->thunkpos;  if (!yy_Nonspacechar(G)) goto l907;  goto l906;
+  l907:;	  G->pos= yypos907; G->thunkpos= yythunkpos907;
+  }  yyText(G, G->begin, G->end);  if (!(YY_END)) goto l899;
+  }
+  l900:;	  yyDo(G, yy_1_RefSrc, G->begin, G->end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "RefSrc", G->buf+G->pos));
+  return 1;
+  l899:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "RefSrc", G->buf+G->pos));
+  return 0;
+}
+YY_RULE(int) yy_AttrValue(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;
+  yyprintf((stderr, "%s\n", "AttrValue"));
+  {  int yypos897= G->pos, yythunkpos897= G->thunkpos;  if (!yy_QuotedValue(G)) goto l898;  goto l897;
+  l898:;	  G->pos= yypos897; G->thunkpos= yythunkpos897;  if (!yy_UnQuotedValue(G)) goto l896;
+  }
+  l897:;	  yyDo(G, yy_1_AttrValue, G->begin, G->end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "AttrValue", G->buf+G->pos));
+  return 1;
+  l896:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "AttrValue", G->buf+G->pos));
+  return 0;
+}
+YY_RULE(int) yy_AttrKey(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;
+  yyprintf((stderr, "%s\n", "AttrKey"));  yyText(G, G->begin, G->end);  if (!(YY_BEGIN)) goto l893;  if (!yy_AlphanumericAscii(G)) goto l893;
+  l894:;	
+  {  int yypos895= G->pos, yythunkpos895= G->thunkpos;  if (!yy_AlphanumericAscii(G)) goto l895;  goto l894;
+  l895:;	  G->pos= yypos895; G->thunkpos= yythunkpos895;
+  }  yyText(G, G->begin, G->end);  if (!(YY_END)) goto l893;  yyDo(G, yy_1_AttrKey, G->begin, G->end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "AttrKey", G->buf+G->pos));
+  return 1;
+  l893:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "AttrKey", G->buf+G->pos));
+  return 0;
+}
+YY_RULE(int) yy_Attribute(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyDo(G, yyPush, 2, 0);
+  yyprintf((stderr, "%s\n", "Attribute"));  if (!yy_Spnl(G)) goto l892;  if (!yy_AttrKey(G)) goto l892;  yyDo(G, yySet, -1, 0);  if (!yymatchChar(G, '=')) goto l892;  if (!yy_AttrValue(G)) goto l892;  yyDo(G, yySet, -2, 0);  yyDo(G, yy_1_Attribute, G->begin, G->end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "Attribute", G->buf+G->pos));  yyDo(G, yyPop, 2, 0);
+  return 1;
+  l892:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "Attribute", G->buf+G->pos));
+  return 0;
+}
+YY_RULE(int) yy_Attributes(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyDo(G, yyPush, 1, 0);
+  yyprintf((stderr, "%s\n", "Attributes"));  if (!yy_StartList(G)) goto l889;  yyDo(G, yySet, -1, 0);  if (!yy_Attribute(G)) goto l889;  yyDo(G, yy_1_Attributes, G->begin, G->end);
+  l890:;	
+  {  int yypos891= G->pos, yythunkpos891= G->thunkpos;  if (!yy_Attribute(G)) goto l891;  yyDo(G, yy_1_Attributes, G->begin, G->end);  goto l890;
+  l891:;	  G->pos= yypos891; G->thunkpos= yythunkpos891;
+  }  yyDo(G, yy_2_Attributes, G->begin, G->end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "Attributes", G->buf+G->pos));  yyDo(G, yyPop, 1, 0);
+  return 1;
+  l889:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "Attributes", G->buf+G->pos));
+  return 0;
+}
+YY_RULE(int) yy_LinkReference(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyDo(G, yyPush, 4, 0);
+  yyprintf((stderr, "%s\n", "LinkReference"));  if (!yy_StartList(G)) goto l883;  yyDo(G, yySet, -1, 0);  if (!yy_NonindentSpace(G)) goto l883;
+  {  int yypos884= G->pos, yythunkpos884= G->thunkpos;  if (!yymatchString(G, "[]")) goto l884;  goto l883;
+  l884:;	  G->pos= yypos884; G->thunkpos= yythunkpos884;
+  }  if (!yy_Label(G)) goto l883;  yyDo(G, yySet, -2, 0);  if (!yymatchChar(G, ':')) goto l883;  if (!yy_Spnl(G)) goto l883;  if (!yy_RefSrc(G)) goto l883;  yyDo(G, yySet, -3, 0);  if (!yy_RefTitle(G)) goto l883;  yyDo(G, yySet, -4, 0);
+  {  int yypos885= G->pos, yythunkpos885= G->thunkpos;  yyText(G, G->begin, G->end);  if (!( !ext(EXT_COMPATIBILITY) )) goto l885;  yyText(G, G->begin, G->end);  if (!(YY_BEGIN)) goto l885;  if (!yy_Attributes(G)) goto l885;  yyDo(G, yy_1_LinkReference, G->begin, G->end);  goto l886;
+  l885:;	  G->pos= yypos885; G->thunkpos= yythunkpos885;
+  }
+  l886:;	  yyText(G, G->begin, G->end);  if (!(YY_END)) goto l883;  if (!yy_BlankLine(G)) goto l883;
+  l887:;	
+  {  int yypos888= G->pos, yythunkpos888= G->thunkpos;  if (!yy_BlankLine(G)) goto l888;  goto l887;
+  l888:;	  G->pos= yypos888; G->thunkpos= yythunkpos888;
+  }  yyDo(G, yy_2_LinkReference, G->begin, G->end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "LinkReference", G->buf+G->pos));  yyDo(G, yyPop, 4, 0);
+  return 1;
+  l883:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "LinkReference", G->buf+G->pos));
+  return 0;
+}
+YY_RULE(int) yy_AutoLinkEmail(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;
+  yyprintf((stderr, "%s\n", "AutoLinkEmail"));  if (!yymatchChar(G, '<')) goto l872;
+  {  int yypos873= G->pos, yythunkpos873= G->thunkpos;  if (!yymatchString(G, "mailto:")) goto l873;  goto l874;
+  l873:;	  G->pos= yypos873; G->thunkpos= yythunkpos873;
+  }
+  l874:;	  yyText(G, G->begin, G->end);  if (!(YY_BEGIN)) goto l872;  if (!yymatchClass(G, (unsigned char *)"\000\000\000\000\062\350\377\003\376\377\377\207\376\377\377\107\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l872;
+  l875:;	
+  {  int yypos876= G->pos, yythunkpos876= G->thunkpos;  if (!yymatchClass(G, (unsigned char *)"\000\000\000\000\062\350\377\003\376\377\377\207\376\377\377\107\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l876;  goto l875;
+  l876:;	  G->pos= yypos876; G->thunkpos= yythunkpos876;
+  }  if (!yymatchChar(G, '@')) goto l872;
+  {  int yypos879= G->pos, yythunkpos879= G->thunkpos;  if (!yy_Newline(G)) goto l879;  goto l872;
+  l879:;	  G->pos= yypos879; G->thunkpos= yythunkpos879;
+  }
+  {  int yypos880= G->pos, yythunkpos880= G->thunkpos;  if (!yymatchChar(G, '>')) goto l880;  goto l872;
+  l880:;	  G->pos= yypos880; G->thunkpos= yythunkpos880;
+  }  if (!yymatchDot(G)) goto l872;
+  l877:;	
+  {  int yypos878= G->pos, yythunkpos878= G->thunkpos;
+  {  int yypos881= G->pos, yythunkpos881= G->thunkpos;  if (!yy_Newline(G)) goto l881;  goto l878;
+  l881:;	  G->pos= yypos881; G->thunkpos= yythunkpos881;
+  }
+  {  int yypos882= G->pos, yythunkpos882= G->thunkpos;  if (!yymatchChar(G, '>')) goto l882;  goto l878;
+  l882:;	  G->pos= yypos882; G->thunkpos= yythunkpos882;
+  }  if (!yymatchDot(G)) goto l878;  goto l877;
+  l878:;	  G->pos= yypos878; G->thunkpos= yythunkpos878;
+  }  yyText(G, G->begin, G->end);  if (!(YY_END)) goto l872;  if (!yymatchChar(G, '>')) goto l872;  yyDo(G, yy_1_AutoLinkEmail, G->begin, G->end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "AutoLinkEmail", G->buf+G->pos));
+  return 1;
+  l872:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "AutoLinkEmail", G->buf+G->pos));
+  return 0;
+}
+YY_RULE(int) yy_AutoLinkUrl(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;
+  yyprintf((stderr, "%s\n", "AutoLinkUrl"));  if (!yymatchChar(G, '<')) goto l863;  yyText(G, G->begin, G->end);  if (!(YY_BEGIN)) goto l863;  if (!yymatchClass(G, (unsigned char *)"\000\000\000\000\000\000\000\000\376\377\377\007\376\377\377\007\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l863;
+  l864:;	
+  {  int yypos865= G->pos, yythunkpos865= G->thunkpos;  if (!yymatchClass(G, (unsigned char *)"\000\000\000\000\000\000\000\000\376\377\377\007\376\377\377\007\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l865;  goto l864;
+  l865:;	  G->pos= yypos865; G->thunkpos= yythunkpos865;
+  }  if (!yymatchString(G, "://")) goto l863;
+  {  int yypos868= G->pos, yythunkpos868= G->thunkpos;  if (!yy_Newline(G)) goto l868;  goto l863;
+  l868:;	  G->pos= yypos868; G->thunkpos= yythunkpos868;
+  }
+  {  int yypos869= G->pos, yythunkpos869= G->thunkpos;  if (!yymatchChar(G, '>')) goto l869;  goto l863;
+  l869:;	  G->pos= yypos869; G->thunkpos= yythunkpos869;
+  }  if (!yymatchDot(G)) goto l863;
+  l866:;	
+  {  int yypos867= G->pos, yythunkpos867= G->thunkpos;
+  {  int yypos870= G->pos, yythunkpos870= G->thunkpos;  if (!yy_Newline(G)) goto l870;  goto l867;
+  l870:;	  G->pos= yypos870; G->thunkpos= yythunkpos870;
+  }
+  {  int yypos871= G->pos, yythunkpos871= G->thunkpos;  if (!yymatchChar(G, '>')) goto l871;  goto l867;
+  l871:;	  G->pos= yypos871; G->thunkpos= yythunkpos871;
+  }  if (!yymatchDot(G)) goto l867;  goto l866;
+  l867:;	  G->pos= yypos867; G->thunkpos= yythunkpos867;
+  }  yyText(G, G->begin, G->end);  if (!(YY_END)) goto l863;  if (!yymatchChar(G, '>')) goto l863;  yyDo(G, yy_1_AutoLinkUrl, G->begin, G->end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "AutoLinkUrl", G->buf+G->pos));
+  return 1;
+  l863:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "AutoLinkUrl", G->buf+G->pos));
+  return 0;
+}
+YY_RULE(int) yy_AutoLink(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;
+  yyprintf((stderr, "%s\n", "AutoLink"));
+  {  int yypos861= G->pos, yythunkpos861= G->thunkpos;  if (!yy_AutoLinkUrl(G)) goto l862;  goto l861;
+  l862:;	  G->pos= yypos861; G->thunkpos= yythunkpos861;  if (!yy_AutoLinkEmail(G)) goto l860;
+  }
+  l861:;	
+  yyprintf((stderr, "  ok   %s @ %s\n", "AutoLink", G->buf+G->pos));
+  return 1;
+  l860:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "AutoLink", G->buf+G->pos));
+  return 0;
+}
+YY_RULE(int) yy_TitleDouble(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;
+  yyprintf((stderr, "%s\n", "TitleDouble"));  if (!yymatchChar(G, '"')) goto l853;  yyText(G, G->begin, G->end);  if (!(YY_BEGIN)) goto l853;
+  l854:;	
+  {  int yypos855= G->pos, yythunkpos855= G->thunkpos;
+  {  int yypos856= G->pos, yythunkpos856= G->thunkpos;  if (!yymatchChar(G, '"')) goto l856;  if (!yy_Sp(G)) goto l856;
+  {  int yypos857= G->pos, yythunkpos857= G->thunkpos;  if (!yymatchChar(G, ')')) goto l858;  goto l857;
+  l858:;	  G->pos= yypos857; G->thunkpos= yythunkpos857;  if (!yy_Newline(G)) goto l856;
+  }
+  l857:;	  goto l855;
+  l856:;	  G->pos= yypos856; G->thunkpos= yythunkpos856;
+  }
+  {  int yypos859= G->pos, yythunkpos859= G->thunkpos;  if (!yy_BlankLine(G)) goto l859;  goto l855;
+  l859:;	  G->pos= yypos859; G->thunkpos= yythunkpos859;
+  }  if (!yymatchDot(G)) goto l855;  goto l854;
+  l855:;	  G->pos= yypos855; G->thunkpos= yythunkpos855;
+  }  yyText(G, G->begin, G->end);  if (!(YY_END)) goto l853;  if (!yymatchChar(G, '"')) goto l853;
+  yyprintf((stderr, "  ok   %s @ %s\n", "TitleDouble", G->buf+G->pos));
+  return 1;
+  l853:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "TitleDouble", G->buf+G->pos));
+  return 0;
+}
+YY_RULE(int) yy_TitleSingle(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;
+  yyprintf((stderr, "%s\n", "TitleSingle"));  if (!yymatchChar(G, '\'')) goto l846;  yyText(G, G->begin, G->end);  if (!(YY_BEGIN)) goto l846;
+  l847:;	
+  {  int yypos848= G->pos, yythunkpos848= G->thunkpos;
+  {  int yypos849= G->pos, yythunkpos849= G->thunkpos;  if (!yymatchChar(G, '\'')) goto l849;  if (!yy_Sp(G)) goto l849;
+  {  int yypos850= G->pos, yythunkpos850= G->thunkpos;  if (!yymatchChar(G, ')')) goto l851;  goto l850;
+  l851:;	  G->pos= yypos850; G->thunkpos= yythunkpos850;  if (!yy_Newline(G)) goto l849;
+  }
+  l850:;	  goto l848;
+  l849:;	  G->pos= yypos849; G->thunkpos= yythunkpos849;
+  }
+  {  int yypos852= G->pos, yythunkpos852= G->thunkpos;  if (!yy_BlankLine(G)) goto l852;  goto l848;
+  l852:;	  G->pos= yypos852; G->thunkpos= yythunkpos852;
+  }  if (!yymatchDot(G)) goto l848;  goto l847;
+  l848:;	  G->pos= yypos848; G->thunkpos= yythunkpos848;
+  }  yyText(G, G->begin, G->end);  if (!(YY_END)) goto l846;  if (!yymatchChar(G, '\'')) goto l846;
+  yyprintf((stderr, "  ok   %s @ %s\n", "TitleSingle", G->buf+G->pos));
+  return 1;
+  l846:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "TitleSingle", G->buf+G->pos));
+  return 0;
+}
+YY_RULE(int) yy_Title(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;
+  yyprintf((stderr, "%s\n", "Title"));
+  {  int yypos843= G->pos, yythunkpos843= G->thunkpos;  if (!yy_TitleSingle(G)) goto l844;  goto l843;
+  l844:;	  G->pos= yypos843; G->thunkpos= yythunkpos843;  if (!yy_TitleDouble(G)) goto l845;  goto l843;
+  l845:;	  G->pos= yypos843; G->thunkpos= yythunkpos843;  yyText(G, G->begin, G->end);  if (!(YY_BEGIN)) goto l842;  if (!yymatchString(G, "")) goto l842;  yyText(G, G->begin, G->end);  if (!(YY_END)) goto l842;
+  }
+  l843:;	  yyDo(G, yy_1_Title, G->begin, G->end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "Title", G->buf+G->pos));
+  return 1;
+  l842:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "Title", G->buf+G->pos));
+  return 0;
+}
+YY_RULE(int) yy_SourceContents(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;
+  yyprintf((stderr, "%s\n", "SourceContents"));
+  {  int yypos827= G->pos, yythunkpos827= G->thunkpos;  yyText(G, G->begin, G->end);  if (!( scan_reuse(MEMO_SOURCE_CONTENTS) )) goto l828;  goto l827;
+  l828:;	  G->pos= yypos827; G->thunkpos= yythunkpos827;  yyText(G, G->begin, G->end);  if (!( scan_start() )) goto l829;  yyText(G, G->begin, G->end);  if (!( scan_passed(MEMO_SOURCE_CONTENTS) )) goto l829;
+  l830:;	
+  {  int yypos831= G->pos, yythunkpos831= G->thunkpos;
+  {  int yypos832= G->pos, yythunkpos832= G->thunkpos;
+  {  int yypos836= G->pos, yythunkpos836= G->thunkpos;  if (!yymatchChar(G, '(')) goto l836;  goto l833;
+  l836:;	  G->pos= yypos836; G->thunkpos= yythunkpos836;
+  }
+  {  int yypos837= G->pos, yythunkpos837= G->thunkpos;  if (!yymatchChar(G, ')')) goto l837;  goto l833;
+  l837:;	  G->pos= yypos837; G->thunkpos= yythunkpos837;
+  }
+  {  int yypos838= G->pos, yythunkpos838= G->thunkpos;  if (!yymatchChar(G, '>')) goto l838;  goto l833;
+  l838:;	  G->pos= yypos838; G->thunkpos= yythunkpos838;
+  }  if (!yy_Nonspacechar(G)) goto l833;
+  l834:;	
+  {  int yypos835= G->pos, yythunkpos835= G->thunkpos;
+  {  int yypos839= G->pos, yythunkpos839= G->thunkpos;  if (!yymatchChar(G, '(')) goto l839;  goto l835;
+  l839:;	  G->pos= yypos839; G->thunkpos= yythunkpos839;
+  }
+  {  int yypos840= G->pos, yythunkpos840= G->thunkpos;  if (!yymatchChar(G, ')')) goto l840;  goto l835;
+  l840:;	  G->pos= yypos840; G->thunkpos= yythunkpos840;
+  }
+  {  int yypos841= G->pos, yythunkpos841= G->thunkpos;  if (!yymatchChar(G, '>')) goto l841;  goto l835;
+  l841:;	  G->pos= yypos841; G->thunkpos= yythunkpos841;
+  }  if (!yy_Nonspacechar(G)) goto l835;  goto l834;
+  l835:;	  G->pos= yypos835; G->thunkpos= yythunkpos835;
+  }  goto l832;
+  l833:;	  G->pos= yypos832; G->thunkpos= yythunkpos832;  if (!yymatchChar(G, '(')) goto l831;  if (!yy_SourceContents(G)) goto l831;  if (!yymatchChar(G, ')')) goto l831;
+  }
+  l832:;	  goto l830;
+  l831:;	  G->pos= yypos831; G->thunkpos= yythunkpos831;
+  }  yyText(G, G->begin, G->end);  if (!( scan_stop(MEMO_SOURCE_CONTENTS) )) goto l829;  goto l827;
+  l829:;	  G->pos= yypos827; G->thunkpos= yythunkpos827;  yyText(G, G->begin, G->end);  if (!( scan_fail() )) goto l826;
+  }
+  l827:;	
+  yyprintf((stderr, "  ok   %s @ %s\n", "SourceContents", G->buf+G->pos));
+  return 1;
+  l826:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "SourceContents", G->buf+G->pos));
+  return 0;
+}
+YY_RULE(int) yy_Source(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;
+  yyprintf((stderr, "%s\n", "Source"));
+  {  int yypos824= G->pos, yythunkpos824= G->thunkpos;  if (!yymatchChar(G, '<')) goto l825;  yyText(G, G->begin, G->end);  if (!(YY_BEGIN)) goto l825;  if (!yy_SourceContents(G)) goto l825;  yyText(G, G->begin, G->end);  if (!(YY_END)) goto l825;  if (!yymatchChar(G, '>')) goto l825;  goto l824;
+  l825:;	  G->pos= yypos824; G->thunkpos= yythunkpos824;  yyText(G, G->begin, G->end);  if (!(YY_BEGIN)) goto l823;  if (!yy_SourceContents(G)) goto l823;  yyText(G, G->begin, G->end);  if (!(YY_END)) goto l823;
+  }
+  l824:;	  yyDo(G, yy_1_Source, G->begin, G->end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "Source", G->buf+G->pos));
+  return 1;
+  l823:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "Source", G->buf+G->pos));
+  return 0;
+}
+YY_RULE(int) yy_ExplicitLink(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyDo(G, yyPush, 3, 0);
+  yyprintf((stderr, "%s\n", "ExplicitLink"));  if (!yy_Label(G)) goto l822;  yyDo(G, yySet, -1, 0);  if (!yy_Spnl(G)) goto l822;  if (!yymatchChar(G, '(')) goto l822;  if (!yy_Sp(G)) goto l822;  if (!yy_Source(G)) goto l822;  yyDo(G, yySet, -2, 0);  if (!yy_Spnl(G)) goto l822;  if (!yy_Title(G)) goto l822;  yyDo(G, yySet, -3, 0);  if (!yy_Sp(G)) goto l822;  yyText(G, G->begin, G->end);  if (!(YY_BEGIN)) goto l822;  if (!yymatchChar(G, ')')) goto l822;  yyText(G, G->begin, G->end);  if (!(YY_END)) goto l822;  yyDo(G, yy_1_ExplicitLink, G->begin, G->end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "ExplicitLink", G->buf+G->pos));  yyDo(G, yyPop, 3, 0);
+  return 1;
+  l822:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "ExplicitLink", G->buf+G->pos));
+  return 0;
+}
+YY_RULE(int) yy_Variable(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;
+  yyprintf((stderr, "%s\n", "Variable"));  if (!yymatchString(G, "[%")) goto l815;  yyText(G, G->begin, G->end);  if (!(YY_BEGIN)) goto l815;
+  {  int yypos818= G->pos, yythunkpos818= G->thunkpos;  if (!yy_Newline(G)) goto l818;  goto l815;
+  l818:;	  G->pos= yypos818; G->thunkpos= yythunkpos818;
+  }
+  {  int yypos819= G->pos, yythunkpos819= G->thunkpos;  if (!yymatchChar(G, ']')) goto l819;  goto l815;
+  l819:;	  G->pos= yypos819; G->thunkpos= yythunkpos819;
+  }  if (!yymatchDot(G)) goto l815;
+  l816:;	
+  {  int yypos817= G->pos, yythunkpos817= G->thunkpos;
+  {  int yypos820= G->pos, yythunkpos820= G->thunkpos;  if (!yy_Newline(G)) goto l820;  goto l817;
+  l820:;	  G->pos= yypos820; G->thunkpos= yythunkpos820;
+  }
+  {  int yypos821= G->pos, yythunkpos821= G->thunkpos;  if (!yymatchChar(G, ']')) goto l821;  goto l817;
+  l821:;	  G->pos= yypos821; G->thunkpos= yythunkpos821;
+  }  if (!yymatchDot(G)) goto l817;  goto l816;
+  l817:;	  G->pos= yypos817; G->thunkpos= yythunkpos817;
+  }  yyText(G, G->begin, G->end);  if (!(YY_END)) goto l815;  if (!yymatchChar(G, ']')) goto l815;  yyDo(G, yy_1_Variable, G->begin, G->end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "Variable", G->buf+G->pos));
+  return 1;
+  l815:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "Variable", G->buf+G->pos));
+  return 0;
+}
+YY_RULE(int) yy_RawCitationReference(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;
+  yyprintf((stderr, "%s\n", "RawCitationReference"));  if (!yymatchString(G, "[#")) goto l808;  yyText(G, G->begin, G->end);  if (!(YY_BEGIN)) goto l808;
+  {  int yypos811= G->pos, yythunkpos811= G->thunkpos;  if (!yy_Newline(G)) goto l811;  goto l808;
+  l811:;	  G->pos= yypos811; G->thunkpos= yythunkpos811;
+  }
+  {  int yypos812= G->pos, yythunkpos812= G->thunkpos;  if (!yymatchChar(G, ']')) goto l812;  goto l808;
+  l812:;	  G->pos= yypos812; G->thunkpos= yythunkpos812;
+  }  if (!yymatchDot(G)) goto l808;
+  l809:;	
+  {  int yypos810= G->pos, yythunkpos810= G->thunkpos;
+  {  int yypos813= G->pos, yythunkpos813= G->thunkpos;  if (!yy_Newline(G)) goto l813;  goto l810;
+  l813:;	  G->pos= yypos813; G->thunkpos= yythunkpos813;
+  }
+  {  int yypos814= G->pos, yythunkpos814= G->thunkpos;  if (!yymatchChar(G, ']')) goto l814;  goto l810;
+  l814:;	  G->pos= yypos814; G->thunkpos= yythunkpos814;
+  }  if (!yymatchDot(G)) goto l810;  goto l809;
+  l810:;	  G->pos= yypos810; G->thunkpos= yythunkpos810;
+  }  yyText(G, G->begin, G->end);  if (!(YY_END)) goto l808;  if (!yymatchChar(G, ']')) goto l808;  yyDo(G, yy_1_RawCitationReference, G->begin, G->end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "RawCitationReference", G->buf+G->pos));
+  return 1;
+  l808:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "RawCitationReference", G->buf+G->pos));
+  return 0;
+}
+YY_RULE(int) yy_CitationReferenceSingle(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyDo(G, yyPush, 1, 0);
+  yyprintf((stderr, "%s\n", "CitationReferenceSingle"));  yyText(G, G->begin, G->end);  if (!(YY_BEGIN)) goto l803;
+  {  int yypos804= G->pos, yythunkpos804= G->thunkpos;  if (!yymatchString(G, "[]")) goto l805;  if (!yy_Spnl(G)) goto l805;  if (!yy_RawCitationReference(G)) goto l805;  yyDo(G, yySet, -1, 0);  goto l804;
+  l805:;	  G->pos= yypos804; G->thunkpos= yythunkpos804;  if (!yy_RawCitationReference(G)) goto l803;  yyDo(G, yySet, -1, 0);
+  {  int yypos806= G->pos, yythunkpos806= G->thunkpos;  if (!yy_Spnl(G)) goto l806;  if (!yymatchString(G, "[]")) goto l806;  goto l807;
+  l806:;	  G->pos= yypos806; G->thunkpos= yythunkpos806;
+  }
+  l807:;	
+  }
+  l804:;	  yyText(G, G->begin, G->end);  if (!(YY_END)) goto l803;  yyDo(G, yy_1_CitationReferenceSingle, G->begin, G->end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "CitationReferenceSingle", G->buf+G->pos));  yyDo(G, yyPop, 1, 0);
+  return 1;
+  l803:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "CitationReferenceSingle", G->buf+G->pos));
+  return 0;
+}
+YY_RULE(int) yy_CitationReferenceDouble(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyDo(G, yyPush, 2, 0);
+  yyprintf((stderr, "%s\n", "CitationReferenceDouble"));
+  {  int yypos801= G->pos, yythunkpos801= G->thunkpos;  if (!yymatchString(G, "[]")) goto l801;  goto l800;
+  l801:;	  G->pos= yypos801; G->thunkpos= yythunkpos801;
+  }  if (!yy_Label(G)) goto l800;  yyDo(G, yySet, -1, 0);  yyText(G, G->begin, G->end);  if (!(YY_BEGIN)) goto l800;  if (!yy_Spnl(G)) goto l800;  yyText(G, G->begin, G->end);  if (!(YY_END)) goto l800;
+  {  int yypos802= G->pos, yythunkpos802= G->thunkpos;  if (!yymatchString(G, "[]")) goto l802;  goto l800;
+  l802:;	  G->pos= yypos802; G->thunkpos= yythunkpos802;
+  }  if (!yy_RawCitationReference(G)) goto l800;  yyDo(G, yySet, -2, 0);  yyDo(G, yy_1_CitationReferenceDouble, G->begin, G->end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "CitationReferenceDouble", G->buf+G->pos));  yyDo(G, yyPop, 2, 0);
+  return 1;
+  l800:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "CitationReferenceDouble", G->buf+G->pos));
+  return 0;
+}
+YY_RULE(int) yy_CitationReference(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;
+  yyprintf((stderr, "%s\n", "CitationReference"));
+  {  int yypos798= G->pos, yythunkpos798= G->thunkpos;  if (!yy_CitationReferenceDouble(G)) goto l799;  goto l798;
+  l799:;	  G->pos= yypos798; G->thunkpos= yythunkpos798;  if (!yy_CitationReferenceSingle(G)) goto l797;
+  }
+  l798:;	
+  yyprintf((stderr, "  ok   %s @ %s\n", "CitationReference", G->buf+G->pos));
+  return 1;
+  l797:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "CitationReference", G->buf+G->pos));
+  return 0;
+}
+YY_RULE(int) yy_ReferenceLinkSingle(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyDo(G, yyPush, 1, 0);
+  yyprintf((stderr, "%s\n", "ReferenceLinkSingle"));  if (!yy_Label(G)) goto l794;  yyDo(G, yySet, -1, 0);  yyText(G, G->begin, G->end);  if (!(YY_BEGIN)) goto l794;
+  {  int yypos795= G->pos, yythunkpos795= G->thunkpos;  if (!yy_Spnl(G)) goto l795;  if (!yymatchString(G, "[]")) goto l795;  goto l796;
+  l795:;	  G->pos= yypos795; G->thunkpos= yythunkpos795;
+  }
+  l796:;	  yyText(G, G->begin, G->end);  if (!(YY_END)) goto l794;  yyDo(G, yy_1_ReferenceLinkSingle, G->begin, G->end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "ReferenceLinkSingle", G->buf+G->pos));  yyDo(G, yyPop, 1, 0);
+  return 1;
+  l794:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "ReferenceLinkSingle", G->buf+G->pos));
+  return 0;
+}
+YY_RULE(int) yy_ReferenceLinkDouble(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyDo(G, yyPush, 2, 0);
+  yyprintf((stderr, "%s\n", "ReferenceLinkDouble"));  if (!yy_Label(G)) goto l792;  yyDo(G, yySet, -1, 0);  yyText(G, G->begin, G->end);  if (!(YY_BEGIN)) goto l792;  if (!yy_Spnl(G)) goto l792;  yyText(G, G->begin, G->end);  if (!(YY_END)) goto l792;
+  {  int yypos793= G->pos, yythunkpos793= G->thunkpos;  if (!yymatchString(G, "[]")) goto l793;  goto l792;
+  l793:;	  G->pos= yypos793; G->thunkpos= yythunkpos793;
+  }  if (!yy_Label(G)) goto l792;  yyDo(G, yySet, -2, 0);  yyDo(G, yy_1_ReferenceLinkDouble, G->begin, G->end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "ReferenceLinkDouble", G->buf+G->pos));  yyDo(G, yyPop, 2, 0);
+  return 1;
+  l792:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "ReferenceLinkDouble", G->buf+G->pos));
+  return 0;
+}
+YY_RULE(int) yy_ReferenceLink(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;
+  yyprintf((stderr, "%s\n", "ReferenceLink"));
+  {  int yypos790= G->pos, yythunkpos790= G->thunkpos;  if (!yy_ReferenceLinkDouble(G)) goto l791;  goto l790;
+  l791:;	  G->pos= yypos790; G->thunkpos= yythunkpos790;  if (!yy_ReferenceLinkSingle(G)) goto l789;
+  }
+  l790:;	
+  yyprintf((stderr, "  ok   %s @ %s\n", "ReferenceLink", G->buf+G->pos));
+  return 1;
+  l789:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "ReferenceLink", G->buf+G->pos));
+  return 0;
+}
+YY_RULE(int) yy_Link(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;
+  yyprintf((stderr, "%s\n", "Link"));
+  {  int yypos784= G->pos, yythunkpos784= G->thunkpos;  yyText(G, G->begin, G->end);  if (!( memo_ok(MEMO_LINK) )) goto l785;
+  {  int yypos786= G->pos, yythunkpos786= G->thunkpos;  if (!yy_ExplicitLink(G)) goto l787;  goto l786;
+  l787:;	  G->pos= yypos786; G->thunkpos= yythunkpos786;  if (!yy_ReferenceLink(G)) goto l788;  goto l786;
+  l788:;	  G->pos= yypos786; G->thunkpos= yythunkpos786;  if (!yy_AutoLink(G)) goto l785;
+  }
+  l786:;	  goto l784;
+  l785:;	  G->pos= yypos784; G->thunkpos= yythunkpos784;  yyText(G, G->begin, G->end);  if (!( memo_fail(MEMO_LINK) )) goto l783;
+  }
+  l784:;	
+  yyprintf((stderr, "  ok   %s @ %s\n", "Link", G->buf+G->pos));
+  return 1;
+  l783:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "Link", G->buf+G->pos));
+  return 0;
+}
+YY_RULE(int) yy_PossibleEmphStrongUl(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;
+  yyprintf((stderr, "%s\n", "PossibleEmphStrongUl"));  if (!yymatchString(G, "__")) goto l770;
+  {  int yypos773= G->pos, yythunkpos773= G->thunkpos;  if (!yymatchChar(G, '\012')) goto l773;  goto l770;
+  l773:;	  G->pos= yypos773; G->thunkpos= yythunkpos773;
+  }
+  {  int yypos774= G->pos, yythunkpos774= G->thunkpos;  if (!yymatchChar(G, '_')) goto l774;  goto l770;
+  l774:;	  G->pos= yypos774; G->thunkpos= yythunkpos774;
+  }  if (!yymatchDot(G)) goto l770;
+  l771:;	
+  {  int yypos772= G->pos, yythunkpos772= G->thunkpos;
+  {  int yypos775= G->pos, yythunkpos775= G->thunkpos;  if (!yymatchChar(G, '\012')) goto l775;  goto l772;
+  l775:;	  G->pos= yypos775; G->thunkpos= yythunkpos775;
+  }
+  {  int yypos776= G->pos, yythunkpos776= G->thunkpos;  if (!yymatchChar(G, '_')) goto l776;  goto l772;
+  l776:;	  G->pos= yypos776; G->thunkpos= yythunkpos776;
+  }  if (!yymatchDot(G)) goto l772;  goto l771;
+  l772:;	  G->pos= yypos772; G->thunkpos= yythunkpos772;
+  }  if (!yymatchString(G, "__")) goto l770;
+  {  int yypos779= G->pos, yythunkpos779= G->thunkpos;  if (!yymatchChar(G, '\012')) goto l779;  goto l770;
+  l779:;	  G->pos= yypos779; G->thunkpos= yythunkpos779;
+  }
+  {  int yypos780= G->pos, yythunkpos780= G->thunkpos;  if (!yymatchChar(G, '_')) goto l780;  goto l770;
+  l780:;	  G->pos= yypos780; G->thunkpos= yythunkpos780;
+  }  if (!yymatchDot(G)) goto l770;
+  l777:;	
+  {  int yypos778= G->pos, yythunkpos778= G->thunkpos;
+  {  int yypos781= G->pos, yythunkpos781= G->thunkpos;  if (!yymatchChar(G, '\012')) goto l781;  goto l778;
+  l781:;	  G->pos= yypos781; G->thunkpos= yythunkpos781;
+  }
+  {  int yypos782= G->pos, yythunkpos782= G->thunkpos;  if (!yymatchChar(G, '_')) goto l782;  goto l778;
+  l782:;	  G->pos= yypos782; G->thunkpos= yythunkpos782;
+  }  if (!yymatchDot(G)) goto l778;  goto l777;
+  l778:;	  G->pos= yypos778; G->thunkpos= yythunkpos778;
+  }  if (!yymatchChar(G, '_')) goto l770;
+  yyprintf((stderr, "  ok   %s @ %s\n", "PossibleEmphStrongUl", G->buf+G->pos));
+  return 1;
+  l770:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "PossibleEmphStrongUl", G->buf+G->pos));
+  return 0;
+}
+YY_RULE(int) yy_EmphAndStrongUl(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyDo(G, yyPush, 2, 0);
+  yyprintf((stderr, "%s\n", "EmphAndStrongUl"));  if (!yymatchChar(G, '_')) goto l762;
+  {  int yypos763= G->pos, yythunkpos763= G->thunkpos;  if (!yy_PossibleEmphStrongUl(G)) goto l762;  G->pos= yypos763; G->thunkpos= yythunkpos763;
+  }  if (!yy_StartList(G)) goto l762;  yyDo(G, yySet, -1, 0);
+  {  int yypos766= G->pos, yythunkpos766= G->thunkpos;  if (!yymatchChar(G, '_')) goto l766;
+  {  int yypos767= G->pos, yythunkpos767= G->thunkpos;  if (!yymatchChar(G, '_')) goto l767;  goto l766;
+  l767:;	  G->pos= yypos767; G->thunkpos= yythunkpos767;
+  }  goto l762;
+  l766:;	  G->pos= yypos766; G->thunkpos= yythunkpos766;
+  }  if (!yy_InlineNoEmph(G)) goto l762;  yyDo(G, yySet, -2, 0);  yyDo(G, yy_1_EmphAndStrongUl, G->begin, G->end);
+  l764:;	
+  {  int yypos765= G->pos, yythunkpos765= G->thunkpos;
+  {  int yypos768= G->pos, yythunkpos768= G->thunkpos;  if (!yymatchChar(G, '_')) goto l768;
+  {  int yypos769= G->pos, yythunkpos769= G->thunkpos;  if (!yymatchChar(G, '_')) goto l769;  goto l768;
+  l769:;	  G->pos= yypos769; G->thunkpos= yythunkpos769;
+  }  goto l765;
+  l768:;	  G->pos= yypos768; G->thunkpos= yythunkpos768;
+  }  if (!yy_InlineNoEmph(G)) goto l765;  yyDo(G, yySet, -2, 0);  yyDo(G, yy_1_EmphAndStrongUl, G->begin, G->end);  goto l764;
+  l765:;	  G->pos= yypos765; G->thunkpos= yythunkpos765;
+  }  yyText(G, G->begin, G->end);  if (!(YY_BEGIN)) goto l762;  if (!yymatchChar(G, '_')) goto l762;  yyText(G, G->begin, G->end);  if (!(YY_END)) goto l762;  yyDo(G, yy_2_EmphAndStrongUl, G->begin, G->end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "EmphAndStrongUl", G->buf+G->pos));  yyDo(G, yyPop, 2, 0);
+  return 1;
+  l762:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "EmphAndStrongUl", G->buf+G->pos));
+  return 0;
+}
+YY_RULE(int) yy_PossibleEmphStrongStar(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;
+  yyprintf((stderr, "%s\n", "PossibleEmphStrongStar"));  if (!yymatchString(G, "**")) goto l749;
+  {  int yypos752= G->pos, yythunkpos752= G->thunkpos;  if (!yymatchChar(G, '\012')) goto l752;  goto l749;
+  l752:;	  G->pos= yypos752; G->thunkpos= yythunkpos752;
+  }
+  {  int yypos753= G->pos, yythunkpos753= G->thunkpos;  if (!yymatchChar(G, '*')) goto l753;  goto l749;
+  l753:;	  G->pos= yypos753; G->thunkpos= yythunkpos753;
+  }  if (!yymatchDot(G)) goto l749;
+  l750:;	
+  {  int yypos751= G->pos, yythunkpos751= G->thunkpos;
+  {  int yypos754= G->pos, yythunkpos754= G->thunkpos;  if (!yymatchChar(G, '\012')) goto l754;  goto l751;
+  l754:;	  G->pos= yypos754; G->thunkpos= yythunkpos754;
+  }
+  {  int yypos755= G->pos, yythunkpos755= G->thunkpos;  if (!yymatchChar(G, '*')) goto l755;  goto l751;
+  l755:;	  G->pos= yypos755; G->thunkpos= yythunkpos755;
+  }  if (!yymatchDot(G)) goto l751;  goto l750;
+  l751:;	  G->pos= yypos751; G->thunkpos= yythunkpos751;
+  }  if (!yymatchString(G, "**")) goto l749;
+  {  int yypos758= G->pos, yythunkpos758= G->thunkpos;  if (!yymatchChar(G, '\012')) goto l758;  goto l749;
+  l758:;	  G->pos= yypos758; G->thunkpos= yythunkpos758;
+  }
+  {  int yypos759= G->pos, yythunkpos759= G->thunkpos;  if (!yymatchChar(G, '*')) goto l759;  goto l749;
+  l759:;	  G->pos= yypos759; G->thunkpos= yythunkpos759;
+  }  if (!yymatchDot(G)) goto l749;
+  l756:;	
+  {  int yypos757= G->pos, yythunkpos757= G->thunkpos;
+  {  int yypos760= G->pos, yythunkpos760= G->thunkpos;  if (!yymatchChar(G, '\012')) goto l760;  goto l757;
+  l760:;	  G->pos= yypos760; G->thunkpos= yythunkpos760;
+  }
+  {  int yypos761= G->pos, yythunkpos761= G->thunkpos;  if (!yymatchChar(G, '*')) goto l761;  goto l757;
+  l761:;	  G->pos= yypos761; G->thunkpos= yythunkpos761;
+  }  if (!yymatchDot(G)) goto l757;  goto l756;
+  l757:;	  G->pos= yypos757; G->thunkpos= yythunkpos757;
+  }  if (!yymatchChar(G, '*')) goto l749;
+  yyprintf((stderr, "  ok   %s @ %s\n", "PossibleEmphStrongStar", G->buf+G->pos));
+  return 1;
+  l749:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "PossibleEmphStrongStar", G->buf+G->pos));
+  return 0;
+}
+YY_RULE(int) yy_EmphAndStrongStar(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyDo(G, yyPush, 2, 0);
+  yyprintf((stderr, "%s\n", "EmphAndStrongStar"));  if (!yymatchChar(G, '*')) goto l741;
+  {  int yypos742= G->pos, yythunkpos742= G->thunkpos;  if (!yy_PossibleEmphStrongStar(G)) goto l741;  G->pos= yypos742; G->thunkpos= yythunkpos742;
+  }  if (!yy_StartList(G)) goto l741;  yyDo(G, yySet, -1, 0);
+  {  int yypos745= G->pos, yythunkpos745= G->thunkpos;  if (!yymatchChar(G, '*')) goto l745;
+  {  int yypos746= G->pos, yythunkpos746= G->thunkpos;  if (!yymatchChar(G, '*')) goto l746;  goto l745;
+  l746:;	  G->pos= yypos746; G->thunkpos= yythunkpos746;
+  }  goto l741;
+  l745:;	  G->pos= yypos745; G->thunkpos= yythunkpos745;
+  }  if (!yy_InlineNoEmph(G)) goto l741;  yyDo(G, yySet, -2, 0);  yyDo(G, yy_1_EmphAndStrongStar, G->begin, G->end);
+  l743:;	
+  {  int yypos744= G->pos, yythunkpos744= G->thunkpos;
+  {  int yypos747= G->pos, yythunkpos747= G->thunkpos;  if (!yymatchChar(G, '*')) goto l747;
+  {  int yypos748= G->pos, yythunkpos748= G->thunkpos;  if (!yymatchChar(G, '*')) goto l748;  goto l747;
+  l748:;	  G->pos= yypos748; G->thunkpos= yythunkpos748;
+  }  goto l744;
+  l747:;	  G->pos= yypos747; G->thunkpos= yythunkpos747;
+  }  if (!yy_InlineNoEmph(G)) goto l744;  yyDo(G, yySet, -2, 0);  yyDo(G, yy_1_EmphAndStrongStar, G->begin, G->end);  goto l743;
+  l744:;	  G->pos= yypos744; G->thunkpos= yythunkpos744;
+  }  yyText(G, G->begin, G->end);  if (!(YY_BEGIN)) goto l741;  if (!yymatchChar(G, '*')) goto l741;  yyText(G, G->begin, G->end);  if (!(YY_END)) goto l741;  yyDo(G, yy_2_EmphAndStrongStar, G->begin, G->end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "EmphAndStrongStar", G->buf+G->pos));  yyDo(G, yyPop, 2, 0);
+  return 1;
+  l741:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "EmphAndStrongStar", G->buf+G->pos));
+  return 0;
+}
+YY_RULE(int) yy_StrongAndEmph(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;
+  yyprintf((stderr, "%s\n", "StrongAndEmph"));
+  {  int yypos737= G->pos, yythunkpos737= G->thunkpos;  yyText(G, G->begin, G->end);  if (!( memo_ok(MEMO_STRONG_AND_EMPH) )) goto l738;
+  {  int yypos739= G->pos, yythunkpos739= G->thunkpos;  if (!yy_EmphAndStrongStar(G)) goto l740;  goto l739;
+  l740:;	  G->pos= yypos739; G->thunkpos= yythunkpos739;  if (!yy_EmphAndStrongUl(G)) goto l738;
+  }
+  l739:;	  goto l737;
+  l738:;	  G->pos= yypos737; G->thunkpos= yythunkpos737;  yyText(G, G->begin, G->end);  if (!( memo_fail(MEMO_STRONG_AND_EMPH) )) goto l736;
+  }
+  l737:;	
+  yyprintf((stderr, "  ok   %s @ %s\n", "StrongAndEmph", G->buf+G->pos));
+  return 1;
+  l736:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "StrongAndEmph", G->buf+G->pos));
+  return 0;
+}
+YY_RULE(int) yy_StrongUl(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;
+  yyprintf((stderr, "%s\n", "StrongUl"));  if (!yymatchString(G, "__")) goto l719;
+  {  int yypos720= G->pos, yythunkpos720= G->thunkpos;  if (!yy_Whitespace(G)) goto l720;  goto l719;
+  l720:;	  G->pos= yypos720; G->thunkpos= yythunkpos720;
+  }
+  {  int yypos721= G->pos, yythunkpos721= G->thunkpos;  yyText(G, G->begin, G->end);  if (!( scan_skip(MEMO_STRONG_UL) )) goto l722;  goto l721;
+  l722:;	  G->pos= yypos721; G->thunkpos= yythunkpos721;  yyText(G, G->begin, G->end);  if (!( scan_start() )) goto l723;  yyText(G, G->begin, G->end);  if (!( scan_passed(MEMO_STRONG_UL) )) goto l723;
+  {  int yypos726= G->pos, yythunkpos726= G->thunkpos;  if (!yy_EmphMatch(G)) goto l727;  goto l726;
+  l727:;	  G->pos= yypos726; G->thunkpos= yythunkpos726;  if (!yy_BracketedText(G)) goto l728;  goto l726;
+  l728:;	  G->pos= yypos726; G->thunkpos= yythunkpos726;
+  {  int yypos729= G->pos, yythunkpos729= G->thunkpos;  if (!yymatchString(G, "__")) goto l729;  goto l723;
+  l729:;	  G->pos= yypos729; G->thunkpos= yythunkpos729;
+  }
+  {  int yypos730= G->pos, yythunkpos730= G->thunkpos;  if (!yy_BlankLine(G)) goto l730;  goto l723;
+  l730:;	  G->pos= yypos730; G->thunkpos= yythunkpos730;
+  }  if (!yymatchDot(G)) goto l723;
+  }
+  l726:;	
+  l724:;	
+  {  int yypos725= G->pos, yythunkpos725= G->thunkpos;  yyText(G, G->begin, G->end);  if (!( scan_passed(MEMO_STRONG_UL) )) goto l725;
+  {  int yypos731= G->pos, yythunkpos731= G->thunkpos;  if (!yy_EmphMatch(G)) goto l732;  goto l731;
+  l732:;	  G->pos= yypos731; G->thunkpos= yythunkpos731;  if (!yy_BracketedText(G)) goto l733;  goto l731;
+  l733:;	  G->pos= yypos731; G->thunkpos= yythunkpos731;
+  {  int yypos734= G->pos, yythunkpos734= G->thunkpos;  if (!yymatchString(G, "__")) goto l734;  goto l725;
+  l734:;	  G->pos= yypos734; G->thunkpos= yythunkpos734;
+  }
+  {  int yypos735= G->pos, yythunkpos735= G->thunkpos;  if (!yy_BlankLine(G)) goto l735;  goto l725;
+  l735:;	  G->pos= yypos735; G->thunkpos= yythunkpos735;
+  }  if (!yymatchDot(G)) goto l725;
+  }
+  l731:;	  goto l724;
+  l725:;	  G->pos= yypos725; G->thunkpos= yythunkpos725;
+  }  yyText(G, G->begin, G->end);  if (!( scan_stop(MEMO_STRONG_UL) )) goto l723;  goto l721;
+  l723:;	  G->pos= yypos721; G->thunkpos= yythunkpos721;  yyText(G, G->begin, G->end);  if (!( scan_fail() )) goto l719;
+  }
+  l721:;	  if (!yymatchString(G, "__")) goto l719;
+  yyprintf((stderr, "  ok   %s @ %s\n", "StrongUl", G->buf+G->pos));
+  return 1;
+  l719:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "StrongUl", G->buf+G->pos));
+  return 0;
+}
+YY_RULE(int) yy_StrongStar(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;
+  yyprintf((stderr, "%s\n", "StrongStar"));  if (!yymatchString(G, "**")) goto l702;
+  {  int yypos703= G->pos, yythunkpos703= G->thunkpos;  if (!yy_Whitespace(G)) goto l703;  goto l702;
+  l703:;	  G->pos= yypos703; G->thunkpos= yythunkpos703;
+  }
+  {  int yypos704= G->pos, yythunkpos704= G->thunkpos;  yyText(G, G->begin, G->end);  if (!( scan_skip(MEMO_STRONG_STAR) )) goto l705;  goto l704;
+  l705:;	  G->pos= yypos704; G->thunkpos= yythunkpos704;  yyText(G, G->begin, G->end);  if (!( scan_start() )) goto l706;  yyText(G, G->begin, G->end);  if (!( scan_passed(MEMO_STRONG_STAR) )) goto l706;
+  {  int yypos709= G->pos, yythunkpos709= G->thunkpos;  if (!yy_EmphMatch(G)) goto l710;  goto l709;
+  l710:;	  G->pos= yypos709; G->thunkpos= yythunkpos709;  if (!yy_BracketedText(G)) goto l711;  goto l709;
+  l711:;	  G->pos= yypos709; G->thunkpos= yythunkpos709;
+  {  int yypos712= G->pos, yythunkpos712= G->thunkpos;  if (!yymatchString(G, "**")) goto l712;  goto l706;
+  l712:;	  G->pos= yypos712; G->thunkpos= yythunkpos712;
+  }
+  {  int yypos713= G->pos, yythunkpos713= G->thunkpos;  if (!yy_BlankLine(G)) goto l713;  goto l706;
+  l713:;	  G->pos= yypos713; G->thunkpos= yythunkpos713;
+  }  if (!yymatchDot(G)) goto l706;
+  }
+  l709:;	
+  l707:;	
+  {  int yypos708= G->pos, yythunkpos708= G->thunkpos;  yyText(G, G->begin, G->end);  if (!( scan_passed(MEMO_STRONG_STAR) )) goto l708;
+  {  int yypos714= G->pos, yythunkpos714= G->thunkpos;  if (!yy_EmphMatch(G)) goto l715;  goto l714;
+  l715:;	  G->pos= yypos714; G->thunkpos= yythunkpos714;  if (!yy_BracketedText(G)) goto l716;  goto l714;
+  l716:;	  G->pos= yypos714; G->thunkpos= yythunkpos714;
+  {  int yypos717= G->pos, yythunkpos717= G->thunkpos;  if (!yymatchString(G, "**")) goto l717;  goto l708;
+  l717:;	  G->pos= yypos717; G->thunkpos= yythunkpos717;
+  }
+  {  int yypos718= G->pos, yythunkpos718= G->thunkpos;  if (!yy_BlankLine(G)) goto l718;  goto l708;
+  l718:;	  G->pos= yypos718; G->thunkpos= yythunkpos718;
+  }  if (!yymatchDot(G)) goto l708;
+  }
+  l714:;	  goto l707;
+  l708:;	  G->pos= yypos708; G->thunkpos= yythunkpos708;
+  }  yyText(G, G->begin, G->end);  if (!( scan_stop(MEMO_STRONG_STAR) )) goto l706;  goto l704;
+  l706:;	  G->pos= yypos704; G->thunkpos= yythunkpos704;  yyText(G, G->begin, G->end);  if (!( scan_fail() )) goto l702;
+  }
+  l704:;	  if (!yymatchString(G, "**")) goto l702;
+  yyprintf((stderr, "  ok   %s @ %s\n", "StrongStar", G->buf+G->pos));
+  return 1;
+  l702:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "StrongStar", G->buf+G->pos));
+  return 0;
+}
+YY_RULE(int) yy_StrongMatch(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;
+  yyprintf((stderr, "%s\n", "StrongMatch"));
+  {  int yypos698= G->pos, yythunkpos698= G->thunkpos;  yyText(G, G->begin, G->end);  if (!( burn_fuel() && memo_ok(MEMO_STRONG_MATCH) )) goto l699;  yyText(G, G->begin, G->end);  if (!( !ext(EXT_NO_STRONG) )) goto l699;
+  {  int yypos700= G->pos, yythunkpos700= G->thunkpos;  if (!yy_StrongStar(G)) goto l701;  goto l700;
+  l701:;	  G->pos= yypos700; G->thunkpos= yythunkpos700;  if (!yy_StrongUl(G)) goto l699;
+  }
+  l700:;	  goto l698;
+  l699:;	  G->pos= yypos698; G->thunkpos= yythunkpos698;  yyText(G, G->begin, G->end);  if (!( memo_fail(MEMO_STRONG_MATCH) )) goto l697;
+  }
+  l698:;	
+  yyprintf((stderr, "  ok   %s @ %s\n", "StrongMatch", G->buf+G->pos));
+  return 1;
+  l697:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "StrongMatch", G->buf+G->pos));
+  return 0;
+}
+YY_RULE(int) yy_Strong(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;
+  yyprintf((stderr, "%s\n", "Strong"));
+  {  int yypos695= G->pos, yythunkpos695= G->thunkpos;  yyText(G, G->begin, G->end);  if (!( memo_ok(MEMO_STRONG) )) goto l696;  yyText(G, G->begin, G->end);  if (!(YY_BEGIN)) goto l696;  if (!yy_StrongMatch(G)) goto l696;  yyText(G, G->begin, G->end);  if (!(YY_END)) goto l696;  yyDo(G, yy_1_Strong, G->begin, G->end);  goto l695;
+  l696:;	  G->pos= yypos695; G->thunkpos= yythunkpos695;  yyText(G, G->begin, G->end);  if (!( memo_fail(MEMO_STRONG) )) goto l694;
+  }
+  l695:;	
+  yyprintf((stderr, "  ok   %s @ %s\n", "Strong", G->buf+G->pos));
+  return 1;
+  l694:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "Strong", G->buf+G->pos));
+  return 0;
+}
+YY_RULE(int) yy_EmphUl(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;
+  yyprintf((stderr, "%s\n", "EmphUl"));  if (!yymatchChar(G, '_')) goto l677;
+  {  int yypos678= G->pos, yythunkpos678= G->thunkpos;  if (!yy_Whitespace(G)) goto l678;  goto l677;
+  l678:;	  G->pos= yypos678; G->thunkpos= yythunkpos678;
+  }
+  {  int yypos679= G->pos, yythunkpos679= G->thunkpos;  yyText(G, G->begin, G->end);  if (!( scan_skip(MEMO_EMPH_UL) )) goto l680;  goto l679;
+  l680:;	  G->pos= yypos679; G->thunkpos= yythunkpos679;  yyText(G, G->begin, G->end);  if (!( scan_start() )) goto l681;  yyText(G, G->begin, G->end);  if (!( scan_passed(MEMO_EMPH_UL) )) goto l681;
+  {  int yypos684= G->pos, yythunkpos684= G->thunkpos;  if (!yy_StrongMatch(G)) goto l685;  goto l684;
+  l685:;	  G->pos= yypos684; G->thunkpos= yythunkpos684;  if (!yy_BracketedText(G)) goto l686;  goto l684;
+  l686:;	  G->pos= yypos684; G->thunkpos= yythunkpos684;
+  {  int yypos687= G->pos, yythunkpos687= G->thunkpos;  if (!yymatchChar(G, '_')) goto l687;  goto l681;
+  l687:;	  G->pos= yypos687; G->thunkpos= yythunkpos687;
+  }
+  {  int yypos688= G->pos, yythunkpos688= G->thunkpos;  if (!yy_BlankLine(G)) goto l688;  goto l681;
+  l688:;	  G->pos= yypos688; G->thunkpos= yythunkpos688;
+  }  if (!yymatchDot(G)) goto l681;
+  }
+  l684:;	
+  l682:;	
+  {  int yypos683= G->pos, yythunkpos683= G->thunkpos;  yyText(G, G->begin, G->end);  if (!( scan_passed(MEMO_EMPH_UL) )) goto l683;
+  {  int yypos689= G->pos, yythunkpos689= G->thunkpos;  if (!yy_StrongMatch(G)) goto l690;  goto l689;
+  l690:;	  G->pos= yypos689; G->thunkpos= yythunkpos689;  if (!yy_BracketedText(G)) goto l691;  goto l689;
+  l691:;	  G->pos= yypos689; G->thunkpos= yythunkpos689;
+  {  int yypos692= G->pos, yythunkpos692= G->thunkpos;  if (!yymatchChar(G, '_')) goto l692;  goto l683;
+  l692:;	  G->pos= yypos692; G->thunkpos= yythunkpos692;
+  }
+  {  int yypos693= G->pos, yythunkpos693= G->thunkpos;  if (!yy_BlankLine(G)) goto l693;  goto l683;
+  l693:;	  G->pos= yypos693; G->thunkpos= yythunkpos693;
+  }  if (!yymatchDot(G)) goto l683;
+  }
+  l689:;	  goto l682;
+  l683:;	  G->pos= yypos683; G->thunkpos= yythunkpos683;
+  }  yyText(G, G->begin, G->end);  if (!( scan_stop(MEMO_EMPH_UL) )) goto l681;  goto l679;
+  l681:;	  G->pos= yypos679; G->thunkpos= yythunkpos679;  yyText(G, G->begin, G->end);  if (!( scan_fail() )) goto l677;
+  }
+  l679:;	  if (!yymatchChar(G, '_')) goto l677;
+  yyprintf((stderr, "  ok   %s @ %s\n", "EmphUl", G->buf+G->pos));
+  return 1;
+  l677:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "EmphUl", G->buf+G->pos));
+  return 0;
+}
+YY_RULE(int) yy_EmphStar(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;
+  yyprintf((stderr, "%s\n", "EmphStar"));  if (!yymatchChar(G, '*')) goto l660;
+  {  int yypos661= G->pos, yythunkpos661= G->thunkpos;  if (!yy_Whitespace(G)) goto l661;  goto l660;
+  l661:;	  G->pos= yypos661; G->thunkpos= yythunkpos661;
+  }
+  {  int yypos662= G->pos, yythunkpos662= G->thunkpos;  yyText(G, G->begin, G->end);  if (!( scan_skip(MEMO_EMPH_STAR) )) goto l663;  goto l662;
+  l663:;	  G->pos= yypos662; G->thunkpos= yythunkpos662;  yyText(G, G->begin, G->end);  if (!( scan_start() )) goto l664;  yyText(G, G->begin, G->end);  if (!( scan_passed(MEMO_EMPH_STAR) )) goto l664;
+  {  int yypos667= G->pos, yythunkpos667= G->thunkpos;  if (!yy_StrongMatch(G)) goto l668;  goto l667;
+  l668:;	  G->pos= yypos667; G->thunkpos= yythunkpos667;  if (!yy_BracketedText(G)) goto l669;  goto l667;
+  l669:;	  G->pos= yypos667; G->thunkpos= yythunkpos667;
+  {  int yypos670= G->pos, yythunkpos670= G->thunkpos;  if (!yymatchChar(G, '*')) goto l670;  goto l664;
+  l670:;	  G->pos= yypos670; G->thunkpos= yythunkpos670;
+  }
+  {  int yypos671= G->pos, yythunkpos671= G->thunkpos;  if (!yy_BlankLine(G)) goto l671;  goto l664;
+  l671:;	  G->pos= yypos671; G->thunkpos= yythunkpos671;
+  }  if (!yymatchDot(G)) goto l664;
+  }
+  l667:;	
+  l665:;	
+  {  int yypos666= G->pos, yythunkpos666= G->thunkpos;  yyText(G, G->begin, G->end);  if (!( scan_passed(MEMO_EMPH_STAR) )) goto l666;
+  {  int yypos672= G->pos, yythunkpos672= G->thunkpos;  if (!yy_StrongMatch(G)) goto l673;  goto l672;
+  l673:;	  G->pos= yypos672; G->thunkpos= yythunkpos672;  if (!yy_BracketedText(G)) goto l674;  goto l672;
+  l674:;	  G->pos= yypos672; G->thunkpos= yythunkpos672;
+  {  int yypos675= G->pos, yythunkpos675= G->thunkpos;  if (!yymatchChar(G, '*')) goto l675;  goto l666;
+  l675:;	  G->pos= yypos675; G->thunkpos= yythunkpos675;
+  }
+  {  int yypos676= G->pos, yythunkpos676= G->thunkpos;  if (!yy_BlankLine(G)) goto l676;  goto l666;
+  l676:;	  G->pos= yypos676; G->thunkpos= yythunkpos676;
+  }  if (!yymatchDot(G)) goto l666;
+  }
+  l672:;	  goto l665;
+  l666:;	  G->pos= yypos666; G->thunkpos= yythunkpos666;
+  }  yyText(G, G->begin, G->end);  if (!( scan_stop(MEMO_EMPH_STAR) )) goto l664;  goto l662;
+  l664:;	  G->pos= yypos662; G->thunkpos= yythunkpos662;  yyText(G, G->begin, G->end);  if (!( scan_fail() )) goto l660;
+  }
+  l662:;	  if (!yymatchChar(G, '*')) goto l660;
+  yyprintf((stderr, "  ok   %s @ %s\n", "EmphStar", G->buf+G->pos));
+  return 1;
+  l660:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "EmphStar", G->buf+G->pos));
+  return 0;
+}
+YY_RULE(int) yy_EmphMatch(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;
+  yyprintf((stderr, "%s\n", "EmphMatch"));
+  {  int yypos656= G->pos, yythunkpos656= G->thunkpos;  yyText(G, G->begin, G->end);  if (!( burn_fuel() && memo_ok(MEMO_EMPH_MATCH) )) goto l657;  yyText(G, G->begin, G->end);  if (!( !ext(EXT_NO_EMPH) )) goto l657;
+  {  int yypos658= G->pos, yythunkpos658= G->thunkpos;  if (!yy_EmphStar(G)) goto l659;  goto l658;
+  l659:;	  G->pos= yypos658; G->thunkpos= yythunkpos658;  if (!yy_EmphUl(G)) goto l657;
+  }
+  l658:;	  goto l656;
+  l657:;	  G->pos= yypos656; G->thunkpos= yythunkpos656;  yyText(G, G->begin, G->end);  if (!( memo_fail(MEMO_EMPH_MATCH) )) goto l655;
+  }
+  l656:;	
+  yyprintf((stderr, "  ok   %s @ %s\n", "EmphMatch", G->buf+G->pos));
+  return 1;
+  l655:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "EmphMatch", G->buf+G->pos));
+  return 0;
+}
+YY_RULE(int) yy_Emph(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;
+  yyprintf((stderr, "%s\n", "Emph"));
+  {  int yypos653= G->pos, yythunkpos653= G->thunkpos;  yyText(G, G->begin, G->end);  if (!( memo_ok(MEMO_EMPH) )) goto l654;  yyText(G, G->begin, G->end);  if (!(YY_BEGIN)) goto l654;  if (!yy_EmphMatch(G)) goto l654;  yyText(G, G->begin, G->end);  if (!(YY_END)) goto l654;  yyDo(G, yy_1_Emph, G->begin, G->end);  goto l653;
+  l654:;	  G->pos= yypos653; G->thunkpos= yythunkpos653;  yyText(G, G->begin, G->end);  if (!( memo_fail(MEMO_EMPH) )) goto l652;
+  }
+  l653:;	
+  yyprintf((stderr, "  ok   %s @ %s\n", "Emph", G->buf+G->pos));
+  return 1;
+  l652:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "Emph", G->buf+G->pos));
+  return 0;
+}
+YY_RULE(int) yy_EmphDelimiter(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;
+  yyprintf((stderr, "%s\n", "EmphDelimiter"));  yyText(G, G->begin, G->end);  if (!(YY_BEGIN)) goto l645;
+  {  int yypos646= G->pos, yythunkpos646= G->thunkpos;  if (!yymatchChar(G, '*')) goto l647;
+  l648:;	
+  {  int yypos649= G->pos, yythunkpos649= G->thunkpos;  if (!yymatchChar(G, '*')) goto l649;  goto l648;
+  l649:;	  G->pos= yypos649; G->thunkpos= yythunkpos649;
+  }  goto l646;
+  l647:;	  G->pos= yypos646; G->thunkpos= yythunkpos646;  if (!yymatchChar(G, '_')) goto l645;
+  l650:;	
+  {  int yypos651= G->pos, yythunkpos651= G->thunkpos;  if (!yymatchChar(G, '_')) goto l651;  goto l650;
+  l651:;	  G->pos= yypos651; G->thunkpos= yythunkpos651;
+  }
+  }
+  l646:;	  yyText(G, G->begin, G->end);  if (!(YY_END)) goto l645;  yyDo(G, yy_1_EmphDelimiter, G->begin, G->end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "EmphDelimiter", G->buf+G->pos));
+  return 1;
+  l645:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "EmphDelimiter", G->buf+G->pos));
+  return 0;
+}
+YY_RULE(int) yy_Whitespace(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;
+  yyprintf((stderr, "%s\n", "Whitespace"));
+  {  int yypos643= G->pos, yythunkpos643= G->thunkpos;  if (!yy_Spacechar(G)) goto l644;  goto l643;
+  l644:;	  G->pos= yypos643; G->thunkpos= yythunkpos643;  if (!yy_Newline(G)) goto l642;
+  }
+  l643:;	
+  yyprintf((stderr, "  ok   %s @ %s\n", "Whitespace", G->buf+G->pos));
+  return 1;
+  l642:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "Whitespace", G->buf+G->pos));
+  return 0;
+}
+YY_RULE(int) yy_UlLine(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;
+  yyprintf((stderr, "%s\n", "UlLine"));
+  {  int yypos635= G->pos, yythunkpos635= G->thunkpos;  yyText(G, G->begin, G->end);  if (!(YY_BEGIN)) goto l636;  if (!yymatchString(G, "____")) goto l636;
+  l637:;	
+  {  int yypos638= G->pos, yythunkpos638= G->thunkpos;  if (!yymatchChar(G, '_')) goto l638;  goto l637;
+  l638:;	  G->pos= yypos638; G->thunkpos= yythunkpos638;
+  }  yyText(G, G->begin, G->end);  if (!(YY_END)) goto l636;  goto l635;
+  l636:;	  G->pos= yypos635; G->thunkpos= yythunkpos635;  yyText(G, G->begin, G->end);  if (!(YY_BEGIN)) goto l634;  if (!yy_Spacechar(G)) goto l634;  if (!yymatchChar(G, '_')) goto l634;
+  l639:;	
+  {  int yypos640= G->pos, yythunkpos640= G->thunkpos;  if (!yymatchChar(G, '_')) goto l640;  goto l639;
+  l640:;	  G->pos= yypos640; G->thunkpos= yythunkpos640;
+  }
+  {  int yypos641= G->pos, yythunkpos641= G->thunkpos;  if (!yy_Spacechar(G)) goto l634;  G->pos= yypos641; G->thunkpos= yythunkpos641;
+  }  yyText(G, G->begin, G->end);  if (!(YY_END)) goto l634;
+  }
+  l635:;	
+  yyprintf((stderr, "  ok   %s @ %s\n", "UlLine", G->buf+G->pos));
+  return 1;
+  l634:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "UlLine", G->buf+G->pos));
+  return 0;
+}
+YY_RULE(int) yy_StarLine(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;
+  yyprintf((stderr, "%s\n", "StarLine"));
+  {  int yypos627= G->pos, yythunkpos627= G->thunkpos;  yyText(G, G->begin, G->end);  if (!(YY_BEGIN)) goto l628;  if (!yymatchString(G, "****")) goto l628;
+  l629:;	
+  {  int yypos630= G->pos, yythunkpos630= G->thunkpos;  if (!yymatchChar(G, '*')) goto l630;  goto l629;
+  l630:;	  G->pos= yypos630; G->thunkpos= yythunkpos630;
+  }  yyText(G, G->begin, G->end);  if (!(YY_END)) goto l628;  goto l627;
+  l628:;	  G->pos= yypos627; G->thunkpos= yythunkpos627;  yyText(G, G->begin, G->end);  if (!(YY_BEGIN)) goto l626;  if (!yy_Spacechar(G)) goto l626;  if (!yymatchChar(G, '*')) goto l626;
+  l631:;	
+  {  int yypos632= G->pos, yythunkpos632= G->thunkpos;  if (!yymatchChar(G, '*')) goto l632;  goto l631;
+  l632:;	  G->pos= yypos632; G->thunkpos= yythunkpos632;
+  }
+  {  int yypos633= G->pos, yythunkpos633= G->thunkpos;  if (!yy_Spacechar(G)) goto l626;  G->pos= yypos633; G->thunkpos= yythunkpos633;
+  }  yyText(G, G->begin, G->end);  if (!(YY_END)) goto l626;
+  }
+  l627:;	
+  yyprintf((stderr, "  ok   %s @ %s\n", "StarLine", G->buf+G->pos));
+  return 1;
+  l626:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "StarLine", G->buf+G->pos));
+  return 0;
+}
+YY_RULE(int) yy_UlOrStarLine(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;
+  yyprintf((stderr, "%s\n", "UlOrStarLine"));
+  {  int yypos624= G->pos, yythunkpos624= G->thunkpos;  if (!yy_UlLine(G)) goto l625;  goto l624;
+  l625:;	  G->pos= yypos624; G->thunkpos= yythunkpos624;  if (!yy_StarLine(G)) goto l623;
+  }
+  l624:;	  yyDo(G, yy_1_UlOrStarLine, G->begin, G->end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "UlOrStarLine", G->buf+G->pos));
+  return 1;
+  l623:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "UlOrStarLine", G->buf+G->pos));
+  return 0;
+}
+YY_RULE(int) yy_DollarMath(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;
+  yyprintf((stderr, "%s\n", "DollarMath"));
+  {  int yypos621= G->pos, yythunkpos621= G->thunkpos;  if (!yy_SingleDollarMath(G)) goto l622;  goto l621;
+  l622:;	  G->pos= yypos621; G->thunkpos= yythunkpos621;  if (!yy_DoubleDollarMath(G)) goto l620;
+  }
+  l621:;	
+  yyprintf((stderr, "  ok   %s @ %s\n", "DollarMath", G->buf+G->pos));
+  return 1;
+  l620:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "DollarMath", G->buf+G->pos));
+  return 0;
+}
+YY_RULE(int) yy_DoubleDollarMath(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;
+  yyprintf((stderr, "%s\n", "DoubleDollarMath"));  yyText(G, G->begin, G->end);  if (!(YY_BEGIN)) goto l615;  if (!yy_DoubleDollarMathStart(G)) goto l615;
+  l616:;	
+  {  int yypos617= G->pos, yythunkpos617= G->thunkpos;
+  {  int yypos618= G->pos, yythunkpos618= G->thunkpos;  if (!yy_DoubleDollarMathEnd(G)) goto l618;  goto l617;
+  l618:;	  G->pos= yypos618; G->thunkpos= yythunkpos618;
+  }
+  {  int yypos619= G->pos, yythunkpos619= G->thunkpos;  if (!yy_BlankLine(G)) goto l619;  if (!yy_BlankLine(G)) goto l619;  goto l617;
+  l619:;	  G->pos= yypos619; G->thunkpos= yythunkpos619;
+  }  if (!yymatchDot(G)) goto l617;  goto l616;
+  l617:;	  G->pos= yypos617; G->thunkpos= yythunkpos617;
+  }  if (!yy_DoubleDollarMathEnd(G)) goto l615;  yyText(G, G->begin, G->end);  if (!(YY_END)) goto l615;  yyDo(G, yy_1_DoubleDollarMath, G->begin, G->end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "DoubleDollarMath", G->buf+G->pos));
+  return 1;
+  l615:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "DoubleDollarMath", G->buf+G->pos));
+  return 0;
+}
+YY_RULE(int) yy_DoubleDollarMathEnd(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;
+  yyprintf((stderr, "%s\n", "DoubleDollarMathEnd"));
+  {  int yypos613= G->pos, yythunkpos613= G->thunkpos;  if (!yymatchChar(G, '\\')) goto l613;  goto l612;
+  l613:;	  G->pos= yypos613; G->thunkpos= yythunkpos613;
+  }  if (!yy_Nonspacechar(G)) goto l612;  if (!yymatchChar(G, '$')) goto l612;  if (!yymatchChar(G, '$')) goto l612;
+  {  int yypos614= G->pos, yythunkpos614= G->thunkpos;  if (!yy_NonPunctuation(G)) goto l614;  goto l612;
+  l614:;	  G->pos= yypos614; G->thunkpos= yythunkpos614;
+  }
+  yyprintf((stderr, "  ok   %s @ %s\n", "DoubleDollarMathEnd", G->buf+G->pos));
+  return 1;
+  l612:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "DoubleDollarMathEnd", G->buf+G->pos));
+  return 0;
+}
+YY_RULE(int) yy_DoubleDollarMathStart(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;
+  yyprintf((stderr, "%s\n", "DoubleDollarMathStart"));  if (!yymatchChar(G, '$')) goto l608;  if (!yymatchChar(G, '$')) goto l608;
+  {  int yypos609= G->pos, yythunkpos609= G->thunkpos;
+  {  int yypos610= G->pos, yythunkpos610= G->thunkpos;  if (!yy_Spacechar(G)) goto l611;  goto l610;
+  l611:;	  G->pos= yypos610; G->thunkpos= yythunkpos610;  if (!yy_Newline(G)) goto l609;
+  }
+  l610:;	  goto l608;
+  l609:;	  G->pos= yypos609; G->thunkpos= yythunkpos609;
+  }
+  yyprintf((stderr, "  ok   %s @ %s\n", "DoubleDollarMathStart", G->buf+G->pos));
+  return 1;
+  l608:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "DoubleDollarMathStart", G->buf+G->pos));
+  return 0;
+}
+YY_RULE(int) yy_SingleDollarMath(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;
+  yyprintf((stderr, "%s\n", "SingleDollarMath"));  yyText(G, G->begin, G->end);  if (!(YY_BEGIN)) goto l603;  if (!yy_SingleDollarMathStart(G)) goto l603;
+  l604:;	
+  {  int yypos605= G->pos, yythunkpos605= G->thunkpos;
+  {  int yypos606= G->pos, yythunkpos606= G->thunkpos;  if (!yy_SingleDollarMathEnd(G)) goto l606;  goto l605;
+  l606:;	  G->pos= yypos606; G->thunkpos= yythunkpos606;
+  }
+  {  int yypos607= G->pos, yythunkpos607= G->thunkpos;  if (!yy_BlankLine(G)) goto l607;  if (!yy_BlankLine(G)) goto l607;  goto l605;
+  l607:;	  G->pos= yypos607; G->thunkpos= yythunkpos607;
+  }  if (!yymatchDot(G)) goto l605;  goto l604;
+  l605:;	  G->pos= yypos605; G->thunkpos= yythunkpos605;
+  }  if (!yy_SingleDollarMathEnd(G)) goto l603;  yyText(G, G->begin, G->end);  if (!(YY_END)) goto l603;  yyDo(G, yy_1_SingleDollarMath, G->begin, G->end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "SingleDollarMath", G->buf+G->pos));
+  return 1;
+  l603:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "SingleDollarMath", G->buf+G->pos));
+  return 0;
+}
+YY_RULE(int) yy_SingleDollarMathEnd(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;
+  yyprintf((stderr, "%s\n", "SingleDollarMathEnd"));
+  {  int yypos600= G->pos, yythunkpos600= G->thunkpos;  if (!yymatchChar(G, '\\')) goto l600;  goto l599;
+  l600:;	  G->pos= yypos600; G->thunkpos= yythunkpos600;
+  }
+  {  int yypos601= G->pos, yythunkpos601= G->thunkpos;  if (!yymatchChar(G, '$')) goto l601;  goto l599;
+  l601:;	  G->pos= yypos601; G->thunkpos= yythunkpos601;
+  }  if (!yy_Nonspacechar(G)) goto l599;  if (!yymatchChar(G, '$')) goto l599;
+  {  int yypos602= G->pos, yythunkpos602= G->thunkpos;  if (!yy_NonPunctuation(G)) goto l602;  goto l599;
+  l602:;	  G->pos= yypos602; G->thunkpos= yythunkpos602;
+  }
+  yyprintf((stderr, "  ok   %s @ %s\n", "SingleDollarMathEnd", G->buf+G->pos));
+  return 1;
+  l599:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "SingleDollarMathEnd", G->buf+G->pos));
+  return 0;
+}
+YY_RULE(int) yy_SingleDollarMathStart(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;
+  yyprintf((stderr, "%s\n", "SingleDollarMathStart"));  if (!yymatchChar(G, '$')) goto l594;
+  {  int yypos595= G->pos, yythunkpos595= G->thunkpos;
+  {  int yypos596= G->pos, yythunkpos596= G->thunkpos;  if (!yy_Spacechar(G)) goto l597;  goto l596;
+  l597:;	  G->pos= yypos596; G->thunkpos= yythunkpos596;  if (!yy_Newline(G)) goto l598;  goto l596;
+  l598:;	  G->pos= yypos596; G->thunkpos= yythunkpos596;  if (!yymatchChar(G, '$')) goto l595;
+  }
+  l596:;	  goto l594;
+  l595:;	  G->pos= yypos595; G->thunkpos= yythunkpos595;
+  }
+  yyprintf((stderr, "  ok   %s @ %s\n", "SingleDollarMathStart", G->buf+G->pos));
+  return 1;
+  l594:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "SingleDollarMathStart", G->buf+G->pos));
+  return 0;
+}
+YY_RULE(int) yy_MathSpan(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;
+  yyprintf((stderr, "%s\n", "MathSpan"));  if (!yymatchChar(G, '\\')) goto l585;  yyText(G, G->begin, G->end);  if (!(YY_BEGIN)) goto l585;
+  {  int yypos586= G->pos, yythunkpos586= G->thunkpos;  if (!yymatchString(G, "\\[")) goto l587;
+  l588:;	
+  {  int yypos589= G->pos, yythunkpos589= G->thunkpos;
+  {  int yypos590= G->pos, yythunkpos590= G->thunkpos;  if (!yymatchString(G, "\\\\]")) goto l590;  goto l589;
+  l590:;	  G->pos= yypos590; G->thunkpos= yythunkpos590;
+  }  if (!yymatchDot(G)) goto l589;  goto l588;
+  l589:;	  G->pos= yypos589; G->thunkpos= yythunkpos589;
+  }  if (!yymatchString(G, "\\\\]")) goto l587;  goto l586;
+  l587:;	  G->pos= yypos586; G->thunkpos= yythunkpos586;  if (!yymatchString(G, "\\(")) goto l585;
+  l591:;	
+  {  int yypos592= G->pos, yythunkpos592= G->thunkpos;
+  {  int yypos593= G->pos, yythunkpos593= G->thunkpos;  if (!yymatchString(G, "\\\\)")) goto l593;  goto l592;
+  l593:;	  G->pos= yypos593; G->thunkpos= yythunkpos593;
+  }  if (!yymatchDot(G)) goto l592;  goto l591;
+  l592:;	  G->pos= yypos592; G->thunkpos= yythunkpos592;
+  }  if (!yymatchString(G, "\\\\)")) goto l585;
+  }
+  l586:;	  yyText(G, G->begin, G->end);  if (!(YY_END)) goto l585;  yyDo(G, yy_1_MathSpan, G->begin, G->end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "MathSpan", G->buf+G->pos));
+  return 1;
+  l585:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "MathSpan", G->buf+G->pos));
+  return 0;
+}
+YY_RULE(int) yy_StartList(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;
+  yyprintf((stderr, "%s\n", "StartList"));
+  {  int yypos584= G->pos, yythunkpos584= G->thunkpos;  if (!yymatchDot(G)) goto l583;  G->pos= yypos584; G->thunkpos= yythunkpos584;
+  }  yyDo(G, yy_1_StartList, G->begin, G->end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "StartList", G->buf+G->pos));
+  return 1;
+  l583:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "StartList", G->buf+G->pos));
+  return 0;
+}
+YY_RULE(int) yy_Subscript(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;
+  yyprintf((stderr, "%s\n", "Subscript"));  if (!yymatchChar(G, '~')) goto l569;  yyText(G, G->begin, G->end);  if (!(YY_BEGIN)) goto l569;
+  {  int yypos570= G->pos, yythunkpos570= G->thunkpos;
+  {  int yypos574= G->pos, yythunkpos574= G->thunkpos;  if (!yymatchChar(G, '~')) goto l574;  goto l571;
+  l574:;	  G->pos= yypos574; G->thunkpos= yythunkpos574;
+  }  if (!yy_Nonspacechar(G)) goto l571;
+  l572:;	
+  {  int yypos573= G->pos, yythunkpos573= G->thunkpos;
+  {  int yypos575= G->pos, yythunkpos575= G->thunkpos;  if (!yymatchChar(G, '~')) goto l575;  goto l573;
+  l575:;	  G->pos= yypos575; G->thunkpos= yythunkpos575;
+  }  if (!yy_Nonspacechar(G)) goto l573;  goto l572;
+  l573:;	  G->pos= yypos573; G->thunkpos= yythunkpos573;
+  }
+  {  int yypos576= G->pos, yythunkpos576= G->thunkpos;  if (!yymatchChar(G, '~')) goto l571;  G->pos= yypos576; G->thunkpos= yythunkpos576;
+  }  goto l570;
+  l571:;	  G->pos= yypos570; G->thunkpos= yythunkpos570;
+  {  int yypos579= G->pos, yythunkpos579= G->thunkpos;  if (!yymatchChar(G, '~')) goto l579;  goto l569;
+  l579:;	  G->pos= yypos579; G->thunkpos= yythunkpos579;
+  }  if (!yy_NonPunctuation(G)) goto l569;
+  l577:;	
+  {  int yypos578= G->pos, yythunkpos578= G->thunkpos;
+  {  int yypos580= G->pos, yythunkpos580= G->thunkpos;  if (!yymatchChar(G, '~')) goto l580;  goto l578;
+  l580:;	  G->pos= yypos580; G->thunkpos= yythunkpos580;
+  }  if (!yy_NonPunctuation(G)) goto l578;  goto l577;
+  l578:;	  G->pos= yypos578; G->thunkpos= yythunkpos578;
+  }
+  }
+  l570:;	  yyText(G, G->begin, G->end);  if (!(YY_END)) goto l569;
+  {  int yypos581= G->pos, yythunkpos581= G->thunkpos;  if (!yymatchChar(G, '~')) goto l581;  goto l582;
+  l581:;	  G->pos= yypos581; G->thunkpos= yythunkpos581;
+  }
+  l582:;	  yyDo(G, yy_1_Subscript, G->begin, G->end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "Subscript", G->buf+G->pos));
+  return 1;
+  l569:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "Subscript", G->buf+G->pos));
+  return 0;
+}
+YY_RULE(int) yy_Superscript(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;
+  yyprintf((stderr, "%s\n", "Superscript"));  if (!yymatchChar(G, '^')) goto l555;  yyText(G, G->begin, G->end);  if (!(YY_BEGIN)) goto l555;
+  {  int yypos556= G->pos, yythunkpos556= G->thunkpos;
+  {  int yypos560= G->pos, yythunkpos560= G->thunkpos;  if (!yymatchChar(G, '^')) goto l560;  goto l557;
+  l560:;	  G->pos= yypos560; G->thunkpos= yythunkpos560;
+  }  if (!yy_Nonspacechar(G)) goto l557;
+  l558:;	
+  {  int yypos559= G->pos, yythunkpos559= G->thunkpos;
+  {  int yypos561= G->pos, yythunkpos561= G->thunkpos;  if (!yymatchChar(G, '^')) goto l561;  goto l559;
+  l561:;	  G->pos= yypos561; G->thunkpos= yythunkpos561;
+  }  if (!yy_Nonspacechar(G)) goto l559;  goto l558;
+  l559:;	  G->pos= yypos559; G->thunkpos= yythunkpos559;
+  }
+  {  int yypos562= G->pos, yythunkpos562= G->thunkpos;  if (!yymatchChar(G, '^')) goto l557;  G->pos= yypos562; G->thunkpos= yythunkpos562;
+  }  goto l556;
+  l557:;	  G->pos= yypos556; G->thunkpos= yythunkpos556;
+  {  int yypos565= G->pos, yythunkpos565= G->thunkpos;  if (!yymatchChar(G, '^')) goto l565;  goto l555;
+  l565:;	  G->pos= yypos565; G->thunkpos= yythunkpos565;
+  }  if (!yy_NonPunctuation(G)) goto l555;
+  l563:;	
+  {  int yypos564= G->pos, yythunkpos564= G->thunkpos;
+  {  int yypos566= G->pos, yythunkpos566= G->thunkpos;  if (!yymatchChar(G, '^')) goto l566;  goto l564;
+  l566:;	  G->pos= yypos566; G->thunkpos= yythunkpos566;
+  }  if (!yy_NonPunctuation(G)) goto l564;  goto l563;
+  l564:;	  G->pos= yypos564; G->thunkpos= yythunkpos564;
+  }
+  }
+  l556:;	  yyText(G, G->begin, G->end);  if (!(YY_END)) goto l555;
+  {  int yypos567= G->pos, yythunkpos567= G->thunkpos;  if (!yymatchChar(G, '^')) goto l567;  goto l568;
+  l567:;	  G->pos= yypos567; G->thunkpos= yythunkpos567;
+  }
+  l568:;	  yyDo(G, yy_1_Superscript, G->begin, G->end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "Superscript", G->buf+G->pos));
+  return 1;
+  l555:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "Superscript", G->buf+G->pos));
+  return 0;
+}
+YY_RULE(int) yy_AposChunk(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;
+  yyprintf((stderr, "%s\n", "AposChunk"));  yyText(G, G->begin, G->end);  if (!( ext(EXT_SMART) )) goto l553;  if (!yymatchChar(G, '\'')) goto l553;
+  {  int yypos554= G->pos, yythunkpos554= G->thunkpos;  if (!yy_Alphanumeric(G)) goto l553;  G->pos= yypos554; G->thunkpos= yythunkpos554;
+  }  yyDo(G, yy_1_AposChunk, G->begin, G->end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "AposChunk", G->buf+G->pos));
+  return 1;
+  l553:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "AposChunk", G->buf+G->pos));
+  return 0;
+}
+YY_RULE(int) yy_StrChunk(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;
+  yyprintf((stderr, "%s\n", "StrChunk"));
+  {  int yypos537= G->pos, yythunkpos537= G->thunkpos;  yyText(G, G->begin, G->end);  if (!(YY_BEGIN)) goto l538;
+  {  int yypos541= G->pos, yythunkpos541= G->thunkpos;  if (!yy_NormalChar(G)) goto l542;  goto l541;
+  l542:;	  G->pos= yypos541; G->thunkpos= yythunkpos541;  yyText(G, G->begin, G->end);  if (!( !ext(EXT_DELIMITER_EMPH) )) goto l538;  if (!yymatchChar(G, '_')) goto l538;
+  l543:;	
+  {  int yypos544= G->pos, yythunkpos544= G->thunkpos;  if (!yymatchChar(G, '_')) goto l544;  goto l543;
+  l544:;	  G->pos= yypos544; G->thunkpos= yythunkpos544;
+  }
+  {  int yypos545= G->pos, yythunkpos545= G->thunkpos;  if (!yy_Punctuation(G)) goto l545;  goto l538;
+  l545:;	  G->pos= yypos545; G->thunkpos= yythunkpos545;
+  }
+  {  int yypos546= G->pos, yythunkpos546= G->thunkpos;  if (!yy_Alphanumeric(G)) goto l538;  G->pos= yypos546; G->thunkpos= yythunkpos546;
+  }
+  }
+  l541:;	
+  l539:;	
+  {  int yypos540= G->pos, yythunkpos540= G->thunkpos;
+  {  int yypos547= G->pos, yythunkpos547= G->thunkpos;  if (!yy_NormalChar(G)) goto l548;  goto l547;
+  l548:;	  G->pos= yypos547; G->thunkpos= yythunkpos547;  yyText(G, G->begin, G->end);  if (!( !ext(EXT_DELIMITER_EMPH) )) goto l540;  if (!yymatchChar(G, '_')) goto l540;
+  l549:;	
+  {  int yypos550= G->pos, yythunkpos550= G->thunkpos;  if (!yymatchChar(G, '_')) goto l550;  goto l549;
+  l550:;	  G->pos= yypos550; G->thunkpos= yythunkpos550;
+  }
+  {  int yypos551= G->pos, yythunkpos551= G->thunkpos;  if (!yy_Punctuation(G)) goto l551;  goto l540;
+  l551:;	  G->pos= yypos551; G->thunkpos= yythunkpos551;
+  }
+  {  int yypos552= G->pos, yythunkpos552= G->thunkpos;  if (!yy_Alphanumeric(G)) goto l540;  G->pos= yypos552; G->thunkpos= yythunkpos552;
+  }
+  }
+  l547:;	  goto l539;
+  l540:;	  G->pos= yypos540; G->thunkpos= yythunkpos540;
+  }  yyText(G, G->begin, G->end);  if (!(YY_END)) goto l538;  yyDo(G, yy_1_StrChunk, G->begin, G->end);  goto l537;
+  l538:;	  G->pos= yypos537; G->thunkpos= yythunkpos537;  if (!yy_AposChunk(G)) goto l536;
+  }
+  l537:;	
+  yyprintf((stderr, "  ok   %s @ %s\n", "StrChunk", G->buf+G->pos));
+  return 1;
+  l536:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "StrChunk", G->buf+G->pos));
+  return 0;
+}
+YY_RULE(int) yy_Str(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyDo(G, yyPush, 1, 0);
+  yyprintf((stderr, "%s\n", "Str"));  if (!yy_StartList(G)) goto l527;  yyDo(G, yySet, -1, 0);  yyText(G, G->begin, G->end);  if (!(YY_BEGIN)) goto l527;  if (!yy_NormalChar(G)) goto l527;
+  l528:;	
+  {  int yypos529= G->pos, yythunkpos529= G->thunkpos;  if (!yy_NormalChar(G)) goto l529;  goto l528;
+  l529:;	  G->pos= yypos529; G->thunkpos= yythunkpos529;
+  }  yyText(G, G->begin, G->end);  if (!(YY_END)) goto l527;  yyDo(G, yy_1_Str, G->begin, G->end);
+  l530:;	
+  {  int yypos531= G->pos, yythunkpos531= G->thunkpos;  yyText(G, G->begin, G->end);  if (!( !ext(EXT_COMPATIBILITY) )) goto l531;  if (!yy_StrChunk(G)) goto l531;  yyDo(G, yy_2_Str, G->begin, G->end);  goto l530;
+  l531:;	  G->pos= yypos531; G->thunkpos= yythunkpos531;
+  }
+  l532:;	
+  {  int yypos533= G->pos, yythunkpos533= G->thunkpos;  yyText(G, G->begin, G->end);  if (!( !ext(EXT_COMPATIBILITY) )) goto l533;
+  {  int yypos534= G->pos, yythunkpos534= G->thunkpos;  if (!yy_Superscript(G)) goto l535;  goto l534;
+  l535:;	  G->pos= yypos534; G->thunkpos= yythunkpos534;  if (!yy_Subscript(G)) goto l533;
+  }
+  l534:;	  yyDo(G, yy_3_Str, G->begin, G->end);  goto l532;
+  l533:;	  G->pos= yypos533; G->thunkpos= yythunkpos533;
+  }  yyDo(G, yy_4_Str, G->begin, G->end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "Str", G->buf+G->pos));  yyDo(G, yyPop, 1, 0);
+  return 1;
+  l527:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "Str", G->buf+G->pos));
+  return 0;
+}
+YY_RULE(int) yy_voidNormalEndline(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;
+  yyprintf((stderr, "%s\n", "voidNormalEndline"));  if (!yy_Sp(G)) goto l516;  if (!yy_Newline(G)) goto l516;
+  {  int yypos517= G->pos, yythunkpos517= G->thunkpos;  if (!yy_BlankLine(G)) goto l517;  goto l516;
+  l517:;	  G->pos= yypos517; G->thunkpos= yythunkpos517;
+  }
+  {  int yypos518= G->pos, yythunkpos518= G->thunkpos;  if (!yymatchChar(G, '>')) goto l518;  goto l516;
+  l518:;	  G->pos= yypos518; G->thunkpos= yythunkpos518;
+  }
+  {  int yypos519= G->pos, yythunkpos519= G->thunkpos;  if (!yy_AtxStart(G)) goto l519;  goto l516;
+  l519:;	  G->pos= yypos519; G->thunkpos= yythunkpos519;
+  }
+  {  int yypos520= G->pos, yythunkpos520= G->thunkpos;  if (!yy_RawLine(G)) goto l520;
+  {  int yypos521= G->pos, yythunkpos521= G->thunkpos;  if (!yymatchChar(G, '=')) goto l522;
+  l523:;	
+  {  int yypos524= G->pos, yythunkpos524= G->thunkpos;  if (!yymatchChar(G, '=')) goto l524;  goto l523;
+  l524:;	  G->pos= yypos524; G->thunkpos= yythunkpos524;
+  }  goto l521;
+  l522:;	  G->pos= yypos521; G->thunkpos= yythunkpos521;  if (!yymatchChar(G, '-')) goto l520;
+  l525:;	
+  {  int yypos526= G->pos, yythunkpos526= G->thunkpos;  if (!yymatchChar(G, '-')) goto l526;  goto l525;
+  l526:;	  G->pos= yypos526; G->thunkpos= yythunkpos526;
+  }
+  }
+  l521:;	  if (!yy_Newline(G)) goto l520;  goto l516;
+  l520:;	  G->pos= yypos520; G->thunkpos= yythunkpos520;
+  }
+  yyprintf((stderr, "  ok   %s @ %s\n", "voidNormalEndline", G->buf+G->pos));
+  return 1;
+  l516:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "voidNormalEndline", G->buf+G->pos));
+  return 0;
+}
+YY_RULE(int) yy_voidEndline(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;
+  yyprintf((stderr, "%s\n", "voidEndline"));
+  {  int yypos511= G->pos, yythunkpos511= G->thunkpos;
+  {  int yypos513= G->pos, yythunkpos513= G->thunkpos;  if (!yymatchString(G, "  ")) goto l514;  goto l513;
+  l514:;	  G->pos= yypos513; G->thunkpos= yythunkpos513;  yyText(G, G->begin, G->end);  if (!( !ext(EXT_COMPATIBILITY) && ext(EXT_ESCAPED_LINE_BREAKS) )) goto l512;  if (!yy_Sp(G)) goto l512;  if (!yymatchChar(G, '\\')) goto l512;
+  }
+  l513:;	  if (!yy_voidNormalEndline(G)) goto l512;  goto l511;
+  l512:;	  G->pos= yypos511; G->thunkpos= yythunkpos511;  if (!yy_Sp(G)) goto l515;  if (!yy_Newline(G)) goto l515;  if (!yy_Eof(G)) goto l515;  goto l511;
+  l515:;	  G->pos= yypos511; G->thunkpos= yythunkpos511;  if (!yy_voidNormalEndline(G)) goto l510;
+  }
+  l511:;	
+  yyprintf((stderr, "  ok   %s @ %s\n", "voidEndline", G->buf+G->pos));
+  return 1;
+  l510:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "voidEndline", G->buf+G->pos));
+  return 0;
+}
+YY_RULE(int) yy_LineBreak(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyDo(G, yyPush, 1, 0);
+  yyprintf((stderr, "%s\n", "LineBreak"));
+  {  int yypos508= G->pos, yythunkpos508= G->thunkpos;  if (!yymatchString(G, "  ")) goto l509;  goto l508;
+  l509:;	  G->pos= yypos508; G->thunkpos= yythunkpos508;  yyText(G, G->begin, G->end);  if (!( !ext(EXT_COMPATIBILITY) && ext(EXT_ESCAPED_LINE_BREAKS) )) goto l507;  if (!yy_Sp(G)) goto l507;  if (!yymatchChar(G, '\\')) goto l507;
+  }
+  l508:;	  if (!yy_NormalEndline(G)) goto l507;  yyDo(G, yySet, -1, 0);  yyDo(G, yy_1_LineBreak, G->begin, G->end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "LineBreak", G->buf+G->pos));  yyDo(G, yyPop, 1, 0);
+  return 1;
+  l507:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "LineBreak", G->buf+G->pos));
+  return 0;
+}
+YY_RULE(int) yy_TerminalEndline(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;
+  yyprintf((stderr, "%s\n", "TerminalEndline"));  if (!yy_Sp(G)) goto l506;  if (!yy_Newline(G)) goto l506;  if (!yy_Eof(G)) goto l506;  yyDo(G, yy_1_TerminalEndline, G->begin, G->end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "TerminalEndline", G->buf+G->pos));
+  return 1;
+  l506:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "TerminalEndline", G->buf+G->pos));
+  return 0;
+}
+YY_RULE(int) yy_NormalEndline(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;
+  yyprintf((stderr, "%s\n", "NormalEndline"));  if (!yy_Sp(G)) goto l495;  if (!yy_Newline(G)) goto l495;
+  {  int yypos496= G->pos, yythunkpos496= G->thunkpos;  if (!yy_BlankLine(G)) goto l496;  goto l495;
+  l496:;	  G->pos= yypos496; G->thunkpos= yythunkpos496;
+  }
+  {  int yypos497= G->pos, yythunkpos497= G->thunkpos;  if (!yymatchChar(G, '>')) goto l497;  goto l495;
+  l497:;	  G->pos= yypos497; G->thunkpos= yythunkpos497;
+  }
+  {  int yypos498= G->pos, yythunkpos498= G->thunkpos;  if (!yy_AtxStart(G)) goto l498;  goto l495;
+  l498:;	  G->pos= yypos498; G->thunkpos= yythunkpos498;
+  }
+  {  int yypos499= G->pos, yythunkpos499= G->thunkpos;  if (!yy_RawLine(G)) goto l499;
+  {  int yypos500= G->pos, yythunkpos500= G->thunkpos;  if (!yymatchChar(G, '=')) goto l501;
+  l502:;	
+  {  int yypos503= G->pos, yythunkpos503= G->thunkpos;  if (!yymatchChar(G, '=')) goto l503;  goto l502;
+  l503:;	  G->pos= yypos503; G->thunkpos= yythunkpos503;
+  }  goto l500;
+  l501:;	  G->pos= yypos500; G->thunkpos= yythunkpos500;  if (!yymatchChar(G, '-')) goto l499;
+  l504:;	
+  {  int yypos505= G->pos, yythunkpos505= G->thunkpos;  if (!yymatchChar(G, '-')) goto l505;  goto l504;
+  l505:;	  G->pos= yypos505; G->thunkpos= yythunkpos505;
+  }
+  }
+  l500:;	  if (!yy_Newline(G)) goto l499;  goto l495;
+  l499:;	  G->pos= yypos499; G->thunkpos= yythunkpos499;
+  }  yyDo(G, yy_1_NormalEndline, G->begin, G->end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "NormalEndline", G->buf+G->pos));
+  return 1;
+  l495:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "NormalEndline", G->buf+G->pos));
+  return 0;
+}
+YY_RULE(int) yy_Endline(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;
+  yyprintf((stderr, "%s\n", "Endline"));
+  {  int yypos492= G->pos, yythunkpos492= G->thunkpos;  if (!yy_LineBreak(G)) goto l493;  goto l492;
+  l493:;	  G->pos= yypos492; G->thunkpos= yythunkpos492;  if (!yy_TerminalEndline(G)) goto l494;  goto l492;
+  l494:;	  G->pos= yypos492; G->thunkpos= yythunkpos492;  if (!yy_NormalEndline(G)) goto l491;
+  }
+  l492:;	
+  yyprintf((stderr, "  ok   %s @ %s\n", "Endline", G->buf+G->pos));
+  return 1;
+  l491:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "Endline", G->buf+G->pos));
+  return 0;
+}
+YY_RULE(int) yy_Space(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;
+  yyprintf((stderr, "%s\n", "Space"));  if (!yy_Spacechar(G)) goto l488;
+  l489:;	
+  {  int yypos490= G->pos, yythunkpos490= G->thunkpos;  if (!yy_Spacechar(G)) goto l490;  goto l489;
+  l490:;	  G->pos= yypos490; G->thunkpos= yythunkpos490;
+  }  yyDo(G, yy_1_Space, G->begin, G->end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "Space", G->buf+G->pos));
+  return 1;
+  l488:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "Space", G->buf+G->pos));
+  return 0;
+}
+YY_RULE(int) yy_InlineNoEmph(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;
+  yyprintf((stderr, "%s\n", "InlineNoEmph"));  yyText(G, G->begin, G->end);  if (!( burn_fuel() )) goto l467;
+  {  int yypos468= G->pos, yythunkpos468= G->thunkpos;  yyText(G, G->begin, G->end);  if (!( ext(EXT_CRITIC) && may_start(INLINE_CRITIC) )) goto l469;  if (!yy_CriticMarkup(G)) goto l469;  goto l468;
+  l469:;	  G->pos= yypos468; G->thunkpos= yythunkpos468;  yyText(G, G->begin, G->end);  if (!( !ext(EXT_COMPATIBILITY) && may_start(INLINE_DOLLAR_MATH) )) goto l470;  if (!yy_DollarMath(G)) goto l470;  goto l468;
+  l470:;	  G->pos= yypos468; G->thunkpos= yythunkpos468;  if (!yy_Str(G)) goto l471;  goto l468;
+  l471:;	  G->pos= yypos468; G->thunkpos= yythunkpos468;  yyText(G, G->begin, G->end);  if (!( !ext(EXT_COMPATIBILITY) && may_start(INLINE_MATH_SPAN) )) goto l472;  if (!yy_MathSpan(G)) goto l472;  goto l468;
+  l472:;	  G->pos= yypos468; G->thunkpos= yythunkpos468;  yyText(G, G->begin, G->end);  if (!( may_start(INLINE_ENDLINE) )) goto l473;  if (!yy_Endline(G)) goto l473;  goto l468;
+  l473:;	  G->pos= yypos468; G->thunkpos= yythunkpos468;  yyText(G, G->begin, G->end);  if (!( may_start(INLINE_UL_OR_STAR_LINE) )) goto l474;  if (!yy_UlOrStarLine(G)) goto l474;  goto l468;
+  l474:;	  G->pos= yypos468; G->thunkpos= yythunkpos468;  yyText(G, G->begin, G->end);  if (!( may_start(INLINE_SPACE) )) goto l475;  if (!yy_Space(G)) goto l475;  goto l468;
+  l475:;	  G->pos= yypos468; G->thunkpos= yythunkpos468;  yyText(G, G->begin, G->end);  if (!( may_start(INLINE_STRONG) )) goto l476;  if (!yy_Strong(G)) goto l476;  goto l468;
+  l476:;	  G->pos= yypos468; G->thunkpos= yythunkpos468;  yyText(G, G->begin, G->end);  if (!( !ext(EXT_COMPATIBILITY) && may_start(INLINE_CITATION) )) goto l477;  if (!yy_CitationReference(G)) goto l477;  goto l468;
+  l477:;	  G->pos= yypos468; G->thunkpos= yythunkpos468;  yyText(G, G->begin, G->end);  if (!( !ext(EXT_COMPATIBILITY) && may_start(INLINE_VARIABLE) )) goto l478;  if (!yy_Variable(G)) goto l478;  goto l468;
+  l478:;	  G->pos= yypos468; G->thunkpos= yythunkpos468;  yyText(G, G->begin, G->end);  if (!( may_start(INLINE_IMAGE) )) goto l479;  if (!yy_Image(G)) goto l479;  goto l468;
+  l479:;	  G->pos= yypos468; G->thunkpos= yythunkpos468;  yyText(G, G->begin, G->end);  if (!( may_start(INLINE_LINK) )) goto l480;  if (!yy_Link(G)) goto l480;  goto l468;
+  l480:;	  G->pos= yypos468; G->thunkpos= yythunkpos468;  yyText(G, G->begin, G->end);  if (!( may_start(INLINE_NOTE_REFERENCE) )) goto l481;  if (!yy_NoteReference(G)) goto l481;  goto l468;
+  l481:;	  G->pos= yypos468; G->thunkpos= yythunkpos468;  yyText(G, G->begin, G->end);  if (!( may_start(INLINE_CODE) )) goto l482;  if (!yy_Code(G)) goto l482;  goto l468;
+  l482:;	  G->pos= yypos468; G->thunkpos= yythunkpos468;  yyText(G, G->begin, G->end);  if (!( may_start(INLINE_HTML_TAG_OPEN) )) goto l483;  if (!yy_MarkdownHtmlTagOpen(G)) goto l483;  goto l468;
+  l483:;	  G->pos= yypos468; G->thunkpos= yythunkpos468;  yyText(G, G->begin, G->end);  if (!( may_start(INLINE_RAW_HTML) )) goto l484;  if (!yy_RawHtml(G)) goto l484;  goto l468;
+  l484:;	  G->pos= yypos468; G->thunkpos= yythunkpos468;  yyText(G, G->begin, G->end);  if (!( may_start(INLINE_ENTITY) )) goto l485;  if (!yy_Entity(G)) goto l485;  goto l468;
+  l485:;	  G->pos= yypos468; G->thunkpos= yythunkpos468;  yyText(G, G->begin, G->end);  if (!( may_start(INLINE_ESCAPED_CHAR) )) goto l486;  if (!yy_EscapedChar(G)) goto l486;  goto l468;
+  l486:;	  G->pos= yypos468; G->thunkpos= yythunkpos468;  yyText(G, G->begin, G->end);  if (!( may_start(INLINE_SMART) )) goto l487;  if (!yy_Smart(G)) goto l487;  goto l468;
+  l487:;	  G->pos= yypos468; G->thunkpos= yythunkpos468;  if (!yy_Symbol(G)) goto l467;
+  }
+  l468:;	
+  yyprintf((stderr, "  ok   %s @ %s\n", "InlineNoEmph", G->buf+G->pos));
+  return 1;
+  l467:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "InlineNoEmph", G->buf+G->pos));
+  return 0;
+}
+YY_RULE(int) yy_Inline(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;
+  yyprintf((stderr, "%s\n", "Inline"));
+  {  int yypos396= G->pos, yythunkpos396= G->thunkpos;  yyText(G, G->begin, G->end);  if (!( burn_fuel() && memo_ok(MEMO_INLINE) )) goto l397;
+  {  int yypos398= G->pos, yythunkpos398= G->thunkpos;  yyText(G, G->begin, G->end);  if (!( ext(EXT_CRITIC) && dispatch(INLINE_CRITIC) )) goto l399;
+  {  int yypos400= G->pos, yythunkpos400= G->thunkpos;  if (!yy_CriticMarkup(G)) goto l401;  goto l400;
+  l401:;	  G->pos= yypos400; G->thunkpos= yythunkpos400;  yyText(G, G->begin, G->end);  if (!( failed(INLINE_CRITIC) )) goto l399;
+  }
+  l400:;	  goto l398;
+  l399:;	  G->pos= yypos398; G->thunkpos= yythunkpos398;  yyText(G, G->begin, G->end);  if (!( !ext(EXT_COMPATIBILITY) && dispatch(INLINE_DOLLAR_MATH) )) goto l402;
+  {  int yypos403= G->pos, yythunkpos403= G->thunkpos;  if (!yy_DollarMath(G)) goto l404;  goto l403;
+  l404:;	  G->pos= yypos403; G->thunkpos= yythunkpos403;  yyText(G, G->begin, G->end);  if (!( failed(INLINE_DOLLAR_MATH) )) goto l402;
+  }
+  l403:;	  goto l398;
+  l402:;	  G->pos= yypos398; G->thunkpos= yythunkpos398;  yyText(G, G->begin, G->end);  if (!( dispatch(INLINE_STR) )) goto l405;
+  {  int yypos406= G->pos, yythunkpos406= G->thunkpos;  if (!yy_Str(G)) goto l407;  goto l406;
+  l407:;	  G->pos= yypos406; G->thunkpos= yythunkpos406;  yyText(G, G->begin, G->end);  if (!( failed(INLINE_STR) )) goto l405;
+  }
+  l406:;	  goto l398;
+  l405:;	  G->pos= yypos398; G->thunkpos= yythunkpos398;  yyText(G, G->begin, G->end);  if (!( !ext(EXT_COMPATIBILITY) && dispatch(INLINE_MATH_SPAN) )) goto l408;
+  {  int yypos409= G->pos, yythunkpos409= G->thunkpos;  if (!yy_MathSpan(G)) goto l410;  goto l409;
+  l410:;	  G->pos= yypos409; G->thunkpos= yythunkpos409;  yyText(G, G->begin, G->end);  if (!( failed(INLINE_MATH_SPAN) )) goto l408;
+  }
+  l409:;	  goto l398;
+  l408:;	  G->pos= yypos398; G->thunkpos= yythunkpos398;  yyText(G, G->begin, G->end);  if (!( dispatch(INLINE_ENDLINE) )) goto l411;
+  {  int yypos412= G->pos, yythunkpos412= G->thunkpos;  if (!yy_Endline(G)) goto l413;  goto l412;
+  l413:;	  G->pos= yypos412; G->thunkpos= yythunkpos412;  yyText(G, G->begin, G->end);  if (!( failed(INLINE_ENDLINE) )) goto l411;
+  }
+  l412:;	  goto l398;
+  l411:;	  G->pos= yypos398; G->thunkpos= yythunkpos398;  yyText(G, G->begin, G->end);  if (!( dispatch(INLINE_UL_OR_STAR_LINE) )) goto l414;
+  {  int yypos415= G->pos, yythunkpos415= G->thunkpos;  if (!yy_UlOrStarLine(G)) goto l416;  goto l415;
+  l416:;	  G->pos= yypos415; G->thunkpos= yythunkpos415;  yyText(G, G->begin, G->end);  if (!( failed(INLINE_UL_OR_STAR_LINE) )) goto l414;
+  }
+  l415:;	  goto l398;
+  l414:;	  G->pos= yypos398; G->thunkpos= yythunkpos398;  yyText(G, G->begin, G->end);  if (!( dispatch(INLINE_SPACE) )) goto l417;
+  {  int yypos418= G->pos, yythunkpos418= G->thunkpos;  if (!yy_Space(G)) goto l419;  goto l418;
+  l419:;	  G->pos= yypos418; G->thunkpos= yythunkpos418;  yyText(G, G->begin, G->end);  if (!( failed(INLINE_SPACE) )) goto l417;
+  }
+  l418:;	  goto l398;
+  l417:;	  G->pos= yypos398; G->thunkpos= yythunkpos398;  yyText(G, G->begin, G->end);  if (!( ext(EXT_DELIMITER_EMPH) && dispatch(INLINE_EMPH_DELIMITER) )) goto l420;
+  {  int yypos421= G->pos, yythunkpos421= G->thunkpos;  if (!yy_EmphDelimiter(G)) goto l422;  goto l421;
+  l422:;	  G->pos= yypos421; G->thunkpos= yythunkpos421;  yyText(G, G->begin, G->end);  if (!( failed(INLINE_EMPH_DELIMITER) )) goto l420;
+  }
+  l421:;	  goto l398;
+  l420:;	  G->pos= yypos398; G->thunkpos= yythunkpos398;  yyText(G, G->begin, G->end);  if (!( !ext(EXT_DELIMITER_EMPH) && dispatch(INLINE_STRONG_AND_EMPH) )) goto l423;
+  {  int yypos424= G->pos, yythunkpos424= G->thunkpos;  if (!yy_StrongAndEmph(G)) goto l425;  goto l424;
+  l425:;	  G->pos= yypos424; G->thunkpos= yythunkpos424;  yyText(G, G->begin, G->end);  if (!( failed(INLINE_STRONG_AND_EMPH) )) goto l423;
+  }
+  l424:;	  goto l398;
+  l423:;	  G->pos= yypos398; G->thunkpos= yythunkpos398;  yyText(G, G->begin, G->end);  if (!( !ext(EXT_DELIMITER_EMPH) && dispatch(INLINE_STRONG) )) goto l426;
+  {  int yypos427= G->pos, yythunkpos427= G->thunkpos;  if (!yy_Strong(G)) goto l428;  goto l427;
+  l428:;	  G->pos= yypos427; G->thunkpos= yythunkpos427;  yyText(G, G->begin, G->end);  if (!( failed(INLINE_STRONG) )) goto l426;
+  }
+  l427:;	  goto l398;
+  l426:;	  G->pos= yypos398; G->thunkpos= yythunkpos398;  yyText(G, G->begin, G->end);  if (!( !ext(EXT_DELIMITER_EMPH) && dispatch(INLINE_EMPH) )) goto l429;
+  {  int yypos430= G->pos, yythunkpos430= G->thunkpos;  if (!yy_Emph(G)) goto l431;  goto l430;
+  l431:;	  G->pos= yypos430; G->thunkpos= yythunkpos430;  yyText(G, G->begin, G->end);  if (!( failed(INLINE_EMPH) )) goto l429;
+  }
+  l430:;	  goto l398;
+  l429:;	  G->pos= yypos398; G->thunkpos= yythunkpos398;  yyText(G, G->begin, G->end);  if (!( !ext(EXT_COMPATIBILITY) && dispatch(INLINE_CITATION) )) goto l432;
+  {  int yypos433= G->pos, yythunkpos433= G->thunkpos;  if (!yy_CitationReference(G)) goto l434;  goto l433;
+  l434:;	  G->pos= yypos433; G->thunkpos= yythunkpos433;  yyText(G, G->begin, G->end);  if (!( failed(INLINE_CITATION) )) goto l432;
+  }
+  l433:;	  goto l398;
+  l432:;	  G->pos= yypos398; G->thunkpos= yythunkpos398;  yyText(G, G->begin, G->end);  if (!( !ext(EXT_COMPATIBILITY) && dispatch(INLINE_VARIABLE) )) goto l435;
+  {  int yypos436= G->pos, yythunkpos436= G->thunkpos;  if (!yy_Variable(G)) goto l437;  goto l436;
+  l437:;	  G->pos= yypos436; G->thunkpos= yythunkpos436;  yyText(G, G->begin, G->end);  if (!( failed(INLINE_VARIABLE) )) goto l435;
+  }
+  l436:;	  goto l398;
+  l435:;	  G->pos= yypos398; G->thunkpos= yythunkpos398;  yyText(G, G->begin, G->end);  if (!( dispatch(INLINE_IMAGE) )) goto l438;
+  {  int yypos439= G->pos, yythunkpos439= G->thunkpos;  if (!yy_Image(G)) goto l440;  goto l439;
+  l440:;	  G->pos= yypos439; G->thunkpos= yythunkpos439;  yyText(G, G->begin, G->end);  if (!( failed(INLINE_IMAGE) )) goto l438;
+  }
+  l439:;	  goto l398;
+  l438:;	  G->pos= yypos398; G->thunkpos= yythunkpos398;  yyText(G, G->begin, G->end);  if (!( dispatch(INLINE_LINK) )) goto l441;
+  {  int yypos442= G->pos, yythunkpos442= G->thunkpos;  if (!yy_Link(G)) goto l443;  goto l442;
+  l443:;	  G->pos= yypos442; G->thunkpos= yythunkpos442;  yyText(G, G->begin, G->end);  if (!( failed(INLINE_LINK) )) goto l441;
+  }
+  l442:;	  goto l398;
+  l441:;	  G->pos= yypos398; G->thunkpos= yythunkpos398;  yyText(G, G->begin, G->end);  if (!( dispatch(INLINE_NOTE_REFERENCE) )) goto l444;
+  {  int yypos445= G->pos, yythunkpos445= G->thunkpos;  if (!yy_NoteReference(G)) goto l446;  goto l445;
+  l446:;	  G->pos= yypos445; G->thunkpos= yythunkpos445;  yyText(G, G->begin, G->end);  if (!( failed(INLINE_NOTE_REFERENCE) )) goto l444;
+  }
+  l445:;	  goto l398;
+  l444:;	  G->pos= yypos398; G->thunkpos= yythunkpos398;  yyText(G, G->begin, G->end);  if (!( dispatch(INLINE_CODE) )) goto l447;
+  {  int yypos448= G->pos, yythunkpos448= G->thunkpos;  if (!yy_Code(G)) goto l449;  goto l448;
+  l449:;	  G->pos= yypos448; G->thunkpos= yythunkpos448;  yyText(G, G->begin, G->end);  if (!( failed(INLINE_CODE) )) goto l447;
+  }
+  l448:;	  goto l398;
+  l447:;	  G->pos= yypos398; G->thunkpos= yythunkpos398;  yyText(G, G->begin, G->end);  if (!( dispatch(INLINE_HTML_TAG_OPEN) )) goto l450;
+  {  int yypos451= G->pos, yythunkpos451= G->thunkpos;  if (!yy_MarkdownHtmlTagOpen(G)) goto l452;  goto l451;
+  l452:;	  G->pos= yypos451; G->thunkpos= yythunkpos451;  yyText(G, G->begin, G->end);  if (!( failed(INLINE_HTML_TAG_OPEN) )) goto l450;
+  }
+  l451:;	  goto l398;
+  l450:;	  G->pos= yypos398; G->thunkpos= yythunkpos398;  yyText(G, G->begin, G->end);  if (!( dispatch(INLINE_RAW_HTML) )) goto l453;
+  {  int yypos454= G->pos, yythunkpos454= G->thunkpos;  if (!yy_RawHtml(G)) goto l455;  goto l454;
+  l455:;	  G->pos= yypos454; G->thunkpos= yythunkpos454;  yyText(G, G->begin, G->end);  if (!( failed(INLINE_RAW_HTML) )) goto l453;
+  }
+  l454:;	  goto l398;
+  l453:;	  G->pos= yypos398; G->thunkpos= yythunkpos398;  yyText(G, G->begin, G->end);  if (!( dispatch(INLINE_ENTITY) )) goto l456;
+  {  int yypos457= G->pos, yythunkpos457= G->thunkpos;  if (!yy_Entity(G)) goto l458;  goto l457;
+  l458:;	  G->pos= yypos457; G->thunkpos= yythunkpos457;  yyText(G, G->begin, G->end);  if (!( failed(INLINE_ENTITY) )) goto l456;
+  }
+  l457:;	  goto l398;
+  l456:;	  G->pos= yypos398; G->thunkpos= yythunkpos398;  yyText(G, G->begin, G->end);  if (!( dispatch(INLINE_ESCAPED_CHAR) )) goto l459;
+  {  int yypos460= G->pos, yythunkpos460= G->thunkpos;  if (!yy_EscapedChar(G)) goto l461;  goto l460;
+  l461:;	  G->pos= yypos460; G->thunkpos= yythunkpos460;  yyText(G, G->begin, G->end);  if (!( failed(INLINE_ESCAPED_CHAR) )) goto l459;
+  }
+  l460:;	  goto l398;
+  l459:;	  G->pos= yypos398; G->thunkpos= yythunkpos398;  yyText(G, G->begin, G->end);  if (!( dispatch(INLINE_SMART) )) goto l462;
+  {  int yypos463= G->pos, yythunkpos463= G->thunkpos;  if (!yy_Smart(G)) goto l464;  goto l463;
+  l464:;	  G->pos= yypos463; G->thunkpos= yythunkpos463;  yyText(G, G->begin, G->end);  if (!( failed(INLINE_SMART) )) goto l462;
+  }
+  l463:;	  goto l398;
+  l462:;	  G->pos= yypos398; G->thunkpos= yythunkpos398;  yyText(G, G->begin, G->end);  if (!( dispatch(INLINE_SYMBOL) )) goto l397;
+  {  int yypos465= G->pos, yythunkpos465= G->thunkpos;  if (!yy_Symbol(G)) goto l466;  goto l465;
+  l466:;	  G->pos= yypos465; G->thunkpos= yythunkpos465;  yyText(G, G->begin, G->end);  if (!( failed(INLINE_SYMBOL) )) goto l397;
+  }
+  l465:;	
+  }
+  l398:;	  goto l396;
+  l397:;	  G->pos= yypos396; G->thunkpos= yythunkpos396;  yyText(G, G->begin, G->end);  if (!( memo_fail(MEMO_INLINE) )) goto l395;
+  }
+  l396:;	
+  yyprintf((stderr, "  ok   %s @ %s\n", "Inline", G->buf+G->pos));
+  return 1;
+  l395:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "Inline", G->buf+G->pos));
+  return 0;
+}
+YY_RULE(int) yy_Inlines(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyDo(G, yyPush, 2, 0);
+  yyprintf((stderr, "%s\n", "Inlines"));  if (!yy_StartList(G)) goto l382;  yyDo(G, yySet, -1, 0);
+  {  int yypos385= G->pos, yythunkpos385= G->thunkpos;
+  {  int yypos387= G->pos, yythunkpos387= G->thunkpos;  if (!yy_Endline(G)) goto l387;  goto l386;
+  l387:;	  G->pos= yypos387; G->thunkpos= yythunkpos387;
+  }  if (!yy_Inline(G)) goto l386;  yyDo(G, yy_1_Inlines, G->begin, G->end);  goto l385;
+  l386:;	  G->pos= yypos385; G->thunkpos= yythunkpos385;  if (!yy_Endline(G)) goto l382;  yyDo(G, yySet, -2, 0);
+  {  int yypos388= G->pos, yythunkpos388= G->thunkpos;  if (!yy_Inline(G)) goto l382;  G->pos= yypos388; G->thunkpos= yythunkpos388;
+  }  yyDo(G, yy_2_Inlines, G->begin, G->end);
+  }
+  l385:;	
+  l383:;	
+  {  int yypos384= G->pos, yythunkpos384= G->thunkpos;
+  {  int yypos389= G->pos, yythunkpos389= G->thunkpos;
+  {  int yypos391= G->pos, yythunkpos391= G->thunkpos;  if (!yy_Endline(G)) goto l391;  goto l390;
+  l391:;	  G->pos= yypos391; G->thunkpos= yythunkpos391;
+  }  if (!yy_Inline(G)) goto l390;  yyDo(G, yy_1_Inlines, G->begin, G->end);  goto l389;
+  l390:;	  G->pos= yypos389; G->thunkpos= yythunkpos389;  if (!yy_Endline(G)) goto l384;  yyDo(G, yySet, -2, 0);
+  {  int yypos392= G->pos, yythunkpos392= G->thunkpos;  if (!yy_Inline(G)) goto l384;  G->pos= yypos392; G->thunkpos= yythunkpos392;
+  }  yyDo(G, yy_2_Inlines, G->begin, G->end);
+  }
+  l389:;	  goto l383;
+  l384:;	  G->pos= yypos384; G->thunkpos= yythunkpos384;
+  }
+  {  int yypos393= G->pos, yythunkpos393= G->thunkpos;  if (!yy_voidEndline(G)) goto l393;  goto l394;
+  l393:;	  G->pos= yypos393; G->thunkpos= yythunkpos393;
+  }
+  l394:;	  yyDo(G, yy_3_Inlines, G->begin, G->end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "Inlines", G->buf+G->pos));  yyDo(G, yyPop, 2, 0);
+  return 1;
+  l382:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "Inlines", G->buf+G->pos));
+  return 0;
+}
+YY_RULE(int) yy_Plain(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyDo(G, yyPush, 1, 0);
+  yyprintf((stderr, "%s\n", "Plain"));  if (!yy_Inlines(G)) goto l381;  yyDo(G, yySet, -1, 0);  yyDo(G, yy_1_Plain, G->begin, G->end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "Plain", G->buf+G->pos));  yyDo(G, yyPop, 1, 0);
+  return 1;
+  l381:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "Plain", G->buf+G->pos));
+  return 0;
+}
+YY_RULE(int) yy_Para(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyDo(G, yyPush, 1, 0);
+  yyprintf((stderr, "%s\n", "Para"));  if (!yy_NonindentSpace(G)) goto l378;  if (!yy_Inlines(G)) goto l378;  yyDo(G, yySet, -1, 0);  if (!yy_BlankLine(G)) goto l378;
+  l379:;	
+  {  int yypos380= G->pos, yythunkpos380= G->thunkpos;  if (!yy_BlankLine(G)) goto l380;  goto l379;
+  l380:;	  G->pos= yypos380; G->thunkpos= yythunkpos380;
+  }  yyDo(G, yy_1_Para, G->begin, G->end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "Para", G->buf+G->pos));  yyDo(G, yyPop, 1, 0);
+  return 1;
+  l378:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "Para", G->buf+G->pos));
+  return 0;
+}
+YY_RULE(int) yy_Entity(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;
+  yyprintf((stderr, "%s\n", "Entity"));
+  {  int yypos375= G->pos, yythunkpos375= G->thunkpos;  if (!yy_HexEntity(G)) goto l376;  goto l375;
+  l376:;	  G->pos= yypos375; G->thunkpos= yythunkpos375;  if (!yy_DecEntity(G)) goto l377;  goto l375;
+  l377:;	  G->pos= yypos375; G->thunkpos= yythunkpos375;  if (!yy_CharEntity(G)) goto l374;
+  }
+  l375:;	  yyDo(G, yy_1_Entity, G->begin, G->end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "Entity", G->buf+G->pos));
+  return 1;
+  l374:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "Entity", G->buf+G->pos));
+  return 0;
+}
+YY_RULE(int) yy_EscapedChar(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;
+  yyprintf((stderr, "%s\n", "EscapedChar"));  if (!yymatchChar(G, '\\')) goto l373;  yyText(G, G->begin, G->end);  if (!(YY_BEGIN)) goto l373;  if (!yymatchClass(G, (unsigned char *)"\000\004\000\000\236\157\000\120\000\000\000\370\001\000\000\170\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l373;  yyText(G, G->begin, G->end);  if (!(YY_END)) goto l373;  yyDo(G, yy_1_EscapedChar, G->begin, G->end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "EscapedChar", G->buf+G->pos));
+  return 1;
+  l373:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "EscapedChar", G->buf+G->pos));
+  return 0;
+}
+YY_RULE(int) yy_Symbol(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;
+  yyprintf((stderr, "%s\n", "Symbol"));  yyText(G, G->begin, G->end);  if (!(YY_BEGIN)) goto l372;  if (!yy_SpecialChar(G)) goto l372;  yyText(G, G->begin, G->end);  if (!(YY_END)) goto l372;  yyDo(G, yy_1_Symbol, G->begin, G->end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "Symbol", G->buf+G->pos));
+  return 1;
+  l372:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "Symbol", G->buf+G->pos));
+  return 0;
+}
+YY_RULE(int) yy_OptionallyIndentedLine(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;
+  yyprintf((stderr, "%s\n", "OptionallyIndentedLine"));
+  {  int yypos370= G->pos, yythunkpos370= G->thunkpos;  if (!yy_Indent(G)) goto l370;  goto l371;
+  l370:;	  G->pos= yypos370; G->thunkpos= yythunkpos370;
+  }
+  l371:;	  if (!yy_LineView(G)) goto l369;
+  yyprintf((stderr, "  ok   %s @ %s\n", "OptionallyIndentedLine", G->buf+G->pos));
+  return 1;
+  l369:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "OptionallyIndentedLine", G->buf+G->pos));
+  return 0;
+}
+YY_RULE(int) yy_IndentedLine(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;
+  yyprintf((stderr, "%s\n", "IndentedLine"));  if (!yy_Indent(G)) goto l368;  if (!yy_Line(G)) goto l368;
+  yyprintf((stderr, "  ok   %s @ %s\n", "IndentedLine", G->buf+G->pos));
+  return 1;
+  l368:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "IndentedLine", G->buf+G->pos));
+  return 0;
+}
+YY_RULE(int) yy_Indent(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;
+  yyprintf((stderr, "%s\n", "Indent"));
+  {  int yypos366= G->pos, yythunkpos366= G->thunkpos;  if (!yymatchChar(G, '\011')) goto l367;  goto l366;
+  l367:;	  G->pos= yypos366; G->thunkpos= yythunkpos366;  if (!yymatchString(G, "    ")) goto l365;
+  }
+  l366:;	
+  yyprintf((stderr, "  ok   %s @ %s\n", "Indent", G->buf+G->pos));
+  return 1;
+  l365:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "Indent", G->buf+G->pos));
+  return 0;
+}
+YY_RULE(int) yy_NonindentSpace(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;
+  yyprintf((stderr, "%s\n", "NonindentSpace"));
+  {  int yypos361= G->pos, yythunkpos361= G->thunkpos;  if (!yymatchString(G, "   ")) goto l362;  goto l361;
+  l362:;	  G->pos= yypos361; G->thunkpos= yythunkpos361;  if (!yymatchString(G, "  ")) goto l363;  goto l361;
+  l363:;	  G->pos= yypos361; G->thunkpos= yythunkpos361;  if (!yymatchChar(G, ' ')) goto l364;  goto l361;
+  l364:;	  G->pos= yypos361; G->thunkpos= yythunkpos361;  if (!yymatchString(G, "")) goto l360;
+  }
+  l361:;	
+  yyprintf((stderr, "  ok   %s @ %s\n", "NonindentSpace", G->buf+G->pos));
+  return 1;
+  l360:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "NonindentSpace", G->buf+G->pos));
+  return 0;
+}
+YY_RULE(int) yy_CharEntity(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;
+  yyprintf((stderr, "%s\n", "CharEntity"));  yyText(G, G->begin, G->end);  if (!(YY_BEGIN)) goto l357;  if (!yymatchChar(G, '&')) goto l357;  if (!yymatchClass(G, (unsigned char *)"\000\000\000\000\000\000\377\003\376\377\377\007\376\377\377\007\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l357;
+  l358:;	
+  {  int yypos359= G->pos, yythunkpos359= G->thunkpos;  if (!yymatchClass(G, (unsigned char *)"\000\000\000\000\000\000\377\003\376\377\377\007\376\377\377\007\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l359;  goto l358;
+  l359:;	  G->pos= yypos359; G->thunkpos= yythunkpos359;
+  }  if (!yymatchChar(G, ';')) goto l357;  yyText(G, G->begin, G->end);  if (!(YY_END)) goto l357;
+  yyprintf((stderr, "  ok   %s @ %s\n", "CharEntity", G->buf+G->pos));
+  return 1;
+  l357:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "CharEntity", G->buf+G->pos));
+  return 0;
+}
+YY_RULE(int) yy_DecEntity(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;
+  yyprintf((stderr, "%s\n", "DecEntity"));  yyText(G, G->begin, G->end);  if (!(YY_BEGIN)) goto l354;  if (!yymatchChar(G, '&')) goto l354;  if (!yymatchChar(G, '#')) goto l354;  if (!yymatchClass(G, (unsigned char *)"\000\000\000\000\000\000\377\003\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l354;
+  l355:;	
+  {  int yypos356= G->pos, yythunkpos356= G->thunkpos;  if (!yymatchClass(G, (unsigned char *)"\000\000\000\000\000\000\377\003\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l356;  goto l355;
+  l356:;	  G->pos= yypos356; G->thunkpos= yythunkpos356;
+  }  yyText(G, G->begin, G->end);  if (!(YY_END)) goto l354;  if (!yymatchChar(G, ';')) goto l354;  yyText(G, G->begin, G->end);  if (!(YY_END)) goto l354;
+  yyprintf((stderr, "  ok   %s @ %s\n", "DecEntity", G->buf+G->pos));
+  return 1;
+  l354:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "DecEntity", G->buf+G->pos));
+  return 0;
+}
+YY_RULE(int) yy_HexEntity(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;
+  yyprintf((stderr, "%s\n", "HexEntity"));  yyText(G, G->begin, G->end);  if (!(YY_BEGIN)) goto l351;  if (!yymatchChar(G, '&')) goto l351;  if (!yymatchChar(G, '#')) goto l351;  if (!yymatchClass(G, (unsigned char *)"\000\000\000\000\000\000\000\000\000\000\000\001\000\000\000\001\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l351;  if (!yymatchClass(G, (unsigned char *)"\000\000\000\000\000\000\377\003\176\000\000\000\176\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l351;
+  l352:;	
+  {  int yypos353= G->pos, yythunkpos353= G->thunkpos;  if (!yymatchClass(G, (unsigned char *)"\000\000\000\000\000\000\377\003\176\000\000\000\176\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l353;  goto l352;
+  l353:;	  G->pos= yypos353; G->thunkpos= yythunkpos353;
+  }  if (!yymatchChar(G, ';')) goto l351;  yyText(G, G->begin, G->end);  if (!(YY_END)) goto l351;
+  yyprintf((stderr, "  ok   %s @ %s\n", "HexEntity", G->buf+G->pos));
+  return 1;
+  l351:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "HexEntity", G->buf+G->pos));
+  return 0;
+}
+YY_RULE(int) yy_Digit(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;
+  yyprintf((stderr, "%s\n", "Digit"));  if (!yymatchClass(G, (unsigned char *)"\000\000\000\000\000\000\377\003\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l350;
+  yyprintf((stderr, "  ok   %s @ %s\n", "Digit", G->buf+G->pos));
+  return 1;
+  l350:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "Digit", G->buf+G->pos));
+  return 0;
+}
+YY_RULE(int) yy_AlphanumericAscii(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;
+  yyprintf((stderr, "%s\n", "AlphanumericAscii"));  if (!yymatchClass(G, (unsigned char *)"\000\000\000\000\000\000\377\003\376\377\377\007\376\377\377\007\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l349;
+  yyprintf((stderr, "  ok   %s @ %s\n", "AlphanumericAscii", G->buf+G->pos));
+  return 1;
+  l349:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "AlphanumericAscii", G->buf+G->pos));
+  return 0;
+}
+YY_RULE(int) yy_Alphanumeric(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;
+  yyprintf((stderr, "%s\n", "Alphanumeric"));  yyText(G, G->begin, G->end);  if (!( char_is(CHAR_ALNUM) )) goto l348;  if (!yymatchDot(G)) goto l348;
+  yyprintf((stderr, "  ok   %s @ %s\n", "Alphanumeric", G->buf+G->pos));
+  return 1;
+  l348:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "Alphanumeric", G->buf+G->pos));
+  return 0;
+}
+YY_RULE(int) yy_RawHtml(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;
+  yyprintf((stderr, "%s\n", "RawHtml"));  yyText(G, G->begin, G->end);  if (!(YY_BEGIN)) goto l344;
+  {  int yypos345= G->pos, yythunkpos345= G->thunkpos;  if (!yy_HtmlComment(G)) goto l346;  goto l345;
+  l346:;	  G->pos= yypos345; G->thunkpos= yythunkpos345;  if (!yy_HtmlBlockScript(G)) goto l347;  goto l345;
+  l347:;	  G->pos= yypos345; G->thunkpos= yythunkpos345;  if (!yy_HtmlTag(G)) goto l344;
+  }
+  l345:;	  yyText(G, G->begin, G->end);  if (!(YY_END)) goto l344;  yyDo(G, yy_1_RawHtml, G->begin, G->end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "RawHtml", G->buf+G->pos));
+  return 1;
+  l344:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "RawHtml", G->buf+G->pos));
+  return 0;
+}
+YY_RULE(int) yy_HtmlTag(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;
+  yyprintf((stderr, "%s\n", "HtmlTag"));  if (!yymatchChar(G, '<')) goto l335;  if (!yy_Spnl(G)) goto l335;
+  {  int yypos336= G->pos, yythunkpos336= G->thunkpos;  if (!yymatchChar(G, '/')) goto l336;  goto l337;
+  l336:;	  G->pos= yypos336; G->thunkpos= yythunkpos336;
+  }
+  l337:;	  if (!yy_AlphanumericAscii(G)) goto l335;
+  l338:;	
+  {  int yypos339= G->pos, yythunkpos339= G->thunkpos;  if (!yy_AlphanumericAscii(G)) goto l339;  goto l338;
+  l339:;	  G->pos= yypos339; G->thunkpos= yythunkpos339;
+  }  if (!yy_Spnl(G)) goto l335;
+  l340:;	
+  {  int yypos341= G->pos, yythunkpos341= G->thunkpos;  if (!yy_HtmlAttribute(G)) goto l341;  goto l340;
+  l341:;	  G->pos= yypos341; G->thunkpos= yythunkpos341;
+  }
+  {  int yypos342= G->pos, yythunkpos342= G->thunkpos;  if (!yymatchChar(G, '/')) goto l342;  goto l343;
+  l342:;	  G->pos= yypos342; G->thunkpos= yythunkpos342;
+  }
+  l343:;	  if (!yy_Spnl(G)) goto l335;  if (!yymatchChar(G, '>')) goto l335;
+  yyprintf((stderr, "  ok   %s @ %s\n", "HtmlTag", G->buf+G->pos));
+  return 1;
+  l335:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "HtmlTag", G->buf+G->pos));
+  return 0;
+}
+YY_RULE(int) yy_HtmlComment(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;
+  yyprintf((stderr, "%s\n", "HtmlComment"));  if (!yymatchString(G, "<!--")) goto l331;
+  l332:;	
+  {  int yypos333= G->pos, yythunkpos333= G->thunkpos;
+  {  int yypos334= G->pos, yythunkpos334= G->thunkpos;  if (!yymatchString(G, "-->")) goto l334;  goto l333;
+  l334:;	  G->pos= yypos334; G->thunkpos= yythunkpos334;
+  }  if (!yymatchDot(G)) goto l333;  goto l332;
+  l333:;	  G->pos= yypos333; G->thunkpos= yythunkpos333;
+  }  if (!yymatchString(G, "-->")) goto l331;
+  yyprintf((stderr, "  ok   %s @ %s\n", "HtmlComment", G->buf+G->pos));
+  return 1;
+  l331:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "HtmlComment", G->buf+G->pos));
+  return 0;
+}
+YY_RULE(int) yy_HtmlAttribute(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;
+  yyprintf((stderr, "%s\n", "HtmlAttribute"));
+  {  int yypos317= G->pos, yythunkpos317= G->thunkpos;  if (!yy_AlphanumericAscii(G)) goto l318;  goto l317;
+  l318:;	  G->pos= yypos317; G->thunkpos= yythunkpos317;  if (!yymatchChar(G, '-')) goto l319;  goto l317;
+  l319:;	  G->pos= yypos317; G->thunkpos= yythunkpos317;  if (!yymatchChar(G, ':')) goto l314;
+  }
+  l317:;	
+  l315:;	
+  {  int yypos316= G->pos, yythunkpos316= G->thunkpos;
+  {  int yypos320= G->pos, yythunkpos320= G->thunkpos;  if (!yy_AlphanumericAscii(G)) goto l321;  goto l320;
+  l321:;	  G->pos= yypos320; G->thunkpos= yythunkpos320;  if (!yymatchChar(G, '-')) goto l322;  goto l320;
+  l322:;	  G->pos= yypos320; G->thunkpos= yythunkpos320;  if (!yymatchChar(G, ':')) goto l316;
+  }
+  l320:;	  goto l315;
+  l316:;	  G->pos= yypos316; G->thunkpos= yythunkpos316;
+  }  if (!yy_Spnl(G)) goto l314;
+  {  int yypos323= G->pos, yythunkpos323= G->thunkpos;  if (!yymatchChar(G, '=')) goto l323;  if (!yy_Spnl(G)) goto l323;
+  {  int yypos325= G->pos, yythunkpos325= G->thunkpos;  if (!yy_Quoted(G)) goto l326;  goto l325;
+  l326:;	  G->pos= yypos325; G->thunkpos= yythunkpos325;
+  {  int yypos329= G->pos, yythunkpos329= G->thunkpos;  if (!yymatchChar(G, '>')) goto l329;  goto l323;
+  l329:;	  G->pos= yypos329; G->thunkpos= yythunkpos329;
+  }  if (!yy_Nonspacechar(G)) goto l323;
+  l327:;	
+  {  int yypos328= G->pos, yythunkpos328= G->thunkpos;
+  {  int yypos330= G->pos, yythunkpos330= G->thunkpos;  if (!yymatchChar(G, '>')) goto l330;  goto l328;
+  l330:;	  G->pos= yypos330; G->thunkpos= yythunkpos330;
+  }  if (!yy_Nonspacechar(G)) goto l328;  goto l327;
+  l328:;	  G->pos= yypos328; G->thunkpos= yythunkpos328;
+  }
+  }
+  l325:;	  goto l324;
+  l323:;	  G->pos= yypos323; G->thunkpos= yythunkpos323;
+  }
+  l324:;	  if (!yy_Spnl(G)) goto l314;
+  yyprintf((stderr, "  ok   %s @ %s\n", "HtmlAttribute", G->buf+G->pos));
+  return 1;
+  l314:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "HtmlAttribute", G->buf+G->pos));
+  return 0;
+}
+YY_RULE(int) yy_Quoted(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;
+  yyprintf((stderr, "%s\n", "Quoted"));
+  {  int yypos306= G->pos, yythunkpos306= G->thunkpos;  if (!yymatchChar(G, '"')) goto l307;
+  l308:;	
+  {  int yypos309= G->pos, yythunkpos309= G->thunkpos;
+  {  int yypos310= G->pos, yythunkpos310= G->thunkpos;  if (!yymatchChar(G, '"')) goto l310;  goto l309;
+  l310:;	  G->pos= yypos310; G->thunkpos= yythunkpos310;
+  }  if (!yymatchDot(G)) goto l309;  goto l308;
+  l309:;	  G->pos= yypos309; G->thunkpos= yythunkpos309;
+  }  if (!yymatchChar(G, '"')) goto l307;  goto l306;
+  l307:;	  G->pos= yypos306; G->thunkpos= yythunkpos306;  if (!yymatchChar(G, '\'')) goto l305;
+  l311:;	
+  {  int yypos312= G->pos, yythunkpos312= G->thunkpos;
+  {  int yypos313= G->pos, yythunkpos313= G->thunkpos;  if (!yymatchChar(G, '\'')) goto l313;  goto l312;
+  l313:;	  G->pos= yypos313; G->thunkpos= yythunkpos313;
+  }  if (!yymatchDot(G)) goto l312;  goto l311;
+  l312:;	  G->pos= yypos312; G->thunkpos= yythunkpos312;
+  }  if (!yymatchChar(G, '\'')) goto l305;
+  }
+  l306:;	
+  yyprintf((stderr, "  ok   %s @ %s\n", "Quoted", G->buf+G->pos));
+  return 1;
+  l305:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "Quoted", G->buf+G->pos));
+  return 0;
+}
+YY_RULE(int) yy_NonPunctuation(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;
+  yyprintf((stderr, "%s\n", "NonPunctuation"));
+  {  int yypos300= G->pos, yythunkpos300= G->thunkpos;  yyText(G, G->begin, G->end);  if (!( char_is(CHAR_NONPUNCT) )) goto l301;  if (!yymatchDot(G)) goto l301;  goto l300;
+  l301:;	  G->pos= yypos300; G->thunkpos= yythunkpos300;
+  {  int yypos302= G->pos, yythunkpos302= G->thunkpos;
+  {  int yypos303= G->pos, yythunkpos303= G->thunkpos;  if (!yymatchString(G, "\343\200\202")) goto l304;  goto l303;
+  l304:;	  G->pos= yypos303; G->thunkpos= yythunkpos303;  if (!yymatchString(G, "\343\200\201")) goto l302;
+  }
+  l303:;	  goto l299;
+  l302:;	  G->pos= yypos302; G->thunkpos= yythunkpos302;
+  }  if (!yymatchString(G, "\343")) goto l299;
+  }
+  l300:;	
+  yyprintf((stderr, "  ok   %s @ %s\n", "NonPunctuation", G->buf+G->pos));
+  return 1;
+  l299:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "NonPunctuation", G->buf+G->pos));
+  return 0;
+}
+YY_RULE(int) yy_Punctuation(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;
+  yyprintf((stderr, "%s\n", "Punctuation"));
+  {  int yypos291= G->pos, yythunkpos291= G->thunkpos;  if (!yymatchChar(G, '.')) goto l292;  goto l291;
+  l292:;	  G->pos= yypos291; G->thunkpos= yythunkpos291;  if (!yymatchChar(G, ',')) goto l293;  goto l291;
+  l293:;	  G->pos= yypos291; G->thunkpos= yythunkpos291;  if (!yymatchChar(G, '\077')) goto l294;  goto l291;
+  l294:;	  G->pos= yypos291; G->thunkpos= yythunkpos291;  if (!yymatchChar(G, '!')) goto l295;  goto l291;
+  l295:;	  G->pos= yypos291; G->thunkpos= yythunkpos291;  if (!yymatchChar(G, ';')) goto l296;  goto l291;
+  l296:;	  G->pos= yypos291; G->thunkpos= yythunkpos291;  if (!yymatchChar(G, ':')) goto l297;  goto l291;
+  l297:;	  G->pos= yypos291; G->thunkpos= yythunkpos291;  if (!yymatchString(G, "\343\200\202")) goto l298;  goto l291;
+  l298:;	  G->pos= yypos291; G->thunkpos= yythunkpos291;  if (!yymatchString(G, "\343\200\201")) goto l290;
+  }
+  l291:;	
+  yyprintf((stderr, "  ok   %s @ %s\n", "Punctuation", G->buf+G->pos));
+  return 1;
+  l290:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "Punctuation", G->buf+G->pos));
+  return 0;
+}
+YY_RULE(int) yy_SpecialChar(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;
+  yyprintf((stderr, "%s\n", "SpecialChar"));
+  {  int yypos287= G->pos, yythunkpos287= G->thunkpos;  yyText(G, G->begin, G->end);  if (!( char_is(CHAR_SPECIAL) )) goto l288;  if (!yymatchDot(G)) goto l288;  goto l287;
+  l288:;	  G->pos= yypos287; G->thunkpos= yythunkpos287;  if (!yymatchString(G, "\343\200\202")) goto l289;  goto l287;
+  l289:;	  G->pos= yypos287; G->thunkpos= yythunkpos287;  if (!yymatchString(G, "\343\200\201")) goto l286;
+  }
+  l287:;	
+  yyprintf((stderr, "  ok   %s @ %s\n", "SpecialChar", G->buf+G->pos));
+  return 1;
+  l286:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "SpecialChar", G->buf+G->pos));
+  return 0;
+}
+YY_RULE(int) yy_NormalChar(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;
+  yyprintf((stderr, "%s\n", "NormalChar"));
+  {  int yypos281= G->pos, yythunkpos281= G->thunkpos;  yyText(G, G->begin, G->end);  if (!( char_is(CHAR_NORMAL) )) goto l282;  if (!yymatchDot(G)) goto l282;  goto l281;
+  l282:;	  G->pos= yypos281; G->thunkpos= yythunkpos281;
+  {  int yypos283= G->pos, yythunkpos283= G->thunkpos;
+  {  int yypos284= G->pos, yythunkpos284= G->thunkpos;  if (!yymatchString(G, "\343\200\202")) goto l285;  goto l284;
+  l285:;	  G->pos= yypos284; G->thunkpos= yythunkpos284;  if (!yymatchString(G, "\343\200\201")) goto l283;
+  }
+  l284:;	  goto l280;
+  l283:;	  G->pos= yypos283; G->thunkpos= yythunkpos283;
+  }  if (!yymatchString(G, "\343")) goto l280;
+  }
+  l281:;	
+  yyprintf((stderr, "  ok   %s @ %s\n", "NormalChar", G->buf+G->pos));
+  return 1;
+  l280:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "NormalChar", G->buf+G->pos));
+  return 0;
+}
+YY_RULE(int) yy_Nonspacechar(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;
+  yyprintf((stderr, "%s\n", "Nonspacechar"));
+  {  int yypos278= G->pos, yythunkpos278= G->thunkpos;  if (!yy_Spacechar(G)) goto l278;  goto l277;
+  l278:;	  G->pos= yypos278; G->thunkpos= yythunkpos278;
+  }
+  {  int yypos279= G->pos, yythunkpos279= G->thunkpos;  if (!yy_Newline(G)) goto l279;  goto l277;
+  l279:;	  G->pos= yypos279; G->thunkpos= yythunkpos279;
+  }  if (!yymatchDot(G)) goto l277;
+  yyprintf((stderr, "  ok   %s @ %s\n", "Nonspacechar", G->buf+G->pos));
+  return 1;
+  l277:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "Nonspacechar", G->buf+G->pos));
+  return 0;
+}
+YY_RULE(int) yy_Spacechar(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;
+  yyprintf((stderr, "%s\n", "Spacechar"));
+  {  int yypos275= G->pos, yythunkpos275= G->thunkpos;  if (!yymatchChar(G, ' ')) goto l276;  goto l275;
+  l276:;	  G->pos= yypos275; G->thunkpos= yythunkpos275;  if (!yymatchChar(G, '\011')) goto l274;
+  }
+  l275:;	
+  yyprintf((stderr, "  ok   %s @ %s\n", "Spacechar", G->buf+G->pos));
+  return 1;
+  l274:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "Spacechar", G->buf+G->pos));
+  return 0;
+}
+YY_RULE(int) yy_Spnl(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;
+  yyprintf((stderr, "%s\n", "Spnl"));  if (!yy_Sp(G)) goto l271;
+  {  int yypos272= G->pos, yythunkpos272= G->thunkpos;  if (!yy_Newline(G)) goto l272;  if (!yy_Sp(G)) goto l272;  goto l273;
+  l272:;	  G->pos= yypos272; G->thunkpos= yythunkpos272;
+  }
+  l273:;	
+  yyprintf((stderr, "  ok   %s @ %s\n", "Spnl", G->buf+G->pos));
+  return 1;
+  l271:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "Spnl", G->buf+G->pos));
+  return 0;
+}
+YY_RULE(int) yy_Sp(GREG *G)
+{
+  yyprintf((stderr, "%s\n", "Sp"));
+  l269:;	
+  {  int yypos270= G->pos, yythunkpos270= G->thunkpos;  if (!yy_Spacechar(G)) goto l270;  goto l269;
+  l270:;	  G->pos= yypos270; G->thunkpos= yythunkpos270;
+  }
+  yyprintf((stderr, "  ok   %s @ %s\n", "Sp", G->buf+G->pos));
+  return 1;
+}
+YY_RULE(int) yy_BlankLine(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;
+  yyprintf((stderr, "%s\n", "BlankLine"));  if (!yy_Sp(G)) goto l267;  if (!yy_Newline(G)) goto l267;
+  yyprintf((stderr, "  ok   %s @ %s\n", "BlankLine", G->buf+G->pos));
+  return 1;
+  l267:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "BlankLine", G->buf+G->pos));
+  return 0;
+}
+YY_RULE(int) yy_NonMatchingRawLine(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;
+  yyprintf((stderr, "%s\n", "NonMatchingRawLine"));
+  {  int yypos260= G->pos, yythunkpos260= G->thunkpos;
+  l262:;	
+  {  int yypos263= G->pos, yythunkpos263= G->thunkpos;
+  {  int yypos264= G->pos, yythunkpos264= G->thunkpos;  if (!yymatchChar(G, '\012')) goto l264;  goto l263;
+  l264:;	  G->pos= yypos264; G->thunkpos= yythunkpos264;
+  }  if (!yymatchDot(G)) goto l263;  goto l262;
+  l263:;	  G->pos= yypos263; G->thunkpos= yythunkpos263;
+  }  if (!yy_Newline(G)) goto l261;  goto l260;
+  l261:;	  G->pos= yypos260; G->thunkpos= yythunkpos260;  if (!yymatchDot(G)) goto l259;
+  l265:;	
+  {  int yypos266= G->pos, yythunkpos266= G->thunkpos;  if (!yymatchDot(G)) goto l266;  goto l265;
+  l266:;	  G->pos= yypos266; G->thunkpos= yythunkpos266;
+  }  if (!yy_Eof(G)) goto l259;
+  }
+  l260:;	
+  yyprintf((stderr, "  ok   %s @ %s\n", "NonMatchingRawLine", G->buf+G->pos));
+  return 1;
+  l259:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "NonMatchingRawLine", G->buf+G->pos));
+  return 0;
+}
+YY_RULE(int) yy_RawLine(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;
+  yyprintf((stderr, "%s\n", "RawLine"));
+  {  int yypos252= G->pos, yythunkpos252= G->thunkpos;  yyText(G, G->begin, G->end);  if (!(YY_BEGIN)) goto l253;
+  l254:;	
+  {  int yypos255= G->pos, yythunkpos255= G->thunkpos;
+  {  int yypos256= G->pos, yythunkpos256= G->thunkpos;  if (!yymatchChar(G, '\012')) goto l256;  goto l255;
+  l256:;	  G->pos= yypos256; G->thunkpos= yythunkpos256;
+  }  if (!yymatchDot(G)) goto l255;  goto l254;
+  l255:;	  G->pos= yypos255; G->thunkpos= yythunkpos255;
+  }  if (!yy_Newline(G)) goto l253;  yyText(G, G->begin, G->end);  if (!(YY_END)) goto l253;  goto l252;
+  l253:;	  G->pos= yypos252; G->thunkpos= yythunkpos252;  yyText(G, G->begin, G->end);  if (!(YY_BEGIN)) goto l251;  if (!yymatchDot(G)) goto l251;
+  l257:;	
+  {  int yypos258= G->pos, yythunkpos258= G->thunkpos;  if (!yymatchDot(G)) goto l258;  goto l257;
+  l258:;	  G->pos= yypos258; G->thunkpos= yythunkpos258;
+  }  yyText(G, G->begin, G->end);  if (!(YY_END)) goto l251;  if (!yy_Eof(G)) goto l251;
+  }
+  l252:;	
+  yyprintf((stderr, "  ok   %s @ %s\n", "RawLine", G->buf+G->pos));
+  return 1;
+  l251:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "RawLine", G->buf+G->pos));
+  return 0;
+}
+YY_RULE(int) yy_LineView(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;
+  yyprintf((stderr, "%s\n", "LineView"));  if (!yy_RawLine(G)) goto l250;  yyDo(G, yy_1_LineView, G->begin, G->end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "LineView", G->buf+G->pos));
+  return 1;
+  l250:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "LineView", G->buf+G->pos));
+  return 0;
+}
+YY_RULE(int) yy_Line(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;
+  yyprintf((stderr, "%s\n", "Line"));  if (!yy_RawLine(G)) goto l249;  yyDo(G, yy_1_Line, G->begin, G->end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "Line", G->buf+G->pos));
+  return 1;
+  l249:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "Line", G->buf+G->pos));
+  return 0;
+}
+YY_RULE(int) yy_Newline(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;
+  yyprintf((stderr, "%s\n", "Newline"));  if (!yymatchChar(G, '\012')) goto l248;
+  yyprintf((stderr, "  ok   %s @ %s\n", "Newline", G->buf+G->pos));
+  return 1;
+  l248:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "Newline", G->buf+G->pos));
+  return 0;
+}
+YY_RULE(int) yy_Eof(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;
+  yyprintf((stderr, "%s\n", "Eof"));
+  {  int yypos247= G->pos, yythunkpos247= G->thunkpos;  if (!yymatchDot(G)) goto l247;  goto l246;
+  l247:;	  G->pos= yypos247; G->thunkpos= yythunkpos247;
+  }
+  yyprintf((stderr, "  ok   %s @ %s\n", "Eof", G->buf+G->pos));
+  return 1;
+  l246:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "Eof", G->buf+G->pos));
+  return 0;
+}
+YY_RULE(int) yy_BOM(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;
+  yyprintf((stderr, "%s\n", "BOM"));  if (!yymatchString(G, "\357\273\277")) goto l245;
+  yyprintf((stderr, "  ok   %s @ %s\n", "BOM", G->buf+G->pos));
+  return 1;
+  l245:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "BOM", G->buf+G->pos));
+  return 0;
+}
+YY_RULE(int) yy_BlockQuoteMarker(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;
+  yyprintf((stderr, "%s\n", "BlockQuoteMarker"));  yyText(G, G->begin, G->end);  if (!(YY_BEGIN)) goto l242;  if (!yymatchChar(G, '>')) goto l242;
+  {  int yypos243= G->pos, yythunkpos243= G->thunkpos;  if (!yymatchChar(G, ' ')) goto l243;  goto l244;
+  l243:;	  G->pos= yypos243; G->thunkpos= yythunkpos243;
+  }
+  l244:;	  yyText(G, G->begin, G->end);  if (!(YY_END)) goto l242;  yyDo(G, yy_1_BlockQuoteMarker, G->begin, G->end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "BlockQuoteMarker", G->buf+G->pos));
+  return 1;
+  l242:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "BlockQuoteMarker", G->buf+G->pos));
+  return 0;
+}
+YY_RULE(int) yy_BlockQuoteRaw(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyDo(G, yyPush, 3, 0);
+  yyprintf((stderr, "%s\n", "BlockQuoteRaw"));  if (!yy_StartList(G)) goto l227;  yyDo(G, yySet, -1, 0);  if (!yy_StartList(G)) goto l227;  yyDo(G, yySet, -2, 0);  if (!yy_NonindentSpace(G)) goto l227;  if (!yy_BlockQuoteMarker(G)) goto l227;  yyDo(G, yySet, -3, 0);  if (!yy_LineView(G)) goto l227;  yyDo(G, yy_1_BlockQuoteRaw, G->begin, G->end);
+  l230:;	
+  {  int yypos231= G->pos, yythunkpos231= G->thunkpos;
+  {  int yypos232= G->pos, yythunkpos232= G->thunkpos;  if (!yy_NonindentSpace(G)) goto l232;  if (!yymatchChar(G, '>')) goto l232;  goto l231;
+  l232:;	  G->pos= yypos232; G->thunkpos= yythunkpos232;
+  }
+  {  int yypos233= G->pos, yythunkpos233= G->thunkpos;  if (!yy_BlankLine(G)) goto l233;  goto l231;
+  l233:;	  G->pos= yypos233; G->thunkpos= yythunkpos233;
+  }  if (!yy_LineView(G)) goto l231;  yyDo(G, yy_2_BlockQuoteRaw, G->begin, G->end);  goto l230;
+  l231:;	  G->pos= yypos231; G->thunkpos= yythunkpos231;
+  }
+  l234:;	
+  {  int yypos235= G->pos, yythunkpos235= G->thunkpos;  if (!yy_BlankLine(G)) goto l235;  yyDo(G, yy_3_BlockQuoteRaw, G->begin, G->end);  goto l234;
+  l235:;	  G->pos= yypos235; G->thunkpos= yythunkpos235;
+  }
+  l228:;	
+  {  int yypos229= G->pos, yythunkpos229= G->thunkpos;  if (!yy_NonindentSpace(G)) goto l229;  if (!yy_BlockQuoteMarker(G)) goto l229;  yyDo(G, yySet, -3, 0);  if (!yy_LineView(G)) goto l229;  yyDo(G, yy_1_BlockQuoteRaw, G->begin, G->end);
+  l236:;	
+  {  int yypos237= G->pos, yythunkpos237= G->thunkpos;
+  {  int yypos238= G->pos, yythunkpos238= G->thunkpos;  if (!yy_NonindentSpace(G)) goto l238;  if (!yymatchChar(G, '>')) goto l238;  goto l237;
+  l238:;	  G->pos= yypos238; G->thunkpos= yythunkpos238;
+  }
+  {  int yypos239= G->pos, yythunkpos239= G->thunkpos;  if (!yy_BlankLine(G)) goto l239;  goto l237;
+  l239:;	  G->pos= yypos239; G->thunkpos= yythunkpos239;
+  }  if (!yy_LineView(G)) goto l237;  yyDo(G, yy_2_BlockQuoteRaw, G->begin, G->end);  goto l236;
+  l237:;	  G->pos= yypos237; G->thunkpos= yythunkpos237;
+  }
+  l240:;	
+  {  int yypos241= G->pos, yythunkpos241= G->thunkpos;  if (!yy_BlankLine(G)) goto l241;  yyDo(G, yy_3_BlockQuoteRaw, G->begin, G->end);  goto l240;
+  l241:;	  G->pos= yypos241; G->thunkpos= yythunkpos241;
+  }  goto l228;
+  l229:;	  G->pos= yypos229; G->thunkpos= yythunkpos229;
+  }  yyDo(G, yy_4_BlockQuoteRaw, G->begin, G->end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "BlockQuoteRaw", G->buf+G->pos));  yyDo(G, yyPop, 3, 0);
+  return 1;
+  l227:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "BlockQuoteRaw", G->buf+G->pos));
+  return 0;
+}
+YY_RULE(int) yy_BlockQuote(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyDo(G, yyPush, 1, 0);
+  yyprintf((stderr, "%s\n", "BlockQuote"));  if (!yy_BlockQuoteRaw(G)) goto l226;  yyDo(G, yySet, -1, 0);  yyDo(G, yy_1_BlockQuote, G->begin, G->end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "BlockQuote", G->buf+G->pos));  yyDo(G, yyPop, 1, 0);
+  return 1;
+  l226:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "BlockQuote", G->buf+G->pos));
+  return 0;
+}
+YY_RULE(int) yy_SetextHeading2(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyDo(G, yyPush, 2, 0);
+  yyprintf((stderr, "%s\n", "SetextHeading2"));
+  {  int yypos217= G->pos, yythunkpos217= G->thunkpos;  if (!yy_RawLine(G)) goto l216;  if (!yy_SetextBottom2(G)) goto l216;  G->pos= yypos217; G->thunkpos= yythunkpos217;
+  }  if (!yy_StartList(G)) goto l216;  yyDo(G, yySet, -1, 0);
+  {  int yypos220= G->pos, yythunkpos220= G->thunkpos;  if (!yy_Endline(G)) goto l220;  goto l216;
+  l220:;	  G->pos= yypos220; G->thunkpos= yythunkpos220;
+  }
+  {  int yypos221= G->pos, yythunkpos221= G->thunkpos;  yyText(G, G->begin, G->end);  if (!( !ext(EXT_COMPATIBILITY) )) goto l221;  if (!yy_Sp(G)) goto l221;  if (!yy_AutoLabel(G)) goto l221;  goto l216;
+  l221:;	  G->pos= yypos221; G->thunkpos= yythunkpos221;
+  }  if (!yy_Inline(G)) goto l216;  yyDo(G, yy_1_SetextHeading2, G->begin, G->end);
+  l218:;	
+  {  int yypos219= G->pos, yythunkpos219= G->thunkpos;
+  {  int yypos222= G->pos, yythunkpos222= G->thunkpos;  if (!yy_Endline(G)) goto l222;  goto l219;
+  l222:;	  G->pos= yypos222; G->thunkpos= yythunkpos222;
+  }
+  {  int yypos223= G->pos, yythunkpos223= G->thunkpos;  yyText(G, G->begin, G->end);  if (!( !ext(EXT_COMPATIBILITY) )) goto l223;  if (!yy_Sp(G)) goto l223;  if (!yy_AutoLabel(G)) goto l223;  goto l219;
+  l223:;	  G->pos= yypos223; G->thunkpos= yythunkpos223;
+  }  if (!yy_Inline(G)) goto l219;  yyDo(G, yy_1_SetextHeading2, G->begin, G->end);  goto l218;
+  l219:;	  G->pos= yypos219; G->thunkpos= yythunkpos219;
+  }
+  {  int yypos224= G->pos, yythunkpos224= G->thunkpos;  if (!yy_Sp(G)) goto l224;  if (!yy_AutoLabel(G)) goto l224;  yyDo(G, yySet, -2, 0);  yyDo(G, yy_2_SetextHeading2, G->begin, G->end);  if (!yy_Sp(G)) goto l224;  goto l225;
+  l224:;	  G->pos= yypos224; G->thunkpos= yythunkpos224;
+  }
+  l225:;	  if (!yy_Sp(G)) goto l216;  if (!yy_Newline(G)) goto l216;  yyText(G, G->begin, G->end);  if (!(YY_BEGIN)) goto l216;  if (!yy_SetextBottom2(G)) goto l216;  yyText(G, G->begin, G->end);  if (!(YY_END)) goto l216;  yyDo(G, yy_3_SetextHeading2, G->begin, G->end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "SetextHeading2", G->buf+G->pos));  yyDo(G, yyPop, 2, 0);
+  return 1;
+  l216:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "SetextHeading2", G->buf+G->pos));
+  return 0;
+}
+YY_RULE(int) yy_SetextHeading1(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyDo(G, yyPush, 2, 0);
+  yyprintf((stderr, "%s\n", "SetextHeading1"));
+  {  int yypos207= G->pos, yythunkpos207= G->thunkpos;  if (!yy_RawLine(G)) goto l206;  if (!yy_SetextBottom1(G)) goto l206;  G->pos= yypos207; G->thunkpos= yythunkpos207;
+  }  if (!yy_StartList(G)) goto l206;  yyDo(G, yySet, -1, 0);
+  {  int yypos210= G->pos, yythunkpos210= G->thunkpos;  if (!yy_Endline(G)) goto l210;  goto l206;
+  l210:;	  G->pos= yypos210; G->thunkpos= yythunkpos210;
+  }
+  {  int yypos211= G->pos, yythunkpos211= G->thunkpos;  yyText(G, G->begin, G->end);  if (!( !ext(EXT_COMPATIBILITY) )) goto l211;  if (!yy_Sp(G)) goto l211;  if (!yy_AutoLabel(G)) goto l211;  goto l206;
+  l211:;	  G->pos= yypos211; G->thunkpos= yythunkpos211;
+  }  if (!yy_Inline(G)) goto l206;  yyDo(G, yy_1_SetextHeading1, G->begin, G->end);
+  l208:;	
+  {  int yypos209= G->pos, yythunkpos209= G->thunkpos;
+  {  int yypos212= G->pos, yythunkpos212= G->thunkpos;  if (!yy_Endline(G)) goto l212;  goto l209;
+  l212:;	  G->pos= yypos212; G->thunkpos= yythunkpos212;
+  }
+  {  int yypos213= G->pos, yythunkpos213= G->thunkpos;  yyText(G, G->begin, G->end);  if (!( !ext(EXT_COMPATIBILITY) )) goto l213;  if (!yy_Sp(G)) goto l213;  if (!yy_AutoLabel(G)) goto l213;  goto l209;
+  l213:;	  G->pos= yypos213; G->thunkpos= yythunkpos213;
+  }  if (!yy_Inline(G)) goto l209;  yyDo(G, yy_1_SetextHeading1, G->begin, G->end);  goto l208;
+  l209:;	  G->pos= yypos209; G->thunkpos= yythunkpos209;
+  }
+  {  int yypos214= G->pos, yythunkpos214= G->thunkpos;  if (!yy_Sp(G)) goto l214;  if (!yy_AutoLabel(G)) goto l214;  yyDo(G, yySet, -2, 0);  yyDo(G, yy_2_SetextHeading1, G->begin, G->end);  if (!yy_Sp(G)) goto l214;  goto l215;
+  l214:;	  G->pos= yypos214; G->thunkpos= yythunkpos214;
+  }
+  l215:;	  if (!yy_Sp(G)) goto l206;  if (!yy_Newline(G)) goto l206;  yyText(G, G->begin, G->end);  if (!(YY_BEGIN)) goto l206;  if (!yy_SetextBottom1(G)) goto l206;  yyText(G, G->begin, G->end);  if (!(YY_END)) goto l206;  yyDo(G, yy_3_SetextHeading1, G->begin, G->end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "SetextHeading1", G->buf+G->pos));  yyDo(G, yyPop, 2, 0);
+  return 1;
+  l206:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "SetextHeading1", G->buf+G->pos));
+  return 0;
+}
+YY_RULE(int) yy_SetextBottom2(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;
+  yyprintf((stderr, "%s\n", "SetextBottom2"));  if (!yy_NonindentSpace(G)) goto l203;  if (!yymatchChar(G, '-')) goto l203;
+  l204:;	
+  {  int yypos205= G->pos, yythunkpos205= G->thunkpos;  if (!yymatchChar(G, '-')) goto l205;  goto l204;
+  l205:;	  G->pos= yypos205; G->thunkpos= yythunkpos205;
+  }  if (!yy_Sp(G)) goto l203;  if (!yy_Newline(G)) goto l203;
+  yyprintf((stderr, "  ok   %s @ %s\n", "SetextBottom2", G->buf+G->pos));
+  return 1;
+  l203:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "SetextBottom2", G->buf+G->pos));
+  return 0;
+}
+YY_RULE(int) yy_SetextBottom1(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;
+  yyprintf((stderr, "%s\n", "SetextBottom1"));  if (!yy_NonindentSpace(G)) goto l200;  if (!yymatchChar(G, '=')) goto l200;
+  l201:;	
+  {  int yypos202= G->pos, yythunkpos202= G->thunkpos;  if (!yymatchChar(G, '=')) goto l202;  goto l201;
+  l202:;	  G->pos= yypos202; G->thunkpos= yythunkpos202;
+  }  if (!yy_Sp(G)) goto l200;  if (!yy_Newline(G)) goto l200;
+  yyprintf((stderr, "  ok   %s @ %s\n", "SetextBottom1", G->buf+G->pos));
+  return 1;
+  l200:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "SetextBottom1", G->buf+G->pos));
+  return 0;
+}
+YY_RULE(int) yy_SetextHeading(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;
+  yyprintf((stderr, "%s\n", "SetextHeading"));  if (!yy_NonindentSpace(G)) goto l197;
+  {  int yypos198= G->pos, yythunkpos198= G->thunkpos;  if (!yy_SetextHeading1(G)) goto l199;  goto l198;
+  l199:;	  G->pos= yypos198; G->thunkpos= yythunkpos198;  if (!yy_SetextHeading2(G)) goto l197;
+  }
+  l198:;	
+  yyprintf((stderr, "  ok   %s @ %s\n", "SetextHeading", G->buf+G->pos));
+  return 1;
+  l197:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "SetextHeading", G->buf+G->pos));
+  return 0;
+}
+YY_RULE(int) yy_AtxHeading(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyDo(G, yyPush, 3, 0);
+  yyprintf((stderr, "%s\n", "AtxHeading"));  if (!yy_AtxStart(G)) goto l188;  yyDo(G, yySet, -1, 0);  if (!yy_Sp(G)) goto l188;  if (!yy_StartList(G)) goto l188;  yyDo(G, yySet, -2, 0);  if (!yy_AtxInline(G)) goto l188;  yyDo(G, yy_1_AtxHeading, G->begin, G->end);
+  l189:;	
+  {  int yypos190= G->pos, yythunkpos190= G->thunkpos;  if (!yy_AtxInline(G)) goto l190;  yyDo(G, yy_1_AtxHeading, G->begin, G->end);  goto l189;
+  l190:;	  G->pos= yypos190; G->thunkpos= yythunkpos190;
+  }
+  {  int yypos191= G->pos, yythunkpos191= G->thunkpos;  if (!yy_Sp(G)) goto l191;  if (!yy_AutoLabel(G)) goto l191;  yyDo(G, yySet, -3, 0);  yyDo(G, yy_2_AtxHeading, G->begin, G->end);  goto l192;
+  l191:;	  G->pos= yypos191; G->thunkpos= yythunkpos191;
+  }
+  l192:;	
+  {  int yypos193= G->pos, yythunkpos193= G->thunkpos;  if (!yy_Sp(G)) goto l193;
+  l195:;	
+  {  int yypos196= G->pos, yythunkpos196= G->thunkpos;  if (!yymatchChar(G, '#')) goto l196;  goto l195;
+  l196:;	  G->pos= yypos196; G->thunkpos= yythunkpos196;
+  }  if (!yy_Sp(G)) goto l193;  goto l194;
+  l193:;	  G->pos= yypos193; G->thunkpos= yythunkpos193;
+  }
+  l194:;	  if (!yy_Sp(G)) goto l188;  yyText(G, G->begin, G->end);  if (!(YY_BEGIN)) goto l188;  if (!yy_Newline(G)) goto l188;  yyText(G, G->begin, G->end);  if (!(YY_END)) goto l188;  yyDo(G, yy_3_AtxHeading, G->begin, G->end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "AtxHeading", G->buf+G->pos));  yyDo(G, yyPop, 3, 0);
+  return 1;
+  l188:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "AtxHeading", G->buf+G->pos));
+  return 0;
+}
+YY_RULE(int) yy_AtxStart(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;
+  yyprintf((stderr, "%s\n", "AtxStart"));  if (!yy_NonindentSpace(G)) goto l181;  yyText(G, G->begin, G->end);  if (!(YY_BEGIN)) goto l181;
+  {  int yypos182= G->pos, yythunkpos182= G->thunkpos;  if (!yymatchString(G, "######")) goto l183;  goto l182;
+  l183:;	  G->pos= yypos182; G->thunkpos= yythunkpos182;  if (!yymatchString(G, "#####")) goto l184;  goto l182;
+  l184:;	  G->pos= yypos182; G->thunkpos= yythunkpos182;  if (!yymatchString(G, "####")) goto l185;  goto l182;
+  l185:;	  G->pos= yypos182; G->thunkpos= yythunkpos182;  if (!yymatchString(G, "###")) goto l186;  goto l182;
+  l186:;	  G->pos= yypos182; G->thunkpos= yythunkpos182;  if (!yymatchString(G, "##")) goto l187;  goto l182;
+  l187:;	  G->pos= yypos182; G->thunkpos= yythunkpos182;  if (!yymatchChar(G, '#')) goto l181;
+  }
+  l182:;	  yyText(G, G->begin, G->end);  if (!(YY_END)) goto l181;  yyDo(G, yy_1_AtxStart, G->begin, G->end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "AtxStart", G->buf+G->pos));
+  return 1;
+  l181:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "AtxStart", G->buf+G->pos));
+  return 0;
+}
+YY_RULE(int) yy_AtxInline(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;
+  yyprintf((stderr, "%s\n", "AtxInline"));
+  {  int yypos174= G->pos, yythunkpos174= G->thunkpos;  if (!yy_Newline(G)) goto l174;  goto l173;
+  l174:;	  G->pos= yypos174; G->thunkpos= yythunkpos174;
+  }
+  {  int yypos175= G->pos, yythunkpos175= G->thunkpos;  yyText(G, G->begin, G->end);  if (!( !ext(EXT_COMPATIBILITY) )) goto l175;  if (!yy_Sp(G)) goto l175;  if (!yy_AutoLabel(G)) goto l175;  if (!yy_Sp(G)) goto l175;
+  l176:;	
+  {  int yypos177= G->pos, yythunkpos177= G->thunkpos;  if (!yymatchChar(G, '#')) goto l177;  goto l176;
+  l177:;	  G->pos= yypos177; G->thunkpos= yythunkpos177;
+  }  if (!yy_Sp(G)) goto l175;  if (!yy_Newline(G)) goto l175;  goto l173;
+  l175:;	  G->pos= yypos175; G->thunkpos= yythunkpos175;
+  }
+  {  int yypos178= G->pos, yythunkpos178= G->thunkpos;  if (!yy_Sp(G)) goto l178;
+  l179:;	
+  {  int yypos180= G->pos, yythunkpos180= G->thunkpos;  if (!yymatchChar(G, '#')) goto l180;  goto l179;
+  l180:;	  G->pos= yypos180; G->thunkpos= yythunkpos180;
+  }  if (!yy_Sp(G)) goto l178;  if (!yy_Newline(G)) goto l178;  goto l173;
+  l178:;	  G->pos= yypos178; G->thunkpos= yythunkpos178;
+  }  if (!yy_Inline(G)) goto l173;
+  yyprintf((stderr, "  ok   %s @ %s\n", "AtxInline", G->buf+G->pos));
+  return 1;
+  l173:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "AtxInline", G->buf+G->pos));
+  return 0;
+}
+YY_RULE(int) yy_HeadingSection(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyDo(G, yyPush, 1, 0);
+  yyprintf((stderr, "%s\n", "HeadingSection"));  if (!yy_StartList(G)) goto l170;  yyDo(G, yySet, -1, 0);  if (!yy_Heading(G)) goto l170;  yyDo(G, yy_1_HeadingSection, G->begin, G->end);
+  l171:;	
+  {  int yypos172= G->pos, yythunkpos172= G->thunkpos;  if (!yy_HeadingSectionBlock(G)) goto l172;  yyDo(G, yy_2_HeadingSection, G->begin, G->end);  goto l171;
+  l172:;	  G->pos= yypos172; G->thunkpos= yythunkpos172;
+  }  yyDo(G, yy_3_HeadingSection, G->begin, G->end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "HeadingSection", G->buf+G->pos));  yyDo(G, yyPop, 1, 0);
+  return 1;
+  l170:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "HeadingSection", G->buf+G->pos));
+  return 0;
+}
+YY_RULE(int) yy_Heading(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;
+  yyprintf((stderr, "%s\n", "Heading"));
+  {  int yypos168= G->pos, yythunkpos168= G->thunkpos;  if (!yy_SetextHeading(G)) goto l169;  goto l168;
+  l169:;	  G->pos= yypos168; G->thunkpos= yythunkpos168;  if (!yy_AtxHeading(G)) goto l167;
+  }
+  l168:;	
+  yyprintf((stderr, "  ok   %s @ %s\n", "Heading", G->buf+G->pos));
+  return 1;
+  l167:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "Heading", G->buf+G->pos));
+  return 0;
+}
+YY_RULE(int) yy_TOC(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;
+  yyprintf((stderr, "%s\n", "TOC"));  if (!yymatchString(G, "{{TOC}}")) goto l166;  if (!yy_Sp(G)) goto l166;  if (!yy_Newline(G)) goto l166;  yyDo(G, yy_1_TOC, G->begin, G->end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "TOC", G->buf+G->pos));
+  return 1;
+  l166:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "TOC", G->buf+G->pos));
+  return 0;
+}
+YY_RULE(int) yy_HeadingSectionBlock(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;
+  yyprintf((stderr, "%s\n", "HeadingSectionBlock"));
+  l143:;	
+  {  int yypos144= G->pos, yythunkpos144= G->thunkpos;  if (!yy_BlankLine(G)) goto l144;  goto l143;
+  l144:;	  G->pos= yypos144; G->thunkpos= yythunkpos144;
+  }
+  {  int yypos145= G->pos, yythunkpos145= G->thunkpos;  if (!yy_Heading(G)) goto l145;  goto l142;
+  l145:;	  G->pos= yypos145; G->thunkpos= yythunkpos145;
+  }
+  {  int yypos146= G->pos, yythunkpos146= G->thunkpos;  yyText(G, G->begin, G->end);  if (!( may_start(BLOCK_QUOTE) )) goto l147;  if (!yy_BlockQuote(G)) goto l147;  goto l146;
+  l147:;	  G->pos= yypos146; G->thunkpos= yythunkpos146;  yyText(G, G->begin, G->end);  if (!( !ext(EXT_COMPATIBILITY) && may_start(BLOCK_FENCED) )) goto l148;  if (!yy_Fenced(G)) goto l148;  goto l146;
+  l148:;	  G->pos= yypos146; G->thunkpos= yythunkpos146;  yyText(G, G->begin, G->end);  if (!( may_start(BLOCK_VERBATIM) )) goto l149;  if (!yy_Verbatim(G)) goto l149;  goto l146;
+  l149:;	  G->pos= yypos146; G->thunkpos= yythunkpos146;  yyText(G, G->begin, G->end);  if (!( !ext(EXT_COMPATIBILITY) )) goto l150;  if (!yy_DefinitionList(G)) goto l150;  goto l146;
+  l150:;	  G->pos= yypos146; G->thunkpos= yythunkpos146;  yyText(G, G->begin, G->end);  if (!( !ext(EXT_COMPATIBILITY) && may_start(BLOCK_GLOSSARY) )) goto l151;  if (!yy_Glossary(G)) goto l151;  goto l146;
+  l151:;	  G->pos= yypos146; G->thunkpos= yythunkpos146;  yyText(G, G->begin, G->end);  if (!( may_start(BLOCK_NOTE) )) goto l152;  if (!yy_Note(G)) goto l152;  goto l146;
+  l152:;	  G->pos= yypos146; G->thunkpos= yythunkpos146;  yyText(G, G->begin, G->end);  if (!( may_start(BLOCK_LINK_REFERENCE) )) goto l153;  if (!yy_LinkReference(G)) goto l153;  goto l146;
+  l153:;	  G->pos= yypos146; G->thunkpos= yythunkpos146;  yyText(G, G->begin, G->end);  if (!( !ext(EXT_COMPATIBILITY) && may_start(BLOCK_ABBREVIATION) )) goto l154;  if (!yy_Abbreviation(G)) goto l154;  goto l146;
+  l154:;	  G->pos= yypos146; G->thunkpos= yythunkpos146;  yyText(G, G->begin, G->end);  if (!( may_start(BLOCK_HORIZONTAL_RULE) )) goto l155;  if (!yy_HorizontalRule(G)) goto l155;  goto l146;
+  l155:;	  G->pos= yypos146; G->thunkpos= yythunkpos146;  yyText(G, G->begin, G->end);  if (!( may_start(BLOCK_ORDERED_LIST) )) goto l156;  if (!yy_OrderedList(G)) goto l156;  goto l146;
+  l156:;	  G->pos= yypos146; G->thunkpos= yythunkpos146;  yyText(G, G->begin, G->end);  if (!( may_start(BLOCK_BULLET_LIST) )) goto l157;  if (!yy_BulletList(G)) goto l157;  goto l146;
+  l157:;	  G->pos= yypos146; G->thunkpos= yythunkpos146;  yyText(G, G->begin, G->end);  if (!( may_start(BLOCK_HTML) )) goto l158;  if (!yy_HtmlBlock(G)) goto l158;  goto l146;
+  l158:;	  G->pos= yypos146; G->thunkpos= yythunkpos146;  yyText(G, G->begin, G->end);  if (!( may_start(BLOCK_MARKDOWN_HTML) )) goto l159;  if (!yy_MarkdownHtmlBlock(G)) goto l159;  goto l146;
+  l159:;	  G->pos= yypos146; G->thunkpos= yythunkpos146;  yyText(G, G->begin, G->end);  if (!( may_start(BLOCK_STYLE) )) goto l160;  if (!yy_StyleBlock(G)) goto l160;  goto l146;
+  l160:;	  G->pos= yypos146; G->thunkpos= yythunkpos146;  yyText(G, G->begin, G->end);  if (!( !ext(EXT_COMPATIBILITY) )) goto l161;  if (!yy_Table(G)) goto l161;  goto l146;
+  l161:;	  G->pos= yypos146; G->thunkpos= yythunkpos146;  yyText(G, G->begin, G->end);  if (!( !ext(EXT_COMPATIBILITY) && may_start(BLOCK_IMAGE) )) goto l162;  if (!yy_ImageBlock(G)) goto l162;  goto l146;
+  l162:;	  G->pos= yypos146; G->thunkpos= yythunkpos146;  yyText(G, G->begin, G->end);  if (!( !ext(EXT_COMPATIBILITY) && may_start(BLOCK_TOC) )) goto l163;  if (!yy_TOC(G)) goto l163;  goto l146;
+  l163:;	  G->pos= yypos146; G->thunkpos= yythunkpos146;
+  {  int yypos165= G->pos, yythunkpos165= G->thunkpos;  if (!yy_Sp(G)) goto l165;  if (!yy_HtmlBlockInTags(G)) goto l165;  goto l164;
+  l165:;	  G->pos= yypos165; G->thunkpos= yythunkpos165;
+  }  if (!yy_Para(G)) goto l164;  goto l146;
+  l164:;	  G->pos= yypos146; G->thunkpos= yythunkpos146;  if (!yy_Plain(G)) goto l142;
+  }
+  l146:;	
+  yyprintf((stderr, "  ok   %s @ %s\n", "HeadingSectionBlock", G->buf+G->pos));
+  return 1;
+  l142:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "HeadingSectionBlock", G->buf+G->pos));
+  return 0;
+}
+YY_RULE(int) yy_Block(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;
+  yyprintf((stderr, "%s\n", "Block"));  yyText(G, G->begin, G->end);  if (!( burn_fuel() )) goto l75;
+  l76:;	
+  {  int yypos77= G->pos, yythunkpos77= G->thunkpos;  if (!yy_BlankLine(G)) goto l77;  goto l76;
+  l77:;	  G->pos= yypos77; G->thunkpos= yythunkpos77;
+  }
+  {  int yypos78= G->pos, yythunkpos78= G->thunkpos;  yyText(G, G->begin, G->end);  if (!( dispatch(BLOCK_QUOTE) )) goto l79;
+  {  int yypos80= G->pos, yythunkpos80= G->thunkpos;  if (!yy_BlockQuote(G)) goto l81;  goto l80;
+  l81:;	  G->pos= yypos80; G->thunkpos= yythunkpos80;  yyText(G, G->begin, G->end);  if (!( failed(BLOCK_QUOTE) )) goto l79;
+  }
+  l80:;	  goto l78;
+  l79:;	  G->pos= yypos78; G->thunkpos= yythunkpos78;  yyText(G, G->begin, G->end);  if (!( !ext(EXT_COMPATIBILITY) && dispatch(BLOCK_FENCED) )) goto l82;
+  {  int yypos83= G->pos, yythunkpos83= G->thunkpos;  if (!yy_Fenced(G)) goto l84;  goto l83;
+  l84:;	  G->pos= yypos83; G->thunkpos= yythunkpos83;  yyText(G, G->begin, G->end);  if (!( failed(BLOCK_FENCED) )) goto l82;
+  }
+  l83:;	  goto l78;
+  l82:;	  G->pos= yypos78; G->thunkpos= yythunkpos78;  yyText(G, G->begin, G->end);  if (!( dispatch(BLOCK_VERBATIM) )) goto l85;
+  {  int yypos86= G->pos, yythunkpos86= G->thunkpos;  if (!yy_Verbatim(G)) goto l87;  goto l86;
+  l87:;	  G->pos= yypos86; G->thunkpos= yythunkpos86;  yyText(G, G->begin, G->end);  if (!( failed(BLOCK_VERBATIM) )) goto l85;
+  }
+  l86:;	  goto l78;
+  l85:;	  G->pos= yypos78; G->thunkpos= yythunkpos78;  yyText(G, G->begin, G->end);  if (!( !ext(EXT_COMPATIBILITY) && dispatch(BLOCK_DEFINITION_LIST) )) goto l88;
+  {  int yypos89= G->pos, yythunkpos89= G->thunkpos;  if (!yy_DefinitionList(G)) goto l90;  goto l89;
+  l90:;	  G->pos= yypos89; G->thunkpos= yythunkpos89;  yyText(G, G->begin, G->end);  if (!( failed(BLOCK_DEFINITION_LIST) )) goto l88;
+  }
+  l89:;	  goto l78;
+  l88:;	  G->pos= yypos78; G->thunkpos= yythunkpos78;  yyText(G, G->begin, G->end);  if (!( !ext(EXT_COMPATIBILITY) && dispatch(BLOCK_GLOSSARY) )) goto l91;
+  {  int yypos92= G->pos, yythunkpos92= G->thunkpos;  if (!yy_Glossary(G)) goto l93;  goto l92;
+  l93:;	  G->pos= yypos92; G->thunkpos= yythunkpos92;  yyText(G, G->begin, G->end);  if (!( failed(BLOCK_GLOSSARY) )) goto l91;
+  }
+  l92:;	  goto l78;
+  l91:;	  G->pos= yypos78; G->thunkpos= yythunkpos78;  yyText(G, G->begin, G->end);  if (!( dispatch(BLOCK_NOTE) )) goto l94;
+  {  int yypos95= G->pos, yythunkpos95= G->thunkpos;  if (!yy_Note(G)) goto l96;  goto l95;
+  l96:;	  G->pos= yypos95; G->thunkpos= yythunkpos95;  yyText(G, G->begin, G->end);  if (!( failed(BLOCK_NOTE) )) goto l94;
+  }
+  l95:;	  goto l78;
+  l94:;	  G->pos= yypos78; G->thunkpos= yythunkpos78;  yyText(G, G->begin, G->end);  if (!( dispatch(BLOCK_LINK_REFERENCE) )) goto l97;
+  {  int yypos98= G->pos, yythunkpos98= G->thunkpos;  if (!yy_LinkReference(G)) goto l99;  goto l98;
+  l99:;	  G->pos= yypos98; G->thunkpos= yythunkpos98;  yyText(G, G->begin, G->end);  if (!( failed(BLOCK_LINK_REFERENCE) )) goto l97;
+  }
+  l98:;	  goto l78;
+  l97:;	  G->pos= yypos78; G->thunkpos= yythunkpos78;  yyText(G, G->begin, G->end);  if (!( !ext(EXT_COMPATIBILITY) && dispatch(BLOCK_ABBREVIATION) )) goto l100;
+  {  int yypos101= G->pos, yythunkpos101= G->thunkpos;  if (!yy_Abbreviation(G)) goto l102;  goto l101;
+  l102:;	  G->pos= yypos101; G->thunkpos= yythunkpos101;  yyText(G, G->begin, G->end);  if (!( failed(BLOCK_ABBREVIATION) )) goto l100;
+  }
+  l101:;	  goto l78;
+  l100:;	  G->pos= yypos78; G->thunkpos= yythunkpos78;  yyText(G, G->begin, G->end);  if (!( dispatch(BLOCK_HORIZONTAL_RULE) )) goto l103;
+  {  int yypos104= G->pos, yythunkpos104= G->thunkpos;  if (!yy_HorizontalRule(G)) goto l105;  goto l104;
+  l105:;	  G->pos= yypos104; G->thunkpos= yythunkpos104;  yyText(G, G->begin, G->end);  if (!( failed(BLOCK_HORIZONTAL_RULE) )) goto l103;
+  }
+  l104:;	  goto l78;
+  l103:;	  G->pos= yypos78; G->thunkpos= yythunkpos78;  yyText(G, G->begin, G->end);  if (!( ext(EXT_HEADINGSECTION) && dispatch(BLOCK_HEADING_SECTION) )) goto l106;
+  {  int yypos107= G->pos, yythunkpos107= G->thunkpos;  if (!yy_HeadingSection(G)) goto l108;  goto l107;
+  l108:;	  G->pos= yypos107; G->thunkpos= yythunkpos107;  yyText(G, G->begin, G->end);  if (!( failed(BLOCK_HEADING_SECTION) )) goto l106;
+  }
+  l107:;	  goto l78;
+  l106:;	  G->pos= yypos78; G->thunkpos= yythunkpos78;  yyText(G, G->begin, G->end);  if (!( dispatch(BLOCK_HEADING) )) goto l109;
+  {  int yypos110= G->pos, yythunkpos110= G->thunkpos;  if (!yy_Heading(G)) goto l111;  goto l110;
+  l111:;	  G->pos= yypos110; G->thunkpos= yythunkpos110;  yyText(G, G->begin, G->end);  if (!( failed(BLOCK_HEADING) )) goto l109;
+  }
+  l110:;	  goto l78;
+  l109:;	  G->pos= yypos78; G->thunkpos= yythunkpos78;  yyText(G, G->begin, G->end);  if (!( dispatch(BLOCK_ORDERED_LIST) )) goto l112;
+  {  int yypos113= G->pos, yythunkpos113= G->thunkpos;  if (!yy_OrderedList(G)) goto l114;  goto l113;
+  l114:;	  G->pos= yypos113; G->thunkpos= yythunkpos113;  yyText(G, G->begin, G->end);  if (!( failed(BLOCK_ORDERED_LIST) )) goto l112;
+  }
+  l113:;	  goto l78;
+  l112:;	  G->pos= yypos78; G->thunkpos= yythunkpos78;  yyText(G, G->begin, G->end);  if (!( dispatch(BLOCK_BULLET_LIST) )) goto l115;
+  {  int yypos116= G->pos, yythunkpos116= G->thunkpos;  if (!yy_BulletList(G)) goto l117;  goto l116;
+  l117:;	  G->pos= yypos116; G->thunkpos= yythunkpos116;  yyText(G, G->begin, G->end);  if (!( failed(BLOCK_BULLET_LIST) )) goto l115;
+  }
+  l116:;	  goto l78;
+  l115:;	  G->pos= yypos78; G->thunkpos= yythunkpos78;  yyText(G, G->begin, G->end);  if (!( dispatch(BLOCK_HTML) )) goto l118;
+  {  int yypos119= G->pos, yythunkpos119= G->thunkpos;  if (!yy_HtmlBlock(G)) goto l120;  goto l119;
+  l120:;	  G->pos= yypos119; G->thunkpos= yythunkpos119;  yyText(G, G->begin, G->end);  if (!( failed(BLOCK_HTML) )) goto l118;
+  }
+  l119:;	  goto l78;
+  l118:;	  G->pos= yypos78; G->thunkpos= yythunkpos78;  yyText(G, G->begin, G->end);  if (!( dispatch(BLOCK_MARKDOWN_HTML) )) goto l121;
+  {  int yypos122= G->pos, yythunkpos122= G->thunkpos;  if (!yy_MarkdownHtmlBlock(G)) goto l123;  goto l122;
+  l123:;	  G->pos= yypos122; G->thunkpos= yythunkpos122;  yyText(G, G->begin, G->end);  if (!( failed(BLOCK_MARKDOWN_HTML) )) goto l121;
+  }
+  l122:;	  goto l78;
+  l121:;	  G->pos= yypos78; G->thunkpos= yythunkpos78;  yyText(G, G->begin, G->end);  if (!( dispatch(BLOCK_STYLE) )) goto l124;
+  {  int yypos125= G->pos, yythunkpos125= G->thunkpos;  if (!yy_StyleBlock(G)) goto l126;  goto l125;
+  l126:;	  G->pos= yypos125; G->thunkpos= yythunkpos125;  yyText(G, G->begin, G->end);  if (!( failed(BLOCK_STYLE) )) goto l124;
+  }
+  l125:;	  goto l78;
+  l124:;	  G->pos= yypos78; G->thunkpos= yythunkpos78;  yyText(G, G->begin, G->end);  if (!( !ext(EXT_COMPATIBILITY) && dispatch(BLOCK_TABLE) )) goto l127;
+  {  int yypos128= G->pos, yythunkpos128= G->thunkpos;  if (!yy_Table(G)) goto l129;  goto l128;
+  l129:;	  G->pos= yypos128; G->thunkpos= yythunkpos128;  yyText(G, G->begin, G->end);  if (!( failed(BLOCK_TABLE) )) goto l127;
+  }
+  l128:;	  goto l78;
+  l127:;	  G->pos= yypos78; G->thunkpos= yythunkpos78;  yyText(G, G->begin, G->end);  if (!( !ext(EXT_COMPATIBILITY) && dispatch(BLOCK_IMAGE) )) goto l130;
+  {  int yypos131= G->pos, yythunkpos131= G->thunkpos;  if (!yy_ImageBlock(G)) goto l132;  goto l131;
+  l132:;	  G->pos= yypos131; G->thunkpos= yythunkpos131;  yyText(G, G->begin, G->end);  if (!( failed(BLOCK_IMAGE) )) goto l130;
+  }
+  l131:;	  goto l78;
+  l130:;	  G->pos= yypos78; G->thunkpos= yythunkpos78;  yyText(G, G->begin, G->end);  if (!( !ext(EXT_COMPATIBILITY) && dispatch(BLOCK_TOC) )) goto l133;
+  {  int yypos134= G->pos, yythunkpos134= G->thunkpos;  if (!yy_TOC(G)) goto l135;  goto l134;
+  l135:;	  G->pos= yypos134; G->thunkpos= yythunkpos134;  yyText(G, G->begin, G->end);  if (!( failed(BLOCK_TOC) )) goto l133;
+  }
+  l134:;	  goto l78;
+  l133:;	  G->pos= yypos78; G->thunkpos= yythunkpos78;  yyText(G, G->begin, G->end);  if (!( dispatch(BLOCK_PARA) )) goto l136;
+  {  int yypos137= G->pos, yythunkpos137= G->thunkpos;
+  {  int yypos139= G->pos, yythunkpos139= G->thunkpos;  if (!yy_Sp(G)) goto l139;  if (!yy_HtmlBlockInTags(G)) goto l139;  goto l138;
+  l139:;	  G->pos= yypos139; G->thunkpos= yythunkpos139;
+  }  if (!yy_Para(G)) goto l138;  goto l137;
+  l138:;	  G->pos= yypos137; G->thunkpos= yythunkpos137;  yyText(G, G->begin, G->end);  if (!( failed(BLOCK_PARA) )) goto l136;
+  }
+  l137:;	  goto l78;
+  l136:;	  G->pos= yypos78; G->thunkpos= yythunkpos78;  yyText(G, G->begin, G->end);  if (!( dispatch(BLOCK_PLAIN) )) goto l75;
+  {  int yypos140= G->pos, yythunkpos140= G->thunkpos;  if (!yy_Plain(G)) goto l141;  goto l140;
+  l141:;	  G->pos= yypos140; G->thunkpos= yythunkpos140;  yyText(G, G->begin, G->end);  if (!( failed(BLOCK_PLAIN) )) goto l75;
+  }
+  l140:;	
+  }
+  l78:;	
+  yyprintf((stderr, "  ok   %s @ %s\n", "Block", G->buf+G->pos));
+  return 1;
+  l75:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "Block", G->buf+G->pos));
+  return 0;
+}
+YY_RULE(int) yy_DocForMetaDataOnly(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyDo(G, yyPush, 1, 0);
+  yyprintf((stderr, "%s\n", "DocForMetaDataOnly"));
+  {  int yypos67= G->pos, yythunkpos67= G->thunkpos;  if (!yy_BOM(G)) goto l67;  goto l68;
+  l67:;	  G->pos= yypos67; G->thunkpos= yythunkpos67;
+  }
+  l68:;	  if (!yy_StartList(G)) goto l66;  yyDo(G, yySet, -1, 0);
+  {  int yypos69= G->pos, yythunkpos69= G->thunkpos;
+  {  int yypos71= G->pos, yythunkpos71= G->thunkpos;
+  {  int yypos72= G->pos, yythunkpos72= G->thunkpos;  if (!yy_YAMLStart(G)) goto l72;  goto l73;
+  l72:;	  G->pos= yypos72; G->thunkpos= yythunkpos72;
+  }
+  l73:;	  if (!yy_MetaDataKey(G)) goto l69;  if (!yy_Sp(G)) goto l69;  if (!yymatchChar(G, ':')) goto l69;  if (!yy_Sp(G)) goto l69;
+  {  int yypos74= G->pos, yythunkpos74= G->thunkpos;  if (!yy_Newline(G)) goto l74;  goto l69;
+  l74:;	  G->pos= yypos74; G->thunkpos= yythunkpos74;
+  }  G->pos= yypos71; G->thunkpos= yythunkpos71;
+  }  if (!yy_MetaData(G)) goto l69;  yyDo(G, yy_1_DocForMetaDataOnly, G->begin, G->end);  goto l70;
+  l69:;	  G->pos= yypos69; G->thunkpos= yythunkpos69;
+  }
+  l70:;	  yyDo(G, yy_2_DocForMetaDataOnly, G->begin, G->end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "DocForMetaDataOnly", G->buf+G->pos));  yyDo(G, yyPop, 1, 0);
+  return 1;
+  l66:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "DocForMetaDataOnly", G->buf+G->pos));
+  return 0;
+}
+YY_RULE(int) yy_YAMLStop(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;
+  yyprintf((stderr, "%s\n", "YAMLStop"));
+  {  int yypos64= G->pos, yythunkpos64= G->thunkpos;  if (!yymatchString(G, "---")) goto l65;  goto l64;
+  l65:;	  G->pos= yypos64; G->thunkpos= yythunkpos64;  if (!yymatchString(G, "...")) goto l63;
+  }
+  l64:;	  if (!yy_BlankLine(G)) goto l63;
+  yyprintf((stderr, "  ok   %s @ %s\n", "YAMLStop", G->buf+G->pos));
+  return 1;
+  l63:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "YAMLStop", G->buf+G->pos));
+  return 0;
+}
+YY_RULE(int) yy_YAMLStart(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;
+  yyprintf((stderr, "%s\n", "YAMLStart"));  if (!yymatchString(G, "---")) goto l62;  if (!yy_BlankLine(G)) goto l62;
+  yyprintf((stderr, "  ok   %s @ %s\n", "YAMLStart", G->buf+G->pos));
+  return 1;
+  l62:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "YAMLStart", G->buf+G->pos));
+  return 0;
+}
+YY_RULE(int) yy_MetaDataValue(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyDo(G, yyPush, 1, 0);
+  yyprintf((stderr, "%s\n", "MetaDataValue"));  if (!yy_StartList(G)) goto l48;  yyDo(G, yySet, -1, 0);  yyText(G, G->begin, G->end);  if (!(YY_BEGIN)) goto l48;
+  l49:;	
+  {  int yypos50= G->pos, yythunkpos50= G->thunkpos;
+  {  int yypos51= G->pos, yythunkpos51= G->thunkpos;  if (!yy_Newline(G)) goto l51;  goto l50;
+  l51:;	  G->pos= yypos51; G->thunkpos= yythunkpos51;
+  }  if (!yymatchDot(G)) goto l50;  goto l49;
+  l50:;	  G->pos= yypos50; G->thunkpos= yythunkpos50;
+  }  yyText(G, G->begin, G->end);  if (!(YY_END)) goto l48;  yyDo(G, yy_1_MetaDataValue, G->begin, G->end);
+  {  int yypos52= G->pos, yythunkpos52= G->thunkpos;  if (!yy_Newline(G)) goto l53;
+  {  int yypos54= G->pos, yythunkpos54= G->thunkpos;
+  {  int yypos55= G->pos, yythunkpos55= G->thunkpos;  if (!yy_BlankLine(G)) goto l55;  goto l53;
+  l55:;	  G->pos= yypos55; G->thunkpos= yythunkpos55;
+  }
+  {  int yypos56= G->pos, yythunkpos56= G->thunkpos;  if (!yy_SingleLineMetaKeyValue(G)) goto l56;  goto l53;
+  l56:;	  G->pos= yypos56; G->thunkpos= yythunkpos56;
+  }  if (!yy_Sp(G)) goto l53;  if (!yy_RawLine(G)) goto l53;  G->pos= yypos54; G->thunkpos= yythunkpos54;
+  }  yyDo(G, yy_2_MetaDataValue, G->begin, G->end);  goto l52;
+  l53:;	  G->pos= yypos52; G->thunkpos= yythunkpos52;  if (!yy_Newline(G)) goto l48;
+  }
+  l52:;	
+  l57:;	
+  {  int yypos58= G->pos, yythunkpos58= G->thunkpos;
+  {  int yypos59= G->pos, yythunkpos59= G->thunkpos;  if (!yy_BlankLine(G)) goto l59;  goto l58;
+  l59:;	  G->pos= yypos59; G->thunkpos= yythunkpos59;
+  }
+  {  int yypos60= G->pos, yythunkpos60= G->thunkpos;  if (!yy_SingleLineMetaKeyValue(G)) goto l60;  goto l58;
+  l60:;	  G->pos= yypos60; G->thunkpos= yythunkpos60;
+  }
+  {  int yypos61= G->pos, yythunkpos61= G->thunkpos;  if (!yy_YAMLStop(G)) goto l61;  goto l58;
+  l61:;	  G->pos= yypos61; G->thunkpos= yythunkpos61;
+  }  if (!yy_Sp(G)) goto l58;  if (!yy_RawLine(G)) goto l58;  yyDo(G, yy_3_MetaDataValue, G->begin, G->end);  goto l57;
+  l58:;	  G->pos= yypos58; G->thunkpos= yythunkpos58;
+  }  yyDo(G, yy_4_MetaDataValue, G->begin, G->end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "MetaDataValue", G->buf+G->pos));  yyDo(G, yyPop, 1, 0);
+  return 1;
+  l48:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "MetaDataValue", G->buf+G->pos));
+  return 0;
+}
+YY_RULE(int) yy_SingleLineMetaKeyValue(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;
+  yyprintf((stderr, "%s\n", "SingleLineMetaKeyValue"));  if (!yy_MetaDataKey(G)) goto l44;  if (!yy_Sp(G)) goto l44;  if (!yymatchChar(G, ':')) goto l44;  if (!yy_Sp(G)) goto l44;
+  l45:;	
+  {  int yypos46= G->pos, yythunkpos46= G->thunkpos;
+  {  int yypos47= G->pos, yythunkpos47= G->thunkpos;  if (!yy_Newline(G)) goto l47;  goto l46;
+  l47:;	  G->pos= yypos47; G->thunkpos= yythunkpos47;
+  }  if (!yymatchDot(G)) goto l46;  goto l45;
+  l46:;	  G->pos= yypos46; G->thunkpos= yythunkpos46;
+  }
+  yyprintf((stderr, "  ok   %s @ %s\n", "SingleLineMetaKeyValue", G->buf+G->pos));
+  return 1;
+  l44:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "SingleLineMetaKeyValue", G->buf+G->pos));
+  return 0;
+}
+YY_RULE(int) yy_MetaDataKey(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;
+  yyprintf((stderr, "%s\n", "MetaDataKey"));  yyText(G, G->begin, G->end);  if (!(YY_BEGIN)) goto l26;
+  {  int yypos27= G->pos, yythunkpos27= G->thunkpos;  if (!yymatchClass(G, (unsigned char *)"\000\000\000\000\000\000\000\000\376\377\377\007\376\377\377\007\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l27;
+  l28:;	
+  {  int yypos29= G->pos, yythunkpos29= G->thunkpos;  if (!yymatchClass(G, (unsigned char *)"\000\000\000\000\000\000\000\000\376\377\377\007\376\377\377\007\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l29;  goto l28;
+  l29:;	  G->pos= yypos29; G->thunkpos= yythunkpos29;
+  }  if (!yymatchString(G, "://")) goto l27;  goto l26;
+  l27:;	  G->pos= yypos27; G->thunkpos= yythunkpos27;
+  }  if (!yy_AlphanumericAscii(G)) goto l26;
+  l30:;	
+  {  int yypos31= G->pos, yythunkpos31= G->thunkpos;  if (!yy_Sp(G)) goto l31;
+  {  int yypos34= G->pos, yythunkpos34= G->thunkpos;  if (!yy_AlphanumericAscii(G)) goto l35;  goto l34;
+  l35:;	  G->pos= yypos34; G->thunkpos= yythunkpos34;  if (!yymatchChar(G, '_')) goto l36;  goto l34;
+  l36:;	  G->pos= yypos34; G->thunkpos= yythunkpos34;  if (!yymatchChar(G, ' ')) goto l37;  goto l34;
+  l37:;	  G->pos= yypos34; G->thunkpos= yythunkpos34;  if (!yymatchChar(G, '-')) goto l38;  goto l34;
+  l38:;	  G->pos= yypos34; G->thunkpos= yythunkpos34;  if (!yymatchChar(G, '.')) goto l31;
+  }
+  l34:;	
+  l32:;	
+  {  int yypos33= G->pos, yythunkpos33= G->thunkpos;
+  {  int yypos39= G->pos, yythunkpos39= G->thunkpos;  if (!yy_AlphanumericAscii(G)) goto l40;  goto l39;
+  l40:;	  G->pos= yypos39; G->thunkpos= yythunkpos39;  if (!yymatchChar(G, '_')) goto l41;  goto l39;
+  l41:;	  G->pos= yypos39; G->thunkpos= yythunkpos39;  if (!yymatchChar(G, ' ')) goto l42;  goto l39;
+  l42:;	  G->pos= yypos39; G->thunkpos= yythunkpos39;  if (!yymatchChar(G, '-')) goto l43;  goto l39;
+  l43:;	  G->pos= yypos39; G->thunkpos= yythunkpos39;  if (!yymatchChar(G, '.')) goto l33;
+  }
+  l39:;	  goto l32;
+  l33:;	  G->pos= yypos33; G->thunkpos= yythunkpos33;
+  }  goto l30;
+  l31:;	  G->pos= yypos31; G->thunkpos= yythunkpos31;
+  }  yyText(G, G->begin, G->end);  if (!(YY_END)) goto l26;  yyDo(G, yy_1_MetaDataKey, G->begin, G->end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "MetaDataKey", G->buf+G->pos));
+  return 1;
+  l26:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "MetaDataKey", G->buf+G->pos));
+  return 0;
+}
+YY_RULE(int) yy_MetaDataKeyValue(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyDo(G, yyPush, 2, 0);
+  yyprintf((stderr, "%s\n", "MetaDataKeyValue"));  if (!yy_MetaDataKey(G)) goto l25;  yyDo(G, yySet, -1, 0);  if (!yy_Sp(G)) goto l25;  if (!yymatchChar(G, ':')) goto l25;  if (!yy_Sp(G)) goto l25;  if (!yy_MetaDataValue(G)) goto l25;  yyDo(G, yySet, -2, 0);  yyDo(G, yy_1_MetaDataKeyValue, G->begin, G->end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "MetaDataKeyValue", G->buf+G->pos));  yyDo(G, yyPop, 2, 0);
+  return 1;
+  l25:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "MetaDataKeyValue", G->buf+G->pos));
+  return 0;
+}
+YY_RULE(int) yy_MetaData(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyDo(G, yyPush, 1, 0);
+  yyprintf((stderr, "%s\n", "MetaData"));  if (!yy_StartList(G)) goto l14;  yyDo(G, yySet, -1, 0);
+  {  int yypos15= G->pos, yythunkpos15= G->thunkpos;  if (!yy_YAMLStart(G)) goto l16;  goto l15;
+  l16:;	  G->pos= yypos15; G->thunkpos= yythunkpos15;
+  {  int yypos17= G->pos, yythunkpos17= G->thunkpos;  if (!yymatchClass(G, (unsigned char *)"\000\000\000\000\000\000\000\000\376\377\377\007\376\377\377\007\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l17;
+  l18:;	
+  {  int yypos19= G->pos, yythunkpos19= G->thunkpos;  if (!yymatchClass(G, (unsigned char *)"\000\000\000\000\000\000\000\000\376\377\377\007\376\377\377\007\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l19;  goto l18;
+  l19:;	  G->pos= yypos19; G->thunkpos= yythunkpos19;
+  }  if (!yymatchString(G, "://")) goto l17;  goto l14;
+  l17:;	  G->pos= yypos17; G->thunkpos= yythunkpos17;
+  }
+  {  int yypos20= G->pos, yythunkpos20= G->thunkpos;  if (!yy_SetextHeading(G)) goto l20;  goto l14;
+  l20:;	  G->pos= yypos20; G->thunkpos= yythunkpos20;
+  }
+  }
+  l15:;	  if (!yy_MetaDataKeyValue(G)) goto l14;  yyDo(G, yy_1_MetaData, G->begin, G->end);
+  l21:;	
+  {  int yypos22= G->pos, yythunkpos22= G->thunkpos;  if (!yy_MetaDataKeyValue(G)) goto l22;  yyDo(G, yy_1_MetaData, G->begin, G->end);  goto l21;
+  l22:;	  G->pos= yypos22; G->thunkpos= yythunkpos22;
+  }
+  {  int yypos23= G->pos, yythunkpos23= G->thunkpos;  if (!yy_YAMLStop(G)) goto l23;  goto l24;
+  l23:;	  G->pos= yypos23; G->thunkpos= yythunkpos23;
+  }
+  l24:;	  yyDo(G, yy_2_MetaData, G->begin, G->end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "MetaData", G->buf+G->pos));  yyDo(G, yyPop, 1, 0);
+  return 1;
+  l14:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "MetaData", G->buf+G->pos));
+  return 0;
+}
+YY_RULE(int) yy_Doc(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyDo(G, yyPush, 2, 0);
+  yyprintf((stderr, "%s\n", "Doc"));
+  {  int yypos2= G->pos, yythunkpos2= G->thunkpos;  if (!yy_BOM(G)) goto l2;  goto l3;
+  l2:;	  G->pos= yypos2; G->thunkpos= yythunkpos2;
+  }
+  l3:;	  if (!yy_StartList(G)) goto l1;  yyDo(G, yySet, -1, 0);  if (!yy_StartList(G)) goto l1;  yyDo(G, yySet, -2, 0);
+  {  int yypos4= G->pos, yythunkpos4= G->thunkpos;  yyText(G, G->begin, G->end);  if (!( !ext(EXT_COMPATIBILITY) && !ext(EXT_NO_METADATA) )) goto l4;
+  {  int yypos6= G->pos, yythunkpos6= G->thunkpos;
+  {  int yypos7= G->pos, yythunkpos7= G->thunkpos;  if (!yy_YAMLStart(G)) goto l7;  goto l8;
+  l7:;	  G->pos= yypos7; G->thunkpos= yythunkpos7;
+  }
+  l8:;	  if (!yy_MetaDataKey(G)) goto l4;  if (!yy_Sp(G)) goto l4;  if (!yymatchChar(G, ':')) goto l4;  if (!yy_Sp(G)) goto l4;
+  {  int yypos9= G->pos, yythunkpos9= G->thunkpos;  if (!yy_Newline(G)) goto l9;  goto l4;
+  l9:;	  G->pos= yypos9; G->thunkpos= yythunkpos9;
+  }  G->pos= yypos6; G->thunkpos= yythunkpos6;
+  }  if (!yy_MetaData(G)) goto l4;  yyDo(G, yy_1_Doc, G->begin, G->end);  goto l5;
+  l4:;	  G->pos= yypos4; G->thunkpos= yythunkpos4;
+  }
+  l5:;	
+  l10:;	
+  {  int yypos11= G->pos, yythunkpos11= G->thunkpos;  if (!yy_Block(G)) goto l11;  yyDo(G, yy_2_Doc, G->begin, G->end);  goto l10;
+  l11:;	  G->pos= yypos11; G->thunkpos= yythunkpos11;
+  }
+  l12:;	
+  {  int yypos13= G->pos, yythunkpos13= G->thunkpos;  if (!yy_BlankLine(G)) goto l13;  goto l12;
+  l13:;	  G->pos= yypos13; G->thunkpos= yythunkpos13;
+  }  yyDo(G, yy_3_Doc, G->begin, G->end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "Doc", G->buf+G->pos));  yyDo(G, yyPop, 2, 0);
+  return 1;
+  l1:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "Doc", G->buf+G->pos));
+  return 0;
+}
+
+#ifndef YY_PART
+
+typedef int (*yyrule)(GREG *G);
+
+YY_PARSE(int) YY_NAME(parse_from)(GREG *G, yyrule yystart)
+{
+  int yyok;
+  if (!G->buflen)
+    {
+      G->buflen= YY_BUFFER_START_SIZE;
+      G->buf= (char*)YY_ALLOC(G->buflen, G->data);
+      G->textlen= YY_BUFFER_START_SIZE;
+      G->text= (char*)YY_ALLOC(G->textlen, G->data);
+      G->thunkslen= YY_STACK_SIZE;
+      G->thunks= (yythunk*)YY_ALLOC(sizeof(yythunk) * G->thunkslen, G->data);
+      G->valslen= YY_STACK_SIZE;
+      G->vals= (YYSTYPE*)YY_ALLOC(sizeof(YYSTYPE) * G->valslen, G->data);
+      G->begin= G->end= G->pos= G->limit= G->thunkpos= 0;
+    }
+  G->begin= G->end= G->pos;
+  G->thunkpos= 0;
+  G->val= G->vals;
+  yyok= yystart(G);
+  if (yyok) yyDone(G);
+  yyCommit(G);
+  return yyok;
+  (void)yyrefill;
+  (void)yymatchDot;
+  (void)yymatchChar;
+  (void)yymatchString;
+  (void)yymatchClass;
+  (void)yyDo;
+  (void)yyText;
+  (void)yyDone;
+  (void)yyCommit;
+  (void)yyAccept;
+  (void)yyPush;
+  (void)yyPop;
+  (void)yySet;
+}
+
+YY_PARSE(int) YY_NAME(parse)(GREG *G)
+{
+  return YY_NAME(parse_from)(G, yy_Doc);
+}
+
+YY_PARSE(void) YY_NAME(init)(GREG *G)
+{
+    memset(G, 0, sizeof(GREG));
+}
+YY_PARSE(void) YY_NAME(deinit)(GREG *G)
+{
+    if (G->buf) YY_FREE(G->buf);
+    if (G->text) YY_FREE(G->text);
+    if (G->thunks) YY_FREE(G->thunks);
+    if (G->vals) YY_FREE((void*)G->vals);
+}
+YY_PARSE(GREG *) YY_NAME(parse_new)(YY_XTYPE data)
+{
+  GREG *G = (GREG *)YY_CALLOC(1, sizeof(GREG), data);
+  G->data = data;
+  return G;
+}
+
+YY_PARSE(void) YY_NAME(parse_free)(GREG *G)
+{
+  YY_NAME(deinit)(G);
+  YY_FREE(G);
+}
+
+#endif
+
+
+/* Nested parses (emphasis, list items, blockquotes, ...) reuse parser
+	contexts instead of setting up greg's buffers from scratch each time;
+	the buffers stay at their high-water size. Each thread keeps its own
+	idle contexts, so the workers in document.c don't contend */
+#define POOL_CONTEXTS    16               /* Idle contexts kept per thread */
+#define POOL_MAX_BUFFER  (1024 * 1024)    /* Don't hold on to bigger buffers */
+
+typedef struct {
+	GREG *idle[POOL_CONTEXTS];
+	int   count;
+} context_pool;
+
+#ifdef MMD_NO_THREADS
+static context_pool pool;
+#else
+static __thread context_pool pool;
+#endif
+
+/* Metadata can only be at the top of the document, and ends at the first
+	blank line -- that is all read_metadata() preformats and parses. The
+	answer is kept for the last few buffers (per thread), since transclusion,
+	mmd header/footer handling and latexmode all ask about the same one */
+#define METADATA_CACHE   4
+
+#ifdef MMD_NO_THREADS
+static metadata_block metadata_cache[METADATA_CACHE];
+static int metadata_next;
+#else
+static __thread metadata_block metadata_cache[METADATA_CACHE];
+static __thread int metadata_next;
+#endif
+
+#ifndef MMD_NO_THREADS
+/* A thread that exits while holding contexts or cached metadata lets them go
+	on the way out, so threads that parse don't have to call
+	release_parser_contexts() themselves (see hold_until_exit) */
+static pthread_key_t release_key;
+static pthread_once_t release_key_once = PTHREAD_ONCE_INIT;
+static __thread bool release_pending;
+
+static void release_at_exit(void *unused) {
+	release_parser_contexts();
+}
+
+static void make_release_key(void) {
+	pthread_key_create(&release_key, release_at_exit);
+}
+#endif
+
+/* hold_until_exit -- this thread is keeping something in the pool or the
+	metadata cache */
+static void hold_until_exit(void) {
+#ifndef MMD_NO_THREADS
+	if (!release_pending) {
+		pthread_once(&release_key_once, make_release_key);
+		pthread_setspecific(release_key, &pool);
+		release_pending = true;
+	}
+#endif
+}
+
+static void clear_metadata_block(metadata_block *meta) {
+	free(meta->text);
+	free_node_tree(meta->result);
+	free_metadata_dict(meta->dict);
+	memset(meta, 0, sizeof(metadata_block));
+}
+
+/* take_context -- a parser context that is ready for a new parse */
+static GREG * take_context(void) {
+	GREG *g;
+
+	if (pool.count > 0) {
+		g = pool.idle[--pool.count];
+
+		/* Drop anything left over from the last parse */
+		g->offset = g->pos = g->limit = 0;
+		g->begin = g->end = 0;
+		g->thunkpos = 0;
+		count_event(&contexts_reused);
+	} else {
+		g = malloc(sizeof(GREG));
+		yyinit(g);
+		count_event(&contexts_created);
+	}
+
+	return g;
+}
+
+/* give_context -- done with g (its data is the caller's to free) */
+static void give_context(GREG *g) {
+	g->data = NULL;
+
+	if ((pool.count < POOL_CONTEXTS) && (g->buflen <= POOL_MAX_BUFFER)) {
+		pool.idle[pool.count++] = g;
+		hold_until_exit();
+	} else {
+		yydeinit(g);
+		free(g);
+	}
+}
+
+/* release_parser_contexts -- free the contexts and cached metadata this
+	thread is holding on to, and add its rule counts to the totals. Other
+	threads do this when they exit; the main thread has to call it */
+void release_parser_contexts(void) {
+	GREG *g;
+	int i;
+
+#ifndef MMD_NO_THREADS
+	release_pending = false;
+#endif
+
+	while (pool.count > 0) {
+		g = pool.idle[--pool.count];
+		yydeinit(g);
+		free(g);
+	}
+
+#ifdef MMD_PARSE_STATS
+	for (i = 0; i < DISPATCH_RULE_COUNT; i++) {
+#ifdef MMD_NO_THREADS
+		rule_totals.tried[i] += rule_counts.tried[i];
+		rule_totals.skipped[i] += rule_counts.skipped[i];
+		rule_totals.failed[i] += rule_counts.failed[i];
+#else
+		__sync_fetch_and_add(&rule_totals.tried[i], rule_counts.tried[i]);
+		__sync_fetch_and_add(&rule_totals.skipped[i], rule_counts.skipped[i]);
+		__sync_fetch_and_add(&rule_totals.failed[i], rule_counts.failed[i]);
+#endif
+	}
+
+	memset(&rule_counts, 0, sizeof(rule_stats));
+#endif
+
+	for (i = 0; i < METADATA_CACHE; i++)
+		clear_metadata_block(&metadata_cache[i]);
+}
+
+/* parser_context_stats -- running totals, to see what the pool saves */
+void parser_context_stats(unsigned long *created, unsigned long *reused, unsigned long *allocations) {
+	*created = contexts_created;
+	*reused = contexts_reused;
+	*allocations = greg_allocations;
+}
+
+/* parser_rule_stats -- totals for one dispatched alternative (threads that
+	are still parsing haven't reported yet). Without dispatch, every skipped
+	attempt would have been a failed one */
+void parser_rule_stats(int rule, unsigned long *tried, unsigned long *skipped, unsigned long *failures) {
+	*tried = rule_totals.tried[rule];
+	*skipped = rule_totals.skipped[rule];
+	*failures = rule_totals.failed[rule];
+}
+
+/* more_input -- add to greg's buffer without consuming it (yyrefill reads
+	in at pos, so it is only safe to call once pos has caught up with limit) */
+static int more_input(GREG *G) {
+	int pos = G->pos;
+	int result;
+
+	G->pos = G->limit;
+	result = yyrefill(G);
+	G->pos = pos;
+
+	return result;
+}
+
+/* skip_known_scan -- move on to where an earlier scan of this kind from
+	here stopped. With moved set, only if that is past here (the scans match
+	at least one thing) */
+static int skip_known_scan(GREG *G, int rule, bool moved) {
+	unsigned long end;
+
+	if (!scan_known((parser_data *)G->data, rule, G->offset + G->pos, &end))
+		return 0;
+
+	if (moved && (end == G->offset + G->pos))
+		return 0;
+
+	end -= G->offset;
+	while (((unsigned long) G->limit < end) && more_input(G));
+	if ((unsigned long) G->limit < end)
+		return 0;
+
+	G->pos = end;
+	return 1;
+}
+
+/* finish_scan -- the scan stopped here, or where the earlier scan it ran
+	into did */
+static int finish_scan(GREG *G, int rule) {
+	if (extension(EXT_MEMOIZE, ((parser_data *)G->data)->extensions))
+		skip_known_scan(G, rule, 0);
+
+	return scan_end((parser_data *)G->data, rule, G->offset + G->pos);
+}
+
+/* bracket_may_close -- false if no ']' comes before the end of the
+	paragraph, so that a label can't start here. Anything else that could
+	carry a ']' past a blank line ('<', '$', '{') counts as one, and after a
+	'[' inside emphasis (which skips over bracketed text) the rest of the
+	input is searched. The stretch scanned last is remembered, so a run of
+	unclosed '[' is only scanned once, and doesn't nest a Label for each of
+	them */
+static int bracket_may_close(GREG *G) {
+	parser_data *data = (parser_data *)G->data;
+	size_t here = G->offset + G->pos;
+	int i = G->pos;
+	int j;
+	bool found = false;
+	bool emphasis = false;
+	bool carried = false;
+
+	if ((here >= data->bracket_from) && (here < data->bracket_to))
+		return data->bracket_found;
+
+	while ((i < G->limit) || more_input(G)) {
+		if ((G->buf[i] == ']') || (G->buf[i] == '<') || (G->buf[i] == '$') || (G->buf[i] == '{')) {
+			found = true;
+			break;
+		}
+
+		if ((G->buf[i] == '*') || (G->buf[i] == '_'))
+			emphasis = true;
+		else if ((G->buf[i] == '[') && emphasis)
+			carried = true;
+
+		if (G->buf[i] == '\n') {
+			/* Stop at a blank line */
+			for (j = i + 1; ((j < G->limit) || more_input(G)) && ((G->buf[j] == ' ') || (G->buf[j] == '\t')); j++);
+			if (((j >= G->limit) || (G->buf[j] == '\n')) && !carried)
+				break;
+		}
+		i++;
+	}
+
+	data->bracket_from = here;
+	data->bracket_to = G->offset + i;
+	data->bracket_found = found;
+
+	data->fuel -= i - G->pos;
+	if ((data->fuel <= 0) && !check_timeout(data))
+		return 0;
+
+	return found;
+}
+
+/* bracket_follows -- false if no ']' comes anywhere after here, which
+	NoteReference needs (its RawInline brackets can run past blank lines) */
+static int bracket_follows(GREG *G) {
+	parser_data *data = (parser_data *)G->data;
+	size_t here = G->offset + G->pos;
+	int i = G->pos;
+
+	if (here < data->close_before)
+		return 1;
+	if (here >= data->close_none_from)
+		return 0;
+
+	while ((i < G->limit) || more_input(G)) {
+		if (G->buf[i] == ']') {
+			data->close_before = G->offset + i + 1;
+			break;
+		}
+		i++;
+	}
+
+	if (here >= data->close_before)
+		data->close_none_from = here;
+
+	data->fuel -= i - G->pos;
+	if ((data->fuel <= 0) && !check_timeout(data))
+		return 0;
+
+	return here < data->close_before;
+}
+
+/* match_html_block -- see scan_html_block. Pulls in more input until the
+	scanner can decide, and charges what it looked at to the parse budget */
+static int match_html_block(GREG *G, const char *only) {
+	parser_data *data = (parser_data *)G->data;
+	size_t scanned;
+	long length;
+
+	while ((length = scan_html_block(G->buf + G->pos, G->limit - G->pos, false, only, &scanned)) < 0) {
+		if (!more_input(G)) {
+			length = scan_html_block(G->buf + G->pos, G->limit - G->pos, true, only, &scanned);
+			break;
+		}
+	}
+
+	data->fuel -= scanned;
+	if ((data->fuel <= 0) && !check_timeout(data))
+		return 0;
+
+	if (length <= 0)
+		return 0;
+
+	G->pos += length;
+	return 1;
+}
+
+/* read_metadata -- the metadata at the top of source (owned by the cache,
+	valid until the next call) */
+metadata_block * read_metadata(const char *source, unsigned long extensions) {
+	size_t length = metadata_block_length(source);
+	metadata_block *meta;
+	const char *formatted;
+	char *copy;
+	node_arena *outer;
+	GREG *g;
+	int i;
+
+	for (i = 0; i < METADATA_CACHE; i++) {
+		meta = &metadata_cache[i];
+		if ((meta->text != NULL) && (meta->length == length) && (meta->extensions == extensions) &&
+			(memcmp(meta->text, source, length) == 0))
+			return meta;
+	}
+
+	meta = &metadata_cache[metadata_next];
+	metadata_next = (metadata_next + 1) % METADATA_CACHE;
+	clear_metadata_block(meta);
+	hold_until_exit();
+
+	meta->text = malloc(length + 1);
+	memcpy(meta->text, source, length);
+	meta->text[length] = '\0';
+	meta->length = length;
+	meta->extensions = extensions;
+
+	/* The cache outlives any arena */
+	outer = use_node_arena(NULL);
+
+	formatted = preformat_source(meta->text, &copy);
+	g = take_context();
+	g->data = mk_parser_data(formatted, extensions);
+
+	yyparse_from(g, yy_DocForMetaDataOnly);
+
+	meta->aborted = ((parser_data *)g->data)->parse_aborted;
+	meta->result = ((parser_data *)g->data)->result;
+	meta->dict = mk_metadata_dict(meta->result);
+	((parser_data *)g->data)->result = NULL;
+
+	free_parser_data((parser_data *)g->data);
+	give_context(g);
+	free(copy);
+	use_node_arena(outer);
+
+	return meta;
+}
+
+/* parse_view -- parse pieces (one block of a RAW view) in place, drawing on
+	the parent's budget. Positions come back relative to the document */
+node * parse_view(node *pieces, unsigned long extensions, parser_data *parent) {
+	GREG *g = take_context();
+	parser_data *data;
+	node *result;
+
+	data = mk_parser_data(NULL, (extensions | EXT_NO_METADATA ));
+	data->fuel = parent->fuel;
+	data->document = parent->document;
+	data->view = mk_view_map(pieces, parent->document, &data->view_count);
+	if (data->view_count > 0)
+		data->memo_limit += MEMO_ENTRIES_PER_BYTE * (data->view[data->view_count - 1].input +
+			data->view[data->view_count - 1].length);
+	g->data = data;
+
+	while (yyparse(g) && !aborted(g));
+
+	result = data->result;
+	data->result = NULL;
+	parent->fuel = data->fuel;
+	parent->parse_aborted |= data->parse_aborted;
+
+	/* Emphasis depends on the characters around it as parsed, without the
+		indents and '>' markers, so resolve it before leaving the view */
+	if (extension(EXT_DELIMITER_EMPH, extensions))
+		result = resolve_all_emphasis(result, data);
+
+	map_view_positions(result, data->view, data->view_count);
+
+	free(data->view);
+	free_parser_data(data);
+	give_context(g);
+
+	return result;
+}
+
+/* process_raw_blocks -- follow the tree and process any RAW nodes and insert them
+	into the tree */
+node * process_raw_blocks(node * n, unsigned long extensions, parser_data *parent) {
+	/* from the parser data we get the parent node and pointer to reference list */
+	node *current = NULL;
+	node *pieces;
+	node *block;
+	node *step;
+	node *last_child;
+
+	/* Pair up emphasis delimiters in this list (EXT_DELIMITER_EMPH); those
+		from parse_view() are already done */
+	if (extension(EXT_DELIMITER_EMPH, extensions))
+		n = resolve_emphasis(n, parent);
+
+	current = n;
+	
+	while (current != NULL) {
+		if (current->key == RAW) {
+			/* Process this RAW block -- a "\001" piece separates blocks
+				that are parsed on their own */
+			raw_string_to_view(current, parent->document);
+
+			pieces = current->children;
+			current->children = NULL;
+			current->key = LIST;
+			last_child = NULL;
+
+			while (pieces != NULL) {
+				block = pieces;
+				step = NULL;
+				while ((pieces != NULL) && ((pieces->str == NULL) || (strcmp(pieces->str, "\001") != 0))) {
+					step = pieces;
+					pieces = pieces->next;
+				}
+
+				if (pieces != NULL) {
+					/* Drop the separator */
+					if (step == NULL)
+						block = NULL;
+					else
+						step->next = NULL;
+					step = pieces->next;
+					free_node(pieces);
+					pieces = step;
+				}
+
+				if (block == NULL)
+					continue;
+
+				if (last_child == NULL)
+					current->children = last_child = parse_view(block, extensions, parent);
+				else
+					last_child->next = parse_view(block, extensions, parent);
+
+				while ((last_child != NULL) && (last_child->next != NULL))
+					last_child = last_child->next;
+
+				free_node_tree(block);
+			}
+		}
+		if (current->children != NULL) {
+			/* Recurse into children */
+			current->children = process_raw_blocks(current->children, extensions, parent);
+		}
+		current = current->next;
+	}
+	return n;
+}
+
+node * markdown_chunk_to_node(const char * source, unsigned long extensions) {
+	node * result = parse_chunk(source, extensions, NULL, 0);
+	parser_data *data = mk_parser_data(source, extensions);
+
+	result = process_raw_blocks(result, extensions, data);
+
+	free_parser_data(data);
+	return result;
+}
+
+/* parse_range -- parse one range of a preformatted document on its own
+	(see document.c). Positions are relative to the whole document, just as
+	they would be if it were parsed in one piece */
+void parse_range(const char * document, unsigned long extensions, block_range *range) {
+	GREG *g = take_context();
+
+	g->data = mk_parser_data_range(document + range->start, range->stop - range->start, extensions);
+	((parser_data *)g->data)->original = document;
+	((parser_data *)g->data)->document = document;
+	((parser_data *)g->data)->offset = range->start;
+	((parser_data *)g->data)->fuel = range->fuel;
+
+	while (yyparse(g) && !aborted(g));
+
+	range->result = NULL;
+	range->autolabels = NULL;
+
+	if (!aborted(g)) {
+		range->result = process_raw_blocks(((parser_data *)g->data)->result, extensions, (parser_data *)g->data);
+		((parser_data *)g->data)->result = NULL;
+
+		if (aborted(g)) {
+			free_node_tree(range->result);
+			range->result = NULL;
+		} else {
+			range->autolabels = ((parser_data *)g->data)->autolabels;
+			((parser_data *)g->data)->autolabels = NULL;
+		}
+	}
+
+	range->fuel = ((parser_data *)g->data)->fuel;
+	range->aborted = aborted(g);
+
+	free_parser_data((parser_data *)g->data);
+	give_context(g);
+}
+
+node * parse_chunk(const char * source, unsigned long extensions, parser_data *parent, size_t offset) {
+	/* 
+		Designed for parsing 'chunks' of markdown from inside a specific range,
+		e.g. a label from '[' ... ']' that can have various markup inside
+
+		Prevents situations where the parser gets greedy and goes beyond the 
+		intended boundaries.
+	*/
+
+	/* fprintf(stderr, "Process '%s'\n",source); */
+
+	GREG *g = take_context();
+	node * result;
+
+	g->data = mk_parser_data(source, extensions);
+	if (parent != NULL) {
+		((parser_data *)g->data)->fuel = parent->fuel;
+		((parser_data *)g->data)->document = parent->document;
+		((parser_data *)g->data)->offset = parent->offset + offset;
+		((parser_data *)g->data)->nesting = parent->nesting + 1;
+
+		/* Positions still refer to the parent's view (but we read source) */
+		((parser_data *)g->data)->view = parent->view;
+		((parser_data *)g->data)->view_count = parent->view_count;
+		((parser_data *)g->data)->view_next = parent->view_count;
+	}
+
+	while (yyparse(g) && !aborted(g));
+
+	/* Any RAW blocks are left for the caller's process_raw_blocks() pass,
+		which sees them once their positions are relative to the document */
+	result = ((parser_data *)g->data)->result;
+
+	((parser_data *)g->data)->result = NULL;
+
+	if (parent != NULL) {
+		parent->fuel = ((parser_data *)g->data)->fuel;
+		parent->parse_aborted |= ((parser_data *)g->data)->parse_aborted;
+	}
+
+	free_parser_data((parser_data *)g->data);
+	give_context(g);
+
+	return result;
+}
+
+char * markdown_to_string(const char * source, unsigned long extensions, int format) {
+	return markdown_to_string_with_budget(source, extensions, format, 0);
+}
+
+/* markdown_to_string_with_budget -- give up after `budget` rule entries
+	(shared with any nested parses); 0 uses a default scaled to the input */
+char * markdown_to_string_with_budget(const char * source, unsigned long extensions, int format, unsigned long budget) {
+	long fuel = (budget == 0) ? default_fuel(strlen(source)) :
+		((budget > LONG_MAX) ? LONG_MAX : (long) budget);
+	char *out;
+	const char *formatted;
+	char *copy;
+	char *target_meta_key = FALSE;
+	char *temp;
+	node *refined = NULL;
+	bool parallel = false;
+	node_arena *arena = NULL;
+	node_arena *outer;
+	GREG *g = take_context();    /* create parser context */
+
+	/* Check for beamer mode in metadata */
+	target_meta_key = extract_metadata_value(source, extensions, "latexmode");
+	if (target_meta_key != NULL) {
+		temp = label_from_string(target_meta_key);
+		if (strcmp(temp, "beamer") == 0) {
+				extensions = extensions | EXT_HEADINGSECTION;				
+		}
+		free(temp);
+	}
+	free(target_meta_key);
+
+	/* The tree and the writers' scratch trees all end with this call */
+	if (!extension(EXT_NO_ARENA, extensions))
+		arena = mk_node_arena();
+	outer = use_node_arena(arena);
+
+	/* Resolve Critic Markup while preformatting */
+	if ((extensions & EXT_CRITIC_ACCEPT) || (extensions & EXT_CRITIC_REJECT)) {
+		if (extensions & EXT_CRITIC_REJECT) {
+			if ((extensions & EXT_CRITIC_ACCEPT) && (format == HTML_FORMAT))
+				copy = preformat_critic(source, CRITIC_HTML_HIGHLIGHT_FORMAT);
+			else
+				copy = preformat_critic(source, CRITIC_REJECT_FORMAT);
+		} else {
+			copy = preformat_critic(source, CRITIC_ACCEPT_FORMAT);
+		}
+		formatted = copy;
+	} else {
+		formatted = preformat_source(source, &copy);
+	}
+	
+	g->data = mk_parser_data(formatted,extensions);
+	((parser_data *)g->data)->fuel = fuel;
+	
+	if (format == OPML_FORMAT) {
+		while (yyparse_from(g, yy_DocForOPML) && !aborted(g));	/* We want simpler version */
+	} else if (format == TOC_FORMAT) {
+		while (yyparse_from(g, yy_DocForTOC) && !aborted(g));		/* We want simpler version */
+	} else if (parse_in_parallel((parser_data *)g->data)) {
+		parallel = true;                           /* workers did the RAW bits too */
+	} else {
+		while (yyparse(g) && !aborted(g));       /* parse */
+	}
+
+	if (parallel)
+		refined = ((parser_data *)g->data)->result;
+	else if (!aborted(g))
+		refined = process_raw_blocks(((parser_data *)g->data)->result, extensions, (parser_data *)g->data);    /* iteratively parse RAW bits */
+
+	if (aborted(g)) {
+		/* clean up */
+		free_parser_data((parser_data *)g->data);
+		give_context(g);
+		
+		free(copy);
+		use_node_arena(outer);
+		free_node_arena(arena);
+		
+		out = strdup("MultiMarkdown was unable to parse this file.");
+		return out;
+	}
+
+	/* move autolabels to main parse tree */
+	if (((parser_data *)g->data)->autolabels != NULL) {
+//		fprintf(stderr, "We have autolabels\n");
+		append_list(((parser_data *)g->data)->autolabels,refined);
+		((parser_data *)g->data)->autolabels = NULL;	
+	} else {
+//		fprintf(stderr, "No autolabels\n");
+	}
+	
+	/* Show what we got */
+	out = export_node_tree_with_references(refined, formatted, format, extensions, NULL, NULL);
+	
+	/* clean up */
+	free_parser_data((parser_data *)g->data);
+	give_context(g);
+	
+	free(copy);
+	use_node_arena(outer);
+	free_node_arena(arena);
+	return out;
+}
+
+/* markdown_to_node_tree -- return the parse tree for source, with node
+	start/stop set to byte offsets into source (NULL if the parse fails) */
+node * markdown_to_node_tree(const char * source, unsigned long extensions) {
+	const char *formatted;
+	char *copy;
+	node *result = NULL;
+	GREG *g = take_context();
+
+	formatted = preformat_source(source, &copy);
+	g->data = mk_parser_data(formatted, extensions);
+
+	if (!parse_in_parallel((parser_data *)g->data)) {
+		while (yyparse(g) && !aborted(g));
+
+		if (!aborted(g))
+			((parser_data *)g->data)->result = process_raw_blocks(((parser_data *)g->data)->result, extensions, (parser_data *)g->data);
+	}
+
+	if (!aborted(g)) {
+		result = ((parser_data *)g->data)->result;
+		((parser_data *)g->data)->result = NULL;
+
+		fill_node_positions(result);
+		map_preformatted_positions(result, source);
+	}
+
+	free_parser_data((parser_data *)g->data);
+	give_context(g);
+
+	free(copy);
+	return result;
+}
+
+/* has_metadata -- determine whether metadata exists or not */
+bool has_metadata(const char *source, unsigned long extensions) {
+	node *result = read_metadata(source, extensions)->result;
+
+	return (result != NULL) && (result->key == METADATA);
+}
+
+/* extract_metadata_keys -- return list of metadata keys as "\n" separated list */
+char * extract_metadata_keys(const char *source, unsigned long extensions) {
+	metadata_block *meta = read_metadata(source, extensions);
+
+	if (meta->aborted)
+		return strdup("MultiMarkdown was unable to parse this file.");
+
+	return metadata_keys(meta->result);
+}
+
+/* extract_metadata_value -- find the value and return it */
+char * extract_metadata_value(const char *source, unsigned long extensions, char *key) {
+	metadata_block *meta = read_metadata(source, extensions);
+	char *value;
+
+	if (meta->aborted)
+		return strdup("MultiMarkdown was unable to parse this file.");
+
+	value = dict_metavalue_for_key(key, meta->dict);
+	return (value == NULL) ? NULL : strdup(value);
+}
+
@@ -9,6 +9,7 @@
 #include <stdbool.h>
 #include <assert.h>
 #include <time.h>
+#include <limits.h>
 #include "glib.h"
 #include "libMultiMarkdown.h"
 
@@ -33,17 +34,225 @@
 /* This is the type used for the $$ pseudovariable passed to parents */
 #define YYSTYPE node *
 
+/* Bulk storage for the nodes of one conversion (see use_node_arena) */
+typedef struct node_arena node_arena;
+
+/* One piece of a RAW block that is parsed in place (see mk_view) -- either
+	a span of the document, or literal text the grammar added */
+typedef struct {
+	size_t      input;          /* Where the piece starts in the nested input */
+	size_t      length;
+	const char *text;           /* The bytes themselves */
+	size_t      source;         /* Document offset (literals: where they were added) */
+	bool        literal;
+} view_piece;
+
+/* Where an emphasis scan that passed a position stopped (EXT_MEMOIZE) */
+typedef struct {
+	unsigned long key;          /* As for the failure memo -- 0 is empty */
+	unsigned long end;          /* Where the scan stopped */
+} scan_entry;
+
 /* This is the data we store in the parser context */
 typedef struct {
 	const char *charbuf;        /* Input buffer */
+	const char *charbuf_end;    /* End of input buffer */
 	const char *original;       /* Original input buffer */
+	const char *document;       /* Top level buffer that node positions refer to */
+	size_t offset;              /* Added to positions in charbuf (nested parses) */
 	node *result;               /* Resulting parse tree */
 	unsigned long extensions;   /* Extension bitfield */
 	node *autolabels;           /* Store for later retrieval */
 	bool  parse_aborted;        /* We got bogged down - fail parse */
-	clock_t stop_time;          /* Note the deadline to complete parsing */
+	long  fuel;                 /* Rule entries left before we give up */
+	unsigned long *memo;        /* Failed (rule, position) attempts */
+	unsigned long memo_size;    /* Number of slots in memo table */
+	unsigned long memo_count;   /* Number of slots in use */
+	unsigned long memo_limit;   /* Entries either table may hold (see MEMO_MAX_ENTRIES) */
+	size_t bracket_from;        /* Last stretch bracket_may_close() scanned */
+	size_t bracket_to;
+	bool   bracket_found;       /* ... and whether it ended at a ']' */
+	size_t close_before;        /* A ']' is at or after anything before this */
+	size_t close_none_from;     /* ... and none follows from here on */
+	scan_entry *scans;          /* Where finished scans stopped */
+	unsigned long scan_size;
+	unsigned long scan_count;
+	unsigned long *scan_visits; /* Positions passed by unfinished scans */
+	unsigned long scan_visit_count;
+	unsigned long scan_visit_size;
+	unsigned long *scan_marks;  /* Where each unfinished scan's visits start */
+	int    scan_depth;
+	int    nesting;             /* Chunks this parse is nested in */
+	view_piece *view;           /* Pieces of the RAW block being parsed (or NULL) */
+	size_t view_count;          /* Number of pieces */
+	size_t view_next;           /* Next piece to hand to the parser */
+	const unsigned char *char_class; /* Byte classes for these extensions (see char_classes) */
+	const unsigned long long *rule_starts; /* Alternatives each byte can start (see dispatch_rules) */
 } parser_data;
 
+/* Bits in the char_classes() tables -- the inline rules look a byte up once
+	instead of trying each alternative in turn */
+enum char_class_bits {
+	CHAR_SPACE     = 1 << 0,    /* Spacechar */
+	CHAR_NEWLINE   = 1 << 1,    /* First byte of a Newline */
+	CHAR_SPECIAL   = 1 << 2,    /* SpecialChar, extensions included */
+	CHAR_NORMAL    = 1 << 3,    /* NormalChar */
+	CHAR_NONPUNCT  = 1 << 4,    /* NonPunctuation */
+	CHAR_ALNUM     = 1 << 5,    /* Alphanumeric */
+	CHAR_WIDE_LEAD = 1 << 6,    /* Lead byte of '。' and '、' -- the grammar decides */
+};
+
+/* Rules that record their failures when EXT_MEMOIZE is enabled.  The id is
+	packed into the low bits of the memo key, so keep MEMO_RULE_COUNT <= 32 */
+enum memo_rules {
+	MEMO_INLINE,
+	MEMO_EMPH,
+	MEMO_EMPH_MATCH,
+	MEMO_STRONG,
+	MEMO_STRONG_MATCH,
+	MEMO_STRONG_AND_EMPH,
+	MEMO_LABEL,
+	MEMO_LABEL_TEXT,
+	MEMO_LINK,
+	MEMO_BRACKETED_TEXT,
+	MEMO_HTML_BLOCK_IN_TAGS,
+	MEMO_EMPH_STAR,             /* Only for the scans (see scan_visit) */
+	MEMO_EMPH_UL,
+	MEMO_STRONG_STAR,
+	MEMO_STRONG_UL,
+	MEMO_SOURCE_CONTENTS,
+	MEMO_RULE_COUNT
+};
+
+/* Alternatives of Block and Inline that are only tried when the next byte
+	could start them (first-byte dispatch). Keep DISPATCH_RULE_COUNT <= 64 */
+enum dispatch_rules {
+	BLOCK_QUOTE,
+	BLOCK_FENCED,
+	BLOCK_VERBATIM,
+	BLOCK_DEFINITION_LIST,
+	BLOCK_GLOSSARY,
+	BLOCK_NOTE,
+	BLOCK_LINK_REFERENCE,
+	BLOCK_ABBREVIATION,
+	BLOCK_HORIZONTAL_RULE,
+	BLOCK_HEADING_SECTION,
+	BLOCK_HEADING,
+	BLOCK_ORDERED_LIST,
+	BLOCK_BULLET_LIST,
+	BLOCK_HTML,
+	BLOCK_MARKDOWN_HTML,
+	BLOCK_STYLE,
+	BLOCK_TABLE,
+	BLOCK_IMAGE,
+	BLOCK_TOC,
+	BLOCK_PARA,
+	BLOCK_PLAIN,
+	INLINE_CRITIC,
+	INLINE_DOLLAR_MATH,
+	INLINE_STR,
+	INLINE_MATH_SPAN,
+	INLINE_ENDLINE,
+	INLINE_UL_OR_STAR_LINE,
+	INLINE_SPACE,
+	INLINE_EMPH_DELIMITER,
+	INLINE_STRONG_AND_EMPH,
+	INLINE_STRONG,
+	INLINE_EMPH,
+	INLINE_CITATION,
+	INLINE_VARIABLE,
+	INLINE_IMAGE,
+	INLINE_LINK,
+	INLINE_NOTE_REFERENCE,
+	INLINE_CODE,
+	INLINE_HTML_TAG_OPEN,
+	INLINE_RAW_HTML,
+	INLINE_ENTITY,
+	INLINE_ESCAPED_CHAR,
+	INLINE_SMART,
+	INLINE_SYMBOL,
+	DISPATCH_RULE_COUNT
+};
+
+#define RULE_BIT(x)      (1ULL << (x))
+
+/* Default parse budget (see check_timeout) -- scales with the input so that
+	long documents aren't penalized, but runaway backtracking is caught.
+	Ordinary documents use under 2 per byte, and the minimum runs out in
+	a second or two, inside the old 3 second timeout */
+#define FUEL_PER_BYTE    100
+#define FUEL_MINIMUM     10000000
+
+#define MEMO_RULE_BITS   5
+#define MEMO_MAX_ENTRIES (1 << 19)  /* Stop recording here (table is then 8 MB on 64 bit) */
+#define MEMO_ENTRIES_PER_BYTE 4     /* ... plus this many for each byte of input */
+#define NEST_MAX_DEPTH   256        /* Emphasis and brackets aren't looked for any deeper (EXT_MEMOIZE) */
+
+/* A range of a preformatted document that parses the same on its own as it
+	does in place (see next_block_boundary) */
+typedef struct {
+	size_t start;               /* Offsets into the document */
+	size_t stop;
+	node  *result;              /* Parse tree, with RAW blocks processed */
+	node  *autolabels;
+	long   fuel;                /* Budget going in, what is left coming out */
+	bool   aborted;
+} block_range;
+
+/* Metadata keys (as label_from_string makes them) and their values,
+	hashed -- see mk_metadata_dict */
+typedef struct {
+	char          *key;
+	char          *value;       /* Trimmed, as metavalue_for_key gives it */
+	node          *meta;        /* The METAKEY node */
+} metadata_entry;
+
+typedef struct {
+	metadata_entry *entries;    /* In document order */
+	size_t         count;
+	int           *index;       /* Entries hashed by key; -1 if empty */
+	int           *node_index;  /* ...and by METAKEY node */
+	size_t         index_size;
+	char          *text;        /* Where the keys and values live */
+} metadata_dict;
+
+/* The metadata at the top of a buffer, as read by read_metadata() */
+typedef struct {
+	char          *text;        /* Raw text it was read from */
+	size_t         length;
+	unsigned long  extensions;
+	node          *result;      /* Parse result -- a METADATA node comes first */
+	metadata_dict *dict;        /* ...and its keys */
+	bool           aborted;
+} metadata_block;
+
+/* Preformatted text built a piece at a time (see preformat_append) */
+typedef struct {
+	char          *str;
+	size_t         length;
+	size_t         size;        /* Room for text, not counting the padding */
+	size_t         line;        /* Where the current line starts... */
+	size_t         checked;     /* ...judging by the text up to here */
+	bool           after_cr;    /* Last piece ended with '\r' */
+} preformat_buffer;
+
+/* A note (footnote, citation or glossary entry) and the numbers it has
+	been given (see note_number_for_label) */
+typedef struct {
+	node          *note;
+	int            number;      /* Order of first use, 0 if not used yet */
+	int            cite;        /* Order among citations, 0 if not cited */
+} note_slot;
+
+/* What an export knows about a node of the parse tree that isn't in the
+	node itself, since export doesn't change the tree (see mark_node) */
+typedef struct {
+	node          *n;
+	short          key;         /* Key to print it as (see node_key), or 0 */
+	node          *abbr;        /* The abbreviation an ABBR or ABBRSTART uses */
+	int            note;        /* Number of a NOTEREFERENCE's inline note */
+} node_mark;
+
 /* A "scratch pad" for storing data when writing output 
 	The structure will vary based on what you need */
 typedef struct {
@@ -57,12 +266,26 @@ typedef struct {
 	char  cell_type;             /* What sort of cell type are we in? */
 	bool  printing_notes;        /* Are we printing notes/glossary/etc.? */
 	node *notes;                 /* Store reference notes */
+	note_slot *note_index;       /* notes hashed by label */
+	size_t note_index_size;
 	node *links;                 /* ... links */
+	node **link_index;           /* links hashed by label (see find_link_data) */
+	size_t link_index_size;
+	node *link_index_of;         /* links as they were when it was built */
 	node *glossary;              /* ... glossary */
 	node *citations;             /* ... citations */
 	node *abbreviations;         /* ... abbreviations */
-	node *used_notes;            /* notes that have been referenced */
+	note_slot *used_notes;       /* notes in order of first use -- note n is used_notes[n - 1] */
+	int   used_note_count;
+	int   used_note_space;
+	int   used_cite_count;       /* how many of them have been cited */
 	node *result_tree;           /* reference to entire result tree */
+	const char *source;          /* the text its positions refer to, or NULL */
+	metadata_dict *metadata;     /* its metadata, by key */
+	node_mark *marks;            /* what we know about its nodes, hashed by node */
+	size_t mark_count;
+	size_t mark_size;
+	node *toc;                   /* contents for {{TOC}} */
 	int   footnote_to_print;     /* set while we are printing so we can reverse link */
 	int   footnote_para_counter; /* so we know which para is last */
 	int   max_footnote_num;      /* so we know if current note is new or repeat */
@@ -88,6 +311,8 @@ typedef struct {
 	int   lyx_table_total_rows;  /* CRC - The total number of rows in the table */
 	int   lyx_table_total_cols;  /* CRC - The total number of columns in the table */
 	node *lyx_table_caption;     /* CRC - Hold the table caption */
+	node *lyx_anchors;           /* links to "#label" anchors: label is the
+	                               anchor, source the prefixed one to use */
 	GString *lyx_debug_pad;      /* CRC - padding to indent debugging informaiton */
 } scratch_pad;
 
@@ -116,21 +341,41 @@ enum smartelements {
 
 
 /* parser utilities declarations */
+node_arena * mk_node_arena(void);
+node_arena * use_node_arena(node_arena *arena);
+void   free_node_arena(node_arena *arena);
+
 node * mk_node(int key);
 node * mk_str(char *string);
 node * mk_list(int key, node *list);
 node * mk_link(node *text, char *label, char *source, char *title, node *attr);
-node * mk_pos_node(int key, char *string, unsigned int start, unsigned int stop);
-node * mk_pos_str(char *string, unsigned int start, unsigned int stop);
-node * mk_pos_list(int key, node *list, unsigned int start, unsigned int stop);
+node * mk_pos_node(int key, char *string, size_t start, size_t stop);
+node * mk_pos_str(char *string, size_t start, size_t stop);
+node * mk_pos_list(int key, node *list, size_t start, size_t stop);
+bool   has_position(node *n);
+void   fill_node_positions(node *n);
+node * mk_view(parser_data *data, size_t begin, size_t end);
+node * mk_raw_from_list(node *list, bool extra_newline);
+void   raw_string_to_view(node *raw, const char *document);
+view_piece * mk_view_map(node *pieces, const char *document, size_t *count);
+void   map_view_positions(node *tree, view_piece *view, size_t count);
+node * resolve_emphasis(node *list, parser_data *data);
+node * resolve_all_emphasis(node *tree, parser_data *data);
+long   scan_html_block(const char *text, size_t length, bool complete, const char *only, size_t *scanned);
+void   map_preformatted_positions(node *tree, const char *source);
 
 void   free_node(node *n);
+void   set_node_str(node *n, char *str);
 void   free_node_tree(node * n);
 void   print_node_tree(node * n);
 node * copy_node(node *n);
 node * copy_node_tree(node *n);
 
 node * cons(node *new, node *list);
+node * add_node(node *list, node *new);
+node * add_node_first(node *list, node *new);
+node * join_lists(node *front, node *back);
+node * close_list(node *list);
 node * reverse_list(node *list);
 void   append_list(node *new, node *list);
 
@@ -138,9 +383,18 @@ node    * mk_str_from_list(node *list, bool extra_newline);
 GString * concat_string_list(node *list);
 
 parser_data * mk_parser_data(const char *charbuf, unsigned long extensions);
+parser_data * mk_parser_data_range(const char *charbuf, size_t length, unsigned long extensions);
+const unsigned char * char_classes(unsigned long extensions);
+const unsigned long long * rule_start_table(void);
+const char * dispatch_rule_name(int rule);
+long   default_fuel(size_t length);
 void   free_parser_data(parser_data *data);
 
 char * preformat_text(const char *text);
+const char * preformat_source(const char *text, char **copy);
+void   preformat_start(preformat_buffer *buf, size_t size);
+void   preformat_append(preformat_buffer *buf, const char *text, size_t length);
+char * preformat_finish(preformat_buffer *buf);
 
 scratch_pad * mk_scratch_pad(unsigned long extensions);
 void   free_scratch_pad(scratch_pad *scratch);
@@ -148,6 +402,7 @@ void   free_scratch_pad(scratch_pad *scratch);
 link_data * mk_link_data(char *label, char *source, char *title, node *attr);
 void   free_link_data(link_data *l);
 link_data * extract_link_data(char *label, scratch_pad *scratch);
+link_data * find_link_data(char *label, scratch_pad *scratch);
 node * mk_autolink(char *text);
 
 void   extract_references(node *list, scratch_pad *scratch);
@@ -158,10 +413,13 @@ bool   extension(int ext, unsigned long extensions);
 /* export utilities */
 void   trim_trailing_whitespace(char *str);
 void   trim_trailing_newlines(char *str);
+char * trimmed_string(const char *str);
 
 /* other utilities */
 char * lower_string(char *str);
 char * label_from_string(char *str);
+void   copy_label(char *out, const char *str);
+unsigned long string_hash(const char *key);
 char * ascii_label_from_string(char *str);
 char * clean_string(char *str);
 char * string_from_node_tree(node *n);
@@ -173,16 +431,38 @@ void   print_raw_node(GString *out, node *n);
 void   print_raw_node_tree(GString *out, node*n);
 
 char * correct_dimension_units(char *original);
+size_t metadata_block_length(const char *source);
 char * metadata_keys(node *list);
 node * metadata_for_key(char *key, node *list);
 char * metavalue_for_key(char *key, node *list);
+metadata_dict * mk_metadata_dict(node *list);
+void   free_metadata_dict(metadata_dict *dict);
+node * dict_metadata_for_key(char *key, metadata_dict *dict);
+char * dict_metavalue_for_key(char *key, metadata_dict *dict);
+char * dict_key_for_node(node *metakey, metadata_dict *dict);
 
 bool tree_contains_key(node *list, int key);
 int tree_contains_key_count(node *list, int key);
 
 node * markdown_chunk_to_node(const char * source, unsigned long extensions);
-
-bool check_timeout();
+void   parse_range(const char * document, unsigned long extensions, block_range *range);
+bool   parse_in_parallel(parser_data *data);
+metadata_block * read_metadata(const char *source, unsigned long extensions);
+void   parser_context_stats(unsigned long *created, unsigned long *reused, unsigned long *allocations);
+void   parser_rule_stats(int rule, unsigned long *tried, unsigned long *skipped, unsigned long *failures);
+void   parser_node_stats(unsigned long *heap, unsigned long *arena, unsigned long *chunks);
+
+bool check_timeout(parser_data *data);
+
+bool memo_check(parser_data *data, int rule, unsigned long pos);
+bool memo_note_failure(parser_data *data, int rule, unsigned long pos);
+bool scan_known(parser_data *data, int rule, unsigned long pos, unsigned long *end);
+bool scan_begin(parser_data *data);
+bool scan_visit(parser_data *data, int rule, unsigned long pos);
+bool scan_end(parser_data *data, int rule, unsigned long end);
+bool scan_abandon(parser_data *data);
+bool nest_enter(parser_data *data);
+bool nest_leave(parser_data *data);
 
 void debug_node(node *n);
 void debug_node_tree(node *n);
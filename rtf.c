@@ -45,6 +45,7 @@ void print_rtf_node(GString *out, node *n, scratch_pad *scratch) {
 	int lev;
 	int old_type;
 	char *temp;
+	char *key;
 	link_data *temp_link_data;
 	node *temp_node;
 
@@ -64,17 +65,15 @@ void print_rtf_node(GString *out, node *n, scratch_pad *scratch) {
 			scratch->padded = 0;
 			break;
 		case METAKEY:
-			/* Convert key */
-			temp = label_from_string(n->str);
-			free(n->str);
-			n->str = temp;
-			if (strcmp(n->str, "baseheaderlevel") == 0) {
+			/* the key as label_from_string makes it */
+			key = metadata_key_for_node(n, scratch);
+			if (strcmp(key, "baseheaderlevel") == 0) {
 				scratch->baseheaderlevel = atoi(n->children->str);
 				break;
-			} else if (strcmp(n->str, "rtfheaderlevel") == 0) {
+			} else if (strcmp(key, "rtfheaderlevel") == 0) {
 				scratch->baseheaderlevel = atoi(n->children->str);
 				break;
-			} else if (strcmp(n->str, "quoteslanguage") == 0) {
+			} else if (strcmp(key, "quoteslanguage") == 0) {
 				temp = label_from_node_tree(n->children);
 				if ((strcmp(temp, "nl") == 0) || (strcmp(temp, "dutch") == 0)) { scratch->language = DUTCH; }   else 
 				if ((strcmp(temp, "de") == 0) || (strcmp(temp, "german") == 0)) { scratch->language = GERMAN; } else 
@@ -85,43 +84,44 @@ void print_rtf_node(GString *out, node *n, scratch_pad *scratch) {
 				break;
 			}
 	
-			if (strcmp(n->str, "title") == 0) {
+			if (strcmp(key, "title") == 0) {
 				g_string_append_printf(out, "{\\title ");
 				print_rtf_node(out, n->children, scratch);
 				g_string_append_printf(out, "}\n");
-			} else if (strcmp(n->str, "author") == 0) {
+			} else if (strcmp(key, "author") == 0) {
 				g_string_append_printf(out, "{\\author ");
 				print_rtf_node(out, n->children, scratch);
 				g_string_append_printf(out, "}\n");
-			} else if (strcmp(n->str, "affiliation") == 0) {
+			} else if (strcmp(key, "affiliation") == 0) {
 				g_string_append_printf(out, "{\\company ");
 				print_rtf_node(out, n->children, scratch);
 				g_string_append_printf(out, "}\n");
-			} else if (strcmp(n->str, "company") == 0) {
+			} else if (strcmp(key, "company") == 0) {
 				g_string_append_printf(out, "{\\company ");
 				print_rtf_node(out, n->children, scratch);
 				g_string_append_printf(out, "}\n");
-			} else if (strcmp(n->str, "keywords") == 0) {
+			} else if (strcmp(key, "keywords") == 0) {
 				g_string_append_printf(out, "{\\keywords ");
 				print_rtf_node(out, n->children, scratch);
 				g_string_append_printf(out, "}\n");
-			} else if (strcmp(n->str, "copyright") == 0) {
+			} else if (strcmp(key, "copyright") == 0) {
 				g_string_append_printf(out, "{\\*\\copyright ");
 				print_rtf_node(out, n->children, scratch);
 				g_string_append_printf(out, "}\n");
-			} else if (strcmp(n->str, "comment") == 0) {
+			} else if (strcmp(key, "comment") == 0) {
 				g_string_append_printf(out, "{\\doccomm ");
 				print_rtf_node(out, n->children, scratch);
 				g_string_append_printf(out, "}\n");
-			} else if (strcmp(n->str, "subject") == 0) {
+			} else if (strcmp(key, "subject") == 0) {
 				g_string_append_printf(out, "{\\subject ");
 				print_rtf_node(out, n->children, scratch);
 				g_string_append_printf(out, "}\n");
 			}
 			break;
 		case METAVALUE:
-			trim_trailing_whitespace(n->str);
-			print_rtf_string(out, n->str, scratch);
+			temp = trimmed_string(n->str);
+			print_rtf_string(out, temp, scratch);
+			free(temp);
 			break;
 		case BLOCKQUOTEMARKER:
 			print_rtf_node_tree(out, n->children, scratch);
@@ -226,6 +226,7 @@ void print_rtf_node(GString *out, node *n, scratch_pad *scratch) {
 			}
 			g_string_append_printf(out, "\\pard\\par\n");
 			scratch->padded = 1;
+			scratch->table_alignment = NULL;
 			break;
 		case TABLELABEL:
 		case TABLECAPTION:
@@ -324,7 +325,8 @@ void print_rtf_node(GString *out, node *n, scratch_pad *scratch) {
 				print_rtf_node_tree(out, n->children, scratch);
 			g_string_append_printf(out, "}}");
 
-			free(temp_link_data);
+			temp_link_data->attr = NULL;
+			free_link_data(temp_link_data);
 			break;
 		case BULLETLIST:
 			pad(out, 2, scratch);
@@ -343,7 +345,7 @@ void print_rtf_node(GString *out, node *n, scratch_pad *scratch) {
 			break;
 		case NOTEREFERENCE:
 			lev = note_number_for_node(n, scratch);
-			temp_node = node_for_count(scratch->used_notes, lev);
+			temp_node = note_for_number(lev, scratch);
 			scratch->padded = 2;
 
 			g_string_append_printf(out, "{\\super\\chftn}{\\footnote\\pard\\plain\\chtfn ");
@@ -369,7 +371,7 @@ void print_rtf_node(GString *out, node *n, scratch_pad *scratch) {
 				if (n->link_data != NULL)
 					lev = note_number_for_label(n->link_data->label, scratch);
 				if (lev != 0) {
-					temp_node = node_for_count(scratch->used_notes, lev);
+					temp_node = note_for_number(lev, scratch);
 					
 					/* flag that this is used as a citation */
 					temp_node->key = CITATIONSOURCE;
@@ -381,7 +383,7 @@ void print_rtf_node(GString *out, node *n, scratch_pad *scratch) {
 						scratch->odf_para_type = CITATION;
 						
 						/* change to represent cite count only */
-						// lev = cite_count_node_from_end(temp_node);
+						// lev = cite_number_for_note(lev, scratch);
 						g_string_append_printf(out, "{\\super\\chftn}{\\footnote\\ftnalt\\pard\\plain\\chtfn ");
 						scratch->padded = 2;
 						if (temp_node->children != NULL) {
@@ -394,7 +396,7 @@ void print_rtf_node(GString *out, node *n, scratch_pad *scratch) {
 						/* We are reusing a previous citation */
 
 						/* Change lev to represent cite count only */
-						// lev = cite_count_node_from_end(temp_node);
+						// lev = cite_number_for_note(lev, scratch);
 					
 						g_string_append_printf(out, "REUSE CITATION");
 					}
@@ -466,12 +468,11 @@ void print_rtf_node(GString *out, node *n, scratch_pad *scratch) {
 			g_string_append_printf(out, "IMAGES CANNOT BE INSERTED INTO AN RTF DOCUMENT FROM MULTIMARKDOWN \\\n");
 			break;
 		case VARIABLE:
-			temp = metavalue_for_key(n->str,scratch->result_tree);
+			temp = dict_metavalue_for_key(n->str, scratch->metadata);
 			if (temp == NULL) {
 				g_string_append_printf(out, "[%%%s]",n->str);
 			} else {
 				print_rtf_string(out, temp, scratch);
-				free(temp);
 			}
 			break;
 		case HTMLBLOCK:
@@ -480,13 +481,12 @@ void print_rtf_node(GString *out, node *n, scratch_pad *scratch) {
 			if (strncmp(n->str,"<!--",4) == 0) {
 				pad(out, 2, scratch);
 				/* trim "-->" from end */
-				n->str[strlen(n->str)-3] = '\0';
-				g_string_append_printf(out, "%s", &n->str[4]);
+				g_string_append_printf(out, "%.*s", (int) strlen(n->str) - 7, &n->str[4]);
 				scratch->padded = 0;
 			}
 			break;
 		case TOC:
-			print_rtf_node_tree(out,n->children, scratch);
+			print_rtf_node_tree(out,scratch->toc, scratch);
 			break;
 		default:
 			fprintf(stderr, "print_rtf_node encountered unknown node key = %d\n",n->key);
@@ -0,0 +1,147 @@
+/*
+
+	compact_tree.c -- Parse each file with markdown_to_compact_tree() and
+		unpack it again. The unpacked tree has to match the one
+		markdown_to_node_tree() gives, node for node, and export to every
+		format as that tree does
+
+	(c) 2013-2015 Fletcher T. Penney (http://fletcherpenney.net/).
+
+	This program is free software; you can redistribute it and/or modify
+	it under the terms of the GNU General Public License or the MIT
+	license.  See LICENSE for details.
+
+*/
+
+#include "parser.h"
+#include "compact.h"
+#include "writer.h"
+
+/* Not RTF, which complains about much of what these tests use */
+static int formats[] = {
+	HTML_FORMAT, LATEX_FORMAT, MEMOIR_FORMAT, BEAMER_FORMAT, ODF_FORMAT,
+	LYX_FORMAT
+};
+
+#define FORMAT_COUNT  (sizeof(formats) / sizeof(formats[0]))
+
+#define EXTENSIONS    (EXT_SMART | EXT_NOTES)
+
+static char * read_file(const char *path) {
+	FILE *file = fopen(path, "r");
+	size_t size = 4096;
+	size_t length = 0;
+	char *source;
+
+	if (file == NULL)
+		return NULL;
+
+	source = malloc(size);
+	while ((length += fread(source + length, 1, size - length - 1, file)) == size - 1) {
+		size *= 2;
+		source = realloc(source, size);
+	}
+	source[length] = '\0';
+
+	fclose(file);
+	return source;
+}
+
+static bool same_string(const char *a, const char *b) {
+	if ((a == NULL) || (b == NULL))
+		return a == b;
+
+	return strcmp(a, b) == 0;
+}
+
+static bool same_tree(node *a, node *b);
+
+static bool same_link_data(link_data *a, link_data *b) {
+	if ((a == NULL) || (b == NULL))
+		return a == b;
+
+	return same_string(a->label, b->label) && same_string(a->source, b->source)
+		&& same_string(a->title, b->title) && same_tree(a->attr, b->attr);
+}
+
+/* same_tree -- do the lists a and b hold the same nodes, in the same order? */
+static bool same_tree(node *a, node *b) {
+	while ((a != NULL) && (b != NULL)) {
+		if ((a->key != b->key) || (a->start != b->start) || (a->stop != b->stop)
+			|| !same_string(a->str, b->str) || !same_link_data(a->link_data, b->link_data)
+			|| !same_tree(a->children, b->children))
+			return false;
+
+		a = a->next;
+		b = b->next;
+	}
+
+	return (a == NULL) && (b == NULL);
+}
+
+/* compare_file -- the number of ways source's compact tree fell short */
+static int compare_file(const char *path, const char *source) {
+	node *tree = markdown_to_node_tree(source, EXTENSIONS);
+	compact_tree *packed = markdown_to_compact_tree(source, EXTENSIONS);
+	node *unpacked = node_tree_from_compact(packed);
+	char *expected;
+	char *got;
+	int failures = 0;
+	size_t f;
+
+	if ((tree == NULL) || (packed == NULL)) {
+		fprintf(stderr, "%s: parse failed\n", path);
+		failures++;
+	} else {
+		if (!same_tree(tree, unpacked)) {
+			fprintf(stderr, "%s: unpacked tree differs from the parse\n", path);
+			failures++;
+		}
+
+		expected = string_from_node_tree(tree);
+		got = string_from_compact_tree(packed);
+		if (strcmp(expected, got) != 0) {
+			fprintf(stderr, "%s: compact tree text differs\n", path);
+			failures++;
+		}
+		free(expected);
+		free(got);
+
+		for (f = 0; f < FORMAT_COUNT; f++) {
+			expected = export_node_tree(tree, formats[f], EXTENSIONS);
+			got = export_node_tree(unpacked, formats[f], EXTENSIONS);
+			if (strcmp(expected, got) != 0) {
+				fprintf(stderr, "%s: export to format %d differs\n", path, formats[f]);
+				failures++;
+			}
+			free(expected);
+			free(got);
+		}
+	}
+
+	free_node_tree(tree);
+	free_node_tree(unpacked);
+	free_compact_tree(packed);
+
+	return failures;
+}
+
+int main(int argc, char **argv) {
+	char *source;
+	int failures = 0;
+	int i;
+
+	for (i = 1; i < argc; i++) {
+		source = read_file(argv[i]);
+		if (source == NULL) {
+			fprintf(stderr, "%s: can't read\n", argv[i]);
+			failures++;
+			continue;
+		}
+
+		failures += compare_file(argv[i], source);
+		free(source);
+	}
+
+	return (failures == 0) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,125 @@
+/*
+
+	edit_references.c -- Edit a document through mmd_doc_edit() and export
+		it after each change. The reference tables are kept between exports
+		unless an edit touches a block that defines something, so every
+		export has to match a fresh parse of the same text
+
+	(c) 2013-2015 Fletcher T. Penney (http://fletcherpenney.net/).
+
+	This program is free software; you can redistribute it and/or modify
+	it under the terms of the GNU General Public License or the MIT
+	license.  See LICENSE for details.
+
+*/
+
+#include "parser.h"
+
+static const char *original =
+	"# Introduction #\n"
+	"\n"
+	"A paragraph with a [link][ref], a note[^note] and a link to the\n"
+	"[Introduction][] and to [Results][].\n"
+	"\n"
+	"| Name | Value |\n"
+	"| ---- | ----- |\n"
+	"| a    | 1     |\n"
+	"[Results]\n"
+	"\n"
+	"[ref]: http://example.com/one \"One\"\n"
+	"\n"
+	"[^note]: The note.\n"
+	"\n"
+	"Another paragraph, with nothing defined in it.\n"
+	"\n"
+	"The last paragraph links to [other][].\n";
+
+/* Each edit is applied to the text before it */
+typedef struct {
+	const char *find;        /* Where the edit goes (first match) */
+	size_t      deleted;     /* Bytes to remove there */
+	const char *inserted;
+	const char *what;
+} doc_change;
+
+static doc_change changes[] = {
+	{ "nothing defined", 7, "still nothing", "change a plain paragraph" },
+	{ "http://example.com/one", 22, "http://example.com/two", "change a link definition" },
+	{ "The last paragraph", 0, "[other]: http://example.com/other\n\n", "add a definition" },
+	{ "[^note]: The note.\n\n", 20, "", "remove a note" },
+	{ "# Introduction #", 16, "# Overview #", "rename a heading" },
+	{ "\"One\"", 5, "\"First\"", "change a link title" },
+	{ "Another paragraph", 0, "[again]: http://example.com/again\n", "turn a paragraph into a definition" },
+	{ "[again]: http://example.com/again\n", 34, "", "turn it back" },
+	{ "[link][ref]", 11, "[link][other]", "change a reference" },
+	{ "| a    | 1     |\n", 0, "| b    | 2     |\n", "add a table row" },
+};
+
+static int formats[] = {
+	HTML_FORMAT, LATEX_FORMAT, ODF_FORMAT, OPML_FORMAT
+};
+
+#define CHANGE_COUNT  (sizeof(changes) / sizeof(changes[0]))
+#define FORMAT_COUNT  (sizeof(formats) / sizeof(formats[0]))
+
+#define EXTENSIONS    (EXT_SMART | EXT_NOTES)
+
+/* compare_exports -- does doc export as a fresh parse of text does? */
+static int compare_exports(mmd_doc *doc, const char *text, const char *what) {
+	mmd_doc *fresh = mmd_doc_new(text, EXTENSIONS);
+	char *expected;
+	char *got;
+	int failures = 0;
+	size_t f;
+
+	for (f = 0; f < FORMAT_COUNT; f++) {
+		got = mmd_export(doc, formats[f]);
+		expected = mmd_export(fresh, formats[f]);
+
+		if (strcmp(got, expected) != 0) {
+			fprintf(stderr, "%s: export to format %d differs from a fresh parse\n", what, formats[f]);
+			failures++;
+		}
+
+		free(got);
+		free(expected);
+	}
+
+	mmd_doc_free(fresh);
+	return failures;
+}
+
+int main(int argc, char **argv) {
+	GString *text = g_string_new((char *) original);
+	mmd_doc *doc = mmd_doc_new(original, EXTENSIONS);
+	int failures = compare_exports(doc, text->str, "original");
+	const char *found;
+	size_t offset;
+	size_t i;
+
+	for (i = 0; i < CHANGE_COUNT; i++) {
+		found = strstr(text->str, changes[i].find);
+		if (found == NULL) {
+			fprintf(stderr, "%s: can't find '%s'\n", changes[i].what, changes[i].find);
+			failures++;
+			continue;
+		}
+		offset = found - text->str;
+
+		if (!mmd_doc_edit(doc, offset, changes[i].deleted, changes[i].inserted)) {
+			fprintf(stderr, "%s: edit refused\n", changes[i].what);
+			failures++;
+			continue;
+		}
+
+		g_string_erase(text, offset, changes[i].deleted);
+		g_string_insert(text, offset, (char *) changes[i].inserted);
+
+		failures += compare_exports(doc, text->str, changes[i].what);
+	}
+
+	mmd_doc_free(doc);
+	g_string_free(text, true);
+
+	return (failures == 0) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
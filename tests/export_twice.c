@@ -0,0 +1,81 @@
+/*
+
+	export_twice.c -- Parse each file once and export it to every format
+		twice from the same parse. Exporting mustn't change the parse, so
+		the second round has to match the first
+
+	(c) 2013-2015 Fletcher T. Penney (http://fletcherpenney.net/).
+
+	This program is free software; you can redistribute it and/or modify
+	it under the terms of the GNU General Public License or the MIT
+	license.  See LICENSE for details.
+
+*/
+
+#include "parser.h"
+
+static int formats[] = {
+	HTML_FORMAT, LATEX_FORMAT, MEMOIR_FORMAT, BEAMER_FORMAT, ODF_FORMAT,
+	RTF_FORMAT, LYX_FORMAT
+};
+
+#define FORMAT_COUNT  (sizeof(formats) / sizeof(formats[0]))
+
+static char * read_file(const char *path) {
+	FILE *file = fopen(path, "r");
+	size_t size = 4096;
+	size_t length = 0;
+	char *source;
+
+	if (file == NULL)
+		return NULL;
+
+	source = malloc(size);
+	while ((length += fread(source + length, 1, size - length - 1, file)) == size - 1) {
+		size *= 2;
+		source = realloc(source, size);
+	}
+	source[length] = '\0';
+
+	fclose(file);
+	return source;
+}
+
+int main(int argc, char **argv) {
+	char *first[FORMAT_COUNT];
+	char *again;
+	char *source;
+	mmd_doc *doc;
+	int failures = 0;
+	size_t f;
+	int i;
+
+	for (i = 1; i < argc; i++) {
+		source = read_file(argv[i]);
+		if (source == NULL) {
+			fprintf(stderr, "%s: can't read\n", argv[i]);
+			failures++;
+			continue;
+		}
+
+		doc = mmd_doc_new(source, EXT_SMART | EXT_NOTES);
+
+		for (f = 0; f < FORMAT_COUNT; f++)
+			first[f] = mmd_export(doc, formats[f]);
+
+		for (f = 0; f < FORMAT_COUNT; f++) {
+			again = mmd_export(doc, formats[f]);
+			if (strcmp(first[f], again) != 0) {
+				fprintf(stderr, "%s: second export to format %d differs\n", argv[i], formats[f]);
+				failures++;
+			}
+			free(again);
+			free(first[f]);
+		}
+
+		mmd_doc_free(doc);
+		free(source);
+	}
+
+	return (failures == 0) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,29 @@
+#!/bin/sh
+#
+# run_tests.sh -- check the program's output for each .text file in a
+#	test directory against the file beside it with the given extension
+#	(the same layout MarkdownTest uses, for tests that live here)
+#
+# usage: run_tests.sh program testdir ext [flags...]
+
+program=$1
+testdir=$2
+ext=$3
+shift 3
+
+passed=0
+failed=0
+
+for input in "$testdir"/*.text; do
+	expected="${input%.text}.$ext"
+	if "$program" "$@" "$input" | diff -u "$expected" - > /dev/null; then
+		passed=$((passed + 1))
+	else
+		echo "FAILED: $input ($*)"
+		"$program" "$@" "$input" | diff -u "$expected" -
+		failed=$((failed + 1))
+	fi
+done
+
+echo "$testdir: $passed passed, $failed failed"
+[ "$failed" -eq 0 ]
@@ -0,0 +1,85 @@
+/*
+
+	scaling.c -- Parse each pathological construct at 100KB and 400KB with
+		--memoize. Both have to fit a parse budget that is linear in the
+		input, and the larger must take well under 16 times as long (what
+		quadratic growth would need) -- 4 times is linear
+
+	(c) 2013-2015 Fletcher T. Penney (http://fletcherpenney.net/).
+
+	This program is free software; you can redistribute it and/or modify
+	it under the terms of the GNU General Public License or the MIT
+	license.  See LICENSE for details.
+
+*/
+
+#include <time.h>
+#include "parser.h"
+
+/* The constructs in pathologicalN.txt (see the Makefile), and others that
+	used to send the parser backtracking */
+static const char *constructs[] = {
+	"*a **b ", "_a __b ", "[a ", "[a](b ", "<div>\n",
+	"**a *b ", "*a _b **c __d ", "***a ", "*a [b ", "[a](", "[^a "
+};
+
+#define CONSTRUCT_COUNT  (sizeof(constructs) / sizeof(constructs[0]))
+
+#define SMALL            (100 * 1024)
+#define RATIO            4          /* The large input is this many times bigger */
+#define FUEL_PER_INPUT   20         /* Parse budget per byte */
+#define MAX_GROWTH       8.0        /* Allowed time ratio (linear is RATIO) */
+
+static char * repeat(const char *text, size_t size) {
+	size_t length = strlen(text);
+	size_t count = size / length;
+	char *result = malloc(count * length + 2);
+	size_t i;
+
+	for (i = 0; i < count; i++)
+		memcpy(result + i * length, text, length);
+	strcpy(result + count * length, "\n");
+
+	return result;
+}
+
+/* parse_time -- seconds of CPU to convert source, or -1 if it ran out */
+static double parse_time(const char *source) {
+	clock_t start = clock();
+	char *out = markdown_to_string_with_budget(source, EXT_MEMOIZE, HTML_FORMAT,
+		FUEL_PER_INPUT * strlen(source));
+
+	if (out == NULL)
+		return -1;
+
+	free(out);
+	return (double)(clock() - start) / CLOCKS_PER_SEC;
+}
+
+int main(int argc, char **argv) {
+	char *source;
+	double small, large;
+	int failures = 0;
+	size_t i;
+
+	for (i = 0; i < CONSTRUCT_COUNT; i++) {
+		source = repeat(constructs[i], SMALL);
+		small = parse_time(source);
+		free(source);
+
+		source = repeat(constructs[i], SMALL * RATIO);
+		large = parse_time(source);
+		free(source);
+
+		if ((small < 0) || (large < 0)) {
+			fprintf(stderr, "'%s': parse ran out of budget\n", constructs[i]);
+			failures++;
+		} else if (large > MAX_GROWTH * small + 0.05) {
+			fprintf(stderr, "'%s': %.2fs for %dKB, but %.2fs for %dKB\n", constructs[i],
+				small, SMALL / 1024, large, SMALL * RATIO / 1024);
+			failures++;
+		}
+	}
+
+	return (failures == 0) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -18,6 +18,74 @@
 #include "toc.h"
 
 
+/* heading_starts_line -- does heading n begin a line of source, markers
+	and all? DocForTOC read the document a line at a time, so it also saw
+	such a heading when it was a lazy line of a blockquote or definition */
+static bool heading_starts_line(node *n, const char *source) {
+	size_t i = n->start;
+
+	while ((i > 0) && ((source[i - 1] == '#') || (source[i - 1] == ' ') || (source[i - 1] == '\t')))
+		i--;
+
+	return (i == 0) || (source[i - 1] == '\n') || (source[i - 1] == '\r');
+}
+
+/* Gather the top level headings (including those in heading sections and
+	processed HTML blocks), each wrapped in a HEADINGSECTION as DocForTOC
+	would give them. The wrappers only borrow the headings. Inside a
+	blockquote or definition list (nested) only the headings that start a
+	line of source are taken -- their labels aren't link targets, so they
+	are listed unresolved, as before */
+static node * collect_toc_headings(node *list, node *sections, const char *source, bool nested) {
+	node *section;
+
+	while (list != NULL) {
+		if ((list->key >= H1) && (list->key <= H6)) {
+			if (!nested || heading_starts_line(list, source)) {
+				section = mk_node(HEADINGSECTION);
+				section->children = list;
+				sections = cons(section, sections);
+			}
+		} else if ((list->key == HEADINGSECTION) || (list->key == LIST)) {
+			sections = collect_toc_headings(list->children, sections, source, nested);
+		} else if ((source != NULL) && ((list->key == BLOCKQUOTE) || (list->key == BLOCKQUOTEMARKER) ||
+			(list->key == DEFLIST) || (list->key == DEFINITION))) {
+			sections = collect_toc_headings(list->children, sections, source, true);
+		}
+		list = list->next;
+	}
+
+	return sections;
+}
+
+/* build_toc -- build the contents that {{TOC}} prints (scratch->toc) from
+	the headings in the parse tree, rather than parsing the document again */
+void build_toc(node *list, scratch_pad *scratch) {
+	node *sections;
+	node *step;
+	node *contents;
+	GString *out;
+
+	if (!tree_contains_key(list, TOC))
+		return;
+
+	sections = reverse_list(collect_toc_headings(list, NULL, scratch->source, false));
+
+	out = g_string_new("");
+	scratch->toc_level = 0;
+	print_toc_node_tree(out, sections, scratch);
+
+	for (step = sections; step != NULL; step = step->next)
+		step->children = NULL;
+	free_node_tree(sections);
+
+	contents = markdown_chunk_to_node(out->str, scratch->extensions | EXT_NO_METADATA);
+	scratch->toc = mk_node(LIST);
+	scratch->toc->children = contents;
+
+	g_string_free(out, true);
+}
+
 /* print_toc_node_tree -- convert node tree to MultiMarkdown */
 void print_toc_node_tree(GString *out, node *list, scratch_pad *scratch) {
 #ifdef DEBUG_ON
@@ -116,6 +184,33 @@ void print_toc_node(GString *out, node *n, scratch_pad *scratch) {
 		case SPACE:
 			g_string_append_printf(out, "%s", n->str);
 			break;
+		case APOSTROPHE:
+			g_string_append_c(out, '\'');
+			break;
+		case ELLIPSIS:
+			g_string_append_printf(out, "...");
+			break;
+		case ENDASH:
+			g_string_append_printf(out, "--");
+			break;
+		case EMDASH:
+			g_string_append_printf(out, "---");
+			break;
+		case SINGLEQUOTED:
+			g_string_append_c(out, '\'');
+			print_toc_node_tree(out, n->children, scratch);
+			g_string_append_c(out, '\'');
+			break;
+		case DOUBLEQUOTED:
+			g_string_append_c(out, '"');
+			print_toc_node_tree(out, n->children, scratch);
+			g_string_append_c(out, '"');
+			break;
+		case NOTEREFERENCE:
+		case CITATION:
+		case NOCITATION:
+		case GLOSSARYTERM:
+			break;
 		case LINK:
 			print_toc_node_tree(out, n->children, scratch);
 			break;
@@ -4,6 +4,7 @@
 #include "parser.h"
 #include "writer.h"
 
+void build_toc(node *list, scratch_pad *scratch);
 void begin_toc_output(GString *out, node* list, scratch_pad *scratch);
 void print_toc_node_tree(GString *out, node *list, scratch_pad *scratch);
 void print_toc_node(GString *out, node *n, scratch_pad *scratch);
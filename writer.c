@@ -22,13 +22,26 @@
 
 #include "writer.h"
 
-/* export_node_tree -- given a tree, export as specified format */
+/* export_node_tree -- given a tree, export as specified format; the tree
+	isn't changed, so it can be exported again */
 char * export_node_tree(node *list, int format, unsigned long extensions) {
+	return export_node_tree_with_references(list, NULL, format, extensions, NULL, NULL);
+}
+
+/* export_node_tree_with_references -- as export_node_tree, but with the
+	links and notes already taken from list by collect_references(). They are
+	only borrowed, so they can be used for the next export too (NULL links
+	extracts them as usual). source is the text list's positions refer to,
+	which {{TOC}} needs to tell a heading that starts a line (or NULL) */
+char * export_node_tree_with_references(node *list, const char *source, int format,
+	unsigned long extensions, node *links, node *notes) {
 	char *output;
 	char *temp;
 	GString *out = g_string_new("");
 	scratch_pad *scratch = mk_scratch_pad(extensions);
 	scratch->result_tree = list;  /* Pointer to result tree to use later */
+	scratch->metadata = mk_metadata_dict(list);
+	scratch->source = source;
 
 #ifdef DEBUG_ON
 	fprintf(stderr, "export_node_tree\n");
@@ -42,18 +55,30 @@ char * export_node_tree(node *list, int format, unsigned long extensions) {
 		(format != CRITIC_ACCEPT_FORMAT) &&
 		(format != CRITIC_REJECT_FORMAT) &&
 		(format != CRITIC_HTML_HIGHLIGHT_FORMAT)) {
+			/* Fill in {{TOC}} from the headings we already have */
+			build_toc(list, scratch);
+
 			/* Find defined abbreviations */
 			extract_abbreviations(list, scratch);
-			/* Apply those abbreviations to source text */
-			find_abbreviations(list, scratch);
 
 			/* Parse for link, images, etc reference definitions */
-			extract_references(list, scratch);
+			if (links == NULL) {
+				extract_references(list, scratch);
+			} else {
+				free_node_tree(scratch->links);
+				free_node_tree(scratch->notes);
+				scratch->links = links;
+				scratch->notes = notes;
+			}
+
+			/* Apply those abbreviations to source text (and to our
+				copies of the notes and contents, printed in its place) */
+			find_abbreviations(list, scratch);
 		}
 	
 	/* Change our desired format based on metadata */
 	if (format == LATEX_FORMAT)
-		format = find_latex_mode(format, list);
+		format = find_latex_mode(format, scratch);
 	
 	switch (format) {
 		case TEXT_FORMAT:
@@ -61,11 +86,10 @@ char * export_node_tree(node *list, int format, unsigned long extensions) {
 			break;
 		case HTML_FORMAT:
 			if (scratch->extensions & EXT_COMPLETE) {
-				temp = metavalue_for_key("lang", scratch->result_tree);
+				temp = dict_metavalue_for_key("lang", scratch->metadata);
 				if (temp != NULL) {
 				    g_string_append_printf(out,
 					"<!DOCTYPE html>\n<html lang=\"%s\">\n<head>\n\t<meta charset=\"utf-8\"/>\n",temp);
-					free(temp);
 				} else {
 				    g_string_append_printf(out,
 					"<!DOCTYPE html>\n<html>\n<head>\n\t<meta charset=\"utf-8\"/>\n");
@@ -157,6 +181,12 @@ char * export_node_tree(node *list, int format, unsigned long extensions) {
 	
 	output = out->str;
 	g_string_free(out, false);
+
+	/* Give back what we borrowed */
+	if ((links != NULL) && (scratch->links == links)) {
+		scratch->links = NULL;
+		scratch->notes = NULL;
+	}
 	free_scratch_pad(scratch);
 
 #ifdef DEBUG_ON
@@ -165,6 +195,103 @@ char * export_node_tree(node *list, int format, unsigned long extensions) {
 	return output;
 }
 
+/*
+	Export leaves the parse tree as it found it, so what it learns about a
+	node along the way -- that a STR starts an abbreviation, that we've
+	copied an abbreviation's definition, or the number an inline note was
+	given -- goes in scratch->marks, hashed by the node's address.
+*/
+
+static size_t mark_slot(node_mark *marks, size_t size, node *n) {
+	size_t mask = size - 1;
+	size_t i = (((size_t) n >> 4) * 2654435761UL) & mask;
+
+	while ((marks[i].n != NULL) && (marks[i].n != n))
+		i = (i + 1) & mask;
+
+	return i;
+}
+
+static node_mark * find_mark(node *n, scratch_pad *scratch) {
+	size_t i;
+
+	if (scratch->mark_count == 0)
+		return NULL;
+
+	i = mark_slot(scratch->marks, scratch->mark_size, n);
+	return (scratch->marks[i].n == NULL) ? NULL : &scratch->marks[i];
+}
+
+/* mark_node -- what we know about n, added if need be; only good until
+	the next call */
+static node_mark * mark_node(node *n, scratch_pad *scratch) {
+	node_mark *old = scratch->marks;
+	size_t old_size = scratch->mark_size;
+	size_t i;
+
+	if ((scratch->mark_count + 1) * 2 > scratch->mark_size) {
+		scratch->mark_size = (old_size == 0) ? 64 : old_size * 2;
+		scratch->marks = calloc(scratch->mark_size, sizeof(node_mark));
+
+		for (i = 0; i < old_size; i++) {
+			if (old[i].n != NULL)
+				scratch->marks[mark_slot(scratch->marks, scratch->mark_size, old[i].n)] = old[i];
+		}
+		free(old);
+	}
+
+	i = mark_slot(scratch->marks, scratch->mark_size, n);
+	if (scratch->marks[i].n == NULL) {
+		scratch->marks[i].n = n;
+		scratch->mark_count++;
+	}
+
+	return &scratch->marks[i];
+}
+
+/* node_key -- the key to print n as: n->key, unless export marked it
+	otherwise (ABBR, ABBRSTART or ABBRSTOP for a STR in an abbreviation,
+	KEY_COUNTER for an abbreviation definition we copied) */
+int node_key(node *n, scratch_pad *scratch) {
+	node_mark *m = find_mark(n, scratch);
+
+	return ((m == NULL) || (m->key == 0)) ? n->key : m->key;
+}
+
+/* abbreviation_for_node -- the abbreviation an ABBR or ABBRSTART uses
+	(it belongs to scratch) */
+node * abbreviation_for_node(node *n, scratch_pad *scratch) {
+	node_mark *m = find_mark(n, scratch);
+
+	return (m == NULL) ? NULL : m->abbr;
+}
+
+/* abbreviation_end -- the ABBRSTOP that the abbreviation starting at n
+	ends on; n itself if it doesn't start one. Writers that print the
+	abbreviation in place of the text carry on after this */
+node * abbreviation_end(node *n, scratch_pad *scratch) {
+	node *step;
+
+	if (node_key(n, scratch) != ABBRSTART)
+		return n;
+
+	for (step = n->next; step != NULL; step = step->next) {
+		if (node_key(step, scratch) == ABBRSTOP)
+			return step;
+	}
+
+	return n;
+}
+
+/* metadata_key_for_node -- the key of METAKEY n as label_from_string
+	makes it (borrowed from scratch), or n->str if it isn't in the
+	document's metadata */
+char * metadata_key_for_node(node *n, scratch_pad *scratch) {
+	char *key = dict_key_for_node(n, scratch->metadata);
+
+	return (key == NULL) ? n->str : key;
+}
+
 /* extract_references -- go through node tree and find elements we need to reference;
    e.g. links, images, citations, footnotes 
    Copy them from main parse tree */
@@ -179,7 +306,7 @@ void extract_references(node *list, scratch_pad *scratch) {
 				l = list->link_data;
 				temp_str = lower_string(l->label);
 
-				temp = mk_link(list->children, temp_str, l->source, l->title, NULL);
+				temp = mk_link(copy_node_tree(list->children), temp_str, l->source, l->title, NULL);
 				temp->link_data->attr = copy_node_tree(l->attr);
 
 				/* store copy of link reference */
@@ -227,6 +354,46 @@ void extract_references(node *list, scratch_pad *scratch) {
 	}
 }
 
+/* collect_references -- what extract_references() would find in list, for
+	export_node_tree_with_references(); free both with free_node_tree() */
+void collect_references(node *list, unsigned long extensions, node **links, node **notes) {
+	scratch_pad *scratch = mk_scratch_pad(extensions);
+
+	extract_references(list, scratch);
+	*links = scratch->links;
+	*notes = scratch->notes;
+
+	scratch->links = NULL;
+	scratch->notes = NULL;
+	free_scratch_pad(scratch);
+}
+
+/* defines_references -- does list hold anything extract_references() would
+	take (definitions, notes, and the headings and tables that get labels)? */
+bool defines_references(node *list) {
+	while (list != NULL) {
+		switch (list->key) {
+			case LINKREFERENCE:
+			case NOTESOURCE:
+			case GLOSSARYSOURCE:
+			case H1: case H2: case H3: case H4: case H5: case H6:
+			case TABLE:
+				return true;
+			case HEADINGSECTION:
+			case RAW:
+			case LIST:
+				if (defines_references(list->children))
+					return true;
+				break;
+			default:
+				break;
+		}
+		list = list->next;
+	}
+
+	return false;
+}
+
 /* extract_abbreviations -- traverse node tree and find abbreviation definitions */
 void extract_abbreviations(node *list, scratch_pad *scratch) {
 	node *temp;
@@ -235,7 +402,7 @@ void extract_abbreviations(node *list, scratch_pad *scratch) {
 		switch (list->key) {
 			case ABBREVIATION:
 				temp = copy_node(list);
-				list->key = KEY_COUNTER;	/* Mark this as dead; we will use it elsewhere */
+				mark_node(list, scratch)->key = KEY_COUNTER;	/* Mark this as dead; we will use it elsewhere */
 				trim_trailing_whitespace(temp->str);
 				scratch->abbreviations = cons(temp, scratch->abbreviations);
 				break;
@@ -255,60 +422,229 @@ void extract_abbreviations(node *list, scratch_pad *scratch) {
 }
 
 
-/* find_abbreviations -- use abbreviations to look for matching strings */
-void find_abbreviations(node *list, scratch_pad *scratch) {
-	node *abbr = scratch->abbreviations;
-	node *temp, *target, *end = NULL;
-	bool ismatch;
+/*
+	Abbreviations are matched with a trie over their tokens, built once per
+	export, so each STR node costs about as many steps as the longest
+	abbreviation has tokens, however many abbreviations there are.
 
-	// Don't look if we didn't define any abbreviations */
-	if (abbr->key == KEY_COUNTER)
+	A word in an abbreviation matches a node with the same text, a space
+	matches any node, and anything else a node of the same type. Every
+	abbreviation that matches at a node marks the node it stops on; of
+	those, the one defined first (last in scratch->abbreviations) is used,
+	just as when we tried them one after another.
+*/
+
+typedef struct {
+	int    space;               /* State after a space, or -1 */
+	int    keyed;               /* First edge for other node types, or -1 */
+	node  *abbr;                /* Abbreviation that ends here, if any */
+	int    order;               /* ...and its place in the list */
+} abbr_state;
+
+typedef struct {
+	int    from;
+	int    to;
+	char  *str;                 /* Word edges, hashed in abbr_trie */
+	short  key;                 /* Other node types, chained from the state */
+	int    next;
+} abbr_edge;
+
+typedef struct {
+	abbr_state *states;
+	int         state_count;
+	abbr_edge  *edges;
+	int         edge_count;
+	int        *words;          /* Word edges by (from, str); -1 if empty */
+	size_t      word_size;
+	node      **stops;          /* Where the matches at this node end */
+	size_t      stop_count;
+	size_t      stop_space;
+	node       *best;           /* Abbreviation to use... */
+	int         best_order;
+	node       *best_end;       /* ...and where it ends */
+} abbr_trie;
+
+static int * abbr_word_slot(abbr_trie *t, int from, const char *str) {
+	size_t mask = t->word_size - 1;
+	size_t i = (string_hash(str) ^ ((unsigned long) from * 2654435761UL)) & mask;
+
+	while ((t->words[i] >= 0) && ((t->edges[t->words[i]].from != from)
+		|| (strcmp(t->edges[t->words[i]].str, str) != 0)))
+		i = (i + 1) & mask;
+
+	return &t->words[i];
+}
+
+static int abbr_new_state(abbr_trie *t) {
+	abbr_state *s = &t->states[t->state_count];
+
+	s->space = -1;
+	s->keyed = -1;
+	s->abbr = NULL;
+	s->order = -1;
+
+	return t->state_count++;
+}
+
+static int abbr_new_edge(abbr_trie *t, int from, char *str, short key) {
+	abbr_edge *e = &t->edges[t->edge_count];
+
+	e->from = from;
+	e->str = str;
+	e->key = key;
+	e->next = -1;
+	e->to = abbr_new_state(t);
+
+	return t->edge_count++;
+}
+
+/* State reached from state by token, adding it if need be */
+static int abbr_add_token(abbr_trie *t, int state, node *token) {
+	int *slot;
+	int e;
+
+	switch (token->key) {
+		case STR:
+			slot = abbr_word_slot(t, state, token->str);
+			if (*slot < 0)
+				*slot = abbr_new_edge(t, state, token->str, STR);
+			return t->edges[*slot].to;
+		case SPACE:
+		case KEY_COUNTER:
+			if (t->states[state].space < 0) {
+				e = abbr_new_state(t);
+				t->states[state].space = e;
+			}
+			return t->states[state].space;
+		default:
+			for (e = t->states[state].keyed; e >= 0; e = t->edges[e].next) {
+				if (t->edges[e].key == token->key)
+					return t->edges[e].to;
+			}
+			e = abbr_new_edge(t, state, NULL, token->key);
+			t->edges[e].next = t->states[state].keyed;
+			t->states[state].keyed = e;
+			return t->edges[e].to;
+	}
+}
+
+static void build_abbr_trie(abbr_trie *t, node *abbr) {
+	size_t tokens = 0;
+	node *step;
+	node *token;
+	int order;
+	int state;
+
+	for (step = abbr; step != NULL; step = step->next) {
+		if ((step->key != KEY_COUNTER) && (step->children != NULL)) {
+			for (token = step->children->children; token != NULL; token = token->next)
+				tokens++;
+		}
+	}
+
+	/* Each token adds at most one edge and one state */
+	t->states = malloc((tokens + 1) * sizeof(abbr_state));
+	t->edges = malloc((tokens + 1) * sizeof(abbr_edge));
+	t->state_count = 0;
+	t->edge_count = 0;
+	t->word_size = 16;
+	while (t->word_size < tokens * 2)
+		t->word_size *= 2;
+	t->words = malloc(t->word_size * sizeof(int));
+	memset(t->words, 0xff, t->word_size * sizeof(int));
+	t->stops = NULL;
+	t->stop_count = 0;
+	t->stop_space = 0;
+
+	abbr_new_state(t);
+
+	for (order = 0; abbr != NULL; abbr = abbr->next, order++) {
+		/* An abbreviation with no tokens has nothing to match */
+		if ((abbr->key == KEY_COUNTER) || (abbr->children == NULL) || (abbr->children->children == NULL))
+			continue;
+
+		state = 0;
+		for (step = abbr->children->children; step != NULL; step = step->next)
+			state = abbr_add_token(t, state, step);
+
+		/* Where two are the same, the later one in the list wins */
+		t->states[state].abbr = abbr;
+		t->states[state].order = order;
+	}
+}
+
+static void free_abbr_trie(abbr_trie *t) {
+	free(t->states);
+	free(t->edges);
+	free(t->words);
+	free(t->stops);
+}
+
+/* Note every abbreviation that the nodes from target on complete, having
+	got as far as state (end is the last node matched) */
+static void match_abbr_trie(abbr_trie *t, int state, node *target, node *end) {
+	abbr_state *s = &t->states[state];
+	int *slot;
+	int e;
+
+	if (s->abbr != NULL) {
+		if (t->stop_count == t->stop_space) {
+			t->stop_space = (t->stop_space == 0) ? 8 : t->stop_space * 2;
+			t->stops = realloc(t->stops, t->stop_space * sizeof(node *));
+		}
+		t->stops[t->stop_count++] = end;
+
+		if (s->order > t->best_order) {
+			t->best = s->abbr;
+			t->best_order = s->order;
+			t->best_end = end;
+		}
+	}
+
+	if (target == NULL)
 		return;
-	
+
+	if (target->str != NULL) {
+		slot = abbr_word_slot(t, state, target->str);
+		if (*slot >= 0)
+			match_abbr_trie(t, t->edges[*slot].to, target->next, target);
+	}
+
+	if (s->space >= 0)
+		match_abbr_trie(t, s->space, target->next, target);
+
+	for (e = s->keyed; e >= 0; e = t->edges[e].next) {
+		if (t->edges[e].key == target->key)
+			match_abbr_trie(t, t->edges[e].to, target->next, target);
+	}
+}
+
+static void tag_abbreviations(node *list, abbr_trie *t, scratch_pad *scratch) {
+	node_mark *m;
+	size_t i;
+
 	while (list != NULL) {
 		switch (list->key) {
 			case STR:
+				/* Not if it's already part of one */
+				if (node_key(list, scratch) != STR)
+					break;
+
 				/* Look for matching abbrevation */
-				/*fprintf(stderr, "Check '%s' for matching abbr\n", list->str); */
-				abbr = scratch->abbreviations;
-				while (abbr != NULL) {
-					if (abbr->key != KEY_COUNTER) {
-						ismatch = true;
-						temp = abbr->children->children;
-						target = list;
-
-						while((ismatch) && (temp != NULL) && (target != NULL)) {
-							switch (temp->key) {
-								case STR:
-									if (strcmp(temp->str, target->str) != 0) {
-										ismatch = false;
-									}
-								case SPACE:
-								case KEY_COUNTER:
-									break;
-								default:
-									if (temp->key != target->key)
-										ismatch = false;
-									break;
-							}
-							temp = temp->next;
-							end = target;
-							target = target->next;
-						}
-						if ((ismatch) && (temp == NULL)) {
-							temp = copy_node(abbr);
-							temp->next = NULL;
-							list->children = temp;
-							if (list != end) {
-								list->key = ABBRSTART;
-                                if (end != NULL)
-                                    end->key = ABBRSTOP;
-							} else {
-								list->key = ABBR;
-							}
-						}
+				t->stop_count = 0;
+				t->best = NULL;
+				t->best_order = -1;
+				match_abbr_trie(t, 0, list, NULL);
+
+				if (t->best != NULL) {
+					for (i = 0; i < t->stop_count; i++) {
+						if (t->stops[i] != list)
+							mark_node(t->stops[i], scratch)->key = ABBRSTOP;
 					}
-					abbr = abbr->next;
+
+					m = mark_node(list, scratch);
+					m->key = (t->best_end == list) ? ABBR : ABBRSTART;
+					m->abbr = t->best;
 				}
 				break;
 			case LIST:
@@ -332,7 +668,7 @@ void find_abbreviations(node *list, scratch_pad *scratch) {
 			case TABLEROW:
 			case TABLECELL:
 				/* Check children of these elements */
-				find_abbreviations(list->children, scratch);
+				tag_abbreviations(list->children, t, scratch);
 				break;
 			default:
 				/* Everything else we skip */
@@ -342,92 +678,155 @@ void find_abbreviations(node *list, scratch_pad *scratch) {
 	}
 }
 
+/* find_abbreviations -- use abbreviations to look for matching strings,
+	and mark them (see node_key) */
+void find_abbreviations(node *list, scratch_pad *scratch) {
+	abbr_trie trie;
 
-/* extract_link_data -- given a label, parse the link data and return */
-link_data * extract_link_data(char *label, scratch_pad *scratch) {
-	char *temp;
-	char *temp2;
-	link_data *d;
-	node *ref = scratch->links;
-	bool debug = 0;
+	// Don't look if we didn't define any abbreviations */
+	if (scratch->abbreviations->key == KEY_COUNTER)
+		return;
 
-	if (debug)
-		fprintf(stderr, "try to extract link for '%s'\n",label);
-	
-	if ((label == NULL) || (strlen(label) == 0))
-		return NULL;
-	
-	temp2 = clean_string(label);
-	temp = lower_string(temp2);
-	
-	/* look for label string as is */
-	while (ref != NULL) {
-		if (ref->key == KEY_COUNTER) {
-			ref = ref->next;
-			
-			continue;
-		}
-		if (strcmp(ref->link_data->label, temp) == 0) {
-			if (debug)
-				fprintf(stderr,"a:matched %s to %s\n",ref->link_data->label, label);
-			/* matched */
-			d = ref->link_data;
-			d = mk_link_data(d->label, d->source, d->title, d->attr);
+	build_abbr_trie(&trie, scratch->abbreviations);
+	tag_abbreviations(list, &trie, scratch);
+	tag_abbreviations(scratch->notes, &trie, scratch);
+	tag_abbreviations(scratch->toc, &trie, scratch);
+	free_abbr_trie(&trie);
+}
 
-			free(temp);
-			free(temp2);
-			
-			return d;
+
+/*
+	Link lookups go through a hash of scratch->links by label, built on the
+	first lookup (and again if links has grown since). Where two links have
+	the same label the one nearer the front of the list wins, as it did when
+	we searched the list.
+
+	A label is tried as a reference label -- whitespace collapsed and lower
+	cased, as in clean_string() and lower_string() -- and then, unless in
+	compatibility mode, in label_from_string() form. Both are made in a
+	buffer on the stack unless the label is unusually long.
+*/
+
+#define LINK_KEY_BUFFER  256
+
+/* Same as lower_string(clean_string(label)) */
+static void reference_key(const char *label, char *out) {
+	bool block_whitespace = true;
+	char *p = out;
+
+	for (; *label != '\0'; label++) {
+		if ((*label == '\t') || (*label == ' ') || (*label == '\n') || (*label == '\r')) {
+			if (!block_whitespace) {
+				*p++ = ' ';
+				block_whitespace = true;
+			}
 		} else {
-			if (debug)
-				fprintf(stderr,"a:did not match %s to %s\n",ref->link_data->label, label);
+			*p++ = *label;
+			block_whitespace = false;
 		}
-		ref = ref->next;
 	}
+	*p = '\0';
 
-	free(temp);
-	free(temp2);
-	
-	/* No match.  Check for label()version */
-	
-	if (scratch->extensions & EXT_COMPATIBILITY) {
-		/* not in compat mode */
-		return NULL;
+	for (p = out; *p != '\0'; p++) {
+		if ((p[1] & 0xC0) == 0x80) {
+			/* Leave multibyte characters alone */
+			while ((p[1] & 0xC0) == 0x80)
+				p++;
+		} else if ((*p >= 'A') && (*p <= 'Z')) {
+			*p = tolower(*p);
+		}
 	}
-	temp = label_from_string(label);
-	
-	ref = scratch->links;
-	
-	while (ref != NULL) {
-		if (ref->key == KEY_COUNTER) {
-			ref = ref->next;
-			
+}
+
+static void index_links(scratch_pad *scratch) {
+	size_t count = 0;
+	size_t mask;
+	size_t i;
+	node *ref;
+
+	for (ref = scratch->links; ref != NULL; ref = ref->next)
+		count++;
+
+	free(scratch->link_index);
+	scratch->link_index_size = 16;
+	while (scratch->link_index_size < count * 2)
+		scratch->link_index_size *= 2;
+
+	scratch->link_index = calloc(scratch->link_index_size, sizeof(node *));
+	scratch->link_index_of = scratch->links;
+	mask = scratch->link_index_size - 1;
+
+	for (ref = scratch->links; ref != NULL; ref = ref->next) {
+		if ((ref->key == KEY_COUNTER) || (ref->link_data == NULL) || (ref->link_data->label == NULL))
 			continue;
-		}
-		if (strcmp(ref->link_data->label, temp) == 0) {
-			if (debug)
-				fprintf(stderr,"b:matched %s to %s\n",ref->link_data->label, label);
-			/* matched */
-			d = ref->link_data;
-			d = mk_link_data(d->label, d->source, d->title, d->attr);
-			
-			free(temp);
 
-			return d;
-		} else {
-			if (debug)
-				fprintf(stderr,"b:did not match %s to %s\n",ref->link_data->label, label);
+		for (i = string_hash(ref->link_data->label) & mask; scratch->link_index[i] != NULL; i = (i + 1) & mask) {
+			if (strcmp(scratch->link_index[i]->link_data->label, ref->link_data->label) == 0)
+				break;
 		}
-		ref = ref->next;
+
+		/* Keep the first of any duplicates */
+		if (scratch->link_index[i] == NULL)
+			scratch->link_index[i] = ref;
+	}
+}
+
+static link_data * lookup_link(scratch_pad *scratch, const char *key) {
+	size_t mask = scratch->link_index_size - 1;
+	size_t i;
+
+	for (i = string_hash(key) & mask; scratch->link_index[i] != NULL; i = (i + 1) & mask) {
+		if (strcmp(scratch->link_index[i]->link_data->label, key) == 0)
+			return scratch->link_index[i]->link_data;
 	}
 
-	free(temp);
-	
-	if (debug)
-		fprintf(stderr, "finish extract\n");
 	return NULL;
 }
 
+/* find_link_data -- the link_data defined for label, or NULL; it still
+	belongs to scratch, so don't change or free it */
+link_data * find_link_data(char *label, scratch_pad *scratch) {
+	char buffer[LINK_KEY_BUFFER];
+	char *key = buffer;
+	size_t len;
+	link_data *d;
+
+	if ((label == NULL) || (label[0] == '\0'))
+		return NULL;
+
+	if ((scratch->link_index == NULL) || (scratch->link_index_of != scratch->links))
+		index_links(scratch);
+
+	len = strlen(label);
+	if (len >= LINK_KEY_BUFFER)
+		key = malloc(len + 1);
+
+	reference_key(label, key);
+	d = lookup_link(scratch, key);
+
+	/* No match.  Check for label() version (not in compat mode) */
+	if ((d == NULL) && !(scratch->extensions & EXT_COMPATIBILITY)) {
+		copy_label(key, label);
+		d = lookup_link(scratch, key);
+	}
+
+	if (key != buffer)
+		free(key);
+
+	return d;
+}
+
+/* extract_link_data -- given a label, parse the link data and return
+	a copy of it */
+link_data * extract_link_data(char *label, scratch_pad *scratch) {
+	link_data *d = find_link_data(label, scratch);
+
+	if (d == NULL)
+		return NULL;
+
+	return mk_link_data(d->label, d->source, d->title, d->attr);
+}
+
 /* pad -- ensure that at least 'x' newlines are at end of output */
 void pad(GString *out, int num, scratch_pad *scratch) {
 	while (num-- > scratch->padded)
@@ -436,9 +835,80 @@ void pad(GString *out, int num, scratch_pad *scratch) {
 	scratch->padded = num;
 }
 
+/*
+	Notes (footnotes, citations and glossary entries) are numbered in the
+	order they are first used. The definitions in scratch->notes are hashed
+	by label on the first lookup, and each note joins scratch->used_notes as
+	it is used, so a note's number, the note for a number and its citation
+	number are all found without walking a list.
+
+	Notes stay in scratch->notes once used, so that is still what frees
+	them; inline notes are used where they sit in the tree and belong to
+	it. Where two notes share a label the one nearer the front of the list
+	wins, as it did when we searched.
+*/
+
+static void index_notes(scratch_pad *scratch) {
+	size_t count = 0;
+	size_t mask;
+	size_t i;
+	node *n;
+
+	for (n = scratch->notes; n != NULL; n = n->next)
+		count++;
+
+	scratch->note_index_size = 16;
+	while (scratch->note_index_size < count * 2)
+		scratch->note_index_size *= 2;
+
+	scratch->note_index = calloc(scratch->note_index_size, sizeof(note_slot));
+	mask = scratch->note_index_size - 1;
+
+	for (n = scratch->notes; n != NULL; n = n->next) {
+		/* Inline notes have no label, and can't be looked up */
+		if ((n->key == KEY_COUNTER) || (n->str == NULL) || (n->str[0] == '\0'))
+			continue;
+
+		for (i = string_hash(n->str) & mask; scratch->note_index[i].note != NULL; i = (i + 1) & mask) {
+			if (strcmp(scratch->note_index[i].note->str, n->str) == 0)
+				break;
+		}
+
+		/* Keep the first of any duplicates */
+		if (scratch->note_index[i].note == NULL)
+			scratch->note_index[i].note = n;
+	}
+}
+
+static note_slot * lookup_note(scratch_pad *scratch, const char *label) {
+	size_t mask = scratch->note_index_size - 1;
+	size_t i;
+
+	for (i = string_hash(label) & mask; scratch->note_index[i].note != NULL; i = (i + 1) & mask) {
+		if (strcmp(scratch->note_index[i].note->str, label) == 0)
+			return &scratch->note_index[i];
+	}
+
+	return NULL;
+}
+
+/* Give note the next number */
+static int use_note(node *note, scratch_pad *scratch) {
+	if (scratch->used_note_count == scratch->used_note_space) {
+		scratch->used_note_space = (scratch->used_note_space == 0) ? 16 : scratch->used_note_space * 2;
+		scratch->used_notes = realloc(scratch->used_notes, scratch->used_note_space * sizeof(note_slot));
+	}
+
+	scratch->used_notes[scratch->used_note_count].note = note;
+	scratch->used_notes[scratch->used_note_count].number = scratch->used_note_count + 1;
+	scratch->used_notes[scratch->used_note_count].cite = 0;
+
+	return ++scratch->used_note_count;
+}
+
 /* note_number_for_label -- given a label to match, determine number to be used*/
 int note_number_for_label(char *text, scratch_pad *scratch) {
-	node *n = NULL;
+	note_slot *slot;
 	char *clean;
 	char *label;
 #ifdef DEBUG_ON
@@ -447,182 +917,85 @@ int note_number_for_label(char *text, scratch_pad *scratch) {
 
 	if ((text == NULL) || (strlen(text) == 0))
 		return 0;	/* Nothing to find */
-	
+
+	if (scratch->note_index == NULL)
+		index_notes(scratch);
+
 	clean = clean_string(text);
-	label = label_from_string(clean);
-	
-	/* have we used this note already? */
-	
-	/* look for label string as is */
-	n = node_matching_label(clean, scratch->used_notes);
-	
-	/* if not, look in reserve queue */
-	if (n == NULL) {
-		n = node_matching_label(clean, scratch->notes);
-		
-		if (n != NULL) {
-			/* move to used queue */
-			move_note_to_used(n, scratch);
-#ifdef DEBUG_ON
-	fprintf(stderr, "note has not already been used for: %s\n",text);
-#endif
-		}
-	} else {
-#ifdef DEBUG_ON
-	fprintf(stderr, "note has already been used for: %s\n",text);
-#endif
-	}
-	
-	/* Check label version */
-	if (n == NULL)
-		n = node_matching_label(label, scratch->used_notes);
-	
-	if (n == NULL) {
-		n = node_matching_label(label, scratch->notes);
-		
-		if (n != NULL) {
-			/* move to used queue */
-			move_note_to_used(n, scratch);
-#ifdef DEBUG_ON
-	fprintf(stderr, "note has not already been used for: %s\n",label);
-#endif
-		}
-	} else {
-#ifdef DEBUG_ON
-	fprintf(stderr, "note has already been used for: %s\n",label);
-#endif
+	slot = lookup_note(scratch, clean);
 
+	/* Check label version */
+	if (slot == NULL) {
+		label = label_from_string(clean);
+		slot = lookup_note(scratch, label);
+		free(label);
 	}
-	
-	/* CAN recursively drill down to start counter at 0 and ++ */
-	/* if found, move to used queue and return the number  */
-	
-	free(label);
+
 	free(clean);
-	if (n != NULL) {
+
+	if (slot == NULL)
+		return 0;
+
+	if (slot->number == 0)
+		slot->number = use_note(slot->note, scratch);
+
 #ifdef DEBUG_ON
-	fprintf(stderr, "note number is: %d\n",count_node_from_end(n));
+	fprintf(stderr, "note number is: %d\n",slot->number);
 #endif
-		return count_node_from_end(n);
-	}
-	else 
-		return 0;
+	return slot->number;
 }
 
 /* note_number_for_node -- given a note reference to match, determine number to be used*/
 int note_number_for_node(node *ref, scratch_pad *scratch) {
-	char *label = ref->str;
-	node *n = NULL;
-	int num = 0;
-	
-	num = note_number_for_label(label, scratch);
+	int num = note_number_for_label(ref->str, scratch);
 	
 	if (num > 0)
 		return num;
 	
 	/* None found, so treat as inline note */
-	n = ref->children;
-	use_inline_footnote(ref, scratch);
-	
-	return count_node_from_end(n);
+	return use_inline_footnote(ref, scratch);
 }
 
+/* note_for_number -- the note that was given number, or NULL */
+node * note_for_number(int number, scratch_pad *scratch) {
+	if ((number < 1) || (number > scratch->used_note_count))
+		return NULL;
 
-/* node_matching_label -- given a string, return the node matching the string */
-node * node_matching_label(char *label, node *n) {
-	while (n != NULL) {
-		if (n->key == KEY_COUNTER) {
-			n = n->next;
-			continue;
-		}
-		if (strcmp(n->str, label) == 0) {
-			return n;
-		}
-		n = n->next;
-	}
-	
-	return NULL;
+	return scratch->used_notes[number - 1].note;
 }
 
-/* since lists are stored in reverse order, need to count from end */
-int count_node_from_end(node *n) {
-	if (n->next == NULL) {
-		if (n->key == KEY_COUNTER)
-			return 0;
-#ifdef DEBUG_ON
-	fprintf(stderr, "note %d: '%s'\n",1,n->str);
-#endif
-		return 1;	/* reserve 0 for not found */
-	}
-#ifdef DEBUG_ON
-	fprintf(stderr, "note %d: '%s'\n",count_node_from_end(n->next) +1,n->str);
-#endif
-	return (count_node_from_end(n->next) + 1);
-}
+/* cite_number_for_note -- number the note given number has among
+	citations; the first time we ask, it gets the next one */
+int cite_number_for_note(int number, scratch_pad *scratch) {
+	note_slot *used;
 
-/* since lists are stored in reverse order, need to count from end 
-	Only count cites (not footnotes) */
-int cite_count_node_from_end(node *n) {
-	if (n->next == NULL) {
-		/* we're the last node */
-		if (n->key == CITATIONSOURCE)
-			return 1;
-		return 0;	/* reserve 0 for not found */
-	}
-	if (n->key == CITATIONSOURCE) {
-		return (cite_count_node_from_end(n->next) + 1);
-	} else {
-		return (cite_count_node_from_end(n->next));
-	}
-}
+	if ((number < 1) || (number > scratch->used_note_count))
+		return 0;
 
-/* node_for_count -- given a number, get that node */
-node * node_for_count(node *n, int count) {
-	if (n == NULL)
-		return NULL;
-	
-	int total = count_node_from_end(n);
-	
-	if (count > total)
-		return NULL;
-	
-	if (count == total)
-		return n;
-	
-	while (total > count) {
-		n = n->next;
-		if (n == NULL)
-			return NULL;
-		total--;
-	}
-	
-	return n;
-}
+	used = &scratch->used_notes[number - 1];
+	if (used->cite == 0)
+		used->cite = ++scratch->used_cite_count;
 
-/* move_note_to_used -- snip note from ->notes and move to used_notes */
-void move_note_to_used(node *list, scratch_pad *scratch) {
-	node * n = scratch->notes;
-	node * last = NULL;
-	
-	while (n != NULL) {
-		if (n == list) {
-			if (last != NULL) {
-				last->next = n->next;
-			} else {
-				scratch->notes = n->next;
-			}
-			scratch->used_notes = cons(n, scratch->used_notes);
-			return;
-		}
-		last = n;
-		n = n->next;
-	}
+	return used->cite;
 }
 
-/* use_inline_footnote -- create a new note definition from inline footnote */
-void use_inline_footnote(node *ref, scratch_pad *scratch) {
-	scratch->used_notes = cons(ref->children, scratch->used_notes);
-	ref->children = NULL;
+/* use_inline_footnote -- number the note given inline in ref (the same
+	number each time ref is printed), and return it */
+int use_inline_footnote(node *ref, scratch_pad *scratch) {
+	node_mark *m;
+	int number;
+
+	if (ref->children == NULL)
+		return 0;
+
+	m = find_mark(ref, scratch);
+	if ((m != NULL) && (m->note != 0))
+		return m->note;
+
+	number = use_note(ref->children, scratch);
+	mark_node(ref, scratch)->note = number;
+
+	return number;
 }
 
 /* find attribute, if present */
@@ -14,23 +14,29 @@
 #include "toc.h"
 
 char * export_node_tree(node *list, int format, unsigned long extensions);
+char * export_node_tree_with_references(node *list, const char *source, int format,
+	unsigned long extensions, node *links, node *notes);
 
 void extract_references(node *list, scratch_pad *scratch);
+void collect_references(node *list, unsigned long extensions, node **links, node **notes);
+bool defines_references(node *list);
 void extract_abbreviations(node *list, scratch_pad *scratch);
 void find_abbreviations(node *list, scratch_pad *scratch);
+node * abbreviation_for_node(node *n, scratch_pad *scratch);
+node * abbreviation_end(node *n, scratch_pad *scratch);
+int node_key(node *n, scratch_pad *scratch);
+char * metadata_key_for_node(node *n, scratch_pad *scratch);
 
 link_data * extract_link_data(char *label, scratch_pad *scratch);
+link_data * find_link_data(char *label, scratch_pad *scratch);
 
 void pad(GString *out, int num, scratch_pad *scratch);
 
 int note_number_for_label(char *text, scratch_pad *scratch);
 int note_number_for_node(node *ref, scratch_pad *scratch);
-node * node_matching_label(char *label, node *n);
-int count_node_from_end(node *n);
-int cite_count_node_from_end(node *n);
-node * node_for_count(node *n, int count);
-void move_note_to_used(node *list, scratch_pad *scratch);
-void use_inline_footnote(node *ref, scratch_pad *scratch);
+node * note_for_number(int number, scratch_pad *scratch);
+int cite_number_for_note(int number, scratch_pad *scratch);
+int use_inline_footnote(node *ref, scratch_pad *scratch);
 node * node_for_attribute(char *querystring, node *list);
 
 char * dimension_for_attribute(char *querystring, node *list);